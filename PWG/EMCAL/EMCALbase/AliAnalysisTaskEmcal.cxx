@@ -35,6 +35,7 @@
 #include "AliAnalysisManager.h"
 #include "AliCentrality.h"
 #include "AliEmcalDownscaleFactorsOCDB.h"
+#include "AliEmcalEventContext.h"
 #include "AliEMCALGeometry.h"
 #include "AliEmcalPythiaInfo.h"
 #include "AliEMCALTriggerPatchInfo.h"
@@ -120,6 +121,7 @@ AliAnalysisTaskEmcal::AliAnalysisTaskEmcal() :
   fPtHardAndJetPtFactor(0.),
   fPtHardAndClusterPtFactor(0.),
   fPtHardAndTrackPtFactor(0.),
+  fUseEventContext(kFALSE),
   fRunNumber(-1),
   fAliAnalysisUtils(nullptr),
   fIsEsd(kFALSE),
@@ -148,6 +150,7 @@ AliAnalysisTaskEmcal::AliAnalysisTaskEmcal() :
   fNTrials(0),
   fXsection(0),
   fPythiaInfo(nullptr),
+  fEventContext(nullptr),
   fOutput(nullptr),
   fHistEventCount(nullptr),
   fHistTrialsAfterSel(nullptr),
@@ -234,6 +237,7 @@ AliAnalysisTaskEmcal::AliAnalysisTaskEmcal(const char *name, Bool_t histo) :
   fPtHardAndJetPtFactor(0.),
   fPtHardAndClusterPtFactor(0.),
   fPtHardAndTrackPtFactor(0.),
+  fUseEventContext(kFALSE),
   fRunNumber(-1),
   fAliAnalysisUtils(nullptr),
   fIsEsd(kFALSE),
@@ -262,6 +266,7 @@ AliAnalysisTaskEmcal::AliAnalysisTaskEmcal(const char *name, Bool_t histo) :
   fNTrials(0),
   fXsection(0),
   fPythiaInfo(0),
+  fEventContext(nullptr),
   fOutput(nullptr),
   fHistEventCount(nullptr),
   fHistTrialsAfterSel(nullptr),
@@ -554,7 +559,12 @@ Bool_t AliAnalysisTaskEmcal::FillGeneralHistograms()
     fHistEventPlane->Fill(fEPV0);
   }
 
-  std::unique_ptr<TObjArray> triggerClasses(InputEvent()->GetFiredTriggerClasses().Tokenize(" "));
+  std::unique_ptr<TObjArray> ownedTriggerClasses;
+  const TObjArray *triggerClasses = fEventContext ? fEventContext->GetFiredTriggerClasses() : nullptr;
+  if (!triggerClasses) {
+    ownedTriggerClasses.reset(InputEvent()->GetFiredTriggerClasses().Tokenize(" "));
+    triggerClasses = ownedTriggerClasses.get();
+  }
   TObjString* triggerClass(nullptr);
   for(auto trg : *triggerClasses){
     triggerClass = static_cast<TObjString*>(trg);
@@ -1395,22 +1405,35 @@ Bool_t AliAnalysisTaskEmcal::RetrieveEventObjects()
     GeneratePythiaInfoObject(MCEvent());
   }
 
-  const AliVVertex *vert = InputEvent()->GetPrimaryVertex();
-  if (vert) {
-    vert->GetXYZ(fVertex);
-    fNVertCont = vert->GetNContributors();
+  fEventContext = fUseEventContext ? AliEmcalEventContext::GetContext(InputEvent()) : nullptr;
+
+  if (fEventContext) {
+    fEventContext->GetVertex(fVertex, fNVertCont);
+    fEventContext->GetVertexSPD(fVertexSPD, fNVertSPDCont);
   }
+  else {
+    const AliVVertex *vert = InputEvent()->GetPrimaryVertex();
+    if (vert) {
+      vert->GetXYZ(fVertex);
+      fNVertCont = vert->GetNContributors();
+    }
 
-  const AliVVertex *vertSPD = InputEvent()->GetPrimaryVertexSPD();
-  if (vertSPD) {
-    vertSPD->GetXYZ(fVertexSPD);
-    fNVertSPDCont = vertSPD->GetNContributors();
+    const AliVVertex *vertSPD = InputEvent()->GetPrimaryVertexSPD();
+    if (vertSPD) {
+      vertSPD->GetXYZ(fVertexSPD);
+      fNVertSPDCont = vertSPD->GetNContributors();
+    }
   }
 
   fBeamType = GetBeamType();
   TObject * header = InputEvent()->GetHeader();
   if (fBeamType == kAA || fBeamType == kpA ) {
-    if (fUseNewCentralityEstimation) {
+    if (fEventContext) {
+      if (!fEventContext->GetCentrality(fCentEst.Data(), fUseNewCentralityEstimation, fCent)) {
+        AliWarning(Form("%s: Could not retrieve centrality information! Assuming 99", GetName()));
+      }
+    }
+    else if (fUseNewCentralityEstimation) {
     if (header->InheritsFrom("AliNanoAODStorage")){
        AliNanoAODHeader *nanoHead = (AliNanoAODHeader*)header;
        fCent=nanoHead->GetCentr(fCentEst.Data());
@@ -1476,7 +1499,12 @@ Bool_t AliAnalysisTaskEmcal::RetrieveEventObjects()
         fCentBin = fNcentBins-1;
       }
     }
-    if (header->InheritsFrom("AliNanoAODStorage")){
+    if (fEventContext) {
+      if (!fEventContext->GetEventPlane(fEPV0, fEPV0A, fEPV0C)) {
+        AliWarning(Form("%s: Could not retrieve event plane information!", GetName()));
+      }
+    }
+    else if (header->InheritsFrom("AliNanoAODStorage")){
         AliNanoAODHeader *nanoHead = (AliNanoAODHeader*)header;
         fEPV0=nanoHead->GetVar(nanoHead->GetVarIndex("cstEvPlaneV0"));
         fEPV0A=nanoHead->GetVar(nanoHead->GetVarIndex("cstEvPlaneV0A"));
@@ -1575,18 +1603,23 @@ Bool_t AliAnalysisTaskEmcal::RetrieveEventObjects()
   }
 
 
-  fTriggers = GetTriggerList();
+  if (!fEventContext || !fEventContext->GetTriggerBits(fTriggerPatchInfo, fTriggers)) {
+    fTriggers = GetTriggerList();
+    if (fEventContext) fEventContext->SetTriggerBits(fTriggerPatchInfo, fTriggers);
+  }
 
   AliEmcalContainer* cont = 0;
 
   TIter nextPartColl(&fParticleCollArray);
   while ((cont = static_cast<AliEmcalContainer*>(nextPartColl()))){
     cont->NextEvent(InputEvent());
+    cont->SetEventContext(fEventContext);
   }
 
   TIter nextClusColl(&fClusterCollArray);
   while ((cont = static_cast<AliParticleContainer*>(nextClusColl()))){
     cont->NextEvent(InputEvent());
+    cont->SetEventContext(fEventContext);
   }
 
   return kTRUE;
@@ -20,6 +20,7 @@ class AliAnalysisUtils;
 class AliEMCALTriggerPatchInfo;
 class AliAODTrack;
 class AliEmcalPythiaInfo;
+class AliEmcalEventContext;
 class AliAODInputHandler;
 class AliESDInputHandler;
 
@@ -329,6 +330,7 @@ class AliAnalysisTaskEmcal : public AliAnalysisTaskSE {
   void                        SetEMCalTriggerMode(EMCalTriggerMode_t m)             { fEMCalTriggerMode  = m                              ; }
   void                        SetUseNewCentralityEstimation(Bool_t b)               { fUseNewCentralityEstimation = b                     ; }
   void                        SetGeneratePythiaInfoObject(Bool_t b)                 { fGeneratePythiaInfoObject = b                       ; }
+  void                        SetUseEventContext(Bool_t b)                          { fUseEventContext   = b                              ; }
   void                        SetPythiaInfoName(const char *n)                      { fPythiaInfoName    = n                              ; }
   const TString&              GetPythiaInfoName()                             const { return fPythiaInfoName                              ; }
   const AliEmcalPythiaInfo   *GetPythiaInfo()                                 const { return fPythiaInfo                                  ; }
@@ -887,6 +889,7 @@ class AliAnalysisTaskEmcal : public AliAnalysisTaskSE {
   Float_t                     fPtHardAndJetPtFactor;       ///< Factor between ptHard and jet pT to reject/accept event.
   Float_t                     fPtHardAndClusterPtFactor;   ///< Factor between ptHard and cluster pT to reject/accept event.
   Float_t                     fPtHardAndTrackPtFactor;     ///< Factor between ptHard and track pT to reject/accept event.
+  Bool_t                      fUseEventContext;            ///< Share vertices, centrality, trigger bits and accepted objects with other tasks via AliEmcalEventContext
 
   // Service fields
   Int_t                       fRunNumber;                  //!<!run number (triggering RunChanged()
@@ -919,6 +922,7 @@ class AliAnalysisTaskEmcal : public AliAnalysisTaskSE {
   Int_t                       fNTrials;                    //!<!event trials
   Float_t                     fXsection;                   //!<!x-section from pythia header
   AliEmcalPythiaInfo         *fPythiaInfo;                 //!<!event parton info
+  AliEmcalEventContext       *fEventContext;               //!<!event context shared between tasks (if fUseEventContext)
 
   // Output
   AliEmcalList               *fOutput;                     //!<!output list
@@ -945,7 +949,7 @@ class AliAnalysisTaskEmcal : public AliAnalysisTaskSE {
   AliAnalysisTaskEmcal &operator=(const AliAnalysisTaskEmcal&); // not implemented
 
   /// \cond CLASSIMP
-  ClassDef(AliAnalysisTaskEmcal, 18) // EMCAL base analysis task
+  ClassDef(AliAnalysisTaskEmcal, 19) // EMCAL base analysis task
   /// \endcond
 };
 
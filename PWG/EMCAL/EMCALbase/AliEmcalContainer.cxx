@@ -20,6 +20,7 @@
 #include "AliTLorentzVector.h"
 
 #include "AliEmcalContainerUtils.h"
+#include "AliEmcalEventContext.h"
 
 #include "AliEmcalContainer.h"
 
@@ -55,6 +56,19 @@ AliEmcalContainer::AliEmcalContainer():
   fCurrentID(0),
   fLabelMap(0),
   fLoadedClass(0),
+  fEventContext(0),
+  fUseEventCache(kFALSE),
+  fAcceptCacheValid(kFALSE),
+  fMomentumCacheValid(kFALSE),
+  fAcceptCache(),
+  fCacheMomOK(),
+  fCachePx(),
+  fCachePy(),
+  fCachePz(),
+  fCacheE(),
+  fCachePt(),
+  fCacheEta(),
+  fCachePhi(),
   fClassName()
 {
   fVertex[0] = 0;
@@ -92,6 +106,19 @@ AliEmcalContainer::AliEmcalContainer(const char *name):
   fCurrentID(0),
   fLabelMap(0),
   fLoadedClass(0),
+  fEventContext(0),
+  fUseEventCache(kFALSE),
+  fAcceptCacheValid(kFALSE),
+  fMomentumCacheValid(kFALSE),
+  fAcceptCache(),
+  fCacheMomOK(),
+  fCachePx(),
+  fCachePy(),
+  fCachePz(),
+  fCacheE(),
+  fCachePt(),
+  fCacheEta(),
+  fCachePhi(),
   fClassName()
 {
   fVertex[0] = 0;
@@ -142,6 +169,8 @@ void AliEmcalContainer::GetVertexFromEvent(const AliVEvent * event)
  */
 void AliEmcalContainer::SetArray(const AliVEvent *event)
 {
+  ResetEventCache();
+
   // Handling of default containers
   if(fClArrayName == "usedefault"){
     fClArrayName = GetDefaultArrayName(event);
@@ -187,16 +216,103 @@ void AliEmcalContainer::NextEvent(const AliVEvent * event)
   // Get the right event (either the current event of the embedded event)
   event = AliEmcalContainerUtils::GetEvent(event, fIsEmbedding);
 
+  ResetEventCache();
+
   if (!event) return;
 
   GetVertexFromEvent(event);
 }
 
+/**
+ * Invalidate the accepted indices and momenta cached for the current event.
+ * The memory is kept for the next event.
+ */
+void AliEmcalContainer::ResetEventCache()
+{
+  fAcceptCacheValid = kFALSE;
+  fMomentumCacheValid = kFALSE;
+}
+
+/**
+ * Get the indices of the accepted objects in the current event, in increasing
+ * order. Evaluated at the first call in the event (or taken from the event
+ * context, if set), and cached until the next event.
+ * @return Indices of the accepted objects
+ */
+const std::vector<Int_t> &AliEmcalContainer::GetAcceptedIndices() const
+{
+  if (!fAcceptCacheValid) {
+    if (fEventContext) {
+      fAcceptCache = fEventContext->GetAcceptedIndices(this);
+    }
+    else {
+      fAcceptCache.clear();
+      for(int index = 0; index < GetNEntries(); index++){
+        UInt_t rejectionReason = 0;
+        if(AcceptObject(index, rejectionReason)) fAcceptCache.push_back(index);
+      }
+    }
+    fAcceptCacheValid = kTRUE;
+  }
+  return fAcceptCache;
+}
+
+/**
+ * Evaluate the momenta of all objects in the current event, if not yet done,
+ * and store them in the per-object arrays.
+ */
+void AliEmcalContainer::FillMomentumCache() const
+{
+  if (fMomentumCacheValid) return;
+
+  const Int_t n = GetNEntries();
+  fCacheMomOK.resize(n);
+  fCachePx.resize(n);
+  fCachePy.resize(n);
+  fCachePz.resize(n);
+  fCacheE.resize(n);
+  fCachePt.resize(n);
+  fCacheEta.resize(n);
+  fCachePhi.resize(n);
+
+  AliTLorentzVector mom;
+  for (Int_t i = 0; i < n; i++) {
+    mom.SetPxPyPzE(0, 0, 0, 0);
+    fCacheMomOK[i] = GetMomentum(mom, i);
+    fCachePx[i] = mom.Px();
+    fCachePy[i] = mom.Py();
+    fCachePz[i] = mom.Pz();
+    fCacheE[i] = mom.E();
+    fCachePt[i] = mom.Pt();
+    // TLorentzVector::Eta warns for vanishing transverse momentum
+    fCacheEta[i] = fCachePt[i] > 0 ? mom.Eta() : 0;
+    fCachePhi[i] = mom.Phi();
+  }
+  fMomentumCacheValid = kTRUE;
+}
+
+/**
+ * Get the momentum of an object from the per-event cache. Gives the same
+ * result as GetMomentum, which is used directly for indices out of range.
+ * @param[out] mom Momentum of the object
+ * @param[in] i Index of the object
+ * @return Return value of GetMomentum for this object
+ */
+Bool_t AliEmcalContainer::GetCachedMomentum(TLorentzVector &mom, Int_t i) const
+{
+  FillMomentumCache();
+  if (i < 0 || i >= static_cast<Int_t>(fCachePx.size())) return GetMomentum(mom, i);
+  mom.SetPxPyPzE(fCachePx[i], fCachePy[i], fCachePz[i], fCacheE[i]);
+  return fCacheMomOK[i];
+}
+
 /**
  * Count accepted entries in the container
  * @return Number of accepted events in the container
  */
 Int_t AliEmcalContainer::GetNAcceptEntries() const{
+  if (fUseEventCache) return GetAcceptedIndices().size();
+  if (fEventContext) return fEventContext->GetAcceptedIndices(this).size();
   Int_t result = 0;
   for(int index = 0; index < GetNEntries(); index++){
     UInt_t rejectionReason = 0;
@@ -10,6 +10,9 @@ class AliTLorentzVector;
 class AliVEvent;
 class AliNamedArrayI;
 class AliVParticle;
+class AliEmcalEventContext;
+
+#include <vector>
 
 #include <TNamed.h>
 #include <TClonesArray.h>
@@ -70,6 +73,12 @@ typedef EMCALIterableContainer::AliEmcalIterableContainerT<TObject, EMCALIterabl
  * }
  * ~~~
  *
+ * With SetUseEventCache(kTRUE) the list of accepted indices and the momenta of all
+ * objects are evaluated only once per event (the cache is invalidated in NextEvent),
+ * and the iterators read from this cache instead of evaluating the cuts and building
+ * the momentum for every loop. The cache must not be used if the objects are modified
+ * between two loops within the same event.
+ *
  * The usage of EMCAL containers is described under \subpage EMCALcontainers
  */
 class AliEmcalContainer : public TObject {
@@ -176,6 +185,16 @@ class AliEmcalContainer : public TObject {
   void                        SetClassName(const char *clname);
   void                        SetIsEmbedding(Bool_t b)                  { fIsEmbedding = b ; }
   Bool_t                      GetIsEmbedding() const                    { return fIsEmbedding; }
+  void                        SetEventContext(AliEmcalEventContext *ctx) { fEventContext = ctx ; }
+  AliEmcalEventContext       *GetEventContext() const                   { return fEventContext; }
+  void                        SetUseEventCache(Bool_t b)                { fUseEventCache = b; ResetEventCache(); }
+  Bool_t                      GetUseEventCache() const                  { return fUseEventCache; }
+  void                        ResetEventCache();
+  const std::vector<Int_t>   &GetAcceptedIndices() const;
+  Bool_t                      GetCachedMomentum(TLorentzVector &mom, Int_t i) const;
+  Double_t                    GetCachedPt(Int_t i)            const { FillMomentumCache(); return fCachePt[i]  ; }
+  Double_t                    GetCachedEta(Int_t i)           const { FillMomentumCache(); return fCacheEta[i] ; }
+  Double_t                    GetCachedPhi(Int_t i)           const { FillMomentumCache(); return fCachePhi[i] ; }
 
   const char*                 GetName()                       const { return fName.Data()               ; }
   void                        SetName(const char* n)                { fName = n                         ; }
@@ -203,6 +222,7 @@ class AliEmcalContainer : public TObject {
    */
   virtual TString             GetDefaultArrayName(const AliVEvent * const ev) const { return ""; }
   void                        GetVertexFromEvent(const AliVEvent * event);
+  void                        FillMomentumCache() const;
 
   TString                     fName;                    ///< object name
   TString                     fClArrayName;             ///< name of branch
@@ -226,6 +246,19 @@ class AliEmcalContainer : public TObject {
   AliNamedArrayI             *fLabelMap;                //!<! Label-Index map
   Double_t                    fVertex[3];               //!<! event vertex array
   TClass                     *fLoadedClass;             //!<! Class of the objects contained in the TClonesArray
+  AliEmcalEventContext       *fEventContext;            //!<! Shared event context providing the accepted indices (optional)
+  Bool_t                      fUseEventCache;           ///< Cache accepted indices and momenta within the event, used by the iterators
+  mutable Bool_t              fAcceptCacheValid;        //!<! Accepted indices cached for the current event
+  mutable Bool_t              fMomentumCacheValid;      //!<! Momenta cached for the current event
+  mutable std::vector<Int_t>  fAcceptCache;             //!<! Indices of the accepted objects
+  mutable std::vector<Bool_t> fCacheMomOK;              //!<! Return value of GetMomentum, per object
+  mutable std::vector<Double_t> fCachePx;               //!<! Momentum x-component, per object
+  mutable std::vector<Double_t> fCachePy;               //!<! Momentum y-component, per object
+  mutable std::vector<Double_t> fCachePz;               //!<! Momentum z-component, per object
+  mutable std::vector<Double_t> fCacheE;                //!<! Energy, per object
+  mutable std::vector<Double_t> fCachePt;               //!<! Transverse momentum, per object
+  mutable std::vector<Double_t> fCacheEta;              //!<! Pseudorapidity, per object (0 for vanishing \f$ p_{t} \f$)
+  mutable std::vector<Double_t> fCachePhi;              //!<! Azimuth, per object
 
  private:
   TString                     fClassName;               ///< name of the class in the TClonesArray
@@ -234,7 +267,7 @@ class AliEmcalContainer : public TObject {
   AliEmcalContainer& operator=(const AliEmcalContainer& other); // assignment
 
   /// \cond CLASSIMP
-  ClassDef(AliEmcalContainer,9);
+  ClassDef(AliEmcalContainer,11);
   /// \endcond
 };
 #endif
@@ -0,0 +1,383 @@
+/**************************************************************************
+ * Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+#include <cstring>
+
+#include <TBufferFile.h>
+#include <TClonesArray.h>
+#include <TObjArray.h>
+
+#include "AliCentrality.h"
+#include "AliEmcalContainer.h"
+#include "AliEmcalEventContext.h"
+#include "AliEventplane.h"
+#include "AliMultSelection.h"
+#include "AliNanoAODHeader.h"
+#include "AliVEvent.h"
+#include "AliVVertex.h"
+
+/// \cond CLASSIMP
+ClassImp(AliEmcalEventContext)
+/// \endcond
+
+const char *AliEmcalEventContext::fgkContextName = "AliEmcalEventContext";
+
+/**
+ * Default constructor
+ */
+AliEmcalEventContext::AliEmcalEventContext():
+  TNamed(fgkContextName, fgkContextName),
+  fEvent(0),
+  fEventKey(),
+  fEventCounter(0),
+  fNVertCont(0),
+  fNVertSPDCont(0),
+  fMultSelection(0),
+  fMultSelectionSearched(kFALSE),
+  fCentEstimators(),
+  fCentValues(),
+  fCentFound(),
+  fEventPlaneDone(kFALSE),
+  fEventPlaneFound(kFALSE),
+  fTriggerPatchArrays(),
+  fTriggerBits(),
+  fFiredTriggerClasses(0),
+  fKeyContainers(),
+  fKeys(),
+  fAcceptKeys(),
+  fAcceptEventCounters(),
+  fAcceptArrays(),
+  fAcceptIndices()
+{
+  memset(fVertex, 0, sizeof(Double_t) * 3);
+  memset(fVertexSPD, 0, sizeof(Double_t) * 3);
+  memset(fEventPlane, 0, sizeof(Double_t) * 3);
+}
+
+/**
+ * Named constructor
+ * @param[in] name Name of the context object
+ */
+AliEmcalEventContext::AliEmcalEventContext(const char *name):
+  TNamed(name, name),
+  fEvent(0),
+  fEventKey(),
+  fEventCounter(0),
+  fNVertCont(0),
+  fNVertSPDCont(0),
+  fMultSelection(0),
+  fMultSelectionSearched(kFALSE),
+  fCentEstimators(),
+  fCentValues(),
+  fCentFound(),
+  fEventPlaneDone(kFALSE),
+  fEventPlaneFound(kFALSE),
+  fTriggerPatchArrays(),
+  fTriggerBits(),
+  fFiredTriggerClasses(0),
+  fKeyContainers(),
+  fKeys(),
+  fAcceptKeys(),
+  fAcceptEventCounters(),
+  fAcceptArrays(),
+  fAcceptIndices()
+{
+  memset(fVertex, 0, sizeof(Double_t) * 3);
+  memset(fVertexSPD, 0, sizeof(Double_t) * 3);
+  memset(fEventPlane, 0, sizeof(Double_t) * 3);
+}
+
+/**
+ * Destructor
+ */
+AliEmcalEventContext::~AliEmcalEventContext()
+{
+  delete fFiredTriggerClasses;
+}
+
+/**
+ * Get the context of the event. The context is created and attached to the
+ * event when called for the first time, and reset when called for a new event.
+ * @param[in] event Input event
+ * @return Context of the event
+ */
+AliEmcalEventContext *AliEmcalEventContext::GetContext(AliVEvent *event)
+{
+  if (!event) return 0;
+
+  AliEmcalEventContext *context = AliEventCacheKey::GetEventObject<AliEmcalEventContext>(event, fgkContextName);
+  // Without an event identifier nothing can be shared safely, Set() then always reports a new event
+  if (context->fEventKey.Set(event)) context->NextEvent(event);
+
+  return context;
+}
+
+/**
+ * Reset the context for a new event. Vertices are retrieved directly, all other
+ * information when requested for the first time.
+ * @param[in] event Input event
+ */
+void AliEmcalEventContext::NextEvent(AliVEvent *event)
+{
+  fEvent = event;
+  fEventCounter++;
+
+  memset(fVertex, 0, sizeof(Double_t) * 3);
+  fNVertCont = 0;
+  memset(fVertexSPD, 0, sizeof(Double_t) * 3);
+  fNVertSPDCont = 0;
+
+  const AliVVertex *vert = event->GetPrimaryVertex();
+  if (vert) {
+    vert->GetXYZ(fVertex);
+    fNVertCont = vert->GetNContributors();
+  }
+
+  const AliVVertex *vertSPD = event->GetPrimaryVertexSPD();
+  if (vertSPD) {
+    vertSPD->GetXYZ(fVertexSPD);
+    fNVertSPDCont = vertSPD->GetNContributors();
+  }
+
+  fMultSelection = 0;
+  fMultSelectionSearched = kFALSE;
+  fCentEstimators.clear();
+  fCentValues.clear();
+  fCentFound.clear();
+  fEventPlaneDone = kFALSE;
+  fEventPlaneFound = kFALSE;
+  memset(fEventPlane, 0, sizeof(Double_t) * 3);
+  fTriggerPatchArrays.clear();
+  fTriggerBits.clear();
+  if (fFiredTriggerClasses) {
+    delete fFiredTriggerClasses;
+    fFiredTriggerClasses = 0;
+  }
+  // accepted indices are kept, they are validated by their event counter
+}
+
+/**
+ * Get the primary vertex of the event
+ * @param[out] vertex Vertex position
+ * @param[out] ncont Number of contributors
+ */
+void AliEmcalEventContext::GetVertex(Double_t *vertex, Int_t &ncont) const
+{
+  memcpy(vertex, fVertex, sizeof(Double_t) * 3);
+  ncont = fNVertCont;
+}
+
+/**
+ * Get the SPD vertex of the event
+ * @param[out] vertex Vertex position
+ * @param[out] ncont Number of contributors
+ */
+void AliEmcalEventContext::GetVertexSPD(Double_t *vertex, Int_t &ncont) const
+{
+  memcpy(vertex, fVertexSPD, sizeof(Double_t) * 3);
+  ncont = fNVertSPDCont;
+}
+
+/**
+ * Get the centrality of the event for a given estimator, in the same way as
+ * AliAnalysisTaskEmcal::RetrieveEventObjects (nano AOD header, AliMultSelection
+ * or AliCentrality).
+ * @param[in] estimator Name of the centrality estimator
+ * @param[in] useNewEstimation If true AliMultSelection is used, otherwise AliCentrality
+ * @param[out] cent Centrality, unchanged if no centrality information is available
+ * @return kFALSE if no centrality information is available
+ */
+Bool_t AliEmcalEventContext::GetCentrality(const char *estimator, Bool_t useNewEstimation, Double_t &cent)
+{
+  std::string key(useNewEstimation ? "1" : "0");
+  key += estimator;
+  for (UInt_t i = 0; i < fCentEstimators.size(); i++) {
+    if (fCentEstimators[i] != key) continue;
+    if (fCentFound[i]) cent = fCentValues[i];
+    return fCentFound[i];
+  }
+
+  Double_t value = cent;
+  Bool_t found = kFALSE;
+  TObject *header = fEvent->GetHeader();
+  if (header && header->InheritsFrom("AliNanoAODStorage")) {
+    AliNanoAODHeader *nanoHead = (AliNanoAODHeader*)header;
+    value = nanoHead->GetCentr(estimator);
+    found = kTRUE;
+  }
+  else if (useNewEstimation) {
+    if (!fMultSelectionSearched) {
+      fMultSelection = fEvent->FindListObject("MultSelection");
+      fMultSelectionSearched = kTRUE;
+    }
+    AliMultSelection *multSelection = static_cast<AliMultSelection*>(fMultSelection);
+    if (multSelection) {
+      value = multSelection->GetMultiplicityPercentile(estimator);
+      found = kTRUE;
+    }
+  }
+  else {
+    AliCentrality *aliCent = fEvent->GetCentrality();
+    if (aliCent) {
+      value = aliCent->GetCentralityPercentile(estimator);
+      found = kTRUE;
+    }
+  }
+
+  fCentEstimators.push_back(key);
+  fCentValues.push_back(value);
+  fCentFound.push_back(found);
+  if (found) cent = value;
+  return found;
+}
+
+/**
+ * Get the V0 event planes of the event.
+ * @param[out] epV0 Event plane V0
+ * @param[out] epV0A Event plane V0A
+ * @param[out] epV0C Event plane V0C
+ * @return kFALSE if no event plane information is available (arguments unchanged)
+ */
+Bool_t AliEmcalEventContext::GetEventPlane(Double_t &epV0, Double_t &epV0A, Double_t &epV0C)
+{
+  if (!fEventPlaneDone) {
+    fEventPlaneDone = kTRUE;
+    TObject *header = fEvent->GetHeader();
+    if (header && header->InheritsFrom("AliNanoAODStorage")) {
+      AliNanoAODHeader *nanoHead = (AliNanoAODHeader*)header;
+      fEventPlane[0] = nanoHead->GetVar(nanoHead->GetVarIndex("cstEvPlaneV0"));
+      fEventPlane[1] = nanoHead->GetVar(nanoHead->GetVarIndex("cstEvPlaneV0A"));
+      fEventPlane[2] = nanoHead->GetVar(nanoHead->GetVarIndex("cstEvPlaneV0C"));
+      fEventPlaneFound = kTRUE;
+    }
+    else {
+      AliEventplane *aliEP = fEvent->GetEventplane();
+      if (aliEP) {
+        fEventPlane[0] = aliEP->GetEventplane("V0" , fEvent);
+        fEventPlane[1] = aliEP->GetEventplane("V0A", fEvent);
+        fEventPlane[2] = aliEP->GetEventplane("V0C", fEvent);
+        fEventPlaneFound = kTRUE;
+      }
+    }
+  }
+
+  if (fEventPlaneFound) {
+    epV0 = fEventPlane[0];
+    epV0A = fEventPlane[1];
+    epV0C = fEventPlane[2];
+  }
+  return fEventPlaneFound;
+}
+
+/**
+ * Get the trigger bits determined from a trigger patch array in this event
+ * @param[in] patches Trigger patch array
+ * @param[out] triggers Trigger bits
+ * @return kFALSE if the trigger bits were not yet determined for this patch array
+ */
+Bool_t AliEmcalEventContext::GetTriggerBits(const TClonesArray *patches, ULong_t &triggers) const
+{
+  for (UInt_t i = 0; i < fTriggerPatchArrays.size(); i++) {
+    if (fTriggerPatchArrays[i] == patches) {
+      triggers = fTriggerBits[i];
+      return kTRUE;
+    }
+  }
+  return kFALSE;
+}
+
+/**
+ * Store the trigger bits determined from a trigger patch array in this event
+ * @param[in] patches Trigger patch array
+ * @param[in] triggers Trigger bits
+ */
+void AliEmcalEventContext::SetTriggerBits(const TClonesArray *patches, ULong_t triggers)
+{
+  fTriggerPatchArrays.push_back(patches);
+  fTriggerBits.push_back(triggers);
+}
+
+/**
+ * Get the fired trigger classes of the event, tokenized
+ * @return Array of TObjString with the names of the trigger classes
+ */
+const TObjArray *AliEmcalEventContext::GetFiredTriggerClasses()
+{
+  if (!fFiredTriggerClasses) fFiredTriggerClasses = fEvent->GetFiredTriggerClasses().Tokenize(" ");
+  return fFiredTriggerClasses;
+}
+
+/**
+ * Get the indices of the objects accepted by a container in this event. The
+ * acceptance is evaluated only for the first container with a given cut
+ * configuration. The reference is valid until the next call.
+ * @param[in] cont Container (must be set to the current event)
+ * @return Indices of the accepted objects, in increasing order
+ */
+const std::vector<Int_t> &AliEmcalEventContext::GetAcceptedIndices(const AliEmcalContainer *cont)
+{
+  const std::string &key = GetCutConfigurationKey(cont);
+  UInt_t slot = 0;
+  for (; slot < fAcceptKeys.size(); slot++) {
+    if (fAcceptKeys[slot] == key) break;
+  }
+  if (slot == fAcceptKeys.size()) {
+    fAcceptKeys.push_back(key);
+    fAcceptEventCounters.push_back(0);
+    fAcceptArrays.push_back(0);
+    fAcceptIndices.push_back(std::vector<Int_t>());
+  }
+
+  std::vector<Int_t> &indices = fAcceptIndices[slot];
+  if (fAcceptEventCounters[slot] != fEventCounter || fAcceptArrays[slot] != cont->GetArray()) {
+    indices.clear();
+    for (Int_t index = 0; index < cont->GetNEntries(); index++) {
+      UInt_t rejectionReason = 0;
+      if (cont->AcceptObject(index, rejectionReason)) indices.push_back(index);
+    }
+    fAcceptEventCounters[slot] = fEventCounter;
+    fAcceptArrays[slot] = cont->GetArray();
+  }
+  return indices;
+}
+
+/**
+ * Get a key describing the cut configuration of a container. The key is made from
+ * the class name and the streamed persistent members of the container, with the
+ * name of the container left empty. It is determined once per container, the cuts
+ * are not expected to change after the first event.
+ * @param[in] cont Container
+ * @return Cut configuration key
+ */
+const std::string &AliEmcalEventContext::GetCutConfigurationKey(const AliEmcalContainer *cont)
+{
+  for (UInt_t i = 0; i < fKeyContainers.size(); i++) {
+    if (fKeyContainers[i] == cont) return fKeys[i];
+  }
+
+  AliEmcalContainer *c = const_cast<AliEmcalContainer*>(cont);
+  TString name(c->GetName());
+  c->SetName("");
+  TBufferFile buffer(TBuffer::kWrite);
+  c->Streamer(buffer);
+  c->SetName(name);
+
+  std::string key(cont->ClassName());
+  key += '/';
+  key.append(buffer.Buffer(), buffer.Length());
+
+  fKeyContainers.push_back(cont);
+  fKeys.push_back(key);
+  return fKeys.back();
+}
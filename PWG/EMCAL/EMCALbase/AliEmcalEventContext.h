@@ -0,0 +1,105 @@
+#ifndef ALIEMCALEVENTCONTEXT_H
+#define ALIEMCALEVENTCONTEXT_H
+/* Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+#include <string>
+#include <vector>
+
+#include <TNamed.h>
+
+#include "AliEventCacheKey.h"
+
+class TClonesArray;
+class TObjArray;
+class AliEmcalContainer;
+class AliVEvent;
+
+/**
+ * \class AliEmcalEventContext
+ * \brief Per-event information shared between all EMCAL framework tasks of a train
+ * \ingroup EMCALCOREFW
+ *
+ * Every AliAnalysisTaskEmcal wagon retrieves the same event objects in
+ * RetrieveEventObjects: vertices, centrality, event plane, trigger bits, and
+ * evaluates the acceptance of its particle and cluster containers. Tasks with
+ * SetUseEventContext(kTRUE) look these up in an event context object instead,
+ * which is attached to the input event and filled only once per event by the
+ * first task needing an entry:
+ *
+ * ~~~{.cxx}
+ * AliEmcalEventContext *ctx = AliEmcalEventContext::GetContext(InputEvent());
+ * ctx->GetVertex(fVertex, fNVertCont);
+ * if (!ctx->GetCentrality(fCentEst, fUseNewCentralityEstimation, fCent)) ...
+ * ~~~
+ *
+ * Centrality is cached per estimator, trigger bits per trigger patch array,
+ * and the indices of the accepted objects of a container per cut configuration:
+ * containers whose persistent members (i.e. all settings, apart from the name)
+ * are identical share one index list. As the values are taken from the first
+ * evaluation in the event, the context must only be used by tasks running after
+ * all tasks modifying the input objects.
+ *
+ * The event is identified by an AliEventCacheKey, i.e. by the entry and the tree
+ * number of the analysis manager and by the event header.
+ */
+class AliEmcalEventContext : public TNamed {
+public:
+  AliEmcalEventContext();
+  AliEmcalEventContext(const char *name);
+  virtual ~AliEmcalEventContext();
+
+  static AliEmcalEventContext *GetContext(AliVEvent *event);
+
+  void                        NextEvent(AliVEvent *event);
+  const AliEventCacheKey     &GetEventKey() const                       { return fEventKey; }
+
+  void                        GetVertex(Double_t *vertex, Int_t &ncont) const;
+  void                        GetVertexSPD(Double_t *vertex, Int_t &ncont) const;
+  Bool_t                      GetCentrality(const char *estimator, Bool_t useNewEstimation, Double_t &cent);
+  Bool_t                      GetEventPlane(Double_t &epV0, Double_t &epV0A, Double_t &epV0C);
+  Bool_t                      GetTriggerBits(const TClonesArray *patches, ULong_t &triggers) const;
+  void                        SetTriggerBits(const TClonesArray *patches, ULong_t triggers);
+  const TObjArray            *GetFiredTriggerClasses();
+  const std::vector<Int_t>   &GetAcceptedIndices(const AliEmcalContainer *cont);
+
+  static const char          *fgkContextName;                          ///< Name of the context object in the event
+
+protected:
+  const std::string          &GetCutConfigurationKey(const AliEmcalContainer *cont);
+
+  AliVEvent                  *fEvent;                                  //!<! Current event
+  AliEventCacheKey            fEventKey;                               //!<! Key of the current event
+  ULong64_t                   fEventCounter;                           //!<! Number of events seen
+  Double_t                    fVertex[3];                              //!<! Primary vertex
+  Int_t                       fNVertCont;                              //!<! Number of contributors to the primary vertex
+  Double_t                    fVertexSPD[3];                           //!<! SPD vertex
+  Int_t                       fNVertSPDCont;                           //!<! Number of contributors to the SPD vertex
+  TObject                    *fMultSelection;                          //!<! Multiplicity selection object of the event
+  Bool_t                      fMultSelectionSearched;                  //!<! Multiplicity selection already searched in this event
+  std::vector<std::string>    fCentEstimators;                         //!<! Estimators with cached centrality ("0"/"1" prefix for old/new estimation)
+  std::vector<Double_t>       fCentValues;                             //!<! Cached centrality per estimator
+  std::vector<Bool_t>         fCentFound;                              //!<! Centrality information was available
+  Bool_t                      fEventPlaneDone;                         //!<! Event plane already retrieved in this event
+  Bool_t                      fEventPlaneFound;                        //!<! Event plane information was available
+  Double_t                    fEventPlane[3];                          //!<! Event plane V0, V0A, V0C
+  std::vector<const TClonesArray*> fTriggerPatchArrays;                //!<! Patch arrays with cached trigger bits
+  std::vector<ULong_t>        fTriggerBits;                            //!<! Cached trigger bits per patch array
+  TObjArray                  *fFiredTriggerClasses;                    //!<! Tokenized fired trigger classes
+  std::vector<const AliEmcalContainer*> fKeyContainers;                //!<! Containers with known cut configuration key
+  std::vector<std::string>    fKeys;                                   //!<! Cut configuration key of the containers
+  std::vector<std::string>    fAcceptKeys;                             //!<! Cut configuration keys with accepted indices
+  std::vector<ULong64_t>      fAcceptEventCounters;                    //!<! Event counter of the accepted indices
+  std::vector<const TClonesArray*> fAcceptArrays;                      //!<! Array the accepted indices belong to
+  std::vector<std::vector<Int_t> > fAcceptIndices;                     //!<! Accepted indices per cut configuration
+
+private:
+  AliEmcalEventContext(const AliEmcalEventContext &);
+  AliEmcalEventContext &operator=(const AliEmcalEventContext &);
+
+  /// \cond CLASSIMP
+  ClassDef(AliEmcalEventContext, 2);
+  /// \endcond
+};
+
+#endif /* ALIEMCALEVENTCONTEXT_H */
@@ -90,6 +90,11 @@ public:
  *   // Do something with the object
  * }
  * ~~~
+ *
+ * If the event cache of the EMCAL container is enabled (AliEmcalContainer::SetUseEventCache),
+ * the iterable container refers to the accepted indices cached in the EMCAL container instead
+ * of copying them, and the iterators take the momenta from the cache. It must therefore not be
+ * used beyond the current event.
  */
 template <typename T, typename STAR=operator_star_object<T> >
 class AliEmcalIterableContainerT final {
@@ -134,6 +139,9 @@ public:
 
     int current_index() const { return fkData->GetInternalIndex(fCurrent); }
     const AliTLorentzVector& get_momentum() const { return this->fCurrentElement.first; }
+    double get_pt() const;
+    double get_eta() const;
+    double get_phi() const;
 
   private:
     iterator();
@@ -150,7 +158,10 @@ public:
       }
       else {
         this->fCurrentElement.second = (*fkData)[fCurrent];
-        fkData->GetContainer()->GetMomentum(this->fCurrentElement.first, fkData->GetInternalIndex(fCurrent));
+        if (fkData->GetContainer()->GetUseEventCache())
+          fkData->GetContainer()->GetCachedMomentum(this->fCurrentElement.first, fkData->GetInternalIndex(fCurrent));
+        else
+          fkData->GetContainer()->GetMomentum(this->fCurrentElement.first, fkData->GetInternalIndex(fCurrent));
       }
     }
   };
@@ -215,10 +226,12 @@ protected:
 private:
   const AliEmcalContainer     *fkContainer;         ///< Container to be iterated over
   TArrayI                     fAcceptIndices;       ///< Array of accepted indices
+  const std::vector<Int_t>    *fkAcceptView;        ///< Accepted indices cached in the container (used instead of fAcceptIndices if set)
   Bool_t                      fUseAccepted;         ///< Switch between accepted and all objects
 
   inline int GetInternalIndex(int index) const {
     if (fUseAccepted) {
+      if (fkAcceptView) return index < 0 || index >= static_cast<int>(fkAcceptView->size()) ? -1 : (*fkAcceptView)[index];
       return index < 0 || index >= fAcceptIndices.GetSize() ? -1 : fAcceptIndices[index];
     }
     else {
@@ -233,6 +246,7 @@ private:
 #endif
 
 #include "AliEmcalContainer.h"
+#include "AliEmcalEventContext.h"
 
 namespace EMCALIterableContainer {
 /**
@@ -242,6 +256,7 @@ template <typename T, typename STAR>
 AliEmcalIterableContainerT<T, STAR>::AliEmcalIterableContainerT():
   fkContainer(NULL),
   fAcceptIndices(),
+  fkAcceptView(NULL),
   fUseAccepted(kFALSE)
 {
 
@@ -257,6 +272,7 @@ template <typename T, typename STAR>
 AliEmcalIterableContainerT<T, STAR>::AliEmcalIterableContainerT(const AliEmcalContainer *cont, bool useAccept):
   fkContainer(cont),
   fAcceptIndices(),
+  fkAcceptView(NULL),
   fUseAccepted(useAccept)
 {
   if (fUseAccepted) BuildAcceptIndices();
@@ -271,6 +287,7 @@ template <typename T, typename STAR>
 AliEmcalIterableContainerT<T, STAR>::AliEmcalIterableContainerT(const AliEmcalIterableContainerT<T, STAR> &ref):
   fkContainer(ref.fkContainer),
   fAcceptIndices(ref.fAcceptIndices),
+  fkAcceptView(ref.fkAcceptView),
   fUseAccepted(ref.fUseAccepted)
 {
 
@@ -287,6 +304,7 @@ AliEmcalIterableContainerT<T, STAR> &AliEmcalIterableContainerT<T, STAR>::operat
   if(this != &ref){
     fkContainer = ref.fkContainer;
     fAcceptIndices = ref.fAcceptIndices;
+    fkAcceptView = ref.fkAcceptView;
     fUseAccepted = ref.fUseAccepted;
   }
   return *this;
@@ -299,7 +317,8 @@ AliEmcalIterableContainerT<T, STAR> &AliEmcalIterableContainerT<T, STAR>::operat
  */
 template <typename T, typename STAR>
 int AliEmcalIterableContainerT<T, STAR>::GetEntries() const {
-  return fUseAccepted ? fAcceptIndices.GetSize() : fkContainer->GetNEntries();
+  if (!fUseAccepted) return fkContainer->GetNEntries();
+  return fkAcceptView ? static_cast<int>(fkAcceptView->size()) : fAcceptIndices.GetSize();
 }
 
 /**
@@ -328,10 +347,23 @@ T *AliEmcalIterableContainerT<T, STAR>::operator[](int index) const {
 /**
  * Build list of accepted indices inside the container.
  * For this all objects inside the container are checked
- * for being accepted or not.
+ * for being accepted or not. With the event cache of the
+ * container enabled, the cached list is used directly.
  */
 template <typename T, typename STAR>
 void AliEmcalIterableContainerT<T, STAR>::BuildAcceptIndices(){
+  if (fkContainer->GetUseEventCache()) {
+    fkAcceptView = &(fkContainer->GetAcceptedIndices());
+    return;
+  }
+  AliEmcalEventContext *context = fkContainer->GetEventContext();
+  if (context) {
+    // accepted indices shared with other tasks in the same event
+    const std::vector<Int_t> &shared = context->GetAcceptedIndices(fkContainer);
+    fAcceptIndices.Set(shared.size());
+    for(UInt_t index = 0; index < shared.size(); index++) fAcceptIndices[index] = shared[index];
+    return;
+  }
   fAcceptIndices.Set(fkContainer->GetNAcceptEntries());
   int acceptCounter = 0;
   for(int index = 0; index < fkContainer->GetNEntries(); index++){
@@ -344,6 +376,46 @@ void AliEmcalIterableContainerT<T, STAR>::BuildAcceptIndices(){
 /// Content of class AliEmcalIterableContainerT<T, STAR>::Iterator            ///
 ///////////////////////////////////////////////////////////////////////
 
+/**
+ * Transverse momentum of the current element. Read from the
+ * event cache of the container, if enabled.
+ * @return Transverse momentum
+ */
+template <typename T, typename STAR>
+double AliEmcalIterableContainerT<T, STAR>::iterator::get_pt() const {
+  int index = fkData->GetInternalIndex(fCurrent);
+  const AliEmcalContainer *cont = fkData->GetContainer();
+  if (cont->GetUseEventCache() && index >= 0 && index < cont->GetNEntries()) return cont->GetCachedPt(index);
+  return this->fCurrentElement.first.Pt();
+}
+
+/**
+ * Pseudorapidity of the current element. Read from the
+ * event cache of the container, if enabled (0 for vanishing
+ * transverse momentum).
+ * @return Pseudorapidity
+ */
+template <typename T, typename STAR>
+double AliEmcalIterableContainerT<T, STAR>::iterator::get_eta() const {
+  int index = fkData->GetInternalIndex(fCurrent);
+  const AliEmcalContainer *cont = fkData->GetContainer();
+  if (cont->GetUseEventCache() && index >= 0 && index < cont->GetNEntries()) return cont->GetCachedEta(index);
+  return this->fCurrentElement.first.Eta();
+}
+
+/**
+ * Azimuth of the current element. Read from the
+ * event cache of the container, if enabled.
+ * @return Azimuth
+ */
+template <typename T, typename STAR>
+double AliEmcalIterableContainerT<T, STAR>::iterator::get_phi() const {
+  int index = fkData->GetInternalIndex(fCurrent);
+  const AliEmcalContainer *cont = fkData->GetContainer();
+  if (cont->GetUseEventCache() && index >= 0 && index < cont->GetNEntries()) return cont->GetCachedPhi(index);
+  return this->fCurrentElement.first.Phi();
+}
+
 /**
  * Constructor of the iterator. Setting underlying data, starting
  * position of the iterator, and direction.
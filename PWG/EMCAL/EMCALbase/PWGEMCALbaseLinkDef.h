@@ -13,6 +13,7 @@
 #pragma link C++ class AliClusterContainer+;
 #pragma link C++ class AliEmcalContainer+;
 #pragma link C++ class AliEmcalContainerUtils+;
+#pragma link C++ class AliEmcalEventContext+;
 #pragma link C++ class AliEmcalParticle+;
 #pragma link C++ class AliEmcalPhysicsSelection+;
 #pragma link C++ class AliEmcalPythiaInfo+;
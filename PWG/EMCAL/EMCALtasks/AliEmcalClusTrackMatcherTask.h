@@ -3,6 +3,11 @@
 
 #include "AliAnalysisTaskEmcal.h"
 
+#if !(defined(__CINT__) || defined(__MAKECINT__))
+#include <vector>
+#include "AliEmcalClusterTrackMatchingGrid.h"
+#endif
+
 class AliEmcalClusTrackMatcherTask : public AliAnalysisTaskEmcal {
  public:
   AliEmcalClusTrackMatcherTask();
@@ -46,11 +51,16 @@ class AliEmcalClusTrackMatcherTask : public AliAnalysisTaskEmcal {
   TH1          *fHistMatchPhiAll;       //!dphi distribution
   TH1          *fHistMatchEta[10][9][2]; //!deta distribution
   TH1          *fHistMatchPhi[10][9][2]; //!dphi distribution
+
+#if !(defined(__CINT__) || defined(__MAKECINT__))
+  AliEmcalClusterTrackMatchingGrid fMatchingGrid;       //!eta-phi grid of the clusters for the matching
+  std::vector<Int_t> fMatchingCandidates;               //!candidate clusters of the current track
+#endif
   
  private:
   AliEmcalClusTrackMatcherTask(const AliEmcalClusTrackMatcherTask&);            // not implemented
   AliEmcalClusTrackMatcherTask &operator=(const AliEmcalClusTrackMatcherTask&); // not implemented
 
-  ClassDef(AliEmcalClusTrackMatcherTask, 8) // Cluster-Track matching task
+  ClassDef(AliEmcalClusTrackMatcherTask, 9) // Cluster-Track matching task
 };
 #endif
@@ -0,0 +1,193 @@
+// AliEmcalClusterTrackMatchingGrid
+//
+
+#include "AliEmcalClusterTrackMatchingGrid.h"
+
+#include <algorithm>
+
+#include <TMath.h>
+#include <TVector2.h>
+#include <TVector3.h>
+
+#include "AliVCluster.h"
+#include "AliVTrack.h"
+
+namespace {
+  /// Safety margin on the cell size, protects against rounding in the cell index calculation
+  const Double_t kCellMargin = 1.001;
+  /// Maximum number of cells, for very small matching distances the cells are made larger
+  const Int_t kMaxCells = 1 << 16;
+}
+
+/**
+ * Default constructor
+ */
+AliEmcalClusterTrackMatchingGrid::AliEmcalClusterTrackMatchingGrid() :
+  fMaxDistance(0),
+  fEtaMin(0),
+  fEtaWidth(0),
+  fPhiWidth(0),
+  fNEtaCells(0),
+  fNPhiCells(0),
+  fUseGrid(kFALSE),
+  fClusterEta(),
+  fClusterPhi(),
+  fClusterValid(),
+  fCellStart(),
+  fCellClusters(),
+  fAlwaysClusters()
+{
+}
+
+/**
+ * Start a new event. Memory of the previous event is kept for reuse.
+ * @param[in] maxDistance Maximum eta-phi distance of matched clusters and tracks (only its square enters the matching)
+ */
+void AliEmcalClusterTrackMatchingGrid::Reset(Double_t maxDistance)
+{
+  fMaxDistance = TMath::Abs(maxDistance);
+  fNEtaCells = 0;
+  fNPhiCells = 0;
+  fUseGrid = kFALSE;
+  fClusterEta.clear();
+  fClusterPhi.clear();
+  fClusterValid.clear();
+  fCellStart.clear();
+  fCellClusters.clear();
+  fAlwaysClusters.clear();
+}
+
+/**
+ * Add the next cluster. Cluster indices are given by the order of the calls.
+ * @param[in] cluster Cluster to add
+ */
+void AliEmcalClusterTrackMatchingGrid::AddCluster(const AliVCluster *cluster)
+{
+  Double_t eta = 0, phi = 0;
+  Bool_t valid = kFALSE;
+  if (cluster) {
+    Float_t pos[3] = {0};
+    cluster->GetPosition(pos);
+    TVector3 cpos(pos);
+    eta = cpos.Eta();
+    phi = cpos.Phi();
+    valid = TMath::Finite(eta) && TMath::Finite(phi);
+    if (valid) phi = TVector2::Phi_0_2pi(phi);
+  }
+  fClusterEta.push_back(eta);
+  fClusterPhi.push_back(phi);
+  fClusterValid.push_back(valid);
+}
+
+/**
+ * Sort the clusters added since the last Reset into the cells.
+ */
+void AliEmcalClusterTrackMatchingGrid::Build()
+{
+  const Int_t nclusters = fClusterEta.size();
+
+  Double_t etaMin = 0, etaMax = 0;
+  Bool_t first = kTRUE;
+  for (Int_t icluster = 0; icluster < nclusters; icluster++) {
+    if (!fClusterValid[icluster]) {
+      fAlwaysClusters.push_back(icluster);
+      continue;
+    }
+    if (first || fClusterEta[icluster] < etaMin) etaMin = fClusterEta[icluster];
+    if (first || fClusterEta[icluster] > etaMax) etaMax = fClusterEta[icluster];
+    first = kFALSE;
+  }
+
+  // Without a finite positive matching distance every cluster has to be tested
+  fUseGrid = fMaxDistance > 0 && TMath::Finite(fMaxDistance) && !first;
+  if (!fUseGrid) return;
+
+  Double_t width = fMaxDistance * kCellMargin;
+  Double_t minWidth = TMath::Sqrt((etaMax - etaMin + width) * TMath::TwoPi() / kMaxCells);
+  if (width < minWidth) width = minWidth;
+
+  fEtaMin = etaMin;
+  fEtaWidth = width;
+  fNEtaCells = TMath::FloorNint((etaMax - etaMin) / width) + 1;
+  fNPhiCells = TMath::FloorNint(TMath::TwoPi() / width);
+  // With less than 3 cells in phi the neighbouring cells cover the full azimuth anyhow
+  if (fNPhiCells < 3) fNPhiCells = 1;
+  fPhiWidth = TMath::TwoPi() / fNPhiCells;
+
+  // Counting sort of the clusters into the cells, keeps the index order inside each cell
+  const Int_t ncells = fNEtaCells * fNPhiCells;
+  fCellStart.assign(ncells + 1, 0);
+  for (Int_t icluster = 0; icluster < nclusters; icluster++) {
+    if (!fClusterValid[icluster]) continue;
+    fCellStart[GetEtaCell(fClusterEta[icluster]) * fNPhiCells + GetPhiCell(fClusterPhi[icluster]) + 1]++;
+  }
+  for (Int_t icell = 0; icell < ncells; icell++) fCellStart[icell + 1] += fCellStart[icell];
+  fCellClusters.resize(fCellStart[ncells]);
+  std::vector<Int_t> fill(fCellStart.begin(), fCellStart.end() - 1);
+  for (Int_t icluster = 0; icluster < nclusters; icluster++) {
+    if (!fClusterValid[icluster]) continue;
+    fCellClusters[fill[GetEtaCell(fClusterEta[icluster]) * fNPhiCells + GetPhiCell(fClusterPhi[icluster])]++] = icluster;
+  }
+}
+
+/**
+ * Get all clusters which can be within the maximum distance of the track,
+ * in increasing index order.
+ * @param[in] track Track on the EMCal surface
+ * @param[out] candidates Indices of the candidate clusters
+ */
+void AliEmcalClusterTrackMatchingGrid::GetCandidates(const AliVTrack *track, std::vector<Int_t> &candidates) const
+{
+  candidates.clear();
+  const Int_t nclusters = fClusterEta.size();
+
+  Double_t eta = 0, phi = 0;
+  Bool_t valid = kFALSE;
+  if (track) {
+    eta = track->GetTrackEtaOnEMCal();
+    phi = track->GetTrackPhiOnEMCal();
+    valid = TMath::Finite(eta) && TMath::Finite(phi);
+  }
+
+  if (!fUseGrid || !valid) {
+    for (Int_t icluster = 0; icluster < nclusters; icluster++) candidates.push_back(icluster);
+    return;
+  }
+
+  // Tracks far outside the eta range of the clusters (e.g. not propagated) have no neighbouring cells
+  Double_t xeta = (eta - fEtaMin) / fEtaWidth;
+  if (xeta < -1 || xeta >= fNEtaCells + 1) {
+    candidates.insert(candidates.end(), fAlwaysClusters.begin(), fAlwaysClusters.end());
+    return;
+  }
+  Int_t ieta = TMath::FloorNint(xeta);
+  Int_t iphi = GetPhiCell(TVector2::Phi_0_2pi(phi));
+  Int_t nphi = fNPhiCells < 3 ? 1 : 3;
+  for (Int_t jeta = TMath::Max(ieta - 1, 0); jeta <= TMath::Min(ieta + 1, fNEtaCells - 1); jeta++) {
+    for (Int_t dphi = 0; dphi < nphi; dphi++) {
+      Int_t jphi = nphi == 1 ? iphi : (iphi + dphi - 1 + fNPhiCells) % fNPhiCells;
+      Int_t icell = jeta * fNPhiCells + jphi;
+      candidates.insert(candidates.end(), fCellClusters.begin() + fCellStart[icell], fCellClusters.begin() + fCellStart[icell + 1]);
+    }
+  }
+  candidates.insert(candidates.end(), fAlwaysClusters.begin(), fAlwaysClusters.end());
+  std::sort(candidates.begin(), candidates.end());
+}
+
+/**
+ * Get the eta cell of a cluster position (clusters are always inside the grid).
+ */
+Int_t AliEmcalClusterTrackMatchingGrid::GetEtaCell(Double_t eta) const
+{
+  Int_t ieta = TMath::FloorNint((eta - fEtaMin) / fEtaWidth);
+  return TMath::Min(TMath::Max(ieta, 0), fNEtaCells - 1);
+}
+
+/**
+ * Get the phi cell of a position, phi in [0, 2pi].
+ */
+Int_t AliEmcalClusterTrackMatchingGrid::GetPhiCell(Double_t phi) const
+{
+  Int_t iphi = TMath::FloorNint(phi / fPhiWidth);
+  return TMath::Min(TMath::Max(iphi, 0), fNPhiCells - 1);
+}
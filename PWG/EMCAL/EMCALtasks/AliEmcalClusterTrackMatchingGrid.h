@@ -0,0 +1,72 @@
+#ifndef ALIEMCALCLUSTERTRACKMATCHINGGRID_H
+#define ALIEMCALCLUSTERTRACKMATCHINGGRID_H
+
+#include <vector>
+
+#include <Rtypes.h>
+
+class AliVCluster;
+class AliVTrack;
+
+/**
+ * @class AliEmcalClusterTrackMatchingGrid
+ * @ingroup EMCALCOREFW
+ * @brief Eta-phi cell grid over cluster positions for geometrical cluster-track matching.
+ *
+ * Brute-force matching evaluates the eta-phi distance of every track-cluster pair,
+ * while only pairs with a distance below the maximum matching distance survive.
+ * The grid is built once per event over the cluster positions, with cells at least
+ * as large as the maximum matching distance, so that for each track only the clusters
+ * in the 3x3 neighbouring cells have to be tested:
+ *
+ * ~~~{.cxx}
+ * grid.Reset(maxDistance);
+ * for (icluster ...) grid.AddCluster(cluster);
+ * grid.Build();
+ * for (itrack ...) {
+ *   grid.GetCandidates(track, candidates);
+ *   for (icand ...) { // test the distance exactly as before
+ * ~~~
+ *
+ * The candidate list of a track contains all clusters that can be within the maximum
+ * distance, in increasing cluster index, such that a matching loop over the candidates
+ * gives the same result, in the same order, as the loop over all clusters. Positions are
+ * the same as in GetEtaPhiDiff (track position on the EMCal surface, cluster position
+ * seen from the nominal interaction point). Tracks or clusters without valid positions
+ * are tested against all clusters resp. tracks.
+ *
+ * Shared by AliEmcalCorrectionClusterTrackMatcher and AliEmcalClusTrackMatcherTask.
+ */
+class AliEmcalClusterTrackMatchingGrid {
+ public:
+  AliEmcalClusterTrackMatchingGrid();
+  ~AliEmcalClusterTrackMatchingGrid() {}
+
+  void          Reset(Double_t maxDistance);
+  void          AddCluster(const AliVCluster *cluster);
+  void          Build();
+  void          GetCandidates(const AliVTrack *track, std::vector<Int_t> &candidates) const;
+
+  Int_t         GetNClusters() const { return static_cast<Int_t>(fClusterEta.size()); }
+  Int_t         GetNCells()    const { return fNEtaCells * fNPhiCells; }
+
+ protected:
+  Int_t         GetEtaCell(Double_t eta) const;
+  Int_t         GetPhiCell(Double_t phi) const;
+
+  Double_t             fMaxDistance;      ///< Maximum matching distance
+  Double_t             fEtaMin;           ///< Lower edge of the first eta cell
+  Double_t             fEtaWidth;         ///< Width of the cells in eta
+  Double_t             fPhiWidth;         ///< Width of the cells in phi
+  Int_t                fNEtaCells;        ///< Number of cells in eta
+  Int_t                fNPhiCells;        ///< Number of cells in phi
+  Bool_t               fUseGrid;          ///< False if all clusters are candidates for every track
+  std::vector<Double_t> fClusterEta;      ///< Eta of the clusters (in order of AddCluster)
+  std::vector<Double_t> fClusterPhi;      ///< Phi of the clusters, in [0, 2pi)
+  std::vector<Bool_t>  fClusterValid;     ///< Cluster has a valid (finite) position
+  std::vector<Int_t>   fCellStart;        ///< Index of the first cluster of each cell in fCellClusters (size ncells+1)
+  std::vector<Int_t>   fCellClusters;     ///< Cluster indices sorted by cell, increasing within a cell
+  std::vector<Int_t>   fAlwaysClusters;   ///< Clusters without valid position, candidates for every track
+};
+
+#endif /* ALIEMCALCLUSTERTRACKMATCHINGGRID_H */
@@ -39,6 +39,8 @@ AliEmcalCorrectionClusterTrackMatcher::AliEmcalCorrectionClusterTrackMatcher() :
   fUpdateClusters(kTRUE),
   fClusterContainerIndexMap(),
   fParticleContainerIndexMap(),
+  fMatchingGrid(),
+  fMatchingCandidates(),
   fEmcalTracks(0),
   fEmcalClusters(0),
   fNEmcalTracks(0),
@@ -368,11 +370,22 @@ void AliEmcalCorrectionClusterTrackMatcher::DoMatching()
 {
   const Double_t maxd2 = fMaxDistance*fMaxDistance;
 
+  // Sort the clusters into an eta-phi grid, each track is then only tested
+  // against the clusters in the neighbouring cells (same result as testing all clusters)
+  fMatchingGrid.Reset(fMaxDistance);
+  for (Int_t icluster = 0; icluster < fNEmcalClusters; icluster++) {
+    AliEmcalParticle* emcalCluster = static_cast<AliEmcalParticle*>(fEmcalClusters->At(icluster));
+    fMatchingGrid.AddCluster(emcalCluster->GetCluster());
+  }
+  fMatchingGrid.Build();
+
   for (Int_t itrack = 0; itrack < fNEmcalTracks; itrack++) {
     AliEmcalParticle* emcalTrack = static_cast<AliEmcalParticle*>(fEmcalTracks->At(itrack));
     AliVTrack* track = emcalTrack->GetTrack();
 
-    for (Int_t icluster = 0; icluster < fNEmcalClusters; icluster++) {
+    fMatchingGrid.GetCandidates(track, fMatchingCandidates);
+    for (UInt_t icand = 0; icand < fMatchingCandidates.size(); icand++) {
+      Int_t icluster = fMatchingCandidates[icand];
       AliEmcalParticle* emcalCluster = static_cast<AliEmcalParticle*>(fEmcalClusters->At(icluster));
       AliVCluster* cluster = emcalCluster->GetCluster();
       
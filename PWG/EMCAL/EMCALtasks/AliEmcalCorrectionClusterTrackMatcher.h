@@ -4,7 +4,9 @@
 #include "AliEmcalCorrectionComponent.h"
 
 #if !(defined(__CINT__) || defined(__MAKECINT__))
+#include <vector>
 #include "AliEmcalContainerIndexMap.h"
+#include "AliEmcalClusterTrackMatchingGrid.h"
 #endif
 
 class TH1;
@@ -92,6 +94,8 @@ class AliEmcalCorrectionClusterTrackMatcher : public AliEmcalCorrectionComponent
   // Handle mapping between index and containers
   AliEmcalContainerIndexMap <AliClusterContainer, AliVCluster> fClusterContainerIndexMap;    //!<! Mapping between index and cluster containers
   AliEmcalContainerIndexMap <AliParticleContainer, AliVParticle> fParticleContainerIndexMap; //!<! Mapping between index and particle containers
+  AliEmcalClusterTrackMatchingGrid fMatchingGrid;                                             //!<! Eta-phi grid of the clusters for the matching
+  std::vector<Int_t> fMatchingCandidates;                                                      //!<! Candidate clusters of the current track
 #endif
 
   TClonesArray *fEmcalTracks;           //!<!emcal tracks
@@ -115,7 +119,7 @@ private:
   static RegisterCorrectionComponent<AliEmcalCorrectionClusterTrackMatcher> reg;
 
   /// \cond CLASSIMP
-  ClassDef(AliEmcalCorrectionClusterTrackMatcher, 4); // EMCal cluster track matcher correction component
+  ClassDef(AliEmcalCorrectionClusterTrackMatcher, 5); // EMCal cluster track matcher correction component
   /// \endcond
 };
 
@@ -32,6 +32,7 @@
 #include "AliEMCALTriggerRawPatch.h"
 #include "AliEmcalTriggerMakerKernel.h"
 #include "AliEmcalTriggerSetupInfo.h"
+#include "AliEmcalTriggerSummedAreaTable.h"
 #include "AliLog.h"
 #include "AliVCaloCells.h"
 #include "AliVCaloTrigger.h"
@@ -65,6 +66,8 @@ AliEmcalTriggerMakerKernel::AliEmcalTriggerMakerKernel():
   fSmearModelMean(nullptr),
   fSmearModelSigma(nullptr),
   fSmearThreshold(0.1),
+  fUseSummedAreaTables(kFALSE),
+  fL1AlgorithmSettings(),
   fGeometry(nullptr),
   fPatchAmplitudes(nullptr),
   fPatchADCSimple(nullptr),
@@ -72,9 +75,14 @@ AliEmcalTriggerMakerKernel::AliEmcalTriggerMakerKernel():
   fPatchEnergySimpleSmeared(nullptr),
   fLevel0TimeMap(nullptr),
   fTriggerBitMap(nullptr),
+  fTableAmplitudes(nullptr),
+  fTableADCSimple(nullptr),
+  fTableADC(nullptr),
+  fTableEnergySimpleSmeared(nullptr),
   fADCtoGeV(1.)
 {
   memset(fThresholdConstants, 0, sizeof(Int_t) * 12);
+  memset(fL0AlgorithmSettings, 0, sizeof(Int_t) * 5);
   memset(fL1ThresholdsOffline, 0, sizeof(ULong64_t) * 4);
   fCellTimeLimits[0] = -10000.;
   fCellTimeLimits[1] = 10000.;
@@ -89,6 +97,10 @@ AliEmcalTriggerMakerKernel::~AliEmcalTriggerMakerKernel() {
   delete fTriggerBitMap;
   delete fPatchFinder;
   delete fLevel0PatchFinder;
+  delete fTableAmplitudes;
+  delete fTableADCSimple;
+  delete fTableADC;
+  delete fTableEnergySimpleSmeared;
   if(fTriggerBitConfig) delete fTriggerBitConfig;
 }
 
@@ -128,6 +140,9 @@ void AliEmcalTriggerMakerKernel::AddL1TriggerAlgorithm(Int_t rowmin, Int_t rowma
   trigger->SetPatchSize(patchSize);
   trigger->SetSubregionSize(subregionSize);
   fPatchFinder->AddTriggerAlgorithm(trigger);
+
+  Int_t settings[5] = {rowmin, rowmax, static_cast<Int_t>(bitmask), patchSize, subregionSize};
+  fL1AlgorithmSettings.insert(fL1AlgorithmSettings.end(), settings, settings + 5);
 }
 
 void AliEmcalTriggerMakerKernel::SetL0TriggerAlgorithm(Int_t rowmin, Int_t rowmax, UInt_t bitmask, Int_t patchSize, Int_t subregionSize)
@@ -136,6 +151,12 @@ void AliEmcalTriggerMakerKernel::SetL0TriggerAlgorithm(Int_t rowmin, Int_t rowma
   fLevel0PatchFinder = new AliEMCALTriggerAlgorithm<double>(rowmin, rowmax, bitmask);
   fLevel0PatchFinder->SetPatchSize(patchSize);
   fLevel0PatchFinder->SetSubregionSize(subregionSize);
+
+  fL0AlgorithmSettings[0] = rowmin;
+  fL0AlgorithmSettings[1] = rowmax;
+  fL0AlgorithmSettings[2] = bitmask;
+  fL0AlgorithmSettings[3] = patchSize;
+  fL0AlgorithmSettings[4] = subregionSize;
 }
 
 void AliEmcalTriggerMakerKernel::ConfigureForPbPb2015()
@@ -146,6 +167,7 @@ void AliEmcalTriggerMakerKernel::ConfigureForPbPb2015()
   // Initialize patch finder
   if (fPatchFinder) delete fPatchFinder;
   fPatchFinder = new AliEMCALTriggerPatchFinder<double>;
+  fL1AlgorithmSettings.clear();
 
   SetL0TriggerAlgorithm(0, 103, 1<<fTriggerBitConfig->GetLevel0Bit(), 2, 1);
   AddL1TriggerAlgorithm(0, 63, 1<<fTriggerBitConfig->GetGammaHighBit() | 1<<fTriggerBitConfig->GetGammaLowBit(), 2, 1);
@@ -163,6 +185,7 @@ void AliEmcalTriggerMakerKernel::ConfigureForPP2015()
   // Initialize patch finder
   if (fPatchFinder) delete fPatchFinder;
   fPatchFinder = new AliEMCALTriggerPatchFinder<double>;
+  fL1AlgorithmSettings.clear();
 
   SetL0TriggerAlgorithm(0, 103, 1<<fTriggerBitConfig->GetLevel0Bit(), 2, 1);
   AddL1TriggerAlgorithm(0, 63, 1<<fTriggerBitConfig->GetGammaHighBit() | 1<<fTriggerBitConfig->GetGammaLowBit(), 2, 1);
@@ -180,6 +203,7 @@ void AliEmcalTriggerMakerKernel::ConfigureForPP20158x8()
   // Initialize patch finder
   if (fPatchFinder) delete fPatchFinder;
   fPatchFinder = new AliEMCALTriggerPatchFinder<double>;
+  fL1AlgorithmSettings.clear();
 
   SetL0TriggerAlgorithm(0, 103, 1<<fTriggerBitConfig->GetLevel0Bit(), 2, 1);
   AddL1TriggerAlgorithm(0, 63, 1<<fTriggerBitConfig->GetGammaHighBit() | 1<<fTriggerBitConfig->GetGammaLowBit(), 2, 1);
@@ -197,6 +221,7 @@ void AliEmcalTriggerMakerKernel::ConfigureForPPb2013()
   // Initialize patch finder
   if (fPatchFinder) delete fPatchFinder;
   fPatchFinder = new AliEMCALTriggerPatchFinder<double>;
+  fL1AlgorithmSettings.clear();
 
   SetL0TriggerAlgorithm(0, 63, 1<<fTriggerBitConfig->GetLevel0Bit(), 2, 1);
   AddL1TriggerAlgorithm(0, 63, 1<<fTriggerBitConfig->GetGammaHighBit() | 1<<fTriggerBitConfig->GetGammaLowBit(), 2, 1);
@@ -212,6 +237,7 @@ void AliEmcalTriggerMakerKernel::ConfigureForPP2012()
   // Initialize patch finder
   if (fPatchFinder) delete fPatchFinder;
   fPatchFinder = new AliEMCALTriggerPatchFinder<double>;
+  fL1AlgorithmSettings.clear();
 
   SetL0TriggerAlgorithm(0, 63, 1<<fTriggerBitConfig->GetLevel0Bit(), 2, 1);
   AddL1TriggerAlgorithm(0, 63, 1<<fTriggerBitConfig->GetGammaHighBit(), 2, 1);
@@ -227,6 +253,7 @@ void AliEmcalTriggerMakerKernel::ConfigureForPbPb2011()
   // Initialize patch finder
   if (fPatchFinder) delete fPatchFinder;
   fPatchFinder = new AliEMCALTriggerPatchFinder<double>;
+  fL1AlgorithmSettings.clear();
 
   SetL0TriggerAlgorithm(0, 63, 1<<fTriggerBitConfig->GetLevel0Bit(), 2, 1);
   AddL1TriggerAlgorithm(0, 63, 1<<fTriggerBitConfig->GetGammaHighBit(), 2, 1);
@@ -242,6 +269,7 @@ void AliEmcalTriggerMakerKernel::ConfigureForPP2011()
   // Initialize patch finder
   if (fPatchFinder) delete fPatchFinder;
   fPatchFinder = new AliEMCALTriggerPatchFinder<double>;
+  fL1AlgorithmSettings.clear();
 
   SetL0TriggerAlgorithm(0, 63, 1<<fTriggerBitConfig->GetLevel0Bit(), 2, 1);
   fConfigured = true;
@@ -504,14 +532,18 @@ void AliEmcalTriggerMakerKernel::CreateTriggerPatches(const AliVEvent *inputeven
   bkgPatchMask = 1 << fTriggerBitConfig->GetBkgBit();
       //l0PatchMask = 1 << fTriggerBitConfig->GetLevel0Bit();
 
-  std::vector<AliEMCALTriggerRawPatch> patches;
-  if (fPatchFinder) {
-    if (useL0amp) {
-      patches = fPatchFinder->FindPatches(*fPatchAmplitudes, *fPatchADCSimple);
-    }
-    else {
-      patches = fPatchFinder->FindPatches(*fPatchADC, *fPatchADCSimple);
+  std::vector<AliEMCALTriggerRawPatch> patches, l0patches;
+  Bool_t useTables = fUseSummedAreaTables && FindPatchesSummedAreaTables(useL0amp, patches, l0patches);
+  if (!useTables) {
+    if (fPatchFinder) {
+      if (useL0amp) {
+        patches = fPatchFinder->FindPatches(*fPatchAmplitudes, *fPatchADCSimple);
+      }
+      else {
+        patches = fPatchFinder->FindPatches(*fPatchADC, *fPatchADCSimple);
+      }
     }
+    if (fLevel0PatchFinder) l0patches = fLevel0PatchFinder->FindPatches(*fPatchAmplitudes, *fPatchADCSimple);
   }
   outputcont.clear();
   for(std::vector<AliEMCALTriggerRawPatch>::iterator patchit = patches.begin(); patchit != patches.end(); ++patchit){
@@ -548,9 +580,13 @@ void AliEmcalTriggerMakerKernel::CreateTriggerPatches(const AliVEvent *inputeven
     if(fPatchEnergySimpleSmeared){
       // Add smeared energy
       double energysmear = 0;
-      for(int icol = 0; icol < fullpatch.GetPatchSize(); icol++){
-        for(int irow = 0; irow < fullpatch.GetPatchSize(); irow++){
-          energysmear += (*fPatchEnergySimpleSmeared)(fullpatch.GetColStart() + icol, fullpatch.GetRowStart() + irow);
+      if(useTables){
+        energysmear = fTableEnergySimpleSmeared->GetPatchSum(fullpatch.GetColStart(), fullpatch.GetRowStart(), fullpatch.GetPatchSize());
+      } else {
+        for(int icol = 0; icol < fullpatch.GetPatchSize(); icol++){
+          for(int irow = 0; irow < fullpatch.GetPatchSize(); irow++){
+            energysmear += (*fPatchEnergySimpleSmeared)(fullpatch.GetColStart() + icol, fullpatch.GetRowStart() + irow);
+          }
         }
       }
       AliDebugStream(1) << "Patch size(" << fullpatch.GetPatchSize() <<") energy " << fullpatch.GetPatchE() << " smeared " << energysmear << std::endl;
@@ -559,9 +595,7 @@ void AliEmcalTriggerMakerKernel::CreateTriggerPatches(const AliVEvent *inputeven
     outputcont.push_back(fullpatch);
   }
 
-  // Find Level0 patches
-  std::vector<AliEMCALTriggerRawPatch> l0patches;
-  if (fLevel0PatchFinder) l0patches = fLevel0PatchFinder->FindPatches(*fPatchAmplitudes, *fPatchADCSimple);
+  // Level0 patches
   for(std::vector<AliEMCALTriggerRawPatch>::iterator patchit = l0patches.begin(); patchit != l0patches.end(); ++patchit){
     Int_t offlinebits = 0, onlinebits = 0;
     if(HasPHOSOverlap(*patchit)) continue;
@@ -579,9 +613,13 @@ void AliEmcalTriggerMakerKernel::CreateTriggerPatches(const AliVEvent *inputeven
     if(fPatchEnergySimpleSmeared){
       // Add smeared energy
       double energysmear = 0;
-      for(int icol = 0; icol < fullpatch.GetPatchSize(); icol++){
-        for(int irow = 0; irow < fullpatch.GetPatchSize(); irow++){
-          energysmear += (*fPatchEnergySimpleSmeared)(fullpatch.GetColStart() + icol, fullpatch.GetRowStart() + irow);
+      if(useTables){
+        energysmear = fTableEnergySimpleSmeared->GetPatchSum(fullpatch.GetColStart(), fullpatch.GetRowStart(), fullpatch.GetPatchSize());
+      } else {
+        for(int icol = 0; icol < fullpatch.GetPatchSize(); icol++){
+          for(int irow = 0; irow < fullpatch.GetPatchSize(); irow++){
+            energysmear += (*fPatchEnergySimpleSmeared)(fullpatch.GetColStart() + icol, fullpatch.GetRowStart() + irow);
+          }
         }
       }
       fullpatch.SetSmearedEnergy(energysmear);
@@ -591,6 +629,42 @@ void AliEmcalTriggerMakerKernel::CreateTriggerPatches(const AliVEvent *inputeven
   // std::cout << "Finished finding trigger patches" << std::endl;
 }
 
+Bool_t AliEmcalTriggerMakerKernel::FindPatchesSummedAreaTables(Bool_t useL0amp, std::vector<AliEMCALTriggerRawPatch> &l1patches, std::vector<AliEMCALTriggerRawPatch> &l0patches){
+  if ((fPatchFinder && fL1AlgorithmSettings.empty()) || (fLevel0PatchFinder && !fL0AlgorithmSettings[3])) {
+    AliWarningStream() << "Algorithm settings not available, summing patches without summed-area tables" << std::endl;
+    fUseSummedAreaTables = kFALSE;
+    return kFALSE;
+  }
+
+  // Tables are built once per event and shared by all algorithms
+  if (!fTableAmplitudes) {
+    fTableAmplitudes = new AliEmcalTriggerSummedAreaTable;
+    fTableADCSimple = new AliEmcalTriggerSummedAreaTable;
+    fTableADC = new AliEmcalTriggerSummedAreaTable;
+  }
+  fTableAmplitudes->Build(*fPatchAmplitudes);
+  fTableADCSimple->Build(*fPatchADCSimple);
+  if (!useL0amp) fTableADC->Build(*fPatchADC);
+  if (fPatchEnergySimpleSmeared) {
+    if (!fTableEnergySimpleSmeared) fTableEnergySimpleSmeared = new AliEmcalTriggerSummedAreaTable;
+    fTableEnergySimpleSmeared->Build(*fPatchEnergySimpleSmeared);
+  }
+
+  l1patches.clear();
+  l0patches.clear();
+  if (fPatchFinder) {
+    const AliEmcalTriggerSummedAreaTable &adc = useL0amp ? *fTableAmplitudes : *fTableADC;
+    for (std::vector<Int_t>::const_iterator settings = fL1AlgorithmSettings.begin(); settings + 5 <= fL1AlgorithmSettings.end(); settings += 5) {
+      AliEmcalTriggerSummedAreaTable::FindPatches(adc, *fTableADCSimple, settings[0], settings[1], settings[2], settings[3], settings[4], l1patches);
+    }
+  }
+  if (fLevel0PatchFinder) {
+    AliEmcalTriggerSummedAreaTable::FindPatches(*fTableAmplitudes, *fTableADCSimple, fL0AlgorithmSettings[0], fL0AlgorithmSettings[1],
+        fL0AlgorithmSettings[2], fL0AlgorithmSettings[3], fL0AlgorithmSettings[4], l0patches);
+  }
+  return kTRUE;
+}
+
 double AliEmcalTriggerMakerKernel::GetL0TriggerChannelAmplitude(Int_t col, Int_t row) const{
   double amp = 0;
   try {
@@ -21,6 +21,7 @@ class AliVCaloTrigger;
 class AliVEvent;
 class AliVVZERO;
 class AliEMCALTriggerBitConfig;
+class AliEmcalTriggerSummedAreaTable;
 template<class T> class AliEMCALTriggerDataGrid;
 template<class T> class AliEMCALTriggerAlgorithm;
 template<class T> class AliEMCALTriggerPatchFinder;
@@ -318,6 +319,18 @@ public:
    */
   void SetApplyOnlineBadChannelMaskingToOffline(Bool_t doApply = kTRUE) { fApplyOnlineBadChannelsToOffline = doApply; }
 
+  /**
+   * @brief Use summed-area tables for the patch sums
+   *
+   * Instead of summing the FastORs of every patch, patch sums are obtained
+   * from summed-area tables of the data grids, built once per event and shared
+   * by all algorithms. Patches are the same, however offline ADC and smeared
+   * energy can differ from the direct sum by floating-point rounding (see
+   * AliEmcalTriggerSummedAreaTable).
+   * @param[in] doUse If true summed-area tables are used
+   */
+  void SetUseSummedAreaTables(Bool_t doUse = kTRUE) { fUseSummedAreaTables = doUse; }
+
   /**
    * @brief Reset all data grids and VZERO-dependent L1 thresholds
    */
@@ -473,6 +486,15 @@ protected:
    */
   bool HasPHOSOverlap(const AliEMCALTriggerRawPatch &patch) const;
 
+  /**
+   * @brief Run the L1 and L0 algorithms on summed-area tables of the data grids
+   * @param[in] useL0amp If true the Level0 amplitude is used for the L1 patches
+   * @param[out] l1patches Found L1 patches
+   * @param[out] l0patches Found L0 patches
+   * @return False if the algorithm settings are not available (kernel configured with an older version)
+   */
+  Bool_t FindPatchesSummedAreaTables(Bool_t useL0amp, std::vector<AliEMCALTriggerRawPatch> &l1patches, std::vector<AliEMCALTriggerRawPatch> &l0patches);
+
   std::set<Short_t>                         fBadChannels;                 ///< Container of bad channels
   std::set<Short_t>                         fOfflineBadChannels;          ///< Abd ID of offline bad channels
   TArrayF                                   fFastORPedestal;              ///< FastOR pedestal
@@ -498,6 +520,9 @@ protected:
   TF1                                       *fSmearModelMean;             ///< Smearing parameterization for the mean
   TF1                                       *fSmearModelSigma;            ///< Smearing parameterization for the width
   Double_t                                  fSmearThreshold;              ///< Smear threshold: Only cell energies above threshold are smeared
+  Bool_t                                    fUseSummedAreaTables;         ///< Use summed-area tables for the patch sums
+  std::vector<Int_t>                        fL1AlgorithmSettings;         ///< Row min, row max, bit mask, patch size and subregion size of each L1 algorithm
+  Int_t                                     fL0AlgorithmSettings[5];      ///< Row min, row max, bit mask, patch size and subregion size of the L0 algorithm
 
   const AliEMCALGeometry                    *fGeometry;                   //!<! Underlying EMCAL geometry
   AliEMCALTriggerDataGrid<double>           *fPatchAmplitudes;            //!<! TRU Amplitudes (for L0)
@@ -506,11 +531,15 @@ protected:
   AliEMCALTriggerDataGrid<double>           *fPatchEnergySimpleSmeared;   //!<! Data grid for smeared energy values from cell energies
   AliEMCALTriggerDataGrid<char>             *fLevel0TimeMap;              //!<! Map needed to store the level0 times
   AliEMCALTriggerDataGrid<int>              *fTriggerBitMap;              //!<! Map of trigger bits
+  AliEmcalTriggerSummedAreaTable            *fTableAmplitudes;            //!<! Summed-area table of the TRU amplitudes
+  AliEmcalTriggerSummedAreaTable            *fTableADCSimple;             //!<! Summed-area table of the offline ADC values
+  AliEmcalTriggerSummedAreaTable            *fTableADC;                   //!<! Summed-area table of the ADC values
+  AliEmcalTriggerSummedAreaTable            *fTableEnergySimpleSmeared;   //!<! Summed-area table of the smeared energies
 
   Double_t                                  fADCtoGeV;                    //!<! Conversion factor from ADC to GeV
 
   /// \cond CLASSIMP
-  ClassDef(AliEmcalTriggerMakerKernel, 4);
+  ClassDef(AliEmcalTriggerMakerKernel, 5);
   /// \endcond
 };
 
@@ -181,6 +181,14 @@ public:
     if(fTriggerMaker) fTriggerMaker->SetApplyOnlineBadChannelMaskingToOffline(doApply);
   }
 
+  /**
+   * @brief Obtain patch sums from summed-area tables in the trigger maker kernel.
+   * @param[in] doUse If true summed-area tables are used
+   */
+  void SetUseSummedAreaTables(Bool_t doUse = kTRUE) {
+    if(fTriggerMaker) fTriggerMaker->SetUseSummedAreaTables(doUse);
+  }
+
   void SetTriggerThresholdJetLow   ( Int_t a, Int_t b, Int_t c ) {
     if(fTriggerMaker) fTriggerMaker->SetTriggerThresholdJetLow(a, b, c);
   }
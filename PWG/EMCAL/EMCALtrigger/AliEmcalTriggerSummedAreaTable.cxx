@@ -0,0 +1,108 @@
+/**************************************************************************
+ * Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+#include <TMath.h>
+
+#include "AliEMCALTriggerDataGrid.h"
+#include "AliEMCALTriggerRawPatch.h"
+#include "AliEmcalTriggerSummedAreaTable.h"
+
+/**
+ * Constructor, creating an empty table
+ */
+AliEmcalTriggerSummedAreaTable::AliEmcalTriggerSummedAreaTable():
+  fNCols(0),
+  fNRows(0),
+  fSums(),
+  fNonZero()
+{
+}
+
+/**
+ * Build the table from the grid of the current event. The memory
+ * is kept for the next event.
+ * @param[in] grid Trigger data grid
+ */
+void AliEmcalTriggerSummedAreaTable::Build(const AliEMCALTriggerDataGrid<double> &grid)
+{
+  fNCols = grid.GetNumberOfCols();
+  fNRows = grid.GetNumberOfRows();
+  const Int_t stride = fNCols + 1;
+  fSums.assign(stride * (fNRows + 1), 0.);
+  fNonZero.assign(stride * (fNRows + 1), 0);
+  for (Int_t irow = 0; irow < fNRows; irow++) {
+    Double_t rowsum = 0;
+    Int_t rownonzero = 0;
+    for (Int_t icol = 0; icol < fNCols; icol++) {
+      Double_t value = grid(icol, irow);
+      rowsum += value;
+      if (value != 0) rownonzero++;
+      fSums[(irow + 1) * stride + icol + 1] = fSums[irow * stride + icol + 1] + rowsum;
+      fNonZero[(irow + 1) * stride + icol + 1] = fNonZero[irow * stride + icol + 1] + rownonzero;
+    }
+  }
+}
+
+/**
+ * Sum of a quadratic patch. Parts of the patch outside the grid
+ * do not contribute.
+ * @param[in] col Start column of the patch
+ * @param[in] row Start row of the patch
+ * @param[in] size Size of the patch in columns and rows
+ * @return Sum of all entries in the patch
+ */
+Double_t AliEmcalTriggerSummedAreaTable::GetPatchSum(Int_t col, Int_t row, Int_t size) const
+{
+  Int_t colmin = TMath::Max(col, 0), colmax = TMath::Min(col + size, fNCols),
+        rowmin = TMath::Max(row, 0), rowmax = TMath::Min(row + size, fNRows);
+  if (colmin >= colmax || rowmin >= rowmax) return 0;
+  const Int_t stride = fNCols + 1;
+  Int_t nonzero = fNonZero[rowmax * stride + colmax] - fNonZero[rowmin * stride + colmax]
+                - fNonZero[rowmax * stride + colmin] + fNonZero[rowmin * stride + colmin];
+  if (!nonzero) return 0;
+  return fSums[rowmax * stride + colmax] - fSums[rowmin * stride + colmax]
+       - fSums[rowmax * stride + colmin] + fSums[rowmin * stride + colmin];
+}
+
+/**
+ * Sliding-window patch finder on summed-area tables, equivalent to
+ * AliEMCALTriggerAlgorithm::FindPatches with the same settings.
+ * Found patches are appended to the result.
+ * @param[in] adc Table of the (online) ADC grid
+ * @param[in] offlineAdc Table of the offline ADC grid
+ * @param[in] rowmin Minimum row value
+ * @param[in] rowmax Maximum row value
+ * @param[in] bitmask Offline bit mask to be applied to the patches
+ * @param[in] patchSize Size of the patches
+ * @param[in] subregionSize Size of the sliding sub region
+ * @param[out] result Found patches
+ */
+void AliEmcalTriggerSummedAreaTable::FindPatches(const AliEmcalTriggerSummedAreaTable &adc, const AliEmcalTriggerSummedAreaTable &offlineAdc,
+                                                 Int_t rowmin, Int_t rowmax, UInt_t bitmask, Int_t patchSize, Int_t subregionSize,
+                                                 std::vector<AliEMCALTriggerRawPatch> &result)
+{
+  Int_t rowStartMax = rowmax - (patchSize - 1),
+        colStartMax = adc.GetNumberOfCols() - patchSize;
+  for (Int_t irow = rowmin; irow <= rowStartMax; irow += subregionSize) {
+    for (Int_t icol = 0; icol <= colStartMax; icol += subregionSize) {
+      Double_t sumadc = adc.GetPatchSum(icol, irow, patchSize),
+               sumofflineAdc = offlineAdc.GetPatchSum(icol, irow, patchSize);
+      if (sumadc > 0 || sumofflineAdc > 0) {
+        AliEMCALTriggerRawPatch recpatch(icol, irow, patchSize, sumadc, sumofflineAdc);
+        recpatch.SetBitmask(bitmask);
+        result.push_back(recpatch);
+      }
+    }
+  }
+}
@@ -0,0 +1,62 @@
+#ifndef ALIEMCALTRIGGERSUMMEDAREATABLE_H
+#define ALIEMCALTRIGGERSUMMEDAREATABLE_H
+/* Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+#include <vector>
+
+#include <Rtypes.h>
+
+class AliEMCALTriggerRawPatch;
+template<class T> class AliEMCALTriggerDataGrid;
+
+/**
+ * @class AliEmcalTriggerSummedAreaTable
+ * @brief Summed-area table (integral image) of a trigger data grid
+ * @ingroup EMCALTRGFW
+ *
+ * The sliding-window patch finder sums all FastORs of a patch, for every patch
+ * position and every algorithm. The summed-area table stores for each (col, row)
+ * the sum of all FastORs below and left of it, so that the sum of any rectangular
+ * patch is obtained from four table entries, independent of the patch size. The
+ * table is built once per event and grid, and shared by all algorithms using
+ * the grid:
+ *
+ * ~~~{.cxx}
+ * AliEmcalTriggerSummedAreaTable adc, offline;
+ * adc.Build(adcgrid);
+ * offline.Build(offlinegrid);
+ * AliEmcalTriggerSummedAreaTable::FindPatches(adc, offline, 0, 63, bitmask, 16, 4, patches);
+ * ~~~
+ *
+ * Patches are found at the same positions, in the same order and with the same
+ * selection (ADC or offline ADC above 0) as with AliEMCALTriggerAlgorithm. For
+ * grids with integer values (i.e. FastOR ADC values) the sums are exact; for
+ * grids with real values (i.e. offline ADC from cells) they can differ from
+ * the direct sum by floating-point rounding. In order not to turn empty patches
+ * into patches with a tiny non-zero amplitude, the number of non-zero entries
+ * is tabulated as well, and the sum of patches without any non-zero entry is
+ * exactly 0.
+ */
+class AliEmcalTriggerSummedAreaTable {
+public:
+  AliEmcalTriggerSummedAreaTable();
+  ~AliEmcalTriggerSummedAreaTable() {}
+
+  void              Build(const AliEMCALTriggerDataGrid<double> &grid);
+  Double_t          GetPatchSum(Int_t col, Int_t row, Int_t size) const;
+  Int_t             GetNumberOfCols() const { return fNCols; }
+  Int_t             GetNumberOfRows() const { return fNRows; }
+
+  static void       FindPatches(const AliEmcalTriggerSummedAreaTable &adc, const AliEmcalTriggerSummedAreaTable &offlineAdc,
+                                Int_t rowmin, Int_t rowmax, UInt_t bitmask, Int_t patchSize, Int_t subregionSize,
+                                std::vector<AliEMCALTriggerRawPatch> &result);
+
+protected:
+  Int_t                 fNCols;       ///< Number of columns of the grid
+  Int_t                 fNRows;       ///< Number of rows of the grid
+  std::vector<Double_t> fSums;        ///< Sum of all entries with col' < col and row' < row, (fNCols+1) x (fNRows+1), row-major
+  std::vector<Int_t>    fNonZero;     ///< Number of non-zero entries with col' < col and row' < row, same layout
+};
+
+#endif /* ALIEMCALTRIGGERSUMMEDAREATABLE_H */
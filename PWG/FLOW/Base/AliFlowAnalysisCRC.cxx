@@ -45,6 +45,7 @@
 #include "AliFlowVector.h"
 #include "AliFlowTrackSimple.h"
 #include "AliFlowAnalysisCRC.h"
+#include "AliFlowQVectorKernel.h"
 #include "AliLog.h"
 #include "TRandom.h"
 #include "TF1.h"
@@ -145,6 +146,8 @@ fExactNoRPs(0),
 fUse2DHistograms(kFALSE),
 fFillProfilesVsMUsingWeights(kTRUE),
 fUseQvectorTerms(kFALSE),
+fQVectorKernel(NULL),
+fQVectorKernelGF(NULL),
 fReQ(NULL),
 fImQ(NULL),
 fSpk(NULL),
@@ -425,6 +428,8 @@ AliFlowAnalysisCRC::~AliFlowAnalysisCRC()
   delete[] fchisqVA;
   delete[] fchisqVC;
   if(fPhiExclZoneHist) delete fPhiExclZoneHist;
+  delete fQVectorKernel;
+  delete fQVectorKernelGF;
 } // end of AliFlowAnalysisCRC::~AliFlowAnalysisCRC()
 
 //================================================================================================================
@@ -464,6 +469,10 @@ void AliFlowAnalysisCRC::Init()
   this->BookEverythingForMixedHarmonics();
   this->BookEverythingForControlHistograms();
   this->BookEverythingForBootstrap();
+  delete fQVectorKernel;
+  fQVectorKernel = new AliFlowQVectorKernel(12,9,1,fHarmonic); // Q_{m*n,k}: m = 1,2,...,12, k = 0,1,...,8
+  delete fQVectorKernelGF;
+  fQVectorKernelGF = new AliFlowQVectorKernel(21,9,0,1); // generic framework: m = 0,1,...,20, k = 0,1,...,8
   this->SetRunList();
   if(fCalculateCRC) {
     this->BookEverythingForCRC();
@@ -817,13 +826,16 @@ void AliFlowAnalysisCRC::Make(AliFlowEventSimple* anEvent)
           if(fPhiExclZoneHist->GetBinContent(fPhiExclZoneHist->FindBin(dEta,dPhi))<0.5) continue;
         }
 
+        // cos((m+1)*n*dPhi), sin((m+1)*n*dPhi) and (w_i)^k are evaluated once for this particle:
+        fQVectorKernel->ComputeHarmonics(dPhi);
+        fQVectorKernel->ComputeWeightPowers(wPhiEta*wPhi*wPt*wEta*wTrack);
         // Calculate Re[Q_{m*n,k}] and Im[Q_{m*n,k}] for this event (m = 1,2,...,12, k = 0,1,...,8):
         for(Int_t m=0;m<12;m++) // to be improved - hardwired 6
         {
           for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
           {
-            (*fReQ)(m,k)+=pow(wPhiEta*wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1)*n*dPhi);
-            (*fImQ)(m,k)+=pow(wPhiEta*wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1)*n*dPhi);
+            (*fReQ)(m,k)+=fQVectorKernel->WeightPower(k)*fQVectorKernel->Cos(m);
+            (*fImQ)(m,k)+=fQVectorKernel->WeightPower(k)*fQVectorKernel->Sin(m);
           }
         }
         // Calculate S_{p,k} for this event (Remark: final calculation of S_{p,k} follows after the loop over data bellow):
@@ -831,7 +843,7 @@ void AliFlowAnalysisCRC::Make(AliFlowEventSimple* anEvent)
         {
           for(Int_t k=0;k<9;k++)
           {
-            (*fSpk)(p,k)+=pow(wPhiEta*wPhi*wPt*wEta*wTrack,k);
+            (*fSpk)(p,k)+=fQVectorKernel->WeightPower(k);
           }
         }
         // Differential flow:
@@ -848,21 +860,21 @@ void AliFlowAnalysisCRC::Make(AliFlowEventSimple* anEvent)
               {
                 for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
                 {
-                  fReRPQ1dEBE[0][pe][m][k]->Fill(ptEta[pe],pow(wPhiEta*wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-                  fImRPQ1dEBE[0][pe][m][k]->Fill(ptEta[pe],pow(wPhiEta*wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);
+                  fReRPQ1dEBE[0][pe][m][k]->Fill(ptEta[pe],fQVectorKernel->WeightPower(k)*fQVectorKernel->Cos(m),1.);
+                  fImRPQ1dEBE[0][pe][m][k]->Fill(ptEta[pe],fQVectorKernel->WeightPower(k)*fQVectorKernel->Sin(m),1.);
                   if(m==0) // s_{p,k} does not depend on index m
                   {
-                    fs1dEBE[0][pe][k]->Fill(ptEta[pe],pow(wPhiEta*wPhi*wPt*wEta*wTrack,k),1.);
+                    fs1dEBE[0][pe][k]->Fill(ptEta[pe],fQVectorKernel->WeightPower(k),1.);
                   } // end of if(m==0) // s_{p,k} does not depend on index m
                 } // end of for(Int_t pe=0;pe<2;pe++) // pt or eta
               } // end of if(fCalculateDiffFlow)
               if(fCalculate2DDiffFlow)
               {
-                fReRPQ2dEBE[0][m][k]->Fill(dPt,dEta,pow(wPhiEta*wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-                fImRPQ2dEBE[0][m][k]->Fill(dPt,dEta,pow(wPhiEta*wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);
+                fReRPQ2dEBE[0][m][k]->Fill(dPt,dEta,fQVectorKernel->WeightPower(k)*fQVectorKernel->Cos(m),1.);
+                fImRPQ2dEBE[0][m][k]->Fill(dPt,dEta,fQVectorKernel->WeightPower(k)*fQVectorKernel->Sin(m),1.);
                 if(m==0) // s_{p,k} does not depend on index m
                 {
-                  fs2dEBE[0][k]->Fill(dPt,dEta,pow(wPhiEta*wPhi*wPt*wEta*wTrack,k),1.);
+                  fs2dEBE[0][k]->Fill(dPt,dEta,fQVectorKernel->WeightPower(k),1.);
                 } // end of if(m==0) // s_{p,k} does not depend on index m
               } // end of if(fCalculate2DDiffFlow)
             } // end of for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
@@ -879,21 +891,21 @@ void AliFlowAnalysisCRC::Make(AliFlowEventSimple* anEvent)
                 {
                   for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
                   {
-                    fReRPQ1dEBE[2][pe][m][k]->Fill(ptEta[pe],pow(wPhiEta*wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-                    fImRPQ1dEBE[2][pe][m][k]->Fill(ptEta[pe],pow(wPhiEta*wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);
+                    fReRPQ1dEBE[2][pe][m][k]->Fill(ptEta[pe],fQVectorKernel->WeightPower(k)*fQVectorKernel->Cos(m),1.);
+                    fImRPQ1dEBE[2][pe][m][k]->Fill(ptEta[pe],fQVectorKernel->WeightPower(k)*fQVectorKernel->Sin(m),1.);
                     if(m==0) // s_{p,k} does not depend on index m
                     {
-                      fs1dEBE[2][pe][k]->Fill(ptEta[pe],pow(wPhiEta*wPhi*wPt*wEta*wTrack,k),1.);
+                      fs1dEBE[2][pe][k]->Fill(ptEta[pe],fQVectorKernel->WeightPower(k),1.);
                     } // end of if(m==0) // s_{p,k} does not depend on index m
                   } // end of for(Int_t pe=0;pe<2;pe++) // pt or eta
                 } // end of if(fCalculateDiffFlow)
                 if(fCalculate2DDiffFlow)
                 {
-                  fReRPQ2dEBE[2][m][k]->Fill(dPt,dEta,pow(wPhiEta*wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-                  fImRPQ2dEBE[2][m][k]->Fill(dPt,dEta,pow(wPhiEta*wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);
+                  fReRPQ2dEBE[2][m][k]->Fill(dPt,dEta,fQVectorKernel->WeightPower(k)*fQVectorKernel->Cos(m),1.);
+                  fImRPQ2dEBE[2][m][k]->Fill(dPt,dEta,fQVectorKernel->WeightPower(k)*fQVectorKernel->Sin(m),1.);
                   if(m==0) // s_{p,k} does not depend on index m
                   {
-                    fs2dEBE[2][k]->Fill(dPt,dEta,pow(wPhiEta*wPhi*wPt*wEta*wTrack,k),1.);
+                    fs2dEBE[2][k]->Fill(dPt,dEta,fQVectorKernel->WeightPower(k),1.);
                   } // end of if(m==0) // s_{p,k} does not depend on index m
                 } // end of if(fCalculate2DDiffFlow)
               } // end of for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
@@ -994,13 +1006,15 @@ void AliFlowAnalysisCRC::Make(AliFlowEventSimple* anEvent)
         // Generic Framework: Calculate Re[Q_{m*n,k}] and Im[Q_{m*n,k}] for this event (m = 1,2,...,12, k = 0,1,...,8):
         Double_t MaxPtCut = 3.;
         if(fMinMulZN==99) MaxPtCut = 1.;
+        fQVectorKernelGF->ComputeHarmonics(dPhi);
+        fQVectorKernelGF->ComputeWeightPowers(wPhiEta*wPhi*wPt*wEta*wTrack);
         if(dPt<MaxPtCut) {
           for(Int_t m=0;m<21;m++) // to be improved - hardwired 6
           {
             for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
             {
-              (*fReQGF)(m,k) += pow(wPhiEta*wPhi*wPt*wEta*wTrack,k)*TMath::Cos(m*dPhi);
-              (*fImQGF)(m,k) += pow(wPhiEta*wPhi*wPt*wEta*wTrack,k)*TMath::Sin(m*dPhi);
+              (*fReQGF)(m,k) += fQVectorKernelGF->WeightPower(k)*fQVectorKernelGF->Cos(m);
+              (*fImQGF)(m,k) += fQVectorKernelGF->WeightPower(k)*fQVectorKernelGF->Sin(m);
             }
           }
         }
@@ -1018,8 +1032,8 @@ void AliFlowAnalysisCRC::Make(AliFlowEventSimple* anEvent)
           {
             for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
             {
-              (*fReQGFPt[ptb])(m,k) += pow(wPhiEta*wPhi*wPt*wEta*wTrack,k)*TMath::Cos(m*dPhi);
-              (*fImQGFPt[ptb])(m,k) += pow(wPhiEta*wPhi*wPt*wEta*wTrack,k)*TMath::Sin(m*dPhi);
+              (*fReQGFPt[ptb])(m,k) += fQVectorKernelGF->WeightPower(k)*fQVectorKernelGF->Cos(m);
+              (*fImQGFPt[ptb])(m,k) += fQVectorKernelGF->WeightPower(k)*fQVectorKernelGF->Sin(m);
             }
           }
         }
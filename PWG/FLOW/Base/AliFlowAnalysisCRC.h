@@ -52,6 +52,7 @@ class AliFlowCommonConstants;
 class AliFlowCommonHist;
 class AliFlowCommonHistResults;
 class AliFlowVector;
+class AliFlowQVectorKernel;
 
 //==============================================================================================================
 
@@ -1279,6 +1280,8 @@ private:
   Bool_t fUse2DHistograms; // use TH2D instead of TProfile to improve numerical stability in reference flow calculation
   Bool_t fFillProfilesVsMUsingWeights; // if the width of multiplicity bin is 1, weights are not needed
   Bool_t fUseQvectorTerms; // use TH2D with separate Q-vector terms instead of TProfile to improve numerical stability in reference flow calculation
+  AliFlowQVectorKernel *fQVectorKernel; //! per-track cos((m+1)*n*phi), sin((m+1)*n*phi) and w^k for Q_{m*n,k}
+  AliFlowQVectorKernel *fQVectorKernelGF; //! per-track cos(m*phi), sin(m*phi) and w^k for the generic framework Q-vectors
 
   //  3c.) event-by-event quantities:
   TMatrixD *fReQ; //! fReQ[m][k] = sum_{i=1}^{M} w_{i}^{k} cos(m*phi_{i})
@@ -2107,7 +2110,7 @@ private:
   Bool_t fbFlagIsBadRunForC34;
   Bool_t fStoreExtraHistoForSubSampling;
 
-  ClassDef(AliFlowAnalysisCRC,74);
+  ClassDef(AliFlowAnalysisCRC,75);
 
 };
 
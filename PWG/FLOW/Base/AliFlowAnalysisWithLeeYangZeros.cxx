@@ -360,6 +360,7 @@ Bool_t AliFlowAnalysisWithLeeYangZeros::Make(AliFlowEventSimple* anEvent)
         
   //get tracks from event
   if (anEvent) {
+    anEvent->BuildColumns(); //tracks may have been modified in place since the last build
     if (fFirstRun){
       fCommonHists->FillControlHistograms(anEvent);
       FillFromFlowEvent(anEvent);
@@ -1275,13 +1276,16 @@ void AliFlowAnalysisWithLeeYangZeros::GetOutputHistograms(TList *outputListHisto
 	  cDenom = dQtheta*(TComplex::Exp(cExpo)); //BP eq 12
 	  //loop over tracks in event
 	  Int_t iNumberOfTracks = anEvent->NumberOfTracks();
+	  const Double_t* dPhiColumn = anEvent->GetPhiColumn();
+	  const Double_t* dPtColumn = anEvent->GetPtColumn();
+	  const Double_t* dEtaColumn = anEvent->GetEtaColumn();
+	  const UInt_t* tagColumn = anEvent->GetTagColumn();
 	  for (Int_t i=0;i<iNumberOfTracks;i++)  {
-	    AliFlowTrackSimple*  pTrack = anEvent->GetTrack(i);
-	    if (pTrack) {
-	      Double_t dEta = pTrack->Eta();
-	      Double_t dPt = pTrack->Pt();
-	      Double_t dPhi = pTrack->Phi();
-	      if (pTrack->InRPSelection()) { // RP selection
+	    if (!AliFlowEventSimple::IsMissingTag(tagColumn[i])) {
+	      Double_t dEta = dEtaColumn[i];
+	      Double_t dPt = dPtColumn[i];
+	      Double_t dPhi = dPhiColumn[i];
+	      if (AliFlowEventSimple::IsRPTag(tagColumn[i])) { // RP selection
 		dCosTermRP = cos(m*dOrder*(dPhi-dTheta));
 		cNumerRP = dCosTermRP*(TComplex::Exp(cExpo));
 		if (cNumerRP.Rho()==0) { cerr<<"WARNING: modulus of cNumerRP is zero in SecondFillFromFlowEvent"<<endl;}
@@ -1290,7 +1294,7 @@ void AliFlowAnalysisWithLeeYangZeros::GetOutputHistograms(TList *outputListHisto
 		  fHist2RP[theta]->Fill(dEta,dPt,cNumerRP); 
 		}
 	      }
-	      if (pTrack->InPOISelection()) { //POI selection
+	      if (AliFlowEventSimple::IsPOITag(tagColumn[i])) { //POI selection
 		dCosTermPOI = cos(m*dOrder*(dPhi-dTheta));
 		cNumerPOI = dCosTermPOI*(TComplex::Exp(cExpo));
 		if (cNumerPOI.Rho()==0) { cerr<<"WARNING: modulus of cNumerPOI is zero in SecondFillFromFlowEvent"<<endl;}
@@ -1348,21 +1352,18 @@ TComplex AliFlowAnalysisWithLeeYangZeros::GetGrtheta(AliFlowEventSimple* const a
   Double_t dWgt = 1.;
   //Double_t dWgt = 1./anEvent->GetEventNSelTracksRP(); //weight with the multiplicity
     
-  Int_t iNumberOfTracks = anEvent->NumberOfTracks();
+  const std::vector<Int_t>& rpIndices = anEvent->GetRPIndices();
+  const Double_t* dPhiColumn = anEvent->GetPhiColumn();
+  Int_t iNumberOfRPs = (Int_t)rpIndices.size();
   
-  for (Int_t i=0;i<iNumberOfTracks;i++) //loop over tracks in event
+  for (Int_t iRP=0;iRP<iNumberOfRPs;iRP++) //loop over RP tracks in event
     {
-      AliFlowTrackSimple* pTrack = anEvent->GetTrack(i) ; 
-      if (pTrack){
-	if (pTrack->InRPSelection()) {
-	  Double_t dPhi = pTrack->Phi();
-	  Double_t dGIm = aR * dWgt*cos(dOrder*(dPhi - aTheta));
-	  TComplex cGi(1., dGIm);
-	  cG *= cGi;     //product over all tracks
-	}
-      }
-      else {cerr << "no particle pointer !!!"<<endl;}
+      Double_t dPhi = dPhiColumn[rpIndices[iRP]];
+      Double_t dGIm = aR * dWgt*cos(dOrder*(dPhi - aTheta));
+      TComplex cGi(1., dGIm);
+      cG *= cGi;     //product over all tracks
     }//loop over tracks
+  for (Int_t i=0;i<anEvent->GetNumberOfMissingTracks();i++) {cerr << "no particle pointer !!!"<<endl;}
   
   return cG;
   
@@ -1390,48 +1391,50 @@ TComplex AliFlowAnalysisWithLeeYangZeros::GetDiffFlow(AliFlowEventSimple* const
   Int_t iNtheta = AliFlowLYZConstants::GetMaster()->GetNtheta();
   Double_t dTheta = ((double)theta/iNtheta)*TMath::Pi()/dOrder;
   
+  const std::vector<Int_t>& rpIndices = anEvent->GetRPIndices();
+  const Double_t* dPhiColumn = anEvent->GetPhiColumn();
+  const Double_t* dPtColumn = anEvent->GetPtColumn();
+  const Double_t* dEtaColumn = anEvent->GetEtaColumn();
+  const UInt_t* tagColumn = anEvent->GetTagColumn();
+  Int_t iNumberOfRPs = (Int_t)rpIndices.size();
+
   //for the denominator (use all RP selected particles)
-  for (Int_t i=0;i<iNumberOfTracks;i++) //loop over tracks in event
+  for (Int_t iRP=0;iRP<iNumberOfRPs;iRP++) //loop over RP tracks in event
     {
-      AliFlowTrackSimple* pTrack = anEvent->GetTrack(i) ;  
-      if (pTrack){
-	if (pTrack->InRPSelection()) {
-	  Double_t dPhi = pTrack->Phi();
-	  Double_t dCosTerm = dWgt*cos(dOrder*(dPhi - dTheta));
-	  //GetGr0theta
-	  Double_t dGIm = aR0 * dCosTerm;
-	  TComplex cGi(1., dGIm);
-	  TComplex cCosTermComplex(1., aR0*dCosTerm);
-	  cG *= cGi;     //product over all tracks
-	  //GetdGr0theta
-	  cdGr0 +=(dCosTerm / cCosTermComplex);  //sum over all tracks
-	}
-      } //if particle
-      else {cerr << "no particle!!!"<<endl;}
+      Double_t dPhi = dPhiColumn[rpIndices[iRP]];
+      Double_t dCosTerm = dWgt*cos(dOrder*(dPhi - dTheta));
+      //GetGr0theta
+      Double_t dGIm = aR0 * dCosTerm;
+      TComplex cGi(1., dGIm);
+      TComplex cCosTermComplex(1., aR0*dCosTerm);
+      cG *= cGi;     //product over all tracks
+      //GetdGr0theta
+      cdGr0 +=(dCosTerm / cCosTermComplex);  //sum over all tracks
     }//loop over tracks
+  for (Int_t i=0;i<anEvent->GetNumberOfMissingTracks();i++) {cerr << "no particle!!!"<<endl;}
   
   //for the numerator
   for (Int_t i=0;i<iNumberOfTracks;i++) 
     {
-      AliFlowTrackSimple* pTrack = anEvent->GetTrack(i) ;  
-      if (pTrack){
-	Double_t dEta = pTrack->Eta();
-	Double_t dPt = pTrack->Pt();
-	Double_t dPhi = pTrack->Phi();
-	Double_t dCosTerm = cos(dOrder*(dPhi-dTheta));
-	TComplex cCosTermComplex(1.,aR0*dCosTerm);
-	//RP selection
-	if (pTrack->InRPSelection()) {
-	  TComplex cNumerRP = cG*dCosTerm/cCosTermComplex;  //PG Eq. 9
-	  fHist2RP[theta]->Fill(dEta,dPt,cNumerRP);  
-	}
-	//POI selection
-	if (pTrack->InPOISelection()) {
-	  TComplex cNumerPOI = cG*dCosTerm/cCosTermComplex;  //PG Eq. 9
-	  fHist2POI[theta]->Fill(dEta,dPt,cNumerPOI);  
-	}
-      } //if particle
-      else {cerr << "no particle pointer!!!"<<endl;}
+      if (AliFlowEventSimple::IsMissingTag(tagColumn[i])) {cerr << "no particle pointer!!!"<<endl; continue;}
+      Bool_t bRP = AliFlowEventSimple::IsRPTag(tagColumn[i]);
+      Bool_t bPOI = AliFlowEventSimple::IsPOITag(tagColumn[i]);
+      if (!bRP && !bPOI) continue;
+      Double_t dEta = dEtaColumn[i];
+      Double_t dPt = dPtColumn[i];
+      Double_t dPhi = dPhiColumn[i];
+      Double_t dCosTerm = cos(dOrder*(dPhi-dTheta));
+      TComplex cCosTermComplex(1.,aR0*dCosTerm);
+      //RP selection
+      if (bRP) {
+	TComplex cNumerRP = cG*dCosTerm/cCosTermComplex;  //PG Eq. 9
+	fHist2RP[theta]->Fill(dEta,dPt,cNumerRP);  
+      }
+      //POI selection
+      if (bPOI) {
+	TComplex cNumerPOI = cG*dCosTerm/cCosTermComplex;  //PG Eq. 9
+	fHist2POI[theta]->Fill(dEta,dPt,cNumerPOI);  
+      }
     }//loop over tracks
   
   TComplex cDenom = cG*cdGr0;  
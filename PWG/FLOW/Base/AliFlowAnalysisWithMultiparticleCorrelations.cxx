@@ -23,6 +23,7 @@
 
 #define AliFlowAnalysisWithMultiparticleCorrelations_cxx
 
+#include <algorithm>
 #include "AliFlowAnalysisWithMultiparticleCorrelations.h"
 
 using std::endl;
@@ -64,6 +65,9 @@ AliFlowAnalysisWithMultiparticleCorrelations::AliFlowAnalysisWithMultiparticleCo
  fQvectorFlagsPro(NULL),
  fCalculateQvector(kFALSE),
  fCalculateDiffQvectors(kFALSE),
+ fQvectorKernel(NULL),
+ fUseRecursionCache(kTRUE),
+ fRecursionCache(),
  // 3.) Correlations:
  fCorrelationsList(NULL),
  fCorrelationsFlagsPro(NULL),
@@ -169,6 +173,7 @@ AliFlowAnalysisWithMultiparticleCorrelations::~AliFlowAnalysisWithMultiparticleC
  // Destructor.
  
  delete fHistList;
+ delete fQvectorKernel;
 
 } // end of AliFlowAnalysisWithMultiparticleCorrelations::~AliFlowAnalysisWithMultiparticleCorrelations()
 
@@ -1994,6 +1999,7 @@ void AliFlowAnalysisWithMultiparticleCorrelations::FillQvector(AliFlowEventSimpl
 {
  // Fill Q-vector components.
 
+ fRecursionCache.clear(); // cached correlators are valid only for the current Q-vectors
  Int_t nTracks = anEvent->NumberOfTracks(); // TBI shall I promote this to data member?
  Double_t dPhi = 0., wPhi = 1.; // azimuthal angle and corresponding phi weight
  Double_t dPt = 0., wPt = 1.; // transverse momentum and corresponding pT weight
@@ -2036,12 +2042,14 @@ void AliFlowAnalysisWithMultiparticleCorrelations::FillQvector(AliFlowEventSimpl
    if(fUseWeights[0][2]){wEta = Weight(dEta,"RP","eta");} // corresponding eta weight
 
    // Calculate Q-vector components:
+   fQvectorKernel->ComputeHarmonics(dPhi);
+   fQvectorKernel->ComputeWeightPowers(wPhi*wPt*wEta); // all powers are 1 if weights are not used
    for(Int_t h=0;h<fMaxHarmonic*fMaxCorrelator+1;h++)
    {
     for(Int_t wp=0;wp<fMaxCorrelator+1;wp++) // weight power
     {
-     if(fUseWeights[0][0]||fUseWeights[0][1]||fUseWeights[0][2]){wToPowerP = pow(wPhi*wPt*wEta,wp);} 
-     fQvector[h][wp] += TComplex(wToPowerP*TMath::Cos(h*dPhi),wToPowerP*TMath::Sin(h*dPhi));
+     wToPowerP = fQvectorKernel->WeightPower(wp);
+     fQvector[h][wp] += TComplex(wToPowerP*fQvectorKernel->Cos(h),wToPowerP*fQvectorKernel->Sin(h));
     } // for(Int_t wp=0;wp<fMaxCorrelator+1;wp++)
    } // for(Int_t h=0;h<fMaxHarmonic*fMaxCorrelator+1;h++)
   } // if(pTrack->InRPSelection()) // fill Q-vector components only with reference particles
@@ -2641,7 +2649,7 @@ void AliFlowAnalysisWithMultiparticleCorrelations::BookEverythingForQvector()
  // Book all the stuff for Q-vector.
 
  // a) Book the profile holding all the flags for Q-vector;
- // ...
+ // b) Book the kernel evaluating harmonics and weight powers per particle.
 
  // a) Book the profile holding all the flags for Q-vector:
  fQvectorFlagsPro = new TProfile("fQvectorFlagsPro","Flags for Q-vectors",2,0,2);
@@ -2656,7 +2664,9 @@ void AliFlowAnalysisWithMultiparticleCorrelations::BookEverythingForQvector()
  fQvectorFlagsPro->GetXaxis()->SetBinLabel(2,"fCalculateDiffQvectors"); fQvectorFlagsPro->Fill(1.5,fCalculateDiffQvectors); 
  fQvectorList->Add(fQvectorFlagsPro);
 
- // ...
+ // b) Book the kernel evaluating harmonics and weight powers per particle:
+ delete fQvectorKernel;
+ fQvectorKernel = new AliFlowQVectorKernel(fMaxHarmonic*fMaxCorrelator+1,fMaxCorrelator+1,0,1); // exact mode, same layout as fQvector[h][wp]
 
 } // void AliFlowAnalysisWithMultiparticleCorrelations::BookEverythingForQvector()
 
@@ -3862,6 +3872,8 @@ void AliFlowAnalysisWithMultiparticleCorrelations::ResetQvector()
 {
  // Reset all Q-vector components to zero before starting a new event. 
 
+ fRecursionCache.clear();
+
  for(Int_t h=0;h<fMaxHarmonic*fMaxCorrelator+1;h++) 
  {
   for(Int_t wp=0;wp<fMaxCorrelator+1;wp++) // weight powe
@@ -5027,6 +5039,59 @@ TComplex AliFlowAnalysisWithMultiparticleCorrelations::Recursion(Int_t n, Int_t*
  // Calculate multi-particle correlators by using recursion (an improved faster version) originally developed by 
  // Kristjan Gulbrandsen (gulbrand@nbi.dk). 
 
+ // Lower-order subterms are shared between many correlators evaluated in the same event, therefore all intermediate
+ // results are memoized in fRecursionCache, which is cleared each time the Q-vectors are refilled or reset. For the
+ // full correlators (mult = 1, skip = 0) the result is symmetric under permutation of harmonics, so the key is sorted.
+
+ ULong64_t key = 0;
+ if(!fUseRecursionCache || n<2 || !RecursionKey(n,harmonic,mult,skip,key)){return RecursionBody(n,harmonic,mult,skip);}
+
+ std::map<ULong64_t,TComplex>::const_iterator it = fRecursionCache.find(key);
+ if(it != fRecursionCache.end()){return it->second;}
+
+ TComplex c = RecursionBody(n,harmonic,mult,skip);
+ fRecursionCache.insert(std::make_pair(key,c));
+
+ return c;
+
+} // TComplex AliFlowAnalysisWithMultiparticleCorrelations::Recursion(Int_t n, Int_t* harmonic, Int_t mult, Int_t skip) 
+
+//=======================================================================================================================
+
+Bool_t AliFlowAnalysisWithMultiparticleCorrelations::RecursionKey(Int_t n, const Int_t* harmonic, Int_t mult, Int_t skip, ULong64_t &key)
+{
+ // Pack {harmonics,mult,skip} of Recursion() into a 64-bit key: 7 bits per harmonic (harmonic+64, 0 marks an unused slot),
+ // so that up to 8 harmonics in [-63,63] take 56 bits, followed by 3 bits for mult-1 and 3 bits for skip. Returns kFALSE
+ // if the arguments do not fit, the caller then evaluates without cache.
+
+ if(n<1 || n>8 || mult<1 || mult>8 || skip<0 || skip>7){return kFALSE;}
+
+ Int_t sorted[8] = {0};
+ for(Int_t i=0;i<n;i++)
+ {
+  if(harmonic[i]<-63 || harmonic[i]>63){return kFALSE;}
+  sorted[i] = harmonic[i];
+ }
+ if(1==mult && 0==skip){std::sort(sorted,sorted+n);}
+
+ key = 0;
+ for(Int_t i=0;i<n;i++)
+ {
+  key |= ((ULong64_t)(sorted[i]+64)) << (7*i);
+ }
+ key |= ((ULong64_t)(mult-1)) << 56;
+ key |= ((ULong64_t)skip) << 59;
+
+ return kTRUE;
+
+} // Bool_t AliFlowAnalysisWithMultiparticleCorrelations::RecursionKey(Int_t n, const Int_t* harmonic, Int_t mult, Int_t skip, ULong64_t &key)
+
+//=======================================================================================================================
+
+TComplex AliFlowAnalysisWithMultiparticleCorrelations::RecursionBody(Int_t n, Int_t* harmonic, Int_t mult, Int_t skip) 
+{
+ // One step of the recursion, lower-order terms are obtained via Recursion() and therefore taken from cache when possible.
+
   Int_t nm1 = n-1;
   TComplex c(Q(harmonic[nm1], mult));
   if (nm1 == 0) return c;
@@ -5057,7 +5122,7 @@ TComplex AliFlowAnalysisWithMultiparticleCorrelations::Recursion(Int_t n, Int_t*
   if (mult == 1) return c-c2;
   return c-Double_t(mult)*c2;
 
-} // TComplex AliFlowAnalysisWithMultiparticleCorrelations::Recursion(Int_t n, Int_t* harmonic, Int_t mult, Int_t skip) 
+} // TComplex AliFlowAnalysisWithMultiparticleCorrelations::RecursionBody(Int_t n, Int_t* harmonic, Int_t mult, Int_t skip) 
 
 //=======================================================================================================================
 
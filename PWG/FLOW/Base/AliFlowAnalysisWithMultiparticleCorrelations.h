@@ -15,6 +15,7 @@
 #ifndef ALIFLOWANALYSISWITHMULTIPARTICLECORRELATIONS_H
 #define ALIFLOWANALYSISWITHMULTIPARTICLECORRELATIONS_H
 
+#include <map>
 #include "TH1D.h"
 #include "TH2D.h"
 #include "TProfile.h"
@@ -30,6 +31,7 @@
 #include "TStopwatch.h"
 #include "AliFlowEventSimple.h"
 #include "AliFlowTrackSimple.h"
+#include "AliFlowQVectorKernel.h"
 
 class AliFlowAnalysisWithMultiparticleCorrelations{
  public:
@@ -160,6 +162,8 @@ class AliFlowAnalysisWithMultiparticleCorrelations{
   Bool_t GetCalculateQvector() const {return this->fCalculateQvector;};
   void SetCalculateDiffQvectors(Bool_t cdqv) {this->fCalculateDiffQvectors = cdqv;};
   Bool_t GetCalculateDiffQvectors() const {return this->fCalculateDiffQvectors;};
+  void SetUseRecursionCache(Bool_t urc) {this->fUseRecursionCache = urc;};
+  Bool_t GetUseRecursionCache() const {return this->fUseRecursionCache;};
 
   //  5.3.) Correlations:
   void SetCorrelationsList(TList* const cl) {this->fCorrelationsList = cl;};
@@ -323,6 +327,8 @@ class AliFlowAnalysisWithMultiparticleCorrelations{
   TH1D* GetHistogramWithWeights(const char *filePath, const char *listName, const char *type, const char *variable, const char *production);
   virtual Double_t CorrelationPsi2nPsi1n(Int_t n, Int_t k=0);
   Bool_t TrackIsInSpecifiedIntervals(AliFlowTrackSimple *);
+  TComplex RecursionBody(Int_t n, Int_t* harmonic, Int_t mult, Int_t skip);
+  static Bool_t RecursionKey(Int_t n, const Int_t* harmonic, Int_t mult, Int_t skip, ULong64_t &key);
 
  private:
   AliFlowAnalysisWithMultiparticleCorrelations(const AliFlowAnalysisWithMultiparticleCorrelations& afawQc);
@@ -383,6 +389,9 @@ class AliFlowAnalysisWithMultiparticleCorrelations{
   Bool_t fCalculateQvector;      // to calculate or not to calculate Q-vector components, that's a Boolean...
   TComplex fQvector[49][9];      // Q-vector components [fMaxHarmonic*fMaxCorrelator+1][fMaxCorrelator+1] = [6*8+1][8+1]  
   Bool_t fCalculateDiffQvectors; // to calculate or not to calculate p- and q-vector components, that's a Boolean...  
+  AliFlowQVectorKernel *fQvectorKernel; //! cos(h*phi), sin(h*phi) and w^p evaluated once per particle
+  Bool_t fUseRecursionCache;     // memoize subterms of Recursion() within an event 
+  std::map<ULong64_t,TComplex> fRecursionCache; //! Recursion() results for the current Q-vectors, key = RecursionKey(harmonics,mult,skip)
   TComplex fpvector[100][49][9]; // p-vector components [bin][fMaxHarmonic*fMaxCorrelator+1][fMaxCorrelator+1] = [6*8+1][8+1] TBI hardwired 100
   TComplex fqvector[100][49][9]; // q-vector components [bin][fMaxHarmonic*fMaxCorrelator+1][fMaxCorrelator+1] = [6*8+1][8+1] TBI hardwired 100
 
@@ -476,7 +485,7 @@ class AliFlowAnalysisWithMultiparticleCorrelations{
   Int_t fHighestHarmonicEtaGaps;      // 2-p correlations with eta gaps will be calculated for harmonics [fLowestHarmonicEtaGaps,fHighestHarmonicEtaGaps]
   TProfile *fEtaGapsPro[6];           // [harmonic] different eta gaps are different bins
 
-  ClassDef(AliFlowAnalysisWithMultiparticleCorrelations,6);
+  ClassDef(AliFlowAnalysisWithMultiparticleCorrelations,8);
 
 };
 
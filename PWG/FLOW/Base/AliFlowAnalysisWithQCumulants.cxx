@@ -43,6 +43,7 @@
 #include "AliFlowEventSimple.h"
 #include "AliFlowTrackSimple.h"
 #include "AliFlowAnalysisWithQCumulants.h"
+#include "AliFlowQVectorKernel.h"
 #include "TArrayD.h"
 #include "TRandom.h"
 #include "TF1.h"
@@ -134,6 +135,8 @@ AliFlowAnalysisWithQCumulants::AliFlowAnalysisWithQCumulants():
  fUse2DHistograms(kFALSE),
  fFillProfilesVsMUsingWeights(kTRUE),
  fUseQvectorTerms(kFALSE),
+ fUseQVectorRecurrence(kFALSE),
+ fQVectorKernel(NULL),
  fReQ(NULL),
  fImQ(NULL),
  fSpk(NULL),
@@ -271,6 +274,7 @@ AliFlowAnalysisWithQCumulants::~AliFlowAnalysisWithQCumulants()
  // destructor
  
  delete fHistList;
+ delete fQVectorKernel;
 
 } // end of AliFlowAnalysisWithQCumulants::~AliFlowAnalysisWithQCumulants()
 
@@ -311,6 +315,9 @@ void AliFlowAnalysisWithQCumulants::Init()
  this->BookEverythingForMixedHarmonics();
  this->BookEverythingForControlHistograms();
  this->BookEverythingForBootstrap();
+ delete fQVectorKernel;
+ fQVectorKernel = new AliFlowQVectorKernel(12,9,1,fHarmonic); // Q_{m*n,k}: m = 1,2,...,12, k = 0,1,...,8
+ fQVectorKernel->SetUseRecurrence(fUseQVectorRecurrence);
 
  // d) Store flags for integrated and differential flow:
  this->StoreIntFlowFlags();
@@ -377,21 +384,27 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
                                                                                                                                                                                                                                                                                         
  // d) Loop over data and calculate e-b-e quantities Q_{n,k}, S_{p,k} and s_{p,k}:
  Int_t nPrim = anEvent->NumberOfTracks();  // nPrim = total number of primary tracks
- AliFlowTrackSimple *aftsTrack = NULL;
- Int_t n = fHarmonic; // shortcut for the harmonic 
+ // Columnar view of the tracks (rebuilt here, tracks may have been modified in place since the last build):
+ anEvent->BuildColumns();
+ const Double_t *dPhiColumn = anEvent->GetPhiColumn();
+ const Double_t *dPtColumn = anEvent->GetPtColumn();
+ const Double_t *dEtaColumn = anEvent->GetEtaColumn();
+ const Double_t *dWeightColumn = anEvent->GetWeightColumn();
+ const UInt_t *tagColumn = anEvent->GetTagColumn();
+ fQVectorKernel->Reserve(anEvent->GetNumberOfRPs());
  for(Int_t i=0;i<nPrim;i++) 
  { 
   if(fExactNoRPs > 0 && nCounterNoRPs>fExactNoRPs){continue;}
-  aftsTrack=anEvent->GetTrack(i);
-  if(aftsTrack)
+  Bool_t bRP = AliFlowEventSimple::IsRPTag(tagColumn[i]);
+  Bool_t bPOI = AliFlowEventSimple::IsPOITag(tagColumn[i]);
+  if(bRP || bPOI) // safety measure: consider only tracks which are RPs or POIs
   {
-   if(!(aftsTrack->InRPSelection() || aftsTrack->InPOISelection())){continue;} // safety measure: consider only tracks which are RPs or POIs
-   if(aftsTrack->InRPSelection()) // RP condition:
+   if(bRP) // RP condition:
    {    
     nCounterNoRPs++;
-    dPhi = aftsTrack->Phi();
-    dPt  = aftsTrack->Pt();
-    dEta = aftsTrack->Eta();
+    dPhi = dPhiColumn[i];
+    dPt  = dPtColumn[i];
+    dEta = dEtaColumn[i];
     if(fUsePhiWeights && fPhiWeights && fnBinsPhi) // determine phi weight for this particle:
     {
      wPhi = fPhiWeights->GetBinContent(1+(Int_t)(TMath::Floor(dPhi*fnBinsPhi/TMath::TwoPi())));
@@ -407,28 +420,16 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
     // Access track weight:
     if(fUseTrackWeights)
     {
-     wTrack = aftsTrack->Weight(); 
+     wTrack = dWeightColumn[i]; 
     }
-    // Calculate Re[Q_{m*n,k}] and Im[Q_{m*n,k}] for this event (m = 1,2,...,12, k = 0,1,...,8):
-    for(Int_t m=0;m<12;m++) // to be improved - hardwired 6 
-    {
-     for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
-     {
-      (*fReQ)(m,k)+=pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1)*n*dPhi); 
-      (*fImQ)(m,k)+=pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1)*n*dPhi); 
-     } 
-    }
-    // Calculate S_{p,k} for this event (Remark: final calculation of S_{p,k} follows after the loop over data bellow):
-    for(Int_t p=0;p<8;p++)
-    {
-     for(Int_t k=0;k<9;k++)
-     {     
-      (*fSpk)(p,k)+=pow(wPhi*wPt*wEta*wTrack,k);
-     }
-    } 
+    // Buffer RP for the batched calculation of Re[Q_{m*n,k}], Im[Q_{m*n,k}] and S_{p,k} after the loop over data:
+    fQVectorKernel->Add(dPhi,wPhi*wPt*wEta*wTrack);
     // Differential flow:
     if(fCalculateDiffFlow || fCalculate2DDiffFlow)
     {
+     // cos((m+1)*n*dPhi), sin((m+1)*n*dPhi) and (w_i)^k are evaluated once for this particle:
+     fQVectorKernel->ComputeHarmonics(dPhi);
+     fQVectorKernel->ComputeWeightPowers(wPhi*wPt*wEta*wTrack);
      ptEta[0] = dPt; 
      ptEta[1] = dEta; 
      // Calculate r_{m*n,k} and s_{p,k} (r_{m,k} is 'p-vector' for RPs): 
@@ -440,27 +441,27 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
        {
         for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
         {
-         fReRPQ1dEBE[0][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-         fImRPQ1dEBE[0][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);          
+         fReRPQ1dEBE[0][pe][m][k]->Fill(ptEta[pe],fQVectorKernel->WeightPower(k)*fQVectorKernel->Cos(m),1.);
+         fImRPQ1dEBE[0][pe][m][k]->Fill(ptEta[pe],fQVectorKernel->WeightPower(k)*fQVectorKernel->Sin(m),1.);          
          if(m==0) // s_{p,k} does not depend on index m
          {
-          fs1dEBE[0][pe][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k),1.);
+          fs1dEBE[0][pe][k]->Fill(ptEta[pe],fQVectorKernel->WeightPower(k),1.);
          } // end of if(m==0) // s_{p,k} does not depend on index m
         } // end of for(Int_t pe=0;pe<2;pe++) // pt or eta
        } // end of if(fCalculateDiffFlow) 
        if(fCalculate2DDiffFlow)
        {
-        fReRPQ2dEBE[0][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-        fImRPQ2dEBE[0][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);      
+        fReRPQ2dEBE[0][m][k]->Fill(dPt,dEta,fQVectorKernel->WeightPower(k)*fQVectorKernel->Cos(m),1.);
+        fImRPQ2dEBE[0][m][k]->Fill(dPt,dEta,fQVectorKernel->WeightPower(k)*fQVectorKernel->Sin(m),1.);      
         if(m==0) // s_{p,k} does not depend on index m
         {
-         fs2dEBE[0][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k),1.);
+         fs2dEBE[0][k]->Fill(dPt,dEta,fQVectorKernel->WeightPower(k),1.);
         } // end of if(m==0) // s_{p,k} does not depend on index m
        } // end of if(fCalculate2DDiffFlow)
       } // end of for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
      } // end of for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
      // Checking if RP particle is also POI particle:      
-     if(aftsTrack->InPOISelection())
+     if(bPOI)
      {
       // Calculate q_{m*n,k} and s_{p,k} ('q-vector' and 's' for RPs && POIs): 
       for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
@@ -471,56 +472,59 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
         {
          for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
          {
-          fReRPQ1dEBE[2][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-          fImRPQ1dEBE[2][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);          
+          fReRPQ1dEBE[2][pe][m][k]->Fill(ptEta[pe],fQVectorKernel->WeightPower(k)*fQVectorKernel->Cos(m),1.);
+          fImRPQ1dEBE[2][pe][m][k]->Fill(ptEta[pe],fQVectorKernel->WeightPower(k)*fQVectorKernel->Sin(m),1.);          
           if(m==0) // s_{p,k} does not depend on index m
           {
-           fs1dEBE[2][pe][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k),1.);
+           fs1dEBE[2][pe][k]->Fill(ptEta[pe],fQVectorKernel->WeightPower(k),1.);
           } // end of if(m==0) // s_{p,k} does not depend on index m
          } // end of for(Int_t pe=0;pe<2;pe++) // pt or eta
         } // end of if(fCalculateDiffFlow) 
         if(fCalculate2DDiffFlow)
         {
-         fReRPQ2dEBE[2][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-         fImRPQ2dEBE[2][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);      
+         fReRPQ2dEBE[2][m][k]->Fill(dPt,dEta,fQVectorKernel->WeightPower(k)*fQVectorKernel->Cos(m),1.);
+         fImRPQ2dEBE[2][m][k]->Fill(dPt,dEta,fQVectorKernel->WeightPower(k)*fQVectorKernel->Sin(m),1.);      
          if(m==0) // s_{p,k} does not depend on index m
          {
-          fs2dEBE[2][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k),1.);
+          fs2dEBE[2][k]->Fill(dPt,dEta,fQVectorKernel->WeightPower(k),1.);
          } // end of if(m==0) // s_{p,k} does not depend on index m
         } // end of if(fCalculate2DDiffFlow)
        } // end of for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
       } // end of for(Int_t k=0;k<9;k++) // to be improved - hardwired 9    
-     } // end of if(aftsTrack->InPOISelection())  
+     } // end of if(bPOI)  
     } // end of if(fCalculateDiffFlow || fCalculate2DDiffFlow)         
    } // end of if(pTrack->InRPSelection())
-   if(aftsTrack->InPOISelection())
+   if(bPOI)
    {
-    dPhi = aftsTrack->Phi();
-    dPt  = aftsTrack->Pt();
-    dEta = aftsTrack->Eta();
+    dPhi = dPhiColumn[i];
+    dPt  = dPtColumn[i];
+    dEta = dEtaColumn[i];
     wPhi = 1.;
     wPt  = 1.;
     wEta = 1.;
     wTrack = 1.;
-    if(fUsePhiWeights && fPhiWeights && fnBinsPhi && aftsTrack->InRPSelection()) // determine phi weight for POI && RP particle:
+    if(fUsePhiWeights && fPhiWeights && fnBinsPhi && bRP) // determine phi weight for POI && RP particle:
     {
      wPhi = fPhiWeights->GetBinContent(1+(Int_t)(TMath::Floor(dPhi*fnBinsPhi/TMath::TwoPi())));
     }
-    if(fUsePtWeights && fPtWeights && fnBinsPt && aftsTrack->InRPSelection()) // determine pt weight for POI && RP particle:
+    if(fUsePtWeights && fPtWeights && fnBinsPt && bRP) // determine pt weight for POI && RP particle:
     {
      wPt = fPtWeights->GetBinContent(1+(Int_t)(TMath::Floor((dPt-fPtMin)/fPtBinWidth))); 
     }              
-    if(fUseEtaWeights && fEtaWeights && fEtaBinWidth && aftsTrack->InRPSelection()) // determine eta weight for POI && RP particle: 
+    if(fUseEtaWeights && fEtaWeights && fEtaBinWidth && bRP) // determine eta weight for POI && RP particle: 
     {
      wEta = fEtaWeights->GetBinContent(1+(Int_t)(TMath::Floor((dEta-fEtaMin)/fEtaBinWidth))); 
     }      
     // Access track weight for POI && RP particle:
-    if(aftsTrack->InRPSelection() && fUseTrackWeights)
+    if(bRP && fUseTrackWeights)
     {
-     wTrack = aftsTrack->Weight(); 
+     wTrack = dWeightColumn[i]; 
     }
     ptEta[0] = dPt;
     ptEta[1] = dEta;
+    if(!(fCalculateDiffFlow || fCalculate2DDiffFlow)){continue;}
+    fQVectorKernel->ComputeHarmonics(dPhi);
+    fQVectorKernel->ComputeWeightPowers(wPhi*wPt*wEta*wTrack);
     // Calculate p_{m*n,k} ('p-vector' for POIs): 
     for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
     {
@@ -530,24 +534,36 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
       {
        for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
        {
-        fReRPQ1dEBE[1][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-        fImRPQ1dEBE[1][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);          
+        fReRPQ1dEBE[1][pe][m][k]->Fill(ptEta[pe],fQVectorKernel->WeightPower(k)*fQVectorKernel->Cos(m),1.);
+        fImRPQ1dEBE[1][pe][m][k]->Fill(ptEta[pe],fQVectorKernel->WeightPower(k)*fQVectorKernel->Sin(m),1.);          
        } // end of for(Int_t pe=0;pe<2;pe++) // pt or eta
       } // end of if(fCalculateDiffFlow) 
       if(fCalculate2DDiffFlow)
       {
-       fReRPQ2dEBE[1][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-       fImRPQ2dEBE[1][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);      
+       fReRPQ2dEBE[1][m][k]->Fill(dPt,dEta,fQVectorKernel->WeightPower(k)*fQVectorKernel->Cos(m),1.);
+       fImRPQ2dEBE[1][m][k]->Fill(dPt,dEta,fQVectorKernel->WeightPower(k)*fQVectorKernel->Sin(m),1.);      
       } // end of if(fCalculate2DDiffFlow)
      } // end of for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
     } // end of for(Int_t k=0;k<9;k++) // to be improved - hardwired 9    
    } // end of if(pTrack->InPOISelection())    
-  } else // to if(aftsTrack)
+  } else if(AliFlowEventSimple::IsMissingTag(tagColumn[i]))
     {
      printf("\n WARNING (QC): No particle (i.e. aftsTrack is a NULL pointer in AFAWQC::Make())!!!!\n\n");
-    }
+    } // end of if(bRP || bPOI)
  } // end of for(Int_t i=0;i<nPrim;i++) 
 
+ // Calculate Re[Q_{m*n,k}], Im[Q_{m*n,k}] (m = 1,2,...,12, k = 0,1,...,8) and S_{p,k} for all buffered RPs in one go
+ // (Remark: final calculation of S_{p,k} follows bellow):
+ Double_t dSumOfWeightPowers[9] = {0.};
+ fQVectorKernel->Accumulate(fReQ->GetMatrixArray(),fImQ->GetMatrixArray(),fReQ->GetNcols(),dSumOfWeightPowers);
+ for(Int_t p=0;p<8;p++)
+ {
+  for(Int_t k=0;k<9;k++)
+  {
+   (*fSpk)(p,k)+=dSumOfWeightPowers[k]; // S_{p,k} before raising to power p+1 does not depend on p
+  }
+ }
+
  // e) Calculate the final expressions for S_{p,k} and s_{p,k} (important !!!!):
  for(Int_t p=0;p<8;p++)
  {
@@ -31,6 +31,7 @@ class TDirectoryFile;
 
 class AliFlowEventSimple;
 class AliFlowVector;
+class AliFlowQVectorKernel;
 
 class AliFlowCommonHist;
 class AliFlowCommonHistResults;
@@ -287,6 +288,8 @@ class AliFlowAnalysisWithQCumulants{
   Bool_t GetFillProfilesVsMUsingWeights() const {return this->fFillProfilesVsMUsingWeights;};
   void SetUseQvectorTerms(Bool_t const uqvt){this->fUseQvectorTerms = uqvt;if(uqvt){this->fStoreControlHistograms = kTRUE;}};
   Bool_t GetUseQvectorTerms() const {return this->fUseQvectorTerms;};
+  void SetUseQVectorRecurrence(Bool_t const uqvr) {this->fUseQVectorRecurrence = uqvr;};
+  Bool_t GetUseQVectorRecurrence() const {return this->fUseQVectorRecurrence;};
 
   // Reference flow profiles:
   void SetAvMultiplicity(TProfile* const avMultiplicity) {this->fAvMultiplicity = avMultiplicity;};
@@ -627,6 +630,8 @@ class AliFlowAnalysisWithQCumulants{
   Bool_t fUse2DHistograms; // use TH2D instead of TProfile to improve numerical stability in reference flow calculation 
   Bool_t fFillProfilesVsMUsingWeights; // if the width of multiplicity bin is 1, weights are not needed  
   Bool_t fUseQvectorTerms; // use TH2D with separate Q-vector terms instead of TProfile to improve numerical stability in reference flow calculation 
+  Bool_t fUseQVectorRecurrence; // build Q-vectors with the complex recurrence instead of TMath::Cos/Sin (faster, equal up to rounding)
+  AliFlowQVectorKernel *fQVectorKernel; //! batched kernel for Q_{m*n,k}, S_{p,k} and the per-track harmonics used in differential flow
 
   //  3c.) event-by-event quantities:
   TMatrixD *fReQ; //! fReQ[m][k] = sum_{i=1}^{M} w_{i}^{k} cos(m*phi_{i})
@@ -847,7 +852,7 @@ class AliFlowAnalysisWithQCumulants{
   TH2D *fBootstrapCumulants; // x-axis => QC{2}, QC{4}, QC{6}, QC{8}; y-axis => subsample # 
   TH2D *fBootstrapCumulantsVsM[4]; // index => QC{2}, QC{4}, QC{6}, QC{8}; x-axis => multiplicity; y-axis => subsample # 
 
-  ClassDef(AliFlowAnalysisWithQCumulants, 4);
+  ClassDef(AliFlowAnalysisWithQCumulants, 5);
 
 };
 
@@ -374,12 +374,22 @@ void AliFlowAnalysisWithScalarProduct::Make(AliFlowEventSimple* anEvent) {
   //loop over the tracks of the event
   AliFlowTrackSimple*   pTrack = NULL; 
   Int_t iNumberOfTracks = anEvent->NumberOfTracks(); 
+  anEvent->BuildColumns(); //tracks may have been modified in place since the last build
+  const Double_t* dPhiColumn = anEvent->GetPhiColumn();
+  const Double_t* dPtColumn = anEvent->GetPtColumn();
+  const Double_t* dEtaColumn = anEvent->GetEtaColumn();
+  const Double_t* dWeightColumn = anEvent->GetWeightColumn();
+  const UInt_t* tagColumn = anEvent->GetTagColumn();
   for (Int_t i=0;i<iNumberOfTracks;i++) {
+    Bool_t bRP = AliFlowEventSimple::IsRPTag(tagColumn[i]);
+    Bool_t bPOI = AliFlowEventSimple::IsPOITag(tagColumn[i],fPOItype);
+    //with minimal booking nothing is filled for tracks which are neither RP nor POI
+    if (fMinimalBook && !bRP && !bPOI) continue;
     pTrack = anEvent->GetTrack(i) ; 
     if (!pTrack) continue;
-    Double_t dPhi = pTrack->Phi();
-    Double_t dPt  = pTrack->Pt();
-    Double_t dEta = pTrack->Eta();
+    Double_t dPhi = dPhiColumn[i];
+    Double_t dPt  = dPtColumn[i];
+    Double_t dEta = dEtaColumn[i];
 
     //calculate vU
     TVector2 vU;
@@ -432,7 +442,7 @@ void AliFlowAnalysisWithScalarProduct::Make(AliFlowEventSimple* anEvent) {
         fHistNumberOfSubtractedDaughters->Fill(numberOfsubtractedDaughters);
       }
 
-      dMq = dMq-dW*pTrack->Weight();
+      dMq = dMq-dW*dWeightColumn[i];
     }
     dNq = fNormalizationType ? dMq : vQm.Mod();
     dWq = fNormalizationType ? dMq : 1;
@@ -455,9 +465,9 @@ void AliFlowAnalysisWithScalarProduct::Make(AliFlowEventSimple* anEvent) {
 
     //fill the profile histograms
     for(Int_t iPOI=0; iPOI!=2; ++iPOI) {
-      if( (iPOI==0)&&(!pTrack->InRPSelection()) )
+      if( (iPOI==0)&&(!bRP) )
         continue;
-      if( (iPOI==1)&&(!pTrack->InPOISelection(fPOItype)) )
+      if( (iPOI==1)&&(!bPOI) )
         continue;
       fHistProUQ[iPOI][0]->Fill(dPt ,dUQ/dNq,dWq); //Fill (uQ/Nq') with weight (Nq')
       fHistProUQ[iPOI][1]->Fill(dEta,dUQ/dNq,dWq); //Fill (uQ/Nq') with weight (Nq')
@@ -87,6 +87,16 @@ AliFlowEventSimple::AliFlowEventSimple():
   fZPCM(0.),
   fZPAM(0.),
   fAbsOrbit(0),
+  fColumnsValid(kFALSE),
+  fColumnPhi(),
+  fColumnPt(),
+  fColumnEta(),
+  fColumnWeight(),
+  fColumnCharge(),
+  fColumnTag(),
+  fRPIndices(),
+  fPOIIndices(),
+  fNumberOfMissingTracks(0),
   fNumberOfPOItypes(2),
   fNumberOfPOIs(NULL)
 {
@@ -146,6 +156,16 @@ AliFlowEventSimple::AliFlowEventSimple( Int_t n,
   fZPCM(0.),
   fZPAM(0.),
   fAbsOrbit(0),
+  fColumnsValid(kFALSE),
+  fColumnPhi(),
+  fColumnPt(),
+  fColumnEta(),
+  fColumnWeight(),
+  fColumnCharge(),
+  fColumnTag(),
+  fRPIndices(),
+  fPOIIndices(),
+  fNumberOfMissingTracks(0),
   fNumberOfPOItypes(2),
   fNumberOfPOIs(new Int_t[fNumberOfPOItypes])
 {
@@ -209,6 +229,16 @@ AliFlowEventSimple::AliFlowEventSimple(const AliFlowEventSimple& anEvent):
   fZPCM(anEvent.fZPCM),
   fZPAM(anEvent.fZPAM),
   fAbsOrbit(anEvent.fAbsOrbit),
+  fColumnsValid(kFALSE),
+  fColumnPhi(),
+  fColumnPt(),
+  fColumnEta(),
+  fColumnWeight(),
+  fColumnCharge(),
+  fColumnTag(),
+  fRPIndices(),
+  fPOIIndices(),
+  fNumberOfMissingTracks(0),
   fNumberOfPOItypes(anEvent.fNumberOfPOItypes),
   fNumberOfPOIs(new Int_t[fNumberOfPOItypes])
 {
@@ -238,6 +268,7 @@ void AliFlowEventSimple::SetNumberOfPOIs( Int_t numberOfPOIs, Int_t poiType)
     delete [] fNumberOfPOIs;
     fNumberOfPOIs = tmp;
     fNumberOfPOItypes = n;
+    fColumnsValid = kFALSE;
   }
 
   fNumberOfPOIs[poiType] = numberOfPOIs;
@@ -298,6 +329,7 @@ AliFlowEventSimple& AliFlowEventSimple::operator=(const AliFlowEventSimple& anEv
   fZPCM = anEvent.fZPCM;
   fZPAM = anEvent.fZPAM;
   fAbsOrbit = anEvent.fAbsOrbit;
+  fColumnsValid = kFALSE;
   for(Int_t i(0); i < 3; i++) {
     fVtxPos[i] = anEvent.fVtxPos[i];
   }
@@ -441,6 +473,7 @@ void AliFlowEventSimple::ShuffleTracks()
   }
   //shuffle
   std::random_shuffle(&fShuffledIndexes[0], &fShuffledIndexes[fNumberOfTracks]);
+  fColumnsValid = kFALSE;
   Printf("Tracks shuffled! tracks: %i",fNumberOfTracks);
 }
 
@@ -467,6 +500,7 @@ void AliFlowEventSimple::TrackAdded()
 {
   //book keeping after a new track has been added
   fNumberOfTracks++;
+  fColumnsValid = kFALSE;
   if (fShuffledIndexes)
   {
     delete [] fShuffledIndexes;
@@ -485,6 +519,49 @@ AliFlowTrackSimple* AliFlowEventSimple::MakeNewTrack()
    return t;
 }
 
+//-----------------------------------------------------------------------
+void AliFlowEventSimple::BuildColumns()
+{
+  //fill the columnar view of the tracks: contiguous kinematics, weights, charges
+  //and flow tags, in the same order as GetTrack(i), plus the RP and POI index lists
+  fColumnPhi.resize(fNumberOfTracks);
+  fColumnPt.resize(fNumberOfTracks);
+  fColumnEta.resize(fNumberOfTracks);
+  fColumnWeight.resize(fNumberOfTracks);
+  fColumnCharge.resize(fNumberOfTracks);
+  fColumnTag.resize(fNumberOfTracks);
+  fRPIndices.clear();
+  fPOIIndices.clear();
+  fNumberOfMissingTracks = 0;
+  for (Int_t i=0; i<fNumberOfTracks; i++)
+  {
+    AliFlowTrackSimple* track = GetTrack(i);
+    if (!track)
+    {
+      fColumnPhi[i] = 0.; fColumnPt[i] = 0.; fColumnEta[i] = 0.;
+      fColumnWeight[i] = 0.; fColumnCharge[i] = 0; fColumnTag[i] = (1u<<kMissingTrackBit);
+      fNumberOfMissingTracks++;
+      continue;
+    }
+    fColumnPhi[i] = track->Phi();
+    fColumnPt[i] = track->Pt();
+    fColumnEta[i] = track->Eta();
+    fColumnWeight[i] = track->Weight();
+    fColumnCharge[i] = track->Charge();
+    UInt_t tag = 0;
+    if (track->InRPSelection()) tag |= 1u;
+    //all POI types the tag can hold, the number of POI types of the event may still grow
+    for (Int_t j=1; j<kMissingTrackBit; j++)
+    {
+      if (track->InPOISelection(j)) tag |= (1u<<j);
+    }
+    fColumnTag[i] = tag;
+    if (IsRPTag(tag)) fRPIndices.push_back(i);
+    if (IsPOITag(tag)) fPOIIndices.push_back(i);
+  }
+  fColumnsValid = kTRUE;
+}
+
 //-----------------------------------------------------------------------
 AliFlowVector AliFlowEventSimple::GetQ( Int_t n,
                                         TList *weightsList,
@@ -893,6 +970,16 @@ AliFlowEventSimple::AliFlowEventSimple( TTree* inputTree,
   fZPCM(0.),
   fZPAM(0.),
   fAbsOrbit(0),
+  fColumnsValid(kFALSE),
+  fColumnPhi(),
+  fColumnPt(),
+  fColumnEta(),
+  fColumnWeight(),
+  fColumnCharge(),
+  fColumnTag(),
+  fRPIndices(),
+  fPOIIndices(),
+  fNumberOfMissingTracks(0),
   fNumberOfPOItypes(2),
   fNumberOfPOIs(new Int_t[fNumberOfPOItypes])
 {
@@ -989,6 +1076,7 @@ void AliFlowEventSimple::TagSubeventsInEta( Double_t etaMinA,
                                             Double_t etaMaxB )
 {
   //Flag two subevents in given eta ranges
+  fColumnsValid = kFALSE;
   for (Int_t i=0; i<fNumberOfTracks; i++)
   {
     AliFlowTrackSimple* track = static_cast<AliFlowTrackSimple*>(fTrackCollection->At(i));
@@ -1004,6 +1092,7 @@ void AliFlowEventSimple::TagSubeventsInEta( Double_t etaMinA,
 void AliFlowEventSimple::TagSubeventsByCharge()
 {
   //Flag two subevents in given eta ranges
+  fColumnsValid = kFALSE;
   for (Int_t i=0; i<fNumberOfTracks; i++)
   {
     AliFlowTrackSimple* track = static_cast<AliFlowTrackSimple*>(fTrackCollection->At(i));
@@ -1157,6 +1246,7 @@ void AliFlowEventSimple::AddV2( TF2* ptEtaDepV2 )
 void AliFlowEventSimple::TagRP( const AliFlowTrackSimpleCuts* cuts )
 {
   //tag tracks as reference particles (RPs)
+  fColumnsValid = kFALSE;
   for (Int_t i=0; i<fNumberOfTracks; i++)
   {
     AliFlowTrackSimple* track = static_cast<AliFlowTrackSimple*>(fTrackCollection->At(i));
@@ -1179,6 +1269,7 @@ void AliFlowEventSimple::TagRP( const AliFlowTrackSimpleCuts* cuts )
 void AliFlowEventSimple::TagPOI( const AliFlowTrackSimpleCuts* cuts, Int_t poiType )
 {
   //tag tracks as particles of interest (POIs)
+  fColumnsValid = kFALSE;
   for (Int_t i=0; i<fNumberOfTracks; i++)
   {
     AliFlowTrackSimple* track = static_cast<AliFlowTrackSimple*>(fTrackCollection->At(i));
@@ -1212,6 +1303,7 @@ void AliFlowEventSimple::DefineDeadZone( Double_t etaMin,
 {
   //mark tracks in given eta-phi region as dead
   //by resetting the flow bits
+  fColumnsValid = kFALSE;
   for (Int_t i=0; i<fNumberOfTracks; i++)
   {
     AliFlowTrackSimple* track = static_cast<AliFlowTrackSimple*>(fTrackCollection->At(i));
@@ -1244,6 +1336,7 @@ Int_t AliFlowEventSimple::CleanUpDeadTracks()
   fTrackCollection->Compress(); //clean up empty slots
   fNumberOfTracks-=ncleaned; //update number of tracks
   delete [] fShuffledIndexes; fShuffledIndexes=NULL;
+  fColumnsValid = kFALSE;
   return ncleaned;
 }
 
@@ -1283,4 +1376,5 @@ void AliFlowEventSimple::ClearFast()
   fAfterBurnerPrecision = 0.001;
   fUserModified = kFALSE;
   delete [] fShuffledIndexes; fShuffledIndexes=NULL;
+  fColumnsValid = kFALSE;
 }
@@ -16,6 +16,7 @@
 #ifndef ALIFLOWEVENTSIMPLE_H
 #define ALIFLOWEVENTSIMPLE_H
 
+#include <vector>
 #include "TObject.h"
 #include "TParameter.h"
 #include "TMath.h"
@@ -82,7 +83,7 @@ class AliFlowEventSimple: public TObject {
   Bool_t   IsSetMCReactionPlaneAngle() const        { return fMCReactionPlaneAngleIsSet; }
   void     SetAfterBurnerPrecision(Double_t p)      { fAfterBurnerPrecision=p; }
   Double_t GetAfterBurnerPrecision() const          { return fAfterBurnerPrecision; }
-  void     SetUserModified(Bool_t s=kTRUE)          { fUserModified=s; }
+  void     SetUserModified(Bool_t s=kTRUE)          { fUserModified=s; if (s) fColumnsValid=kFALSE; }
   Bool_t   IsUserModified() const                   { return fUserModified; }
   void     SetShuffleTracks(Bool_t b)               {fShuffleTracks=b;}
   void     ShuffleTracks();
@@ -117,6 +118,28 @@ class AliFlowEventSimple: public TObject {
   void TrackAdded();
   AliFlowTrackSimple* MakeNewTrack();
 
+  // columnar (structure-of-arrays) view of the tracks, entry i corresponds to GetTrack(i);
+  // built on first access and invalidated by all methods of this class which change tracks.
+  // Tracks obtained with GetTrack() can be modified in place by the caller, therefore the
+  // analyses call BuildColumns() at the start of Make() before reading the columns;
+  // other users call InvalidateColumns() after such modifications
+  enum { kMissingTrackBit = 31 };
+  void BuildColumns();
+  void InvalidateColumns()                          { fColumnsValid = kFALSE; }
+  Bool_t ColumnsValid() const                       { return fColumnsValid; }
+  const Double_t* GetPhiColumn()                    { if (!fColumnsValid) BuildColumns(); return fColumnPhi.data(); }
+  const Double_t* GetPtColumn()                     { if (!fColumnsValid) BuildColumns(); return fColumnPt.data(); }
+  const Double_t* GetEtaColumn()                    { if (!fColumnsValid) BuildColumns(); return fColumnEta.data(); }
+  const Double_t* GetWeightColumn()                 { if (!fColumnsValid) BuildColumns(); return fColumnWeight.data(); }
+  const Int_t*    GetChargeColumn()                 { if (!fColumnsValid) BuildColumns(); return fColumnCharge.data(); }
+  const UInt_t*   GetTagColumn()                    { if (!fColumnsValid) BuildColumns(); return fColumnTag.data(); }
+  const std::vector<Int_t>& GetRPIndices()          { if (!fColumnsValid) BuildColumns(); return fRPIndices; }
+  const std::vector<Int_t>& GetPOIIndices()         { if (!fColumnsValid) BuildColumns(); return fPOIIndices; }
+  Int_t GetNumberOfMissingTracks()                 { if (!fColumnsValid) BuildColumns(); return fNumberOfMissingTracks; }
+  static Bool_t IsRPTag(UInt_t tag)                 { return (tag&1u); }
+  static Bool_t IsPOITag(UInt_t tag, Int_t poiType=1) { return (poiType<kMissingTrackBit)&&((tag>>poiType)&1u); }
+  static Bool_t IsMissingTag(UInt_t tag)            { return ((tag>>kMissingTrackBit)&1u); }
+
   virtual AliFlowVector GetQ(Int_t n=2, TList *weightsList=NULL, Bool_t usePhiWeights=kFALSE, Bool_t usePtWeights=kFALSE, Bool_t useEtaWeights=kFALSE);
   virtual void Get2Qsub(AliFlowVector* Qarray, Int_t n=2, TList *weightsList=NULL, Bool_t usePhiWeights=kFALSE, Bool_t usePtWeights=kFALSE, Bool_t useEtaWeights=kFALSE);
   virtual void GetZDC2Qsub(AliFlowVector* Qarray);
@@ -204,12 +227,22 @@ class AliFlowEventSimple: public TObject {
   Double_t                fZPAM;                      // total energy from ZPC-A
   Double_t                fVtxPos[3];                 // Primary vertex position (x,y,z)
   UInt_t                  fAbsOrbit;                  // Absolute orbit number
+  Bool_t                  fColumnsValid;              //! are the columns below in sync with the track collection?
+  std::vector<Double_t>   fColumnPhi;                 //! azimuthal angle of track i
+  std::vector<Double_t>   fColumnPt;                  //! transverse momentum of track i
+  std::vector<Double_t>   fColumnEta;                 //! pseudorapidity of track i
+  std::vector<Double_t>   fColumnWeight;              //! weight of track i
+  std::vector<Int_t>      fColumnCharge;              //! charge of track i
+  std::vector<UInt_t>     fColumnTag;                 //! bit j set if track i is of POI type j (bit 0 = RP), only bit kMissingTrackBit for missing tracks
+  std::vector<Int_t>      fRPIndices;                 //! indices i of the RPs
+  std::vector<Int_t>      fPOIIndices;                //! indices i of the POIs (type 1)
+  Int_t                   fNumberOfMissingTracks;     //! number of NULL entries in the track collection
 
  private:
   Int_t                   fNumberOfPOItypes;    // how many different flow particle types do we have? (RP,POI,POI_2,...)
   Int_t*                  fNumberOfPOIs;          //[fNumberOfPOItypes] number of tracks that have passed the POI selection
 
-  ClassDef(AliFlowEventSimple,7)
+  ClassDef(AliFlowEventSimple,8)
 };
 
 #endif
@@ -0,0 +1,298 @@
+/*************************************************************************
+* Copyright(c) 1998-2008, ALICE Experiment at CERN, All rights reserved. *
+*                                                                        *
+* Author: The ALICE Off-line Project.                                    *
+* Contributors are mentioned in the code where appropriate.              *
+*                                                                        *
+* Permission to use, copy, modify and distribute this software and its   *
+* documentation strictly for non-commercial purposes is hereby granted   *
+* without fee, provided that the above copyright notice appears in all   *
+* copies and that both the copyright notice and this permission notice   *
+* appear in the supporting documentation. The authors make no claims     *
+* about the suitability of this software for any purpose. It is          *
+* provided "as is" without express or implied warranty.                  *
+**************************************************************************/
+
+/************************************************************
+ * Batched kernel for weighted Q-vectors                    *
+ *   Q_{h,k} = sum_{i} w_{i}^{k} exp(i*(h0+h)*n*phi_{i})    *
+ * shared by Q-cumulants, CRC and generic framework (MPC)   *
+ *                                                          *
+ * Two modes are provided:                                  *
+ *  - exact (default): each harmonic is evaluated with      *
+ *    TMath::Cos/Sin and each weight power with pow, in the *
+ *    same order as the original nested loops, so that the  *
+ *    results are bit-for-bit identical. Trigonometry and   *
+ *    pow are however evaluated only once per track and not *
+ *    once per (harmonic, power) pair;                      *
+ *  - recurrence: cos/sin of higher harmonics are obtained  *
+ *    with the complex recurrence                           *
+ *      e^{i(h+1)x} = e^{ihx} * e^{ix},                     *
+ *    weight powers by repeated multiplication, and tracks  *
+ *    are accumulated into fgkLanes independent partial     *
+ *    sums which the compiler maps onto SIMD registers.     *
+ *    Results agree with the exact mode up to rounding.     *
+ ************************************************************/
+
+#include <algorithm>
+#include "AliFlowQVectorKernel.h"
+#include "TMath.h"
+
+//================================================================================================================
+
+AliFlowQVectorKernel::AliFlowQVectorKernel(Int_t nHarmonics, Int_t nPowers, Int_t firstHarmonic, Int_t harmonic):
+ fNHarmonics(0),
+ fNPowers(0),
+ fFirstHarmonic(0),
+ fHarmonic(0),
+ fUseRecurrence(kFALSE),
+ fCos(),
+ fSin(),
+ fWeightPower(),
+ fPhi(),
+ fWeight(),
+ fLanePower(),
+ fLaneRe(),
+ fLaneIm(),
+ fLaneS()
+{
+ // constructor
+
+ this->Configure(nHarmonics,nPowers,firstHarmonic,harmonic);
+
+} // end of constructor
+
+//================================================================================================================
+
+AliFlowQVectorKernel::~AliFlowQVectorKernel()
+{
+ // destructor
+
+} // end of AliFlowQVectorKernel::~AliFlowQVectorKernel()
+
+//================================================================================================================
+
+void AliFlowQVectorKernel::Configure(Int_t nHarmonics, Int_t nPowers, Int_t firstHarmonic, Int_t harmonic)
+{
+ // Set the dimensions of the Q-vector array and (re)allocate all internal buffers.
+
+ fNHarmonics = nHarmonics;
+ fNPowers = nPowers;
+ fFirstHarmonic = firstHarmonic;
+ fHarmonic = harmonic;
+
+ fCos.assign(fNHarmonics,0.);
+ fSin.assign(fNHarmonics,0.);
+ fWeightPower.assign(fNPowers,0.);
+ fLanePower.assign(fNPowers*fgkLanes,0.);
+ fLaneRe.assign(fNHarmonics*fNPowers*fgkLanes,0.);
+ fLaneIm.assign(fNHarmonics*fNPowers*fgkLanes,0.);
+ fLaneS.assign(fNPowers*fgkLanes,0.);
+
+} // end of void AliFlowQVectorKernel::Configure(Int_t nHarmonics, Int_t nPowers, Int_t firstHarmonic, Int_t harmonic)
+
+//================================================================================================================
+
+void AliFlowQVectorKernel::ComputeHarmonics(Double_t phi)
+{
+ // Fill fCos[h] = cos((h0+h)*n*phi) and fSin[h] = sin((h0+h)*n*phi) for one track.
+
+ if(!fUseRecurrence)
+ {
+  for(Int_t h=0;h<fNHarmonics;h++)
+  {
+   fCos[h] = TMath::Cos((fFirstHarmonic+h)*fHarmonic*phi);
+   fSin[h] = TMath::Sin((fFirstHarmonic+h)*fHarmonic*phi);
+  }
+  return;
+ }
+
+ Double_t c1 = TMath::Cos(fHarmonic*phi);
+ Double_t s1 = TMath::Sin(fHarmonic*phi);
+ Double_t c = TMath::Cos(fFirstHarmonic*fHarmonic*phi);
+ Double_t s = TMath::Sin(fFirstHarmonic*fHarmonic*phi);
+ for(Int_t h=0;h<fNHarmonics;h++)
+ {
+  fCos[h] = c;
+  fSin[h] = s;
+  Double_t cNext = c*c1-s*s1;
+  s = s*c1+c*s1;
+  c = cNext;
+ }
+
+} // end of void AliFlowQVectorKernel::ComputeHarmonics(Double_t phi)
+
+//================================================================================================================
+
+void AliFlowQVectorKernel::ComputeWeightPowers(Double_t w)
+{
+ // Fill fWeightPower[k] = w^k for one track.
+
+ if(!fUseRecurrence)
+ {
+  for(Int_t k=0;k<fNPowers;k++)
+  {
+   fWeightPower[k] = pow(w,k);
+  }
+  return;
+ }
+
+ Double_t wToPowerK = 1.;
+ for(Int_t k=0;k<fNPowers;k++)
+ {
+  fWeightPower[k] = wToPowerK;
+  wToPowerK *= w;
+ }
+
+} // end of void AliFlowQVectorKernel::ComputeWeightPowers(Double_t w)
+
+//================================================================================================================
+
+void AliFlowQVectorKernel::Accumulate(Double_t *re, Double_t *im, Int_t ld, Double_t *sumOfWeightPowers)
+{
+ // Accumulate all tracks buffered with Add(phi,w) and clear the buffer.
+
+ this->Accumulate(this->GetN(),fPhi.data(),fWeight.data(),re,im,ld,sumOfWeightPowers);
+ this->Clear();
+
+} // end of void AliFlowQVectorKernel::Accumulate(Double_t *re, Double_t *im, Int_t ld, Double_t *sumOfWeightPowers)
+
+//================================================================================================================
+
+void AliFlowQVectorKernel::Accumulate(Int_t n, const Double_t *phi, const Double_t *w, Double_t *re, Double_t *im, Int_t ld, Double_t *sumOfWeightPowers)
+{
+ // Accumulate re[h*ld+k] += w_i^k cos((h0+h)*n*phi_i) and im[h*ld+k] += w_i^k sin((h0+h)*n*phi_i) over
+ // n tracks given in SoA form. If sumOfWeightPowers is not NULL, also sumOfWeightPowers[k] += w_i^k.
+ // The row-major layout with leading dimension ld matches TMatrixD::GetMatrixArray().
+
+ if(n<=0){return;}
+ if(!fUseRecurrence)
+ {
+  this->AccumulateExact(n,phi,w,re,im,ld,sumOfWeightPowers);
+ } else
+   {
+    this->AccumulateRecurrence(n,phi,w,re,im,ld,sumOfWeightPowers);
+   }
+
+} // end of void AliFlowQVectorKernel::Accumulate(...)
+
+//================================================================================================================
+
+void AliFlowQVectorKernel::AccumulateExact(Int_t n, const Double_t *phi, const Double_t *w, Double_t *re, Double_t *im, Int_t ld, Double_t *sumOfWeightPowers)
+{
+ // Track-by-track accumulation, each element receives the same sequence of additions as in the original nested loops.
+
+ for(Int_t i=0;i<n;i++)
+ {
+  this->ComputeHarmonics(phi[i]);
+  this->ComputeWeightPowers(w[i]);
+  for(Int_t h=0;h<fNHarmonics;h++)
+  {
+   for(Int_t k=0;k<fNPowers;k++)
+   {
+    re[h*ld+k] += fWeightPower[k]*fCos[h];
+    im[h*ld+k] += fWeightPower[k]*fSin[h];
+   }
+  }
+  if(sumOfWeightPowers)
+  {
+   for(Int_t k=0;k<fNPowers;k++)
+   {
+    sumOfWeightPowers[k] += fWeightPower[k];
+   }
+  }
+ } // end of for(Int_t i=0;i<n;i++)
+
+} // end of void AliFlowQVectorKernel::AccumulateExact(...)
+
+//================================================================================================================
+
+void AliFlowQVectorKernel::AccumulateRecurrence(Int_t n, const Double_t *phi, const Double_t *w, Double_t *re, Double_t *im, Int_t ld, Double_t *sumOfWeightPowers)
+{
+ // Blocks of fgkLanes tracks are processed together. All innermost loops run over the lane index
+ // with fixed trip count and no cross-lane dependency, so they are vectorised without -ffast-math.
+
+ const Int_t kL = fgkLanes;
+ std::fill(fLaneRe.begin(),fLaneRe.end(),0.);
+ std::fill(fLaneIm.begin(),fLaneIm.end(),0.);
+ std::fill(fLaneS.begin(),fLaneS.end(),0.);
+ Double_t *wp = fLanePower.data();
+ Double_t *lre = fLaneRe.data();
+ Double_t *lim = fLaneIm.data();
+ Double_t *ls = fLaneS.data();
+
+ Double_t c1[kL], s1[kL], c[kL], s[kL], wl[kL];
+ for(Int_t i0=0;i0<n;i0+=kL)
+ {
+  // Load the block, padding lanes get weight power 0 for all k:
+  for(Int_t l=0;l<kL;l++)
+  {
+   Bool_t valid = (i0+l<n);
+   Double_t x = valid ? phi[i0+l] : 0.;
+   wl[l] = valid ? w[i0+l] : 0.;
+   wp[l] = valid ? 1. : 0.;
+   c1[l] = TMath::Cos(fHarmonic*x);
+   s1[l] = TMath::Sin(fHarmonic*x);
+   c[l] = TMath::Cos(fFirstHarmonic*fHarmonic*x);
+   s[l] = TMath::Sin(fFirstHarmonic*fHarmonic*x);
+  }
+  for(Int_t k=1;k<fNPowers;k++)
+  {
+   for(Int_t l=0;l<kL;l++)
+   {
+    wp[k*kL+l] = wp[(k-1)*kL+l]*wl[l];
+   }
+  }
+  // Accumulate, then step all lanes to the next harmonic:
+  for(Int_t h=0;h<fNHarmonics;h++)
+  {
+   for(Int_t k=0;k<fNPowers;k++)
+   {
+    Double_t *r = lre+(h*fNPowers+k)*kL;
+    Double_t *m = lim+(h*fNPowers+k)*kL;
+    const Double_t *p = wp+k*kL;
+    for(Int_t l=0;l<kL;l++)
+    {
+     r[l] += p[l]*c[l];
+     m[l] += p[l]*s[l];
+    }
+   }
+   for(Int_t l=0;l<kL;l++)
+   {
+    Double_t cNext = c[l]*c1[l]-s[l]*s1[l];
+    s[l] = s[l]*c1[l]+c[l]*s1[l];
+    c[l] = cNext;
+   }
+  } // end of for(Int_t h=0;h<fNHarmonics;h++)
+  for(Int_t k=0;k<fNPowers*kL;k++)
+  {
+   ls[k] += wp[k];
+  }
+ } // end of for(Int_t i0=0;i0<n;i0+=kL)
+
+ // Horizontal reduction of the lanes:
+ for(Int_t h=0;h<fNHarmonics;h++)
+ {
+  for(Int_t k=0;k<fNPowers;k++)
+  {
+   const Double_t *r = lre+(h*fNPowers+k)*kL;
+   const Double_t *m = lim+(h*fNPowers+k)*kL;
+   for(Int_t l=0;l<kL;l++)
+   {
+    re[h*ld+k] += r[l];
+    im[h*ld+k] += m[l];
+   }
+  }
+ }
+ if(sumOfWeightPowers)
+ {
+  for(Int_t k=0;k<fNPowers;k++)
+  {
+   for(Int_t l=0;l<kL;l++)
+   {
+    sumOfWeightPowers[k] += ls[k*kL+l];
+   }
+  }
+ }
+
+} // end of void AliFlowQVectorKernel::AccumulateRecurrence(...)
@@ -0,0 +1,72 @@
+/*
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved.
+ * See cxx source for full Copyright notice
+ * $Id$
+ */
+
+/************************************************************
+ * Batched kernel for weighted Q-vectors                    *
+ *   Q_{h,k} = sum_{i} w_{i}^{k} exp(i*(h0+h)*n*phi_{i})    *
+ * shared by Q-cumulants, CRC and generic framework (MPC)   *
+ ************************************************************/
+
+#ifndef ALIFLOWQVECTORKERNEL_H
+#define ALIFLOWQVECTORKERNEL_H
+
+#include <vector>
+#include "Rtypes.h"
+
+//================================================================================================================
+
+class AliFlowQVectorKernel{
+ public:
+  AliFlowQVectorKernel(Int_t nHarmonics=12, Int_t nPowers=9, Int_t firstHarmonic=1, Int_t harmonic=2);
+  virtual ~AliFlowQVectorKernel();
+  // 0.) configuration:
+  void Configure(Int_t nHarmonics, Int_t nPowers, Int_t firstHarmonic, Int_t harmonic);
+  void SetUseRecurrence(Bool_t const ur) {this->fUseRecurrence = ur;};
+  Bool_t GetUseRecurrence() const {return this->fUseRecurrence;};
+  Int_t GetNumberOfHarmonics() const {return this->fNHarmonics;};
+  Int_t GetNumberOfPowers() const {return this->fNPowers;};
+  // 1.) per-track tables:
+  void ComputeHarmonics(Double_t phi);
+  void ComputeWeightPowers(Double_t w);
+  Double_t Cos(Int_t h) const {return this->fCos[h];};
+  Double_t Sin(Int_t h) const {return this->fSin[h];};
+  Double_t WeightPower(Int_t k) const {return this->fWeightPower[k];};
+  // 2.) batched accumulation over SoA arrays:
+  void Clear() {fPhi.clear(); fWeight.clear();};
+  void Reserve(Int_t n) {fPhi.reserve(n); fWeight.reserve(n);};
+  void Add(Double_t phi, Double_t w) {fPhi.push_back(phi); fWeight.push_back(w);};
+  Int_t GetN() const {return (Int_t)fPhi.size();};
+  void Accumulate(Double_t *re, Double_t *im, Int_t ld, Double_t *sumOfWeightPowers=NULL);
+  void Accumulate(Int_t n, const Double_t *phi, const Double_t *w, Double_t *re, Double_t *im, Int_t ld, Double_t *sumOfWeightPowers=NULL);
+
+ private:
+  AliFlowQVectorKernel(const AliFlowQVectorKernel& afqvk);
+  AliFlowQVectorKernel& operator=(const AliFlowQVectorKernel& afqvk);
+  void AccumulateExact(Int_t n, const Double_t *phi, const Double_t *w, Double_t *re, Double_t *im, Int_t ld, Double_t *sumOfWeightPowers);
+  void AccumulateRecurrence(Int_t n, const Double_t *phi, const Double_t *w, Double_t *re, Double_t *im, Int_t ld, Double_t *sumOfWeightPowers);
+
+  static const Int_t fgkLanes = 4; // number of independent accumulators in the recurrence mode (SIMD width)
+
+  Int_t fNHarmonics; // number of harmonics h = 0,...,fNHarmonics-1
+  Int_t fNPowers; // number of weight powers k = 0,...,fNPowers-1
+  Int_t fFirstHarmonic; // h0, i.e. the multiple of fHarmonic stored at index 0
+  Int_t fHarmonic; // n
+  Bool_t fUseRecurrence; // kFALSE: TMath::Cos/Sin and pow for each entry, bit-for-bit identical to the original nested loops
+                         // kTRUE: complex recurrence and repeated multiplication, lane-split accumulation (equal up to rounding)
+  std::vector<Double_t> fCos; // cos((h0+h)*n*phi) for the current track
+  std::vector<Double_t> fSin; // sin((h0+h)*n*phi) for the current track
+  std::vector<Double_t> fWeightPower; // w^k for the current track
+  std::vector<Double_t> fPhi; // SoA buffer: azimuthal angles
+  std::vector<Double_t> fWeight; // SoA buffer: weights
+  std::vector<Double_t> fLanePower; // [k][lane] weight powers of the current block in recurrence mode
+  std::vector<Double_t> fLaneRe; // [h][k][lane] partial sums in recurrence mode
+  std::vector<Double_t> fLaneIm; // [h][k][lane] partial sums in recurrence mode
+  std::vector<Double_t> fLaneS; // [k][lane] partial sums of weight powers in recurrence mode
+};
+
+//================================================================================================================
+
+#endif
@@ -340,7 +340,7 @@ class AliEmcalJet : public AliVParticle
   // Ghosts
   void AddGhost(const Double_t dPx, const Double_t dPy, const Double_t dPz, const Double_t dE);
   Bool_t HasGhost() const                               { return fHasGhost; }
-  const std::vector<TLorentzVector> GetGhosts()   const { return fGhosts  ; }
+  const std::vector<TLorentzVector>& GetGhosts()  const { return fGhosts  ; }
 
   // Debug printouts
   void Print(Option_t* /*opt*/ = "") const;
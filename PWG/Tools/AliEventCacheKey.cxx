@@ -0,0 +1,105 @@
+/**************************************************************************
+ * Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+#include <TTree.h>
+
+#include "AliAnalysisManager.h"
+#include "AliEventCacheKey.h"
+
+/// \cond CLASSIMP
+ClassImp(AliEventCacheKey)
+/// \endcond
+
+/**
+ * Default constructor, invalid key
+ */
+AliEventCacheKey::AliEventCacheKey():
+  fEvent(0),
+  fEntry(-1),
+  fTreeNumber(-1),
+  fRunNumber(-1),
+  fPeriod(0),
+  fOrbit(0),
+  fBunchCrossing(0)
+{
+}
+
+/**
+ * Key of the current event of the analysis manager
+ * @param[in] event Input event
+ */
+AliEventCacheKey::AliEventCacheKey(const AliVEvent *event):
+  fEvent(event),
+  fEntry(-1),
+  fTreeNumber(-1),
+  fRunNumber(-1),
+  fPeriod(0),
+  fOrbit(0),
+  fBunchCrossing(0)
+{
+  AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+  if (!event || !mgr) return;
+  fEntry = mgr->GetCurrentEntry();
+  // the entry restarts at every file of the chain
+  TTree *tree = mgr->GetTree();
+  fTreeNumber = tree ? tree->GetTreeNumber() : -1;
+  fRunNumber = event->GetRunNumber();
+  fPeriod = event->GetPeriodNumber();
+  fOrbit = event->GetOrbitNumber();
+  fBunchCrossing = event->GetBunchCrossNumber();
+}
+
+/**
+ * Set the key to the current event
+ * @param[in] event Input event
+ * @return kTRUE if the event differs from the previous one or cannot be identified,
+ * i.e. if everything cached for the previous event has to be discarded
+ */
+Bool_t AliEventCacheKey::Set(const AliVEvent *event)
+{
+  AliEventCacheKey key(event);
+  if (key.IsValid() && key == *this) return kFALSE;
+  *this = key;
+  return kTRUE;
+}
+
+/**
+ * Check whether the key belongs to the current event
+ * @param[in] event Input event
+ * @return kTRUE if the key is valid and was set for this event
+ */
+Bool_t AliEventCacheKey::IsEvent(const AliVEvent *event) const
+{
+  return IsValid() && AliEventCacheKey(event) == *this;
+}
+
+/**
+ * Invalidate the key
+ */
+void AliEventCacheKey::Reset()
+{
+  *this = AliEventCacheKey();
+}
+
+/**
+ * Compare two keys
+ * @param[in] other Key to compare with
+ * @return kTRUE if all components of the keys are equal
+ */
+bool AliEventCacheKey::operator==(const AliEventCacheKey &other) const
+{
+  return fEntry == other.fEntry && fTreeNumber == other.fTreeNumber && fEvent == other.fEvent &&
+      fRunNumber == other.fRunNumber && fPeriod == other.fPeriod && fOrbit == other.fOrbit &&
+      fBunchCrossing == other.fBunchCrossing;
+}
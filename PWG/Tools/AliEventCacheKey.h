@@ -0,0 +1,76 @@
+#ifndef ALIEVENTCACHEKEY_H
+#define ALIEVENTCACHEKEY_H
+/* Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+#include <Rtypes.h>
+
+#include "AliVEvent.h"
+
+/**
+ * \class AliEventCacheKey
+ * \brief Identifies the event of a per-event cache shared between the tasks of a train
+ *
+ * Objects attached to the input event (AliVEvent::AddObject) survive from one
+ * event to the next, and so does the input event object, also across input files.
+ * A cache attached to the event therefore has to find out whether it was filled
+ * for the current event. The key combines
+ * - the entry of the analysis manager, which is counted within the current tree,
+ * - the number of the current tree of the input chain,
+ * - run number, period, orbit and bunch crossing of the event header,
+ * - the event object.
+ *
+ * Without an analysis manager the key is invalid and Set() always reports a new event,
+ * i.e. nothing is shared.
+ *
+ * ~~~{.cxx}
+ * AliMyEventCache *cache = AliEventCacheKey::GetEventObject<AliMyEventCache>(event, "AliMyEventCache");
+ * if (cache->fEventKey.Set(event)) cache->NextEvent(event);
+ * ~~~
+ */
+class AliEventCacheKey {
+public:
+  AliEventCacheKey();
+  AliEventCacheKey(const AliVEvent *event);
+  virtual ~AliEventCacheKey() {}
+
+  Bool_t IsValid() const                            { return fEntry >= 0; }
+  Bool_t Set(const AliVEvent *event);
+  Bool_t IsEvent(const AliVEvent *event) const;
+  void   Reset();
+
+  bool   operator==(const AliEventCacheKey &other) const;
+  bool   operator!=(const AliEventCacheKey &other) const { return !(*this == other); }
+
+  /**
+   * Find an object in the list of objects of the event, or create it and add it to the event.
+   * The object is owned by the event.
+   * @param[in] event Input event
+   * @param[in] name Name of the object, passed to the constructor of T
+   * @return Object of the event
+   */
+  template <class T> static T *GetEventObject(AliVEvent *event, const char *name)
+  {
+    T *obj = dynamic_cast<T*>(event->FindListObject(name));
+    if (!obj) {
+      obj = new T(name);
+      event->AddObject(obj);
+    }
+    return obj;
+  }
+
+protected:
+  const AliVEvent *fEvent;                 //!<! Event object
+  Long64_t         fEntry;                 //!<! Entry of the analysis manager within the current tree
+  Int_t            fTreeNumber;            //!<! Number of the current tree of the input chain
+  Int_t            fRunNumber;             //!<! Run number
+  UInt_t           fPeriod;                //!<! Period number
+  UInt_t           fOrbit;                 //!<! Orbit number
+  UShort_t         fBunchCrossing;         //!<! Bunch crossing number
+
+  /// \cond CLASSIMP
+  ClassDef(AliEventCacheKey, 1); // Identifies the event of a per-event cache
+  /// \endcond
+};
+
+#endif /* ALIEVENTCACHEKEY_H */
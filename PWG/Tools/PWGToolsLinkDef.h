@@ -6,6 +6,7 @@
 
 #pragma link C++ class AliAnalysisHelperJetTasks+;
 #pragma link C++ class AliBasicParticle+;
+#pragma link C++ class AliEventCacheKey+;
 #pragma link C++ class AliFigure+;
 #pragma link C++ class AliCanvas+;
 #pragma link C++ class AliHelperPID+;
@@ -46,4 +47,5 @@
 #pragma link C++ function TestTHistManager::TestRunBuildGrouped();
 #pragma link C++ function TestTHistManager::TestRunFillSimple();
 #pragma link C++ function TestTHistManager::TestRunFillGrouped();
+#pragma link C++ function TestTHistManager::TestRunFillHandles();
 #endif
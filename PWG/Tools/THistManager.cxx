@@ -625,6 +625,132 @@ void THistManager::FillProfile(const char* name, double x, double y, double weig
   hist->Fill(x, y, weight);
 }
 
+THistManager::HistHandle THistManager::GetHandle(const char *name, Option_t *opt) const {
+  TString dirname(basename(name)), hname(histname(name));
+  THashList *parent(FindGroup(dirname));
+  if(!parent){
+    Fatal("THistManager::GetHandle", "Parent group %s does not exist", dirname.Data());
+    return HistHandle();
+  }
+  TObject *obj = parent->FindObject(hname);
+  if(!obj){
+    Fatal("THistManager::GetHandle", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
+    return HistHandle();
+  }
+
+  HistHandle handle;
+  TString optstring(opt);
+  if(THnSparse *sparse = dynamic_cast<THnSparse *>(obj)){
+    handle.fSparse = sparse;
+    handle.fType = HistHandle::kTHMTHnSparse;
+    for(Int_t iaxis = 0; iaxis < TMath::Min(sparse->GetNdimensions(), 32); iaxis++){
+      if(optstring.Contains(Form("w%d", iaxis))) handle.fWidthAxes |= (1u << iaxis);
+    }
+    return handle;
+  }
+  TH1 *hist = dynamic_cast<TH1 *>(obj);
+  if(!hist){
+    Fatal("THistManager::GetHandle", "Object %s in parent group %s is not a histogram", hname.Data(), dirname.Data());
+    return HistHandle();
+  }
+  handle.fHist = hist;
+  if(dynamic_cast<TProfile *>(hist)) handle.fType = HistHandle::kTHMTProfile;
+  else if(dynamic_cast<TH3 *>(hist)) handle.fType = HistHandle::kTHMTH3;
+  else if(dynamic_cast<TH2 *>(hist)) handle.fType = HistHandle::kTHMTH2;
+  else handle.fType = HistHandle::kTHMTH1;
+  switch(handle.fType){
+  case HistHandle::kTHMTH1:
+    if(optstring.Contains("w")) handle.fWidthAxes |= 1;
+    break;
+  case HistHandle::kTHMTH2:
+  case HistHandle::kTHMTH3:
+    if(optstring.Contains("wx")) handle.fWidthAxes |= 1;
+    if(optstring.Contains("wy")) handle.fWidthAxes |= 2;
+    if(handle.fType == HistHandle::kTHMTH3 && optstring.Contains("wz")) handle.fWidthAxes |= 4;
+    break;
+  default:
+    break;
+  }
+  return handle;
+}
+
+void THistManager::FillTH1(const HistHandle &handle, double x, double weight) {
+  CheckHandle(handle, HistHandle::kTHMTH1, "THistManager::FillTH1");
+  if(handle.fWidthAxes) weight = GetWidthWeight(handle, &x, weight);
+  handle.fHist->Fill(x, weight);
+}
+
+void THistManager::FillTH1(const HistHandle &handle, int n, const double *x, const double *weight) {
+  CheckHandle(handle, HistHandle::kTHMTH1, "THistManager::FillTH1");
+  if(!handle.fWidthAxes){
+    handle.fHist->FillN(n, x, weight);
+    return;
+  }
+  for(int i = 0; i < n; i++) handle.fHist->Fill(x[i], GetWidthWeight(handle, x + i, weight ? weight[i] : 1.));
+}
+
+void THistManager::FillTH2(const HistHandle &handle, double x, double y, double weight) {
+  CheckHandle(handle, HistHandle::kTHMTH2, "THistManager::FillTH2");
+  if(handle.fWidthAxes){
+    double point[2] = {x, y};
+    weight = GetWidthWeight(handle, point, weight);
+  }
+  static_cast<TH2 *>(handle.fHist)->Fill(x, y, weight);
+}
+
+void THistManager::FillTH2(const HistHandle &handle, int n, const double *x, const double *y, const double *weight) {
+  CheckHandle(handle, HistHandle::kTHMTH2, "THistManager::FillTH2");
+  TH2 *hist = static_cast<TH2 *>(handle.fHist);
+  if(!handle.fWidthAxes){
+    hist->FillN(n, x, y, weight);
+    return;
+  }
+  for(int i = 0; i < n; i++){
+    double point[2] = {x[i], y[i]};
+    hist->Fill(x[i], y[i], GetWidthWeight(handle, point, weight ? weight[i] : 1.));
+  }
+}
+
+void THistManager::FillTH3(const HistHandle &handle, double x, double y, double z, double weight) {
+  CheckHandle(handle, HistHandle::kTHMTH3, "THistManager::FillTH3");
+  if(handle.fWidthAxes){
+    double point[3] = {x, y, z};
+    weight = GetWidthWeight(handle, point, weight);
+  }
+  static_cast<TH3 *>(handle.fHist)->Fill(x, y, z, weight);
+}
+
+void THistManager::FillTHnSparse(const HistHandle &handle, const double *x, double weight) {
+  CheckHandle(handle, HistHandle::kTHMTHnSparse, "THistManager::FillTHnSparse");
+  if(handle.fWidthAxes) weight = GetWidthWeight(handle, x, weight);
+  handle.fSparse->Fill(x, weight);
+}
+
+void THistManager::FillProfile(const HistHandle &handle, double x, double y, double weight) {
+  CheckHandle(handle, HistHandle::kTHMTProfile, "THistManager::FillTProfile");
+  static_cast<TProfile *>(handle.fHist)->Fill(x, y, weight);
+}
+
+void THistManager::CheckHandle(const HistHandle &handle, HistHandle::THMHistType_t type, const char *method) const {
+  if(handle.fType != type)
+    Fatal(method, "Handle of type %d used for histogram type %d", handle.fType, type);
+}
+
+double THistManager::GetWidthWeight(const HistHandle &handle, const double *x, double weight) const {
+  double myweight = 1.;
+  for(Int_t iaxis = 0; iaxis < 32; iaxis++){
+    if(!(handle.fWidthAxes & (1u << iaxis))) continue;
+    const TAxis *axis(nullptr);
+    if(handle.fSparse) axis = handle.fSparse->GetAxis(iaxis);
+    else if(iaxis == 0) axis = handle.fHist->GetXaxis();
+    else if(iaxis == 1) axis = handle.fHist->GetYaxis();
+    else axis = handle.fHist->GetZaxis();
+    Int_t bin = axis->FindFixBin(x[iaxis]);
+    if(bin != 0 && bin != axis->GetNbins()) myweight *= 1./axis->GetBinWidth(bin);
+  }
+  return myweight;
+}
+
 TObject *THistManager::FindObject(const char *name) const {
 	TString dirname(basename(name)), hname(histname(name));
 	THashList *parent(FindGroup(dirname));
@@ -659,6 +785,17 @@ TString THistManager::histname(const TString &path) const {
 	return TString(path(index+1, path.Length() - (index+1)));
 }
 
+//////////////////////////////////////////////////////////
+///                                                    ///
+/// Implementation of THistManager::HistHandle         ///
+///                                                    ///
+//////////////////////////////////////////////////////////
+
+TObject *THistManager::HistHandle::GetObject() const {
+  if(fSparse) return fSparse;
+  return fHist;
+}
+
 //////////////////////////////////////////////////////////
 ///                                                    ///
 /// Implementation of THistManager::iterator           ///
@@ -1030,6 +1167,69 @@ namespace TestTHistManager {
     return success ? 0 : 1;
   }
 
+  int THistManagerTestSuite::TestFillHandles(){
+    THistManager testmgr("testmgr");
+
+    testmgr.CreateTH1("Group1/Test1", "Test fill 1D histogram via handle", 1, 0., 1.);
+    testmgr.CreateTH2("Group1/Test2", "Test fill 2D histogram via handle", 1, 0., 1., 1, 0., 1.);
+    testmgr.CreateTH3("Group1/Test3", "Test fill 3D histogram via handle", 1, 0., 1., 1, 0., 1., 1, 0., 1.);
+    int nbins[4] = {1,1,1,1}; double min[4] = {0.,0.,0.,0.}, max[4] = {1.,1.,1.,1.};
+    testmgr.CreateTHnSparse("Group1/TestN", "Test fill THnSparse via handle", 4, nbins, min, max);
+    testmgr.CreateTProfile("Group1/Subgroup1/TestProfile", "Test fill Profile histogram via handle", 1, 0., 1.);
+
+    THistManager::HistHandle handles[5] = {
+        testmgr.GetHandle("Group1/Test1"),
+        testmgr.GetHandle("Group1/Test2"),
+        testmgr.GetHandle("Group1/Test3"),
+        testmgr.GetHandle("Group1/TestN"),
+        testmgr.GetHandle("Group1/Subgroup1/TestProfile")
+    };
+    const THistManager::HistHandle::THMHistType_t types[5] = {
+        THistManager::HistHandle::kTHMTH1, THistManager::HistHandle::kTHMTH2, THistManager::HistHandle::kTHMTH3,
+        THistManager::HistHandle::kTHMTHnSparse, THistManager::HistHandle::kTHMTProfile
+    };
+    const double expected[5] = {200., 200., 100., 100., 1.};
+
+    bool success(true);
+    for(int i = 0; i < 5; i++){
+      if(!handles[i].IsValid() || handles[i].GetType() != types[i]){
+        std::cout << "Handle " << i << ": invalid or wrong type" << std::endl;
+        success = false;
+      }
+    }
+    if(!success) return 1;
+
+    double point[4] = {0.5, 0.5, 0.5, 0.5};
+    std::vector<double> xvals(100, 0.5), yvals(100, 0.5);
+    for(int i = 0; i < 100; i++){
+      testmgr.FillTH1(handles[0], 0.5);
+      testmgr.FillTH2(handles[1], 0.5, 0.5);
+      testmgr.FillTH3(handles[2], 0.5, 0.5, 0.5);
+      testmgr.FillTHnSparse(handles[3], point);
+      testmgr.FillProfile(handles[4], 0.5, 1.);
+    }
+    testmgr.FillTH1(handles[0], 100, xvals.data());
+    testmgr.FillTH2(handles[1], 100, xvals.data(), yvals.data());
+
+    // Evalutate test
+    // tell user why test has failed
+    for(int i = 0; i < 5; i++){
+      double content(0.);
+      if(i == 3){
+        int bin[4] = {1, 1, 1, 1};
+        content = static_cast<THnSparse *>(handles[i].GetObject())->GetBinContent(bin);
+      } else {
+        TH1 *hist = static_cast<TH1 *>(handles[i].GetObject());
+        content = hist->GetBinContent(hist->GetBin(1, 1, 1));
+      }
+      if(TMath::Abs(content - expected[i]) > DBL_EPSILON){
+        std::cout << handles[i].GetObject()->GetName() << ": Mismatch in values, expected " << expected[i] << ", found " << content << std::endl;
+        success = false;
+      }
+    }
+    return success ? 0 : 1;
+  }
+
   int TestRunAll(){
     int testresult(0);
     THistManagerTestSuite testsuite;
@@ -1050,6 +1250,10 @@ namespace TestTHistManager {
     testresult += testsuite.TestFillGroupedHistograms();
     std::cout << "Result after test: " << testresult << std::endl;
 
+    std::cout << "Running test: Fill Handles" << std::endl;
+    testresult += testsuite.TestFillHandles();
+    std::cout << "Result after test: " << testresult << std::endl;
+
     return testresult;
   }
 
@@ -1072,4 +1276,9 @@ namespace TestTHistManager {
     THistManagerTestSuite testsuite;
     return testsuite.TestFillGroupedHistograms();
   }
+
+  int TestRunFillHandles(){
+    THistManagerTestSuite testsuite;
+    return testsuite.TestFillHandles();
+  }
 }
@@ -88,6 +88,14 @@ class TProfile;
  * }
  * ~~~
  *
+ * ## Filling via handles
+ *
+ * Fill functions taking the histogram name need to look up the histogram
+ * for every entry. In the event loop it is faster to obtain a @ref HistHandle
+ * once with GetHandle and to use the Fill functions taking the handle, which
+ * fill the histogram directly. For 1D and 2D histograms also batched fills of
+ * arrays of values are available.
+ *
  * ## Optional automatic correction of the bin width
  *
  * Correction for the bin width can be automatically handled by the histogram
@@ -229,6 +237,76 @@ public:
     iterator();
   };
 
+  /**
+   * @class HistHandle
+   * @brief Direct reference to a histogram in the histogram manager
+   * @ingroup Histmanager
+   *
+   * Obtained once via THistManager::GetHandle, outside the event loop. The
+   * handle stores the pointer to the histogram, its type and the bin width
+   * correction decoded from the fill option, so that filling via the handle
+   * involves neither string operations nor lookups in the hash lists:
+   *
+   * ~~~{.cxx}
+   * THistManager::HistHandle hpt = mgr.GetHandle("tracks/hPt");    // once
+   * mgr.FillTH1(hpt, track->Pt());                                 // per track
+   * ~~~
+   *
+   * A handle is valid as long as the histogram manager owning the histogram
+   * exists.
+   */
+  class HistHandle {
+  public:
+    /**
+     * @enum THMHistType_t
+     * @brief Type of the histogram connected to the handle
+     */
+    enum THMHistType_t {
+      kTHMnone = 0,       //!< Invalid handle
+      kTHMTH1 = 1,        //!< 1D histogram
+      kTHMTH2 = 2,        //!< 2D histogram
+      kTHMTH3 = 3,        //!< 3D histogram
+      kTHMTHnSparse = 4,  //!< THnSparse
+      kTHMTProfile = 5    //!< Profile histogram
+    };
+
+    /**
+     * @brief Constructor, creating an invalid handle
+     */
+    HistHandle(): fHist(nullptr), fSparse(nullptr), fType(kTHMnone), fWidthAxes(0) { }
+
+    /**
+     * @brief Destructor
+     */
+    ~HistHandle() { }
+
+    /**
+     * @brief Check whether the handle is connected to a histogram
+     * @return True if the handle points to a histogram
+     */
+    Bool_t IsValid() const { return fType != kTHMnone; }
+
+    /**
+     * @brief Get the type of the histogram connected to the handle
+     * @return Histogram type
+     */
+    THMHistType_t GetType() const { return fType; }
+
+    /**
+     * @brief Get the histogram connected to the handle
+     * @return Histogram (nullptr for invalid handles)
+     */
+    TObject *GetObject() const;
+
+  private:
+    friend class THistManager;
+
+    TH1                        *fHist;          ///< Histogram (TH1, TH2, TH3, TProfile)
+    THnSparse                  *fSparse;        ///< Histogram (THnSparse)
+    THMHistType_t               fType;          ///< Type of the histogram
+    UInt_t                      fWidthAxes;     ///< Axes for which the weight is the inverse bin width (bit i for axis i)
+  };
+
   /**
    * @brief Default constructor.
    *
@@ -634,6 +712,83 @@ public:
 	 */
   void FillProfile(const char *name, double x, double y, double weight = 1.);
 
+  /**
+   * @brief Get a handle to a histogram within the container.
+   *
+   * The histogram is looked up once, and the fill options
+   * for the bin width correction are decoded. The handle
+   * can be used in the handle-based Fill functions, which
+   * fill the histogram directly.
+   *
+   * @param[in] name Name of the histogram, including the parent group(s)
+   * @param[in] opt Fill options (bin width correction, same notation as in the string-based Fill functions)
+   * @return Handle to the histogram
+   */
+  HistHandle GetHandle(const char *name, Option_t *opt = "") const;
+
+  /**
+   * @brief Fill a 1D histogram via its handle.
+   * @param[in] handle Handle to the histogram
+   * @param[in] x x-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   */
+  void FillTH1(const HistHandle &handle, double x, double weight = 1.);
+
+  /**
+   * @brief Fill a 1D histogram via its handle with n entries.
+   * @param[in] handle Handle to the histogram
+   * @param[in] n Number of entries
+   * @param[in] x Array of x-coordinates (size n)
+   * @param[in] weight Array of weights (size n, nullptr for weight 1)
+   */
+  void FillTH1(const HistHandle &handle, int n, const double *x, const double *weight = nullptr);
+
+  /**
+   * @brief Fill a 2D histogram via its handle.
+   * @param[in] handle Handle to the histogram
+   * @param[in] x x-coordinate
+   * @param[in] y y-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   */
+  void FillTH2(const HistHandle &handle, double x, double y, double weight = 1.);
+
+  /**
+   * @brief Fill a 2D histogram via its handle with n entries.
+   * @param[in] handle Handle to the histogram
+   * @param[in] n Number of entries
+   * @param[in] x Array of x-coordinates (size n)
+   * @param[in] y Array of y-coordinates (size n)
+   * @param[in] weight Array of weights (size n, nullptr for weight 1)
+   */
+  void FillTH2(const HistHandle &handle, int n, const double *x, const double *y, const double *weight = nullptr);
+
+  /**
+   * @brief Fill a 3D histogram via its handle.
+   * @param[in] handle Handle to the histogram
+   * @param[in] x x-coordinate
+   * @param[in] y y-coordinate
+   * @param[in] z z-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   */
+  void FillTH3(const HistHandle &handle, double x, double y, double z, double weight = 1.);
+
+  /**
+   * @brief Fill a THnSparse via its handle.
+   * @param[in] handle Handle to the histogram
+   * @param[in] x Point to be filled (one value per dimension)
+   * @param[in] weight optional weight of the entry (default 1)
+   */
+  void FillTHnSparse(const HistHandle &handle, const double *x, double weight = 1.);
+
+  /**
+   * @brief Fill a profile histogram via its handle.
+   * @param[in] handle Handle to the histogram
+   * @param[in] x x-coordinate
+   * @param[in] y y-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   */
+  void FillProfile(const HistHandle &handle, double x, double y, double weight = 1.);
+
   /**
    * @brief Create forward iterator starting at the beginning of the
    * container
@@ -719,6 +874,29 @@ private:
 	 */
 	TString histname(const TString &path) const;
 
+	/**
+	 * @brief Check that the handle is connected to a histogram of the expected type.
+	 *
+	 * Fatal if the handle is invalid or of a different type.
+	 * @param[in] handle Handle to check
+	 * @param[in] type Expected type of the histogram
+	 * @param[in] method Name of the calling method (for the error message)
+	 */
+	void CheckHandle(const HistHandle &handle, HistHandle::THMHistType_t type, const char *method) const;
+
+	/**
+	 * @brief Get the weight for the bin width correction of a handle.
+	 *
+	 * Same convention as in the string-based Fill functions: in case a bin width
+	 * correction is requested the weight given by the user is replaced by the
+	 * product of the inverse bin widths.
+	 * @param[in] handle Handle to the histogram
+	 * @param[in] x Point to be filled (one value per dimension)
+	 * @param[in] weight Weight given by the user
+	 * @return Weight for the fill
+	 */
+	double GetWidthWeight(const HistHandle &handle, const double *x, double weight) const;
+
 	THashList *fHistos;                   ///< List of histograms
 	bool fIsOwner;                        ///< Set the ownership
 
@@ -845,6 +1023,22 @@ public:
    * @return 0 if test is passed, 1 if it failed
    */
   int TestFillGroupedHistograms();
+
+  /**
+   * Purpose of the test: Check whether the handle-based fill functions fill the same histograms
+   * as the string-based fill functions
+   * Relies on: TestFillSimpleHistograms, TestFillGroupedHistograms
+   *
+   * Creating histograms of all types in a group and filling them via handles
+   * - 100 times with single entries
+   * - 100 times in one batched fill (TH1 and TH2)
+   *
+   * Test passed:
+   * - Handles are valid and have the correct type
+   * - All histograms have the expected value (200 for TH1 and TH2, 100 for TH3 and THnSparse, 1 for profile)
+   * @return 0 if test is passed, 1 if it failed
+   */
+  int TestFillHandles();
 };
 
 /**
@@ -882,5 +1076,12 @@ int TestRunFillSimple();
  */
 int TestRunFillGrouped();
 
+/**
+ * Run the test for filling histograms via handles. See @ref THistManagerTestSuite
+ * for details.
+ * @return 0 if test is passed, 1 if failed
+ */
+int TestRunFillHandles();
+
 }
 #endif
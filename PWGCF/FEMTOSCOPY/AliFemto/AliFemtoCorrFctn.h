@@ -42,6 +42,14 @@ public:
   /// Not Implemented - Add background pair
   virtual void AddMixedPair(AliFemtoPair* aPir);
 
+  /// Add a block of signal pairs - by default calls AddRealPair on each
+  ///
+  /// Called by the analysis with all pairs passing the pair cut, in the
+  /// same order as they were built. Override to process the block at once.
+  virtual void AddRealPairs(AliFemtoPair** pairs, int n);
+  /// Add a block of background pairs - by default calls AddMixedPair on each
+  virtual void AddMixedPairs(AliFemtoPair** pairs, int n);
+
   /// Not Implemented - Add pair with optional
   virtual void AddFirstParticle(AliFemtoParticle *particle, bool mixing);
   virtual void AddSecondParticle(AliFemtoParticle *particle);
@@ -82,6 +90,20 @@ inline void AliFemtoCorrFctn::SetPairSelectionCut(AliFemtoPairCut* cut)
   fPairCut = cut;
 }
 
+inline void AliFemtoCorrFctn::AddRealPairs(AliFemtoPair** pairs, int n)
+{
+  for (int i = 0; i < n; ++i) {
+    AddRealPair(pairs[i]);
+  }
+}
+
+inline void AliFemtoCorrFctn::AddMixedPairs(AliFemtoPair** pairs, int n)
+{
+  for (int i = 0; i < n; ++i) {
+    AddMixedPair(pairs[i]);
+  }
+}
+
 inline void AliFemtoCorrFctn::EventBegin(const AliFemtoEvent* /* event */)
 { // no-op
 }
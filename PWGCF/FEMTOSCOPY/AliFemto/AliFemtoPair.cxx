@@ -20,12 +20,8 @@ AliFemtoPair::AliFemtoPair():
   fTrack1(NULL),
   fTrack2(NULL),
   fPairAngleEP(0.0),
-  fNonIdParNotCalculated(0.0),
-  fDKSide(0.0),
-  fDKOut(0.0),
-  fDKLong(0.0),
-  fCVK(0.0),
-  fKStarCalc(0.0),
+  fNonIdParNotCalculated(1),
+  fKinematics(),
   fNonIdParNotCalculatedGlobal(0),
   fMergingParNotCalculated(0),
   fWeightedAvSep(0.0),
@@ -58,12 +54,8 @@ AliFemtoPair::AliFemtoPair(AliFemtoParticle* a, AliFemtoParticle* b):
   fTrack1(a),
   fTrack2(b),
   fPairAngleEP(0.0),
-  fNonIdParNotCalculated(0.0),
-  fDKSide(0.0),
-  fDKOut(0.0),
-  fDKLong(0.0),
-  fCVK(0.0),
-  fKStarCalc(0.0),
+  fNonIdParNotCalculated(1),
+  fKinematics(),
   fNonIdParNotCalculatedGlobal(0),
   fMergingParNotCalculated(0),
   fWeightedAvSep(0.0),
@@ -128,11 +120,7 @@ AliFemtoPair::AliFemtoPair(const AliFemtoPair &aPair):
   fTrack2(aPair.fTrack2),
   fPairAngleEP(aPair.fPairAngleEP),
   fNonIdParNotCalculated(aPair.fNonIdParNotCalculated),
-  fDKSide(aPair.fDKSide),
-  fDKOut(aPair.fDKOut),
-  fDKLong(aPair.fDKLong),
-  fCVK(aPair.fCVK),
-  fKStarCalc(aPair.fKStarCalc),
+  fKinematics(aPair.fKinematics),
   fNonIdParNotCalculatedGlobal(aPair.fNonIdParNotCalculatedGlobal),
   fMergingParNotCalculated(aPair.fMergingParNotCalculated),
   fWeightedAvSep(aPair.fWeightedAvSep),
@@ -173,11 +161,7 @@ AliFemtoPair& AliFemtoPair::operator=(const AliFemtoPair &aPair)
   fPairAngleEP = aPair.fPairAngleEP;
 
   fNonIdParNotCalculated = aPair.fNonIdParNotCalculated;
-  fDKSide = aPair.fDKSide;
-  fDKOut = aPair.fDKOut;
-  fDKLong = aPair.fDKLong;
-  fCVK = aPair.fCVK;
-  fKStarCalc = aPair.fKStarCalc;
+  fKinematics = aPair.fKinematics;
 
   fNonIdParNotCalculatedGlobal = aPair.fNonIdParNotCalculatedGlobal;
 
@@ -219,22 +203,6 @@ double AliFemtoPair::GetPairAngleEP() const
 	return fPairAngleEP;
 }
 //_________________
-double AliFemtoPair::MInv() const
-{
-  // invariant mass
-    double tInvariantMass = abs(fTrack1->FourMomentum() + fTrack2->FourMomentum());
-    return (tInvariantMass);
-}
-//_________________
-double AliFemtoPair::KT() const
-{
-  // transverse momentum
-  double tmp = (fTrack1->FourMomentum() + fTrack2->FourMomentum()).Perp();
-  tmp *= .5;
-
-  return (tmp);
-}
-//_________________
 double AliFemtoPair::Rap() const
 {
   // longitudinal pair rapidity : Y = 0.5 ::log( E1 + E2 + pz1 + pz2 / E1 + E2 - pz1 - pz2 )
@@ -712,26 +680,31 @@ void AliFemtoPair::CalcNonIdPar() const
   // Calculate generalized relative mometum
   // Use this instead of qXYZ() function when calculating
   // anything for non-identical particles
+  //
+  // All kinematic variables of the pair (qinv, kT, minv, k* and its
+  // components) are filled here at once, so that the boosts are done
+  // only once per pair, whichever cut or CF asks first.
   fNonIdParNotCalculated=0;
-  double px1 = fTrack1->FourMomentum().vect().x();
-  double py1 = fTrack1->FourMomentum().vect().y();
-  double pz1 = fTrack1->FourMomentum().vect().z();
-  double pE1  = fTrack1->FourMomentum().e();
-  double tParticle1Mass;
-  if((pE1*pE1 - px1*px1 - py1*py1 - pz1*pz1)>0)
-    tParticle1Mass = ::sqrt(pE1*pE1 - px1*px1 - py1*py1 - pz1*pz1);
-  else
-    tParticle1Mass = 0;
-
-  double px2 = fTrack2->FourMomentum().vect().x();
-  double py2 = fTrack2->FourMomentum().vect().y();
-  double pz2 = fTrack2->FourMomentum().vect().z();
-  double pE2  = fTrack2->FourMomentum().e();
-  double tParticle2Mass;
-  if((pE2*pE2 - px2*px2 - py2*py2 - pz2*pz2)>0)
-    tParticle2Mass = ::sqrt(pE2*pE2 - px2*px2 - py2*py2 - pz2*pz2);
-  else
-    tParticle2Mass = 0;
+  const AliFemtoLorentzVector &tP1 = fTrack1->FourMomentum(),
+                              &tP2 = fTrack2->FourMomentum();
+
+  fKinematics.fQInv = -1.* (tP1-tP2).m();
+  const AliFemtoLorentzVector tPSum = tP1 + tP2;
+  fKinematics.fKT = tPSum.Perp();
+  fKinematics.fKT *= .5;
+  fKinematics.fMInv = abs(tPSum);
+
+  double px1 = tP1.vect().x();
+  double py1 = tP1.vect().y();
+  double pz1 = tP1.vect().z();
+  double pE1  = tP1.e();
+  double tParticle1Mass = fTrack1->Mass();
+
+  double px2 = tP2.vect().x();
+  double py2 = tP2.vect().y();
+  double pz2 = tP2.vect().z();
+  double pE2  = tP2.e();
+  double tParticle2Mass = fTrack2->Mass();
 
   double tPx = px1+px2;
   double tPy = py1+py2;
@@ -750,7 +723,7 @@ void AliFemtoPair::CalcNonIdPar() const
   double tQ = (tParticle1Mass*tParticle1Mass - tParticle2Mass*tParticle2Mass)/tPinv;
   tQ = sqrt ( tQ*tQ - tQinvL);
 
-  fKStarCalc = tQ/2;
+  fKinematics.fKStar = tQ/2;
 
   // ad 1) go to LCMS
   double beta = tPz/tPE;
@@ -760,14 +733,14 @@ void AliFemtoPair::CalcNonIdPar() const
   double pE1L = gamma * (pE1 - beta * pz1);
 
   // fill histogram for beam projection ( z - axis )
-  fDKLong = pz1L;
+  fKinematics.fKStarLong = pz1L;
 
   // ad 2) rotation px -> tPt
   double px1R = (px1*tPx + py1*tPy)/tPtrans;
   double py1R = (-px1*tPy + py1*tPx)/tPtrans;
 
   //fill histograms for side projection ( y - axis )
-  fDKSide = py1R;
+  fKinematics.fKStarSide = py1R;
 
   // ad 3) go from LCMS to CMS
   beta = tPtrans/tMtrans;
@@ -776,9 +749,9 @@ void AliFemtoPair::CalcNonIdPar() const
   double px1C = gamma * (px1R - beta * pE1L);
 
   // fill histogram for out projection ( x - axis )
-  fDKOut  = px1C;
+  fKinematics.fKStarOut  = px1C;
 
-  fCVK = (fDKOut*tPtrans + fDKLong*tPz)/fKStarCalc/::sqrt(tPtrans*tPtrans+tPz*tPz);
+  fKinematics.fCVK = (fKinematics.fKStarOut*tPtrans + fKinematics.fKStarLong*tPz)/fKinematics.fKStar/::sqrt(tPtrans*tPtrans+tPz*tPz);
 }
 
 
@@ -17,6 +17,22 @@
 #include "AliFemtoParticle.h"
 #include "AliFemtoTypes.h"
 
+/// \struct AliFemtoPairKinematics
+/// \brief Kinematic variables of a pair, computed together in a single pass
+///
+/// Filled on the first request after the tracks of the pair have been set,
+/// then shared by all pair cuts and correlation functions reading the pair.
+struct AliFemtoPairKinematics {
+  double fQInv;      ///< invariant momentum difference
+  double fKT;        ///< half of the pair transverse momentum
+  double fMInv;      ///< invariant mass
+  double fKStar;     ///< momentum of first particle in PRF - k*
+  double fKStarOut;  ///< k* out component
+  double fKStarSide; ///< k* side component
+  double fKStarLong; ///< k* long component
+  double fCVK;       ///< cos between velocity and relative momentum k*
+};
+
 class AliFemtoPair {
 public:
   AliFemtoPair();
@@ -32,6 +48,9 @@ public:
   void SetTrack1(const AliFemtoParticle* trkPtr);
   void SetTrack2(const AliFemtoParticle* trkPtr);
 
+  /// All cached kinematic variables of the pair (computed once per pair)
+  const AliFemtoPairKinematics& Kinematics() const;
+
   AliFemtoLorentzVector FourMomentumDiff() const;
   AliFemtoLorentzVector FourMomentumSum() const;
   double QInv() const;
@@ -164,12 +183,8 @@ private:
 
   double fPairAngleEP;	//Pair emission angle wrt EP
 
-  mutable short fNonIdParNotCalculated; // Set to 1 when NonId variables (kstar) have been already calculated for this pair
-  mutable double fDKSide; // momemntum of first particle in PRF - k* side component
-  mutable double fDKOut;  // momemntum of first particle in PRF - k* out component
-  mutable double fDKLong; // momemntum of first particle in PRF - k* long component
-  mutable double fCVK;    // cos between velocity and relative momentum k*
-  mutable double fKStarCalc; // momemntum of first particle in PRF - k*
+  mutable short fNonIdParNotCalculated; // Set to 1 when the kinematic variables (qinv, kT, k*, ...) must be recalculated for this pair
+  mutable AliFemtoPairKinematics fKinematics; // Kinematic variables of the pair
   void CalcNonIdPar() const;
 
   mutable short fNonIdParNotCalculatedGlobal; // If global k* was calculated
@@ -250,43 +265,44 @@ inline void AliFemtoPair::SetTrack2(const AliFemtoParticle* trkPtr){
 inline AliFemtoParticle* AliFemtoPair::Track1() const {return fTrack1;}
 inline AliFemtoParticle* AliFemtoPair::Track2() const {return fTrack2;}
 
-inline double AliFemtoPair::KSide() const{
+inline const AliFemtoPairKinematics& AliFemtoPair::Kinematics() const{
   if(fNonIdParNotCalculated) CalcNonIdPar();
-  return fDKSide;
+  return fKinematics;
+}
+inline double AliFemtoPair::KSide() const{
+  return Kinematics().fKStarSide;
 }
 inline double AliFemtoPair::KOut() const{
-  if(fNonIdParNotCalculated) CalcNonIdPar();
-  return fDKOut;
+  return Kinematics().fKStarOut;
 }
 inline double AliFemtoPair::KLong() const{
-  if(fNonIdParNotCalculated) CalcNonIdPar();
-  return fDKLong;
+  return Kinematics().fKStarLong;
 }
 inline double AliFemtoPair::KStar() const{
-  if(fNonIdParNotCalculated) CalcNonIdPar();
-  return fKStarCalc;
+  return Kinematics().fKStar;
 }
 inline double AliFemtoPair::QInv() const {
-  AliFemtoLorentzVector tDiff = (fTrack1->FourMomentum()-fTrack2->FourMomentum());
-  return ( -1.* tDiff.m());
+  return Kinematics().fQInv;
+}
+inline double AliFemtoPair::KT() const {
+  return Kinematics().fKT;
+}
+inline double AliFemtoPair::MInv() const {
+  return Kinematics().fMInv;
 }
 
 // Fabrice private <<<
 inline double AliFemtoPair::KStarSide() const{
-  if(fNonIdParNotCalculated) CalcNonIdPar();
-  return fDKSide;//mKStarSide;
+  return Kinematics().fKStarSide;//mKStarSide;
 }
 inline double AliFemtoPair::KStarOut() const{
-  if(fNonIdParNotCalculated) CalcNonIdPar();
-  return fDKOut;//mKStarOut;
+  return Kinematics().fKStarOut;//mKStarOut;
 }
 inline double AliFemtoPair::KStarLong() const{
-  if(fNonIdParNotCalculated) CalcNonIdPar();
-  return fDKLong;//mKStarLong;
+  return Kinematics().fKStarLong;//mKStarLong;
 }
 inline double AliFemtoPair::CVK() const{
-  if(fNonIdParNotCalculated) CalcNonIdPar();
-  return fCVK;
+  return Kinematics().fCVK;
 }
 
 inline float AliFemtoPair::PionPairProbability() const{
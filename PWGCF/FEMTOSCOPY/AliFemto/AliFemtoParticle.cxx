@@ -33,6 +33,7 @@ AliFemtoParticle::AliFemtoParticle() :
   fKink(NULL),
   fXi(NULL),
   fFourMomentum(),
+  fMass(-1.0),
   fHelix(),
   fHiddenInfo(NULL),
   fPrimaryVertex(),
@@ -54,6 +55,7 @@ AliFemtoParticle::AliFemtoParticle(const AliFemtoParticle &aParticle):
   fKink(NULL),
   fXi(NULL),
   fFourMomentum(aParticle.fFourMomentum),
+  fMass(-1.0),
   fHelix(aParticle.fHelix),
   fHiddenInfo(NULL),
   fPrimaryVertex(aParticle.fPrimaryVertex),
@@ -97,6 +99,7 @@ AliFemtoParticle::AliFemtoParticle(const AliFemtoTrack *const hbtTrack, const do
   fKink(NULL),
   fXi(NULL),
   fFourMomentum(::sqrt(hbtTrack->P().Mag2() + mass*mass), hbtTrack->P()),
+  fMass(-1.0),
   fHelix(hbtTrack->Helix()),
   fHiddenInfo(NULL),
   fPrimaryVertex(),
@@ -131,6 +134,7 @@ AliFemtoParticle::AliFemtoParticle(const AliFemtoV0 *const hbtV0, const double &
   fKink(NULL),
   fXi(NULL),
   fFourMomentum(::sqrt(hbtV0->MomV0().Mag2() + mass*mass), hbtV0->MomV0()),
+  fMass(-1.0),
   fHelix(),
   fHiddenInfo(NULL),
   fPrimaryVertex(hbtV0->PrimaryVertex()),
@@ -156,6 +160,7 @@ AliFemtoParticle::AliFemtoParticle(const AliFemtoKink *const hbtKink, const doub
   fKink(new AliFemtoKink(*hbtKink)),
   fXi(NULL),
   fFourMomentum(::sqrt(hbtKink->Parent().P().Mag2() + mass*mass), hbtKink->Parent().P()),
+  fMass(-1.0),
   fHelix(),
 //   fNominalTpcExitPoint(0),
 //   fNominalTpcEntrancePoint(0),
@@ -180,6 +185,7 @@ AliFemtoParticle::AliFemtoParticle(const AliFemtoXi *const hbtXi, const double &
   fKink(NULL),
   fXi(new AliFemtoXi(*hbtXi)),
   fFourMomentum(::sqrt(hbtXi->MomXi().Mag2() + mass*mass), hbtXi->MomXi()),
+  fMass(-1.0),
   fHelix(),
 //   fNominalTpcExitPoint(0),
 //   fNominalTpcEntrancePoint(0),
@@ -224,6 +230,7 @@ AliFemtoParticle &AliFemtoParticle::operator=(const AliFemtoParticle &aParticle)
     fXi = new AliFemtoXi(*aParticle.fXi);
 
   fFourMomentum = aParticle.fFourMomentum;
+  fMass = aParticle.fMass;
   fHelix = aParticle.fHelix;
 
   fPrimaryVertex = aParticle.fPrimaryVertex;
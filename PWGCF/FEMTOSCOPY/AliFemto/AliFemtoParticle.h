@@ -34,6 +34,9 @@ public:
   AliFemtoParticle &operator=(const AliFemtoParticle &aParticle);
 
   const AliFemtoLorentzVector& FourMomentum() const;
+  /// Mass from the four-momentum, sqrt(E^2 - p^2) or 0 if not timelike,
+  /// evaluated once per particle and shared by all pairs it enters
+  double Mass() const;
 
   AliFmPhysicalHelixD& Helix();
 
@@ -93,6 +96,7 @@ private:
   AliFemtoXi *fXi;        // copy of the Xi the particle was formed of, else Null
 
   AliFemtoLorentzVector fFourMomentum; // Particle momentum
+  mutable double fMass;                // Mass from fFourMomentum, negative until first requested
   AliFmPhysicalHelixD fHelix;          // Particle trajectory helix
   //unsigned long  fMap[2];
   //int fNhits;
@@ -197,6 +201,18 @@ inline void AliFemtoParticle::SetHiddenInfo(AliFemtoHiddenInfo *aHiddenInfo)
 inline void AliFemtoParticle::ResetFourMomentum(const AliFemtoLorentzVector &vec)
 {
   fFourMomentum = vec;
+  fMass = -1.0;
+}
+inline double AliFemtoParticle::Mass() const
+{
+  if (fMass < 0.0) {
+    const double px = fFourMomentum.vect().x(),
+                 py = fFourMomentum.vect().y(),
+                 pz = fFourMomentum.vect().z(),
+                 pE = fFourMomentum.e();
+    fMass = ((pE*pE - px*px - py*py - pz*pz) > 0) ? ::sqrt(pE*pE - px*px - py*py - pz*pz) : 0.0;
+  }
+  return fMass;
 }
 
 inline AliFemtoKink *AliFemtoParticle::Kink() const
@@ -30,19 +30,22 @@
 #define AliFemtoParticleCollection_hh
 #include "AliFemtoParticle.h"
 #include <list>
+#include <vector>
 
 #if !defined(ST_NO_NAMESPACES)
 using std::list;
 #endif
 
+// Particle collections are only ever filled with push_back and then
+// iterated (mostly in the O(N^2) pair loops), so contiguous storage is used.
 #ifdef ST_NO_TEMPLATE_DEF_ARGS
-typedef list<AliFemtoParticle *, allocator<AliFemtoParticle *> >            AliFemtoParticleCollection;
-typedef list<AliFemtoParticle *, allocator<AliFemtoParticle *> >::iterator  AliFemtoParticleIterator;
-typedef list<AliFemtoParticle *, allocator<AliFemtoParticle *> >::const_iterator  AliFemtoParticleConstIterator;
+typedef std::vector<AliFemtoParticle *, allocator<AliFemtoParticle *> >            AliFemtoParticleCollection;
+typedef std::vector<AliFemtoParticle *, allocator<AliFemtoParticle *> >::iterator  AliFemtoParticleIterator;
+typedef std::vector<AliFemtoParticle *, allocator<AliFemtoParticle *> >::const_iterator  AliFemtoParticleConstIterator;
 #else
-typedef list<AliFemtoParticle *>            AliFemtoParticleCollection;
-typedef list<AliFemtoParticle *>::iterator  AliFemtoParticleIterator;
-typedef list<AliFemtoParticle *>::const_iterator  AliFemtoParticleConstIterator;
+typedef std::vector<AliFemtoParticle *>            AliFemtoParticleCollection;
+typedef std::vector<AliFemtoParticle *>::iterator  AliFemtoParticleIterator;
+typedef std::vector<AliFemtoParticle *>::const_iterator  AliFemtoParticleConstIterator;
 #endif
 
 #endif
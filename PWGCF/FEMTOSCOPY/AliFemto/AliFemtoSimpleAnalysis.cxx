@@ -11,6 +11,7 @@
 #include "AliFemtoPicoEvent.h"
 
 #include <string>
+#include <cstring>
 #include <iostream>
 #include <iterator>
 
@@ -183,11 +184,16 @@ AliFemtoSimpleAnalysis::AliFemtoSimpleAnalysis():
   fMinSizePartCollection(0),
   fVerbose(kTRUE),
   fPerformSharedDaughterCut(kFALSE),
-  fEnablePairMonitors(kFALSE)
+  fEnablePairMonitors(kFALSE),
+  fPairPool(fgkPairBlockSize),
+  fPairBlock(fgkPairBlockSize, nullptr)
 {
   // Default constructor
   fCorrFctnCollection = new AliFemtoCorrFctnCollection;
   fMixingBuffer = new AliFemtoPicoEventCollection;
+  for (unsigned int i = 0; i < fgkPairBlockSize; ++i) {
+    fPairBlock[i] = &fPairPool[i];
+  }
 }
 //____________________________
 AliFemtoSimpleAnalysis::AliFemtoSimpleAnalysis(const AliFemtoSimpleAnalysis& a):
@@ -205,9 +211,14 @@ AliFemtoSimpleAnalysis::AliFemtoSimpleAnalysis(const AliFemtoSimpleAnalysis& a):
   fMinSizePartCollection(a.fMinSizePartCollection),
   fVerbose(a.fVerbose),
   fPerformSharedDaughterCut(a.fPerformSharedDaughterCut),
-  fEnablePairMonitors(a.fEnablePairMonitors)
+  fEnablePairMonitors(a.fEnablePairMonitors),
+  fPairPool(fgkPairBlockSize),
+  fPairBlock(fgkPairBlockSize, nullptr)
 {
   /// Copy constructor
+  for (unsigned int i = 0; i < fgkPairBlockSize; ++i) {
+    fPairBlock[i] = &fPairPool[i];
+  }
 
   const char msg_template[] = " AliFemtoSimpleAnalysis::AliFemtoSimpleAnalysis(const AliFemtoSimpleAnalysis& a) - %s",
             warn_template[] = " WARNING [AliFemtoSimpleAnalysis::AliFemtoSimpleAnalysis(const AliFemtoSimpleAnalysis& a)] %s";
@@ -585,69 +596,69 @@ void AliFemtoSimpleAnalysis::MakePairs(const char* typeIn,
 /// AddMixedPair() methods. If no second particle collection is
 /// specfied, make pairs within first particle collection.
 
-  const string type = typeIn;
-
-  //  int swpart = ((long int) partCollection1) % 2;
+  // Resolve the real/mixed dispatch once per call, not once per pair
+  void (AliFemtoCorrFctn::*tAddPairs)(AliFemtoPair**, int) = nullptr;
+  if (strcmp(typeIn, "real") == 0) {
+    tAddPairs = &AliFemtoCorrFctn::AddRealPairs;
+  } else if (strcmp(typeIn, "mixed") == 0) {
+    tAddPairs = &AliFemtoCorrFctn::AddMixedPairs;
+  } else {
+    cout << "Problem with pair type, type = " << typeIn << endl;
+    return;
+  }
 
   // Used to swap particle 1 & 2 in identical-particle analysis
   // to avoid any implicit ordering in the event collection
   // "Seed" this here.
   bool swpart = fNeventsProcessed % 2;
 
-  // Setup iterator ranges
+  // Setup index ranges
   //
   // The outer loop alway starts at beginning of particle collection 1.
   // * If we are iterating over both particle collections, then the loop simply
   // runs through both from beginning to end.
   // * If we are only iterating over one particle collection, the inner loop
-  // loops over all particles between the outer iterator and the end of the
+  // loops over all particles after the outer index up to the end of the
   // collection. The outer loop must skip the last entry of the list.
-  AliFemtoParticleConstIterator tStartOuterLoop = partCollection1->begin(),
-                                tEndOuterLoop = partCollection1->end(),
-                                tStartInnerLoop,
-                                tEndInnerLoop;
-
-  if (partCollection2) {                         // Two collections:
-    tStartInnerLoop = partCollection2->begin();  //   Full inner & outer loops
-    tEndInnerLoop   = partCollection2->end();    //
-  }
-  else {                                         // One collection:
-    tEndOuterLoop--;                             //   Outer loop goes to next-to-last particle
-    tEndInnerLoop = partCollection1->end() ;     //   Inner loop goes to last particle
-  }
-
-  // Create the pair outside the loop - only allocate once
-  AliFemtoPair* tPair = new AliFemtoPair;
+  AliFemtoParticle* const* tParticles1 = partCollection1->data();
+  AliFemtoParticle* const* tParticles2 = partCollection2 ? partCollection2->data()
+                                                         : tParticles1;
+  const size_t tSize1 = partCollection1->size(),
+               tSize2 = partCollection2 ? partCollection2->size() : tSize1;
+
+  // Passing pairs are collected in fPairPool and flushed block by block
+  unsigned int tNPairs = 0;
+  const auto flush_block = [&] () {
+    for (auto &tCorrFctn : *fCorrFctnCollection) {
+      (tCorrFctn->*tAddPairs)(fPairBlock.data(), tNPairs);
+    }
+    tNPairs = 0;
+  };
 
   // Begin the outer loop
-  for (AliFemtoParticleConstIterator tPartIter1 = tStartOuterLoop;
-                                     tPartIter1 != tEndOuterLoop;
-                                     ++tPartIter1) {
+  for (size_t i = 0; i < tSize1; ++i) {
+
+    AliFemtoParticle *tPart1 = tParticles1[i];
 
     // If analyzing identical particles, start inner loop at the particle
     // after the current outer loop position, (loops until end)
-    if (!partCollection2) {
-      tStartInnerLoop = tPartIter1;
-      tStartInnerLoop++;
-    }
-
-    // If we have two collections - set the first track
-    if (partCollection2 != nullptr) {
-      tPair->SetTrack1(*tPartIter1);
-    }
+    const size_t tStartInner = partCollection2 ? 0 : i + 1;
 
     // Begin the inner loop
-    for (AliFemtoParticleConstIterator tPartIter2 = tStartInnerLoop;
-                                       tPartIter2 != tEndInnerLoop;
-                                     ++tPartIter2) {
-      // If we have two collections - only set the second track
+    for (size_t j = tStartInner; j < tSize2; ++j) {
+
+      AliFemtoParticle *tPart2 = tParticles2[j];
+      AliFemtoPair *tPair = fPairBlock[tNPairs];
+
+      // If we have two collections - keep the order
       if (partCollection2 != nullptr) {
-        tPair->SetTrack2(*tPartIter2);
+        tPair->SetTrack1(tPart1);
+        tPair->SetTrack2(tPart2);
 
       // Swap between first and second particles to avoid biased ordering
       } else {
-        tPair->SetTrack1(swpart ? *tPartIter2 : *tPartIter1);
-        tPair->SetTrack2(swpart ? *tPartIter1 : *tPartIter2);
+        tPair->SetTrack1(swpart ? tPart2 : tPart1);
+        tPair->SetTrack2(swpart ? tPart1 : tPart2);
         swpart = !swpart;
       }
 
@@ -659,23 +670,19 @@ void AliFemtoSimpleAnalysis::MakePairs(const char* typeIn,
         fPairCut->FillCutMonitor(tPair, tmpPassPair);
       }
 
-      // If pair passes cut, loop over CF's and add pair to real/mixed
-      if (tmpPassPair) {
-        for (auto &tCorrFctn : *fCorrFctnCollection) {
-          if (type == "real")
-            tCorrFctn->AddRealPair(tPair);
-          else if(type == "mixed")
-            tCorrFctn->AddMixedPair(tPair);
-          else
-            cout << "Problem with pair type, type = " << type << endl;
-        } // loop over corellatoin functions
+      // If pair passes cut, keep it for the CFs (pair object is not reused
+      // until the block has been flushed)
+      if (tmpPassPair && ++tNPairs == fgkPairBlockSize) {
+        flush_block();
       }
 
     }    // loop over second particle
   }      // loop over first particle
 
-  // we are done with the pair
-  delete tPair;
+  // hand the remaining pairs to the CFs
+  if (tNPairs > 0) {
+    flush_block();
+  }
 }
 //_________________________
 void AliFemtoSimpleAnalysis::EventBegin(const AliFemtoEvent* ev)
@@ -16,6 +16,8 @@
 #include "AliFemtoV0SharedDaughterCut.h"
 #include "AliFemtoXiSharedDaughterCut.h"
 
+#include <vector>
+
 class AliFemtoPicoEventCollectionVectorHideAway;
 class AliFemtoPicoEvent;
 
@@ -153,7 +155,10 @@ protected:
   /// specfied, make pairs within first particle collection.
   ///
   /// \param type Either the string "real" or "mixed", specifying which method
-  ///             to call (AddRealPair or AddMixedPair)
+  ///             to call (AddRealPairs or AddMixedPairs)
+  ///
+  /// Pairs passing the pair cut are collected in blocks of
+  /// fgkPairBlockSize and handed to the correlation functions at once.
   void MakePairs(const char* type,
                  AliFemtoParticleCollection* ParticlesPassingCut1,
                  AliFemtoParticleCollection* ParticlesPssingCut2=NULL,
@@ -178,6 +183,10 @@ protected:
   Bool_t fPerformSharedDaughterCut;
   Bool_t fEnablePairMonitors;
 
+  static const unsigned int fgkPairBlockSize = 64;   ///< number of passing pairs handed to the correlation functions at once
+  std::vector<AliFemtoPair> fPairPool;               //!<! pair objects reused by MakePairs, allocated once
+  std::vector<AliFemtoPair*> fPairBlock;             //!<! pointers into fPairPool, as passed to AddRealPairs/AddMixedPairs
+
 #ifdef __ROOT__
   /// \cond CLASSIMP
   ClassDef(AliFemtoSimpleAnalysis, 0);
@@ -153,17 +153,18 @@ void AliFemtoDreamPairCleaner::CleanDecay(
 }
 
 void AliFemtoDreamPairCleaner::StoreParticle(
-    std::vector<AliFemtoDreamBasePart> Particles) {
+    const std::vector<AliFemtoDreamBasePart> &Particles) {
   int counter = 0;
-  std::vector<AliFemtoDreamBasePart> tmpParticles;
-  for (auto itPart : Particles) {
+  fParticles.emplace_back();
+  std::vector<AliFemtoDreamBasePart> &tmpParticles = fParticles.back();
+  tmpParticles.reserve(Particles.size());
+  for (const auto &itPart : Particles) {
     if (itPart.UseParticle()) {
       tmpParticles.push_back(itPart);
     } else {
       counter++;
     }
   }
-  fParticles.push_back(tmpParticles);
 }
 void AliFemtoDreamPairCleaner::ResetArray() {
   fParticles.clear();
@@ -32,7 +32,7 @@ class AliFemtoDreamPairCleaner {
   void FillInvMassPair(std::vector<AliFemtoDreamBasePart> &Part1, int PDGCode1,
                        std::vector<AliFemtoDreamBasePart> &Part2, int PDGCode2,
                        int histnumber);
-  void StoreParticle(std::vector<AliFemtoDreamBasePart> Particles);
+  void StoreParticle(const std::vector<AliFemtoDreamBasePart> &Particles);
   TList* GetHistList() {
     return fHists->GetHistList();
   }
@@ -12,13 +12,15 @@
 ClassImp(AliFemtoDreamPartContainer)
 AliFemtoDreamPartContainer::AliFemtoDreamPartContainer()
     : fPartBuffer(),
-      fMixingDepth(0) {
+      fMixingDepth(0),
+      fFirstEvent(0) {
 
 }
 
 AliFemtoDreamPartContainer::AliFemtoDreamPartContainer(int MixingDepth)
     : fPartBuffer(),
-      fMixingDepth(MixingDepth) {
+      fMixingDepth(MixingDepth),
+      fFirstEvent(0) {
 
 }
 
@@ -36,39 +38,47 @@ AliFemtoDreamPartContainer& AliFemtoDreamPartContainer::operator=(
 //  }
   this->fMixingDepth = obj.fMixingDepth;
   this->fPartBuffer = obj.fPartBuffer;
+  this->fFirstEvent = obj.fFirstEvent;
   return (*this);
 }
 
 AliFemtoDreamPartContainer::~AliFemtoDreamPartContainer() {
 }
 
+std::vector<AliFemtoDreamBasePart> &AliFemtoDreamPartContainer::NextSlot() {
+  //Returns the slot for the next event: a new one while the buffer is not
+  //full, otherwise the one of the oldest event, which is then dropped.
+  if (fPartBuffer.capacity() < fMixingDepth) {
+    fPartBuffer.reserve(fMixingDepth);
+  }
+  if (fPartBuffer.size() < fMixingDepth) {
+    fPartBuffer.emplace_back();
+    return fPartBuffer.back();
+  }
+  std::vector<AliFemtoDreamBasePart> &slot = fPartBuffer[fFirstEvent];
+  fFirstEvent = (fFirstEvent + 1) % fPartBuffer.size();
+  return slot;
+}
+
 void AliFemtoDreamPartContainer::SetEvent(
-    std::vector<AliFemtoDreamBasePart> &Particles) {
-  if (!(fPartBuffer.size() < fMixingDepth)) {
-//    std::cout << "Popping Front" << std::endl;
-    fPartBuffer.pop_front();
+    const std::vector<AliFemtoDreamBasePart> &Particles) {
+  if (fMixingDepth == 0) {
+    return;
   }
-  fPartBuffer.push_back(Particles);
-//  std::cout << "PartBuffer Size: "<<fPartBuffer.size()<<'\t'<<"Input Size: "
-//      << Particles.size() << '\n';
+  //Copy assignment reuses the memory of the replaced event
+  NextSlot() = Particles;
   return;
 }
 
 void AliFemtoDreamPartContainer::PrintLastEvent() {
-  for (std::deque<std::vector<AliFemtoDreamBasePart>>::iterator itEvt =
-      fPartBuffer.begin(); itEvt != fPartBuffer.end(); ++itEvt) {
-    std::cout << "Printing Last Event with size: " << itEvt->size() << '\n';
-    for (std::vector<AliFemtoDreamBasePart>::iterator itPart = itEvt->begin();
-        itPart != itEvt->end(); ++itPart) {
+  for (unsigned int iDepth = 0; iDepth < fPartBuffer.size(); ++iDepth) {
+    std::vector<AliFemtoDreamBasePart> &itEvt = GetEvent(iDepth);
+    std::cout << "Printing Last Event with size: " << itEvt.size() << '\n';
+    for (std::vector<AliFemtoDreamBasePart>::iterator itPart = itEvt.begin();
+        itPart != itEvt.end(); ++itPart) {
       TVector3 P(itPart->GetMomentum());
       std::cout << "Px: " << P.X() << '\t' << "Py: " << P.Y() << '\t' << "Pz: "
                 << P.Z() << std::endl;
     }
   }
 }
-std::vector<AliFemtoDreamBasePart> &AliFemtoDreamPartContainer::GetEvent(
-    int Depth) {
-  std::deque<std::vector<AliFemtoDreamBasePart>>::iterator itEvt = fPartBuffer
-      .begin() + Depth;
-  return *itEvt;
-}
@@ -7,7 +7,6 @@
 
 #ifndef ALIFEMTODREAMPARTCONTAINER_H_
 #define ALIFEMTODREAMPARTCONTAINER_H_
-#include <deque>
 #include <vector>
 #include "Rtypes.h"
 
@@ -16,6 +15,10 @@
 //Class Containing the Particles from previous Events up to a certain mixing
 //depth for one Particle Species and Mult/ZVtx Bin
 //ZVtx bin.
+//The events are kept in a ring buffer of fMixingDepth slots. A new event
+//overwrites the slot of the oldest one, so that the particle vectors (and the
+//vectors inside the particles) keep their capacity from event to event and
+//references to stored events stay valid until the event is replaced.
 class AliFemtoDreamPartContainer {
  public:
   AliFemtoDreamPartContainer();
@@ -23,19 +26,26 @@ class AliFemtoDreamPartContainer {
   AliFemtoDreamPartContainer& operator=(const AliFemtoDreamPartContainer& obj);
   virtual ~AliFemtoDreamPartContainer();
   void PrintLastEvent();
-  void SetEvent(std::vector<AliFemtoDreamBasePart> &Particles);
-  std::deque<std::vector<AliFemtoDreamBasePart>> GetEventBuffer() const {
+  void SetEvent(const std::vector<AliFemtoDreamBasePart> &Particles);
+  //Ring buffer storage, use GetEvent to access the events ordered in time
+  const std::vector<std::vector<AliFemtoDreamBasePart>> &GetEventBuffer() const {
     return fPartBuffer;
   }
   ;
-  std::vector<AliFemtoDreamBasePart> &GetEvent(int Depth);
+  //Depth 0 is the oldest stored event
+  std::vector<AliFemtoDreamBasePart> &GetEvent(int Depth) {
+    return fPartBuffer[(fFirstEvent + Depth) % fPartBuffer.size()];
+  }
+  ;
   unsigned int GetMixingDepth() const {
     return fPartBuffer.size();
   }
   ;
  private:
-  std::deque<std::vector<AliFemtoDreamBasePart>> fPartBuffer;
-  unsigned int fMixingDepth;ClassDef(AliFemtoDreamPartContainer,2)
+  std::vector<AliFemtoDreamBasePart> &NextSlot();
+  std::vector<std::vector<AliFemtoDreamBasePart>> fPartBuffer;
+  unsigned int fMixingDepth;
+  unsigned int fFirstEvent;ClassDef(AliFemtoDreamPartContainer,3)
   ;
 };
 
@@ -72,7 +72,7 @@ void AliFemtoDreamZVtxMultContainer::PairParticlesSE(
       //Now loop over the actual Particles and correlate them
       for (auto itPart1 = itSpec1->begin(); itPart1 != itSpec1->end();
           ++itPart1) {
-        AliFemtoDreamBasePart part1 = *itPart1;
+        AliFemtoDreamBasePart &part1 = *itPart1;
         std::vector<AliFemtoDreamBasePart>::iterator itPart2;
         if (itSpec1 == itSpec2) {
           itPart2 = itPart1 + 1;
@@ -80,7 +80,7 @@ void AliFemtoDreamZVtxMultContainer::PairParticlesSE(
           itPart2 = itSpec2->begin();
         }
         while (itPart2 != itSpec2->end()) {
-          AliFemtoDreamBasePart part2 = *itPart2;
+          AliFemtoDreamBasePart &part2 = *itPart2;
           RelativeK = RelativePairMomentum(itPart1->GetMomentum(), *itPDGPar1,
                                            itPart2->GetMomentum(), *itPDGPar2);
 
@@ -160,7 +160,7 @@ void AliFemtoDreamZVtxMultContainer::PairMCParticlesSE(
       //Now loop over the actual Particles and correlate them
       for (auto itPart1 = itSpec1->begin(); itPart1 != itSpec1->end();
           ++itPart1) {
-        AliFemtoDreamBasePart part1 = *itPart1;
+        AliFemtoDreamBasePart &part1 = *itPart1;
         std::vector<AliFemtoDreamBasePart>::iterator itPart2;
         if (itSpec1 == itSpec2) {
           itPart2 = itPart1 + 1;
@@ -168,7 +168,7 @@ void AliFemtoDreamZVtxMultContainer::PairMCParticlesSE(
           itPart2 = itSpec2->begin();
         }
         while (itPart2 != itSpec2->end()) {
-          AliFemtoDreamBasePart part2 = *itPart2;
+          AliFemtoDreamBasePart &part2 = *itPart2;
 
           // Delta eta - Delta phi* cut
           if (fDoDeltaEtaDeltaPhiCut) {
@@ -222,16 +222,17 @@ void AliFemtoDreamZVtxMultContainer::PairParticlesME(
                                               (int) itSpec2->GetMixingDepth());
       }
       for (int iDepth = 0; iDepth < (int) itSpec2->GetMixingDepth(); ++iDepth) {
-        std::vector<AliFemtoDreamBasePart> ParticlesOfEvent = itSpec2->GetEvent(
+        //Reference into the mixing buffer, the stored event is not copied
+        std::vector<AliFemtoDreamBasePart> &ParticlesOfEvent = itSpec2->GetEvent(
             iDepth);
         ResultsHist->FillPartnersME(HistCounter, itSpec1->size(),
                                     ParticlesOfEvent.size());
         for (auto itPart1 = itSpec1->begin(); itPart1 != itSpec1->end();
             ++itPart1) {
-          AliFemtoDreamBasePart part1 = *itPart1;
+          AliFemtoDreamBasePart &part1 = *itPart1;
           for (auto itPart2 = ParticlesOfEvent.begin();
               itPart2 != ParticlesOfEvent.end(); ++itPart2) {
-            AliFemtoDreamBasePart part2 = *itPart2;
+            AliFemtoDreamBasePart &part2 = *itPart2;
             RelativeK = RelativePairMomentum(itPart1->GetMomentum(), *itPDGPar1,
                                              itPart2->GetMomentum(),
                                              *itPDGPar2);
@@ -42,6 +42,8 @@ The names are available via the function PairClassName(Int_t i)
 //                                                                       //
 ///////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
+
 #include <TString.h>
 #include <TList.h>
 #include <TMath.h>
@@ -134,6 +136,8 @@ AliDielectron::AliDielectron() :
   fHistos(0x0),
   fUsedVars(new TBits(AliDielectronVarManager::kNMaxValues)),
   fPairCandidates(new TObjArray(11)),
+  fPairPool(),
+  fLegKFIndex(),
   fCfManagerPair(0x0),
   fTrackRotator(0x0),
   fRotatePP(kFALSE),
@@ -171,7 +175,7 @@ AliDielectron::AliDielectron() :
   //
   // Default constructor
   //
-
+  fPairPool.SetOwner();
 }
 
 //________________________________________________________________
@@ -211,6 +215,8 @@ AliDielectron::AliDielectron(const char* name, const char* title) :
   fHistos(0x0),
   fUsedVars(new TBits(AliDielectronVarManager::kNMaxValues)),
   fPairCandidates(new TObjArray(11)),
+  fPairPool(),
+  fLegKFIndex(),
   fCfManagerPair(0x0),
   fTrackRotator(0x0),
   fRotatePP(kFALSE),
@@ -247,7 +253,7 @@ AliDielectron::AliDielectron(const char* name, const char* title) :
   //
   // Named constructor
   //
-
+  fPairPool.SetOwner();
 }
 
 //________________________________________________________________
@@ -465,6 +471,7 @@ Bool_t AliDielectron::Process(AliVEvent *ev1, AliVEvent *ev2)
   //fill track arrays for the first event
   if (ev1){
     FillTrackArrays(ev1);
+    FillLegKFCache(0);
     if (((fPreFilterAllSigns1)||(fPreFilterUnlikeOnly1)) && !fPreFilterLikeOnly1 && ( fPairPreFilter1.GetCuts()->GetEntries()>0 )) PairPreFilter(0, 1, fTracks[0], fTracks[1], ev1, 1);
     if (((fPreFilterAllSigns2)||(fPreFilterUnlikeOnly2)) && !fPreFilterLikeOnly2 && ( fPairPreFilter2.GetCuts()->GetEntries()>0 )) PairPreFilter(0, 1, fTracks[0], fTracks[1], ev1, 2);
 
@@ -483,6 +490,7 @@ Bool_t AliDielectron::Process(AliVEvent *ev1, AliVEvent *ev2)
   //fill track arrays for the second event
   if (ev2) {
     FillTrackArrays(ev2,1);
+    FillLegKFCache(1);
     if (((fPreFilterAllSigns1)||(fPreFilterUnlikeOnly1)) && !fPreFilterLikeOnly1 && ( fPairPreFilter1.GetCuts()->GetEntries()>0 )) PairPreFilter(2, 3, fTracks[2], fTracks[3], ev2, 1);
     if (((fPreFilterAllSigns2)||(fPreFilterUnlikeOnly2)) && !fPreFilterLikeOnly2 && ( fPairPreFilter2.GetCuts()->GetEntries()>0 )) PairPreFilter(2, 3, fTracks[2], fTracks[3], ev2, 2);
 
@@ -1235,6 +1243,10 @@ void AliDielectron::PairPreFilter(Int_t arr1, Int_t arr2, TObjArray &arrTracks1,
 
     Int_t pairIndex=GetPairIndex(arr1RP,arr2RP);
 
+    //KF daughters of the tracks of this pass
+    GetLegKF(*arrTracks1RP,0);
+    GetLegKF(*arrTracks2RP,1);
+
     if( prefilterOnlyOnePair ){
       Double_t maxLikelihood1[ntrack1RP];
       Double_t maxLikelihood2[ntrack2RP];
@@ -1256,14 +1268,7 @@ void AliDielectron::PairPreFilter(Int_t arr1, Int_t arr2, TObjArray &arrTracks1,
           if (!track1 || !track2) continue;
           maxLikelihood2[itrack2] = -999.;
           //create the pair
-          if(prefilterPhotons){
-            candidate.SetGammaTracks(static_cast<AliVTrack*>(track1), fPdgLeg1,
-                              static_cast<AliVTrack*>(track2), fPdgLeg2);
-          }
-          else{
-            candidate.SetTracks(static_cast<AliVTrack*>(track1), fPdgLeg1,
-                              static_cast<AliVTrack*>(track2), fPdgLeg2);
-          }
+          SetPairTracks(&candidate, prefilterPhotons, track1, itrack1, track2, itrack2);
 
           candidate.SetType(pairIndex);
           candidate.SetLabel(AliDielectronMC::Instance()->GetLabelMotherWithPdg(&candidate,fPdgMother));
@@ -1308,14 +1313,7 @@ void AliDielectron::PairPreFilter(Int_t arr1, Int_t arr2, TObjArray &arrTracks1,
           TObject *track2=(*arrTracks2RP).UncheckedAt(itrack2);
           if (!track1 || !track2) continue;
           //create the pair
-          if(prefilterPhotons){
-            candidate.SetGammaTracks(static_cast<AliVTrack*>(track1), fPdgLeg1,
-                              static_cast<AliVTrack*>(track2), fPdgLeg2);
-          }
-          else{
-            candidate.SetTracks(static_cast<AliVTrack*>(track1), fPdgLeg1,
-                              static_cast<AliVTrack*>(track2), fPdgLeg2);
-          }
+          SetPairTracks(&candidate, prefilterPhotons, track1, itrack1, track2, itrack2);
 
           candidate.SetType(pairIndex);
           candidate.SetLabel(AliDielectronMC::Instance()->GetLabelMotherWithPdg(&candidate,fPdgMother));
@@ -1403,8 +1401,13 @@ void AliDielectron::FillPairArrays(Int_t arr1, Int_t arr2, const AliVEvent *ev)
   // select pairs and fill pair candidate arrays
   //
 
-  TObjArray arrTracks1=fTracks[arr1];
-  TObjArray arrTracks2=fTracks[arr2];
+  //working copies of the track arrays, the pre filter removes tracks from them
+  TObjArray &arrTracks1=fPairTracks[0];
+  TObjArray &arrTracks2=fPairTracks[1];
+  arrTracks1.Clear();
+  arrTracks2.Clear();
+  for (Int_t itrack=0; itrack<fTracks[arr1].GetEntriesFast(); ++itrack) arrTracks1.AddLast(fTracks[arr1].UncheckedAt(itrack));
+  for (Int_t itrack=0; itrack<fTracks[arr2].GetEntriesFast(); ++itrack) arrTracks2.AddLast(fTracks[arr2].UncheckedAt(itrack));
 
   //process pre filter if set
   if ((!fPreFilterAllSigns1) && (!fPreFilterUnlikeOnly1) && (!fPreFilterLikeOnly1) && ( fPairPreFilter1.GetCuts()->GetEntries()>0 ))  PairPreFilter(arr1, arr2, arrTracks1, arrTracks2, ev, 1);
@@ -1416,18 +1419,22 @@ void AliDielectron::FillPairArrays(Int_t arr1, Int_t arr2, const AliVEvent *ev)
   Int_t ntrack1=arrTracks1.GetEntriesFast();
   Int_t ntrack2=arrTracks2.GetEntriesFast();
 
-  AliDielectronPair *candidate=new AliDielectronPair;
+  AliDielectronPair *candidate=fPairPool.GetEntriesFast()>0 ?
+    static_cast<AliDielectronPair*>(fPairPool.RemoveAt(fPairPool.GetEntriesFast()-1)) : new AliDielectronPair;
   candidate->SetKFUsage(fUseKF);
 
   UInt_t selectedMask=(1<<fPairFilter.GetCuts()->GetEntries())-1;
 
+  //KF daughters of the selected tracks
+  GetLegKF(arrTracks1,0);
+  GetLegKF(arrTracks2,1);
+
   for (Int_t itrack1=0; itrack1<ntrack1; ++itrack1){
     Int_t end=ntrack2;
     if (arr1==arr2) end=itrack1;
     for (Int_t itrack2=0; itrack2<end; ++itrack2){
       //create the pair (direct pointer to the memory by this daughter reference are kept also for ME)
-      candidate->SetTracks(&(*static_cast<AliVTrack*>(arrTracks1.UncheckedAt(itrack1))), fPdgLeg1,
-                           &(*static_cast<AliVTrack*>(arrTracks2.UncheckedAt(itrack2))), fPdgLeg2);
+      SetPairTracks(candidate, kFALSE, arrTracks1.UncheckedAt(itrack1), itrack1, arrTracks2.UncheckedAt(itrack2), itrack2);
       candidate->SetType(pairIndex);
 
       Int_t label=AliDielectronMC::Instance()->GetLabelMotherWithPdg(candidate,fPdgMother);
@@ -1438,8 +1445,7 @@ void AliDielectron::FillPairArrays(Int_t arr1, Int_t arr2, const AliVEvent *ev)
       // check for gamma kf particle
       label=AliDielectronMC::Instance()->GetLabelMotherWithPdg(candidate,22);
       if (label>-1 && fUseGammaTracks) {
-        candidate->SetGammaTracks(static_cast<AliVTrack*>(arrTracks1.UncheckedAt(itrack1)), fPdgLeg1,
-                                  static_cast<AliVTrack*>(arrTracks2.UncheckedAt(itrack2)), fPdgLeg2);
+        SetPairTracks(candidate, kTRUE, arrTracks1.UncheckedAt(itrack1), itrack1, arrTracks2.UncheckedAt(itrack2), itrack2);
       // should we set the pdgmothercode and the label
       }
 
@@ -1464,12 +1470,105 @@ void AliDielectron::FillPairArrays(Int_t arr1, Int_t arr2, const AliVEvent *ev)
       //add the candidate to the candidate array
       PairArray(pairIndex)->Add(candidate);
       //get a new candidate
-      candidate=new AliDielectronPair;
+      candidate=fPairPool.GetEntriesFast()>0 ?
+        static_cast<AliDielectronPair*>(fPairPool.RemoveAt(fPairPool.GetEntriesFast()-1)) : new AliDielectronPair;
       candidate->SetKFUsage(fUseKF);
     }
   }
-  //delete the surplus candidate
-  delete candidate;
+  //return the surplus candidate to the pool
+  fPairPool.AddLast(candidate);
+}
+
+//________________________________________________________________
+void AliDielectron::FillLegKFCache(Int_t eventNr)
+{
+  //
+  // build the KF daughters of the selected tracks of event eventNr once,
+  // they are shared by the pre filters and the pairing of this event
+  //
+  if (fNoPairing && fPairPreFilter1.GetCuts()->GetEntries()==0 && fPairPreFilter2.GetCuts()->GetEntries()==0) return;
+
+  for (Int_t iarr=eventNr*2; iarr<eventNr*2+2; ++iarr){
+    for (Int_t itrack=0; itrack<fTracks[iarr].GetEntriesFast(); ++itrack){
+      AliVTrack *track=static_cast<AliVTrack*>(fTracks[iarr].UncheckedAt(itrack));
+      fLegKFIndex.push_back(std::make_pair(static_cast<const TObject*>(track),(Int_t)fLegKF[0].size()));
+      fLegKF[0].push_back(AliKFParticle(*track,fPdgLeg1));
+      if (fPdgLeg2!=fPdgLeg1) fLegKF[1].push_back(AliKFParticle(*track,fPdgLeg2));
+    }
+  }
+  std::sort(fLegKFIndex.begin(),fLegKFIndex.end());
+}
+
+//________________________________________________________________
+void AliDielectron::GetLegKF(const TObjArray &arrTracks, Int_t leg)
+{
+  //
+  // look up the cached KF daughters of the tracks in arrTracks for the leg
+  // hypothesis leg (0: fPdgLeg1, 1: fPdgLeg2), 0x0 if the track is not cached
+  // (e.g. tracks from the mixing pool)
+  //
+  std::vector<const AliKFParticle*> &kf=fPairKF[leg];
+  std::vector<AliKFParticle> &legKF=fLegKF[fPdgLeg2!=fPdgLeg1 ? leg : 0];
+  const Int_t ntracks=arrTracks.GetEntriesFast();
+  kf.assign(ntracks,0x0);
+  if (fLegKFIndex.empty()) return;
+
+  for (Int_t itrack=0; itrack<ntracks; ++itrack){
+    const TObject *track=arrTracks.UncheckedAt(itrack);
+    if (!track) continue;
+    std::vector<std::pair<const TObject*,Int_t> >::const_iterator it=
+      std::lower_bound(fLegKFIndex.begin(),fLegKFIndex.end(),std::make_pair(track,0));
+    if (it!=fLegKFIndex.end() && it->first==track) kf[itrack]=&legKF[it->second];
+  }
+}
+
+//________________________________________________________________
+void AliDielectron::SetPairTracks(AliDielectronPair *pair, Bool_t gamma, TObject *track1, Int_t itrack1, TObject *track2, Int_t itrack2)
+{
+  //
+  // set the pair daughters, using the cached KF daughters if available
+  // (call GetLegKF for both track arrays before)
+  //
+  AliVTrack *vtrack1=static_cast<AliVTrack*>(track1);
+  AliVTrack *vtrack2=static_cast<AliVTrack*>(track2);
+  const AliKFParticle *kf1=fPairKF[0][itrack1];
+  const AliKFParticle *kf2=fPairKF[1][itrack2];
+
+  if (kf1 && kf2) {
+    if (gamma) pair->SetGammaTracks(vtrack1, *kf1, vtrack2, *kf2);
+    else       pair->SetTracks(vtrack1, *kf1, vtrack2, *kf2);
+  } else {
+    if (gamma) pair->SetGammaTracks(vtrack1, fPdgLeg1, vtrack2, fPdgLeg2);
+    else       pair->SetTracks(vtrack1, fPdgLeg1, vtrack2, fPdgLeg2);
+  }
+}
+
+//________________________________________________________________
+void AliDielectron::ClearArrays()
+{
+  //
+  // Reset the Arrays
+  // the pairs are kept in the pool and reused for the next event
+  //
+  for (Int_t i=0;i<4;++i){
+    fTracks[i].Clear();
+  }
+  for (Int_t i=0;i<11;++i){
+    TObjArray *arr=PairArray(i);
+    if (!arr) continue;
+    for (Int_t ipair=0; ipair<arr->GetEntriesFast(); ++ipair){
+      TObject *pair=arr->UncheckedAt(ipair);
+      if (!pair) continue;
+      if (pair->IsA()==AliDielectronPair::Class()) fPairPool.AddLast(pair);
+      else delete pair;
+    }
+    arr->SetOwner(kFALSE);
+    arr->Clear();
+    arr->SetOwner(kTRUE);
+  }
+  fLegKFIndex.clear();
+  fLegKF[0].clear();
+  fLegKF[1].clear();
 }
 
 //________________________________________________________________
@@ -16,6 +16,9 @@
 //#####################################################
 
 
+#include <vector>
+#include <utility>
+
 #include <TNamed.h>
 #include <TObjArray.h>
 #include <THnBase.h>
@@ -244,6 +247,12 @@ private:
 
   TObjArray *fPairCandidates;     //! Pair candidate arrays
                                   //TODO: better way to store it? TClonesArray?
+  TObjArray fPairPool;            //! Pair objects released by ClearArrays, reused by FillPairArrays
+  TObjArray fPairTracks[2];       //! Working copies of the track arrays in FillPairArrays
+
+  std::vector<std::pair<const TObject*,Int_t> > fLegKFIndex; //! Selected tracks sorted by address -> index in fLegKF
+  std::vector<AliKFParticle> fLegKF[2];                      //! KF daughters of the selected tracks for fPdgLeg1, fPdgLeg2
+  std::vector<const AliKFParticle*> fPairKF[2];              //! KF daughters of the tracks in the current pair loop
 
   AliDielectronCF *fCfManagerPair;//Correction Framework Manager for the Pair
   AliDielectronTrackRotator *fTrackRotator; //Track rotator
@@ -280,6 +289,10 @@ private:
   void FillPairArrays(Int_t arr1, Int_t arr2, const AliVEvent *ev = 0x0);
   void FillPairArrayTR();
 
+  void FillLegKFCache(Int_t eventNr);
+  void GetLegKF(const TObjArray &arrTracks, Int_t leg);
+  void SetPairTracks(AliDielectronPair *pair, Bool_t gamma, TObject *track1, Int_t itrack1, TObject *track2, Int_t itrack2);
+
   Int_t GetPairIndex(Int_t arr1, Int_t arr2) const {return arr1>=arr2?arr1*(arr1+1)/2+arr2:arr2*(arr2+1)/2+arr1;}
 
   void InitPairCandidateArrays();
@@ -312,7 +325,7 @@ private:
   AliDielectron(const AliDielectron &c);
   AliDielectron &operator=(const AliDielectron &c);
 
-  ClassDef(AliDielectron,17);
+  ClassDef(AliDielectron,18);
 };
 
 inline void AliDielectron::InitPairCandidateArrays()
@@ -336,17 +349,4 @@ inline TObjArray* AliDielectron::PairArray(Int_t i)
   return static_cast<TObjArray*>(fPairCandidates->UncheckedAt(i));
 }
 
-inline void AliDielectron::ClearArrays()
-{
-  //
-  // Reset the Arrays
-  //
-  for (Int_t i=0;i<4;++i){
-    fTracks[i].Clear();
-  }
-  for (Int_t i=0;i<11;++i){
-    if (PairArray(i)) PairArray(i)->Delete();
-  }
-}
-
 #endif
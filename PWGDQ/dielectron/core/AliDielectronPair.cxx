@@ -111,43 +111,29 @@ void AliDielectronPair::SetTracks(AliVTrack * const particle1, Int_t pid1,
   // refParticle1 and 2 are the original tracks. In the case of track rotation
   // they are needed in the framework
   //
+  AliKFParticle kf1(*particle1,pid1);
+  AliKFParticle kf2(*particle2,pid2);
+  SetTracks(particle1, kf1, particle2, kf2);
+}
+
+//______________________________________________
+void AliDielectronPair::SetTracks(AliVTrack * const particle1, const AliKFParticle &kf1,
+                                  AliVTrack * const particle2, const AliKFParticle &kf2)
+{
+  //
+  // As SetTracks(particle1,pid1,particle2,pid2), but with the AliKF daughters
+  // already built for the given tracks (e.g. cached once per track and event)
+  //
   fPair.Initialize();
   fD1.Initialize();
   fD2.Initialize();
 
-  AliKFParticle kf1(*particle1,pid1);
-  AliKFParticle kf2(*particle2,pid2);
-
   fPair.AddDaughter(kf1);
   fPair.AddDaughter(kf2);
 
-  if (fRandomizeDaughters) {
-    if (fRandom3.Rndm()>0.5){
-      fRefD1 = particle1;
-      fRefD2 = particle2;
-      fD1+=kf1;
-      fD2+=kf2;
-    } else {
-      fRefD1 = particle2;
-      fRefD2 = particle1;
-      fD1+=kf2;
-      fD2+=kf1;
-    }
-  }
-  else { // usual behaviour, sort by pt
-    if (particle1->Pt()>particle2->Pt()){
-      fRefD1 = particle1;
-      fRefD2 = particle2;
-      fD1+=kf1;
-      fD2+=kf2;
-    } else {
-      fRefD1 = particle2;
-      fRefD2 = particle1;
-      fD1+=kf2;
-      fD2+=kf1;
-    }
-  }
+  SetDaughters(particle1, kf1, particle2, kf2);
 }
+
 //______________________________________________
 void AliDielectronPair::SetGammaTracks(AliVTrack * const particle1, Int_t pid1,
 				       AliVTrack * const particle2, Int_t pid2)
@@ -158,13 +144,34 @@ void AliDielectronPair::SetGammaTracks(AliVTrack * const particle1, Int_t pid1,
   // refParticle1 and 2 are the original tracks. In the case of track rotation
   // they are needed in the framework
   //
+  AliKFParticle kf1(*particle1,pid1);
+  AliKFParticle kf2(*particle2,pid2);
+  SetGammaTracks(particle1, kf1, particle2, kf2);
+}
+
+//______________________________________________
+void AliDielectronPair::SetGammaTracks(AliVTrack * const particle1, const AliKFParticle &kf1,
+				       AliVTrack * const particle2, const AliKFParticle &kf2)
+{
+  //
+  // As SetGammaTracks(particle1,pid1,particle2,pid2), but with the AliKF
+  // daughters already built for the given tracks
+  //
   fD1.Initialize();
   fD2.Initialize();
 
-  AliKFParticle kf1(*particle1,pid1);
-  AliKFParticle kf2(*particle2,pid2);
   fPair.ConstructGamma(kf1,kf2);
 
+  SetDaughters(particle1, kf1, particle2, kf2);
+}
+
+//______________________________________________
+void AliDielectronPair::SetDaughters(AliVTrack * const particle1, const AliKFParticle &kf1,
+                                     AliVTrack * const particle2, const AliKFParticle &kf2)
+{
+  //
+  // assign the daughters, first particle larger Pt (if fRandomizeDaughters=kFALSE)
+  //
   if (fRandomizeDaughters) {
     if (fRandom3.Rndm()>0.5){
       fRefD1 = particle1;
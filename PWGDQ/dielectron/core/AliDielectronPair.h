@@ -57,6 +57,12 @@ public:
   void SetGammaTracks(AliVTrack * const particle1, Int_t pid1,
 		      AliVTrack * const particle2, Int_t pid2);
 
+  void SetTracks(AliVTrack * const particle1, const AliKFParticle &kf1,
+                 AliVTrack * const particle2, const AliKFParticle &kf2);
+
+  void SetGammaTracks(AliVTrack * const particle1, const AliKFParticle &kf1,
+		      AliVTrack * const particle2, const AliKFParticle &kf2);
+
   void SetTracks(const AliKFParticle * const particle1,
                  const AliKFParticle * const particle2,
                  AliVTrack * const refParticle1,
@@ -187,6 +193,9 @@ private:
   
   static Bool_t   fRandomizeDaughters;
   static TRandom3 fRandom3;
+
+  void SetDaughters(AliVTrack * const particle1, const AliKFParticle &kf1,
+                    AliVTrack * const particle2, const AliKFParticle &kf2);
   
   ClassDef(AliDielectronPair,5)
 };
@@ -12,12 +12,18 @@ Instructions in AddTask_EPcorrectionsExample.C
 #include <AliAnalysisTaskReducedEventProcessor.h>
 
 #include <iostream>
+#include <deque>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 #include <TROOT.h>
 #include <TTimeStamp.h>
 #include <TStopwatch.h>
 #include <TChain.h>
 #include <THashList.h>
+#include <TH1.h>
 #include <AliInputEventHandler.h>
 #include <AliMultiInputEventHandler.h>
 #include <AliESDInputHandler.h>
@@ -28,6 +34,8 @@ Instructions in AddTask_EPcorrectionsExample.C
 #include "AliReducedBaseEvent.h"
 #include "AliReducedEventInfo.h"
 #include "AliHistogramManager.h"
+#include "AliMixingHandler.h"
+#include "AliReducedVarManager.h"
 #include "AliReducedAnalysisTaskSE.h"
 #include "AliReducedEventInputHandler.h"
 
@@ -38,13 +46,67 @@ using std::endl;
 ClassImp(AliAnalysisTaskReducedEventProcessor);
 
 
+//_________________________________________________________________________________
+struct AliAnalysisTaskReducedEventProcessor::WorkerPool {
+  //
+  // Each worker owns a clone of the reduced task, a variable manager context and a bounded queue of events.
+  // Events are deep copies of the input events, deleted by the worker once processed.
+  //
+  struct Worker {
+    Worker() : fTask(0x0), fContext(0x0), fQueue(), fMutex(), fNotEmpty(), fNotFull(), fDone(kFALSE), fThread() {}
+    AliReducedAnalysisTaskSE* fTask;                 // clone of the reduced task
+    AliReducedVarManager::VarContext* fContext;      // variable manager context of the worker thread
+    std::deque<AliReducedBaseEvent*> fQueue;         // events waiting to be processed
+    std::mutex fMutex;
+    std::condition_variable fNotEmpty;
+    std::condition_variable fNotFull;
+    Bool_t fDone;                                    // no more events will be queued
+    std::thread fThread;
+  };
+  WorkerPool() : fWorkers(), fNextWorker(0), fReaderContext(0x0), fValues() {}
+  std::vector<Worker*> fWorkers;
+  Int_t fNextWorker;                                 // round-robin dispatching if the task does not do event mixing
+  AliReducedVarManager::VarContext* fReaderContext;  // variable manager context for dispatching, with only the mixing variables used
+  Float_t fValues[AliReducedVarManager::kNVars];     // event variables needed to find the mixing category
+  
+  static void Run(Worker* w);
+};
+
+
+//_________________________________________________________________________________
+void AliAnalysisTaskReducedEventProcessor::WorkerPool::Run(Worker* w) {
+  //
+  // Worker thread loop
+  //
+  AliReducedVarManager::SetContext(w->fContext);
+  while(kTRUE) {
+    AliReducedBaseEvent* event = 0x0;
+    {
+      std::unique_lock<std::mutex> lock(w->fMutex);
+      while(w->fQueue.empty() && !w->fDone) w->fNotEmpty.wait(lock);
+      if(w->fQueue.empty()) break;
+      event = w->fQueue.front();
+      w->fQueue.pop_front();
+    }
+    w->fNotFull.notify_one();
+    w->fTask->SetEvent(event);
+    w->fTask->Process();
+    delete event;
+  }
+  AliReducedVarManager::SetContext(0x0);
+}
+
+
 //_________________________________________________________________________________
 AliAnalysisTaskReducedEventProcessor::AliAnalysisTaskReducedEventProcessor() :
   AliAnalysisTaskSE(),
   fReducedTask(0x0),
   fRunningMode(kUseEventsFromTree),
   fReducedEvent(),
-  fWriteFilteredTree(kFALSE)
+  fWriteFilteredTree(kFALSE),
+  fNWorkers(0),
+  fQueueSize(100),
+  fWorkerPool(0x0)
 {
   //
   // Default constructor
@@ -57,7 +119,10 @@ AliAnalysisTaskReducedEventProcessor::AliAnalysisTaskReducedEventProcessor(const
   fReducedTask(0x0),
   fRunningMode(runningMode),
   fReducedEvent(),
-  fWriteFilteredTree(writeFilteredTree)
+  fWriteFilteredTree(writeFilteredTree),
+  fNWorkers(0),
+  fQueueSize(100),
+  fWorkerPool(0x0)
 {
   //
   // Constructor
@@ -73,6 +138,16 @@ AliAnalysisTaskReducedEventProcessor::AliAnalysisTaskReducedEventProcessor(const
 }
 
 
+//_________________________________________________________________________________
+AliAnalysisTaskReducedEventProcessor::~AliAnalysisTaskReducedEventProcessor()
+{
+  //
+  // Destructor
+  //
+  if(fWorkerPool) StopWorkers();
+}
+
+
 //______________________________________________________________________________
 void AliAnalysisTaskReducedEventProcessor::ConnectInputData(Option_t* /*option*/)
 {
@@ -105,6 +180,16 @@ void AliAnalysisTaskReducedEventProcessor::UserCreateOutputObjects()
   //
   // Add all histogram manager histogram lists to the output TList
   //
+  if(fNWorkers>0 && fWriteFilteredTree) {
+     AliWarning("Filtered trees cannot be written by worker threads, the events will be processed sequentially");
+     fNWorkers = 0;
+  }
+  if(fNWorkers>0 && !fReducedTask->CanRunInWorkers()) {
+     AliWarning(Form("Task %s cannot be processed by worker threads, the events will be processed sequentially", fReducedTask->GetName()));
+     fNWorkers = 0;
+  }
+  if(fNWorkers>0) StartWorkers();
+  
   fReducedTask->GetHistogramManager()->AddHistogramsToOutputList();
   PostData(1, fReducedTask->GetHistogramManager()->GetHistogramOutputList());
   
@@ -139,6 +224,12 @@ void AliAnalysisTaskReducedEventProcessor::UserExec(Option_t *){
   }
   
   if(!event) return;
+  
+  if(fWorkerPool) {
+     DispatchEvent(event);
+     PostData(1, fReducedTask->GetHistogramManager()->GetHistogramOutputList());
+     return;
+  }
     
   fReducedTask->SetEvent(event);
   fReducedTask->Process();
@@ -156,10 +247,115 @@ void AliAnalysisTaskReducedEventProcessor::FinishTaskOutput()
     //
     // Finish Task 
     //
-  fReducedTask->Finish();
+  if(fWorkerPool) StopWorkers();
+  else fReducedTask->Finish();
   PostData(1, fReducedTask->GetHistogramManager()->GetHistogramOutputList());
   if(fWriteFilteredTree)
      PostData(2, fReducedTask->GetFilteredTree());
   
   return;
 }
+
+
+//__________________________________________________________________
+void AliAnalysisTaskReducedEventProcessor::StartWorkers()
+{
+  //
+  // Clone the reduced task for each worker and start the worker threads.
+  // The clones are made via the streamers, i.e. the same way the task is shipped to grid or PROOF jobs,
+  // such that each worker gets its own histograms, cuts and mixing pools.
+  //
+  ROOT::EnableThreadSafety();
+  // initialize the mixing pools before cloning, and not concurrently in the worker threads.
+  // Each worker context gets its own random number generator (downscaling, track rotation, smearing), seeded from gRandom.
+  AliMixingHandler* mixingHandler = fReducedTask->GetMixingHandler();
+  Bool_t addDirectory = TH1::AddDirectoryStatus();
+  TH1::AddDirectory(kFALSE);
+  fWorkerPool = new WorkerPool();
+  if(mixingHandler && mixingHandler->GetNMixingVariables()>0) {
+     mixingHandler->Init();
+     // the reader thread only needs the variables defining the mixing categories
+     fWorkerPool->fReaderContext = AliReducedVarManager::CreateContext(kFALSE);
+     AliReducedVarManager::SetContext(fWorkerPool->fReaderContext);
+     for(Int_t iVar=0; iVar<mixingHandler->GetNMixingVariables(); ++iVar)
+        AliReducedVarManager::SetUseVariable(mixingHandler->GetMixingVariable(iVar));
+     AliReducedVarManager::SetContext(0x0);
+  }
+  for(Int_t i=0; i<fNWorkers; ++i) {
+    WorkerPool::Worker* w = new WorkerPool::Worker();
+    w->fTask = (AliReducedAnalysisTaskSE*)fReducedTask->Clone();
+    w->fContext = AliReducedVarManager::CreateContext();
+    fWorkerPool->fWorkers.push_back(w);
+  }
+  TH1::AddDirectory(addDirectory);
+  for(Int_t i=0; i<fNWorkers; ++i) {
+    WorkerPool::Worker* w = fWorkerPool->fWorkers[i];
+    w->fThread = std::thread(&WorkerPool::Run, w);
+  }
+  cout << "AliAnalysisTaskReducedEventProcessor::StartWorkers(): processing events with " << fNWorkers << " worker threads" << endl;
+}
+
+
+//__________________________________________________________________
+void AliAnalysisTaskReducedEventProcessor::DispatchEvent(AliReducedBaseEvent* event)
+{
+  //
+  // Queue a copy of the event to one of the workers.
+  // If the task does event mixing, all events of a given mixing category are sent to the same worker and in
+  // the order they are read, such that the mixing pools and the mixed pairs do not depend on the thread scheduling.
+  //
+  Int_t iWorker = -1;
+  AliMixingHandler* mixingHandler = fReducedTask->GetMixingHandler();
+  if(mixingHandler && mixingHandler->GetNMixingVariables()>0) {
+     AliReducedVarManager::SetContext(fWorkerPool->fReaderContext);
+     AliReducedVarManager::FillEventInfo(event, fWorkerPool->fValues);
+     AliReducedVarManager::SetContext(0x0);
+     Int_t category = mixingHandler->FindEventCategory(fWorkerPool->fValues);
+     iWorker = (category<0 ? 0 : category%fNWorkers);
+  }
+  else {
+     iWorker = fWorkerPool->fNextWorker;
+     fWorkerPool->fNextWorker = (fWorkerPool->fNextWorker+1)%fNWorkers;
+  }
+  
+  AliReducedBaseEvent* copy = (AliReducedBaseEvent*)event->Clone();
+  WorkerPool::Worker* w = fWorkerPool->fWorkers[iWorker];
+  {
+     std::unique_lock<std::mutex> lock(w->fMutex);
+     while((Int_t)w->fQueue.size()>=fQueueSize) w->fNotFull.wait(lock);
+     w->fQueue.push_back(copy);
+  }
+  w->fNotEmpty.notify_one();
+}
+
+
+//__________________________________________________________________
+void AliAnalysisTaskReducedEventProcessor::StopWorkers()
+{
+  //
+  // Process the queued events, finish the task clones and add their histograms to the output of the main task
+  //
+  for(UInt_t i=0; i<fWorkerPool->fWorkers.size(); ++i) {
+     WorkerPool::Worker* w = fWorkerPool->fWorkers[i];
+     {
+        std::unique_lock<std::mutex> lock(w->fMutex);
+        w->fDone = kTRUE;
+     }
+     w->fNotEmpty.notify_one();
+  }
+  for(UInt_t i=0; i<fWorkerPool->fWorkers.size(); ++i) {
+     WorkerPool::Worker* w = fWorkerPool->fWorkers[i];
+     if(w->fThread.joinable()) w->fThread.join();
+     // leftover mixing is run with the variable manager context of the worker
+     AliReducedVarManager::SetContext(w->fContext);
+     w->fTask->Finish();
+     AliReducedVarManager::SetContext(0x0);
+     fReducedTask->GetHistogramManager()->MergeHistograms(w->fTask->GetHistogramManager());
+     delete w->fTask;
+     delete w->fContext;
+     delete w;
+  }
+  delete fWorkerPool->fReaderContext;
+  delete fWorkerPool;
+  fWorkerPool = 0x0;
+}
@@ -30,9 +30,11 @@ public:
  public:
   AliAnalysisTaskReducedEventProcessor();
   AliAnalysisTaskReducedEventProcessor(const char *name, Int_t runningMode=kUseEventsFromTree, Bool_t writeFilteredTree=kFALSE);
-  virtual ~AliAnalysisTaskReducedEventProcessor(){}
+  virtual ~AliAnalysisTaskReducedEventProcessor();
 
   void AddTask(AliReducedAnalysisTaskSE* task) {fReducedTask=task;}
+  void SetNWorkers(Int_t n) {fNWorkers=n;}        // run the reduced task in n worker threads (0: sequential processing in UserExec)
+  void SetQueueSize(Int_t n) {fQueueSize=n;}      // maximum number of events waiting to be processed by each worker
 
   virtual void UserExec(Option_t *);
   virtual void UserCreateOutputObjects();
@@ -44,8 +46,12 @@ public:
   AliReducedAnalysisTaskSE* GetReducedTask() const {return fReducedTask;}
   
   Bool_t GetWriteFilteredTree() const {return fWriteFilteredTree;}
+  Int_t GetNWorkers() const {return fNWorkers;}
+  Int_t GetQueueSize() const {return fQueueSize;}
   
  protected:
+  struct WorkerPool;                          // worker threads, their event queues and reduced task clones (see the implementation file)
+  
   AliReducedAnalysisTaskSE* fReducedTask;      // Pointer to the analysis task which will process the reduced events
   
   Int_t fRunningMode;                               // Running mode, as specified in options 1 and 2 from Constants
@@ -54,10 +60,18 @@ public:
   
   Bool_t fWriteFilteredTree;                   // if kTRUE, the reduced task will produce filtered reduced trees
   
+  Int_t fNWorkers;                             // number of worker threads, 0 for sequential processing
+  Int_t fQueueSize;                            // maximum number of queued events per worker
+  WorkerPool* fWorkerPool;                     //! worker threads
+  
+  void StartWorkers();
+  void DispatchEvent(AliReducedBaseEvent* event);
+  void StopWorkers();
+  
   AliAnalysisTaskReducedEventProcessor(const AliAnalysisTaskReducedEventProcessor &c);
   AliAnalysisTaskReducedEventProcessor& operator= (const AliAnalysisTaskReducedEventProcessor &c);
 
-  ClassDef(AliAnalysisTaskReducedEventProcessor, 4);
+  ClassDef(AliAnalysisTaskReducedEventProcessor, 5);
 };
 
 #endif
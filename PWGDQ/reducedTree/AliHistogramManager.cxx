@@ -49,7 +49,11 @@ AliHistogramManager::AliHistogramManager() :
   fBinsAllocated(0),
   fVariableNames(),
   fVariableUnits(),
-  fNVars(0)
+  fNVars(0),
+  fFillPlanHandles(),
+  fFillPlan(),
+  fFillPlanVars(),
+  fFillPlanValid(kFALSE)
 {
   //
   // Constructor
@@ -71,7 +75,11 @@ AliHistogramManager::AliHistogramManager(const Char_t* name, Int_t nvars) :
   fBinsAllocated(0),
   fVariableNames(),
   fVariableUnits(),
-  fNVars(nvars)
+  fNVars(nvars),
+  fFillPlanHandles(),
+  fFillPlan(),
+  fFillPlanVars(),
+  fFillPlanValid(kFALSE)
 {
   //
   // Constructor
@@ -131,6 +139,7 @@ void AliHistogramManager::AddHistClass(const Char_t* histClass) {
   hList->SetOwner(kTRUE);
   hList->SetName(histClass);
   fMainList.Add(hList);
+  fFillPlanValid = kFALSE;
 }
 
 //_________________________________________________________________
@@ -154,6 +163,7 @@ void AliHistogramManager::AddHistogram(const Char_t* histClass,
     cout << "Warning in AliHistogramManager::AddHistogram(): Histogram " << name << " already exists" << endl;
     return;
   }
+  fFillPlanValid = kFALSE;
   TString hname = name;
   
   Int_t dimension = 1;
@@ -293,6 +303,7 @@ void AliHistogramManager::AddHistogram(const Char_t* histClass,
     cout << "Warning in AliHistogramManager::AddHistogram(): Histogram " << name << " already exists" << endl;
     return;
   }
+  fFillPlanValid = kFALSE;
   TString hname = name;
   
   Int_t dimension = 1;
@@ -435,6 +446,7 @@ void AliHistogramManager::AddHistogram(const Char_t* histClass,
     cout << "Warning in AliHistogramManager::AddHistogram(): Histogram " << name << " already exists" << endl;
     return;
   }
+  fFillPlanValid = kFALSE;
   TString hname = name;
   
   TString titleStr(title);
@@ -488,6 +500,7 @@ void AliHistogramManager::AddHistogram(const Char_t* histClass,
     cout << "Warning in AliHistogramManager::AddHistogram(): Histogram " << name << " already exists" << endl;
     return;
   }
+  fFillPlanValid = kFALSE;
   TString hname = name;
   
   TString titleStr(title);
@@ -613,151 +626,154 @@ THnF* AliHistogramManager::CreateHistogram( const Char_t* name, const Char_t* ti
 
 
 
+//__________________________________________________________________
+void AliHistogramManager::CompileFillPlan() {
+  //
+  // Translate the histogram classes into fill instructions.
+  // The variable mapping encoded in the unique IDs of the histograms and axes is decoded once here.
+  // Handles are given in the order in which the classes were added and remain valid after recompilation.
+  //
+  fFillPlan.clear();
+  fFillPlanVars.clear();
+  fFillPlanHandles.clear();
+  
+  TIter nextClass(&fMainList);
+  THashList* hList=0x0;
+  while((hList=(THashList*)nextClass())) {
+    fFillPlanHandles[hList] = fFillPlan.size();
+    fFillPlan.push_back(std::vector<FillPlanEntry>());
+    std::vector<FillPlanEntry>& plan = fFillPlan.back();
+    
+    TIter next(hList);
+    TObject* h=0x0;
+    while((h=next())) {
+      Int_t uid = h->GetUniqueID();
+      Bool_t isProfile = (uid%10==1 ? kTRUE : kFALSE);   // units digit encodes the isProfile
+      Bool_t isTHn = ((uid%100)>10 ? kTRUE : kFALSE);
+      Int_t thnDim = 0;
+      if(isTHn) thnDim = (uid%100)-10;        // the excess over 10 from the last 2 digits give the dimension of the THn
+      
+      uid = (uid-(uid%100))/100;
+      Int_t varT = -1;
+      Int_t varW = -1;
+      if(uid>0) {
+        varW = uid%(fNVars+1)-1;
+        if(varW==0) varW=AliReducedVarManager::kNothing;
+        uid = (uid-(uid%(fNVars+1)))/(fNVars+1);
+        if(uid>0) varT = uid - 1;
+      }
+      
+      FillPlanEntry entry;
+      entry.fHist = h;
+      entry.fVarW = varW;
+      entry.fFirstVar = fFillPlanVars.size();
+      if(!isTHn) {
+        Int_t dimension = ((TH1*)h)->GetDimension();
+        if(dimension<1 || dimension>3) continue;
+        entry.fKind = 2*(dimension-1) + (isProfile ? 1 : 0);
+        fFillPlanVars.push_back(((TH1*)h)->GetXaxis()->GetUniqueID());
+        if(dimension>1 || isProfile) fFillPlanVars.push_back(((TH1*)h)->GetYaxis()->GetUniqueID());
+        if(dimension>2 || (dimension==2 && isProfile)) fFillPlanVars.push_back(((TH1*)h)->GetZaxis()->GetUniqueID());
+        if(dimension==3 && isProfile) fFillPlanVars.push_back(varT);
+      }
+      else {
+        entry.fKind = (h->InheritsFrom(THnSparse::Class()) ? kFillTHnSparse : kFillTHn);
+        for(Int_t idim=0;idim<thnDim;++idim)
+          fFillPlanVars.push_back(((THnBase*)h)->GetAxis(idim)->GetUniqueID());
+      }
+      entry.fNVars = fFillPlanVars.size() - entry.fFirstVar;
+      
+      // histograms depending on variables which are not marked as used are never filled
+      Bool_t allVarsGood = kTRUE;
+      for(Int_t iv=entry.fFirstVar; iv<entry.fFirstVar+entry.fNVars; ++iv)
+        if(fFillPlanVars[iv]<0 || !fUsedVars[fFillPlanVars[iv]]) allVarsGood = kFALSE;
+      if(varW>AliReducedVarManager::kNothing && !fUsedVars[varW]) allVarsGood = kFALSE;
+      if(!allVarsGood) {
+        fFillPlanVars.resize(entry.fFirstVar);
+        continue;
+      }
+      plan.push_back(entry);
+    }  // end loop over histograms
+  }  // end loop over histogram classes
+  fFillPlanValid = kTRUE;
+}
+
+
+//__________________________________________________________________
+Int_t AliHistogramManager::GetClassHandle(const Char_t* className) {
+  //
+  //  get the handle of a histogram class, to be retrieved once at initialization
+  //
+  if(!fFillPlanValid) CompileFillPlan();
+  TObject* hList = fMainList.FindObject(className);
+  if(!hList) return -1;
+  return fFillPlanHandles[hList];
+}
+
+
 //__________________________________________________________________
 void AliHistogramManager::FillHistClass(const Char_t* className, Float_t* values) {
   //
   //  fill a class of histograms
   //
-  THashList* hList = (THashList*)fMainList.FindObject(className);
+  if(!fFillPlanValid) CompileFillPlan();
+  TObject* hList = fMainList.FindObject(className);
   if(!hList) {
     /*cout << "Warning in AliHistogramManager::FillHistClass(): Histogram list " << className << " not found!" << endl;
     cout << "         Histogram list not filled" << endl; */
     return;
   }
-  if(!hList) {
-    return;
-  }
-    
-  TIter next(hList);
-  TObject* h=0x0;
-  Bool_t isProfile;
-  Bool_t isTHn;
-  Int_t thnDim=0;
-  Bool_t isSparse=kFALSE;
+  FillHistClass(fFillPlanHandles[hList], values);
+}
+
+
+//__________________________________________________________________
+void AliHistogramManager::FillHistClass(Int_t classHandle, Float_t* values) {
+  //
+  //  fill a class of histograms using its handle
+  //
+  if(!fFillPlanValid) CompileFillPlan();
+  if(classHandle<0 || classHandle>=(Int_t)fFillPlan.size()) return;
+  
+  const std::vector<FillPlanEntry>& plan = fFillPlan[classHandle];
   Double_t fillValues[20]={0.0};
-  Int_t uid = 0;
-  Int_t varX=-1, varY=-1, varZ=-1, varT=-1, varW=-1;
-  Int_t dimension=0;
-  while((h=next())) {
-    Bool_t allVarsGood = kTRUE;
-    uid = h->GetUniqueID();
-    isProfile = (uid%10==1 ? kTRUE : kFALSE);   // units digit encodes the isProfile
-    isTHn = ((uid%100)>10 ? kTRUE : kFALSE);      
-    if(isTHn) thnDim = (uid%100)-10;        // the excess over 10 from the last 2 digits give the dimension of the THn
-    if(isTHn && ((TString)h->ClassName()).Contains("Sparse")) isSparse = kTRUE;
-    dimension = 0;
-    if(!isTHn) dimension = ((TH1*)h)->GetDimension();
-        
-    uid = (uid-(uid%100))/100;
-    varX = -1;
-    varY = -1;
-    varZ = -1;
-    varT = -1;
-    varW = -1;
-    if(uid>0) {
-      varW = uid%(fNVars+1)-1;
-      if(varW==0) varW=AliReducedVarManager::kNothing;
-      uid = (uid-(uid%(fNVars+1)))/(fNVars+1);
-      if(uid>0) varT = uid - 1;
-      //cout << "Filling " << h->GetName() << " with varT " << varT << endl;
-    }
-        
-    if(!isTHn) {
-      varX = ((TH1*)h)->GetXaxis()->GetUniqueID();
-      if(fUsedVars[varX]) {
-        switch(dimension) {
-          case 1:
-            if(isProfile) {
-              varY = ((TH1*)h)->GetYaxis()->GetUniqueID();
-              if(!fUsedVars[varY]) break;
-              if(varW>AliReducedVarManager::kNothing) { 
-                if(!fUsedVars[varW]) break;
-                ((TProfile*)h)->Fill(values[varX],values[varY],values[varW]);
-              }
-              else 
-                ((TProfile*)h)->Fill(values[varX],values[varY]);
-            }
-            else {
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TH1F*)h)->Fill(values[varX],values[varW]);
-              }
-              else
-                ((TH1F*)h)->Fill(values[varX]);
-            }
-          break;
-          case 2:
-            varY = ((TH1*)h)->GetYaxis()->GetUniqueID();
-            if(!fUsedVars[varY]) break;
-            if(isProfile) {
-              varZ = ((TH1*)h)->GetZaxis()->GetUniqueID();
-              if(!fUsedVars[varZ]) break;
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TProfile2D*)h)->Fill(values[varX],values[varY],values[varZ],values[varW]);
-              }
-              else
-                ((TProfile2D*)h)->Fill(values[varX],values[varY],values[varZ]);        
-            }
-            else {
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TH2F*)h)->Fill(values[varX],values[varY], values[varW]);
-              }
-              else
-                ((TH2F*)h)->Fill(values[varX],values[varY]);
-            }
-          break;
-          case 3:
-            varY = ((TH1*)h)->GetYaxis()->GetUniqueID();
-            if(!fUsedVars[varY]) break;
-            varZ = ((TH1*)h)->GetZaxis()->GetUniqueID();
-            if(!fUsedVars[varZ]) break;
-            if(isProfile) {
-              if(!fUsedVars[varT]) break;
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TProfile3D*)h)->Fill(values[varX],values[varY],values[varZ],values[varT],values[varW]);
-              }
-              else
-                ((TProfile3D*)h)->Fill(values[varX],values[varY],values[varZ],values[varT]);
-            }
-            else {
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TH3F*)h)->Fill(values[varX],values[varY],values[varZ],values[varW]);
-              }
-              else
-                ((TH3F*)h)->Fill(values[varX],values[varY],values[varZ]);
-            }
-          break;
-          default:
-          break;
-        }  // end switch
-      }
-    }  // end if(!isTHn)
-    else {
-      for(Int_t idim=0;idim<thnDim;++idim) {
-        if (isSparse) {
-          allVarsGood &= fUsedVars[((THnSparseF*)h)->GetAxis(idim)->GetUniqueID()];
-          fillValues[idim] = values[((THnSparseF*)h)->GetAxis(idim)->GetUniqueID()];
-        } else {
-          allVarsGood &= fUsedVars[((THnF*)h)->GetAxis(idim)->GetUniqueID()];
-          fillValues[idim] = values[((THnF*)h)->GetAxis(idim)->GetUniqueID()];
-        }
-      }
-      if(allVarsGood) {
-        if(varW>AliReducedVarManager::kNothing) {
-          if(fUsedVars[varW]) {
-            if (isSparse) ((THnSparseF*)h)->Fill(fillValues,values[varW]);
-            else          ((THnF*)h)->Fill(fillValues,values[varW]);
-          }
-        }
-        else {
-          if (isSparse) ((THnSparseF*)h)->Fill(fillValues);
-          else          ((THnF*)h)->Fill(fillValues);
-        }
-      }
+  for(std::vector<FillPlanEntry>::const_iterator it=plan.begin(); it!=plan.end(); ++it) {
+    const Int_t* vars = &fFillPlanVars[it->fFirstVar];
+    Int_t varW = it->fVarW;
+    Bool_t weighted = (varW>AliReducedVarManager::kNothing);
+    switch(it->fKind) {
+      case kFillTH1:
+        if(weighted) ((TH1F*)it->fHist)->Fill(values[vars[0]],values[varW]);
+        else         ((TH1F*)it->fHist)->Fill(values[vars[0]]);
+        break;
+      case kFillTProfile:
+        if(weighted) ((TProfile*)it->fHist)->Fill(values[vars[0]],values[vars[1]],values[varW]);
+        else         ((TProfile*)it->fHist)->Fill(values[vars[0]],values[vars[1]]);
+        break;
+      case kFillTH2:
+        if(weighted) ((TH2F*)it->fHist)->Fill(values[vars[0]],values[vars[1]],values[varW]);
+        else         ((TH2F*)it->fHist)->Fill(values[vars[0]],values[vars[1]]);
+        break;
+      case kFillTProfile2D:
+        if(weighted) ((TProfile2D*)it->fHist)->Fill(values[vars[0]],values[vars[1]],values[vars[2]],values[varW]);
+        else         ((TProfile2D*)it->fHist)->Fill(values[vars[0]],values[vars[1]],values[vars[2]]);
+        break;
+      case kFillTH3:
+        if(weighted) ((TH3F*)it->fHist)->Fill(values[vars[0]],values[vars[1]],values[vars[2]],values[varW]);
+        else         ((TH3F*)it->fHist)->Fill(values[vars[0]],values[vars[1]],values[vars[2]]);
+        break;
+      case kFillTProfile3D:
+        if(weighted) ((TProfile3D*)it->fHist)->Fill(values[vars[0]],values[vars[1]],values[vars[2]],values[vars[3]],values[varW]);
+        else         ((TProfile3D*)it->fHist)->Fill(values[vars[0]],values[vars[1]],values[vars[2]],values[vars[3]]);
+        break;
+      case kFillTHn:
+      case kFillTHnSparse:
+        for(Int_t idim=0;idim<it->fNVars;++idim) fillValues[idim] = values[vars[idim]];
+        if(weighted) ((THnBase*)it->fHist)->Fill(fillValues,values[varW]);
+        else         ((THnBase*)it->fHist)->Fill(fillValues);
+        break;
+      default:
+        break;
     }
   }
 }
@@ -782,6 +798,31 @@ void AliHistogramManager::WriteOutput(TFile* save) {
 }
 
 
+//__________________________________________________________________
+void AliHistogramManager::MergeHistograms(const AliHistogramManager* other) {
+  //
+  // Add the histograms of another manager with the same histogram classes (e.g. a clone used in a worker thread)
+  //
+  if(!other) return;
+  TIter nextClass(&other->fMainList);
+  THashList* otherList=0x0;
+  while((otherList=(THashList*)nextClass())) {
+    THashList* hList = (THashList*)fMainList.FindObject(otherList->GetName());
+    if(!hList) {
+      cout << "Warning in AliHistogramManager::MergeHistograms(): Histogram list " << otherList->GetName() << " not found!" << endl;
+      continue;
+    }
+    TIter next(otherList);
+    TObject* o=0x0;
+    while((o=next())) {
+      TObject* h = hList->FindObject(o->GetName());
+      if(!h) continue;
+      if(h->InheritsFrom(THnBase::Class())) ((THnBase*)h)->Add((THnBase*)o);
+      else ((TH1*)h)->Add((TH1*)o);
+    }
+  }
+}
+
 //__________________________________________________________________
 THashList* AliHistogramManager::AddHistogramsToOutputList() {
   //
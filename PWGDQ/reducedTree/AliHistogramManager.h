@@ -14,6 +14,9 @@
 #include <TList.h>
 #include <THashList.h>
 
+#include <map>
+#include <vector>
+
 #include "AliReducedVarManager.h"
 
 class TAxis;
@@ -69,6 +72,9 @@ class AliHistogramManager : public TObject {
                         TAxis* axis);
   
   void FillHistClass(const Char_t* className, Float_t* values);
+  void FillHistClass(Int_t classHandle, Float_t* values);
+  void MergeHistograms(const AliHistogramManager* other);    // add the histograms of a manager with the same booking
+  Int_t GetClassHandle(const Char_t* className);     // handle of a histogram class to be used with FillHistClass(Int_t, Float_t*); -1 if not found
   
   void SetUseDefaultVariableNames(Bool_t flag) {fUseDefaultVariableNames = flag;};
   void SetDefaultVarNames(TString* vars, TString* units);
@@ -106,9 +112,27 @@ class AliHistogramManager : public TObject {
   TString fVariableUnits[AliReducedVarManager::kNVars];               //! variable units
   Int_t fNVars;                          // maximum number of variables
   
+  // Fill plan: the histogram classes compiled into flat lists of fill instructions, such that
+  // filling requires no string lookup, no unique ID decoding and no class name checks
+  enum FillKind {
+    kFillTH1=0, kFillTProfile, kFillTH2, kFillTProfile2D, kFillTH3, kFillTProfile3D, kFillTHn, kFillTHnSparse
+  };
+  struct FillPlanEntry {
+    TObject* fHist;     // histogram to be filled
+    Int_t fKind;        // one of FillKind
+    Int_t fVarW;        // weight variable, or AliReducedVarManager::kNothing
+    Int_t fNVars;       // number of fill variables (for TProfile3D the 4th variable is varT)
+    Int_t fFirstVar;    // offset of the fill variables in fFillPlanVars
+  };
+  std::map<const TObject*, Int_t> fFillPlanHandles;          //! histogram class -> handle
+  std::vector<std::vector<FillPlanEntry> > fFillPlan;        //! fill instructions for each handle
+  std::vector<Int_t> fFillPlanVars;                          //! fill variables of all entries
+  Bool_t fFillPlanValid;                                     //! kFALSE if histograms were added since the plan was compiled
+  
   void MakeAxisLabels(TAxis* ax, const Char_t* labels);
+  void CompileFillPlan();
   
-  ClassDef(AliHistogramManager, 4)
+  ClassDef(AliHistogramManager, 5)
 };
 
 #endif
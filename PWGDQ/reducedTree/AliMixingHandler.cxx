@@ -43,6 +43,7 @@ AliMixingHandler::AliMixingHandler(Int_t mixingSetup /* = kMixResonanceLegs*/) :
   fVariables(),
   fNMixingVariables(0),
   fHistos(0x0),
+  fHistClassHandles(),
   fCrossPairsCuts(),
   fLikePairsLeg1Cuts(),
   fLikePairsLeg2Cuts()
@@ -82,6 +83,7 @@ AliMixingHandler::AliMixingHandler(const Char_t* name, const Char_t* title, Int_
   fVariables(),
   fNMixingVariables(0),
   fHistos(0x0),
+  fHistClassHandles(),
   fCrossPairsCuts(),
   fLikePairsLeg1Cuts(),
   fLikePairsLeg2Cuts()
@@ -182,12 +184,26 @@ void AliMixingHandler::Init() {
 }
 
 
+//_________________________________________________________________________
+void AliMixingHandler::ResolveHistClassHandles() {
+  //
+  // Retrieve the handles of the histogram classes, in the order given in fHistClassNames
+  // NOTE: Done at the first mixing and not in Init(), since the handles are not streamed to copies of the handler
+  //
+  fHistClassHandles.clear();
+  TObjArray* histClassArr = fHistClassNames.Tokenize(";");
+  for(Int_t i=0; i<histClassArr->GetEntries(); ++i)
+    fHistClassHandles.push_back(fHistos->GetClassHandle(histClassArr->At(i)->GetName()));
+  delete histClassArr;
+}
+
+
 //_________________________________________________________________________
 Bool_t AliMixingHandler::AcceptTrack() {
   //
   // Randomly decide to reject a track if a track downscale parameter has been set
   //
-  if(fDownscaleTracks>1.0 && (gRandom->Rndm()>(1.0/fDownscaleTracks))) return kFALSE;
+  if(fDownscaleTracks>1.0 && (AliReducedVarManager::GetRandom()->Rndm()>(1.0/fDownscaleTracks))) return kFALSE;
   return kTRUE;
 }
 
@@ -202,7 +218,7 @@ void AliMixingHandler::FillEvent(TList* leg1List, TList* leg2List, Float_t* valu
   if(leg1List->GetEntries()==0 && leg2List->GetEntries()==0) return;
   
   // randomly accept/reject this event in case fDownscaleEvents is used
-  if(fDownscaleEvents>1.0 && (gRandom->Rndm()>(1.0/fDownscaleEvents))) 
+  if(fDownscaleEvents>1.0 && (AliReducedVarManager::GetRandom()->Rndm()>(1.0/fDownscaleEvents))) 
     return;
   
   // find the event category
@@ -408,7 +424,7 @@ void AliMixingHandler::RunEventMixing(TClonesArray* leg1Pool, TClonesArray* leg2
   Int_t entries = leg1Pool->GetEntries();
   if(entries<2) return;
   
-  TObjArray* histClassArr = fHistClassNames.Tokenize(";");
+  if(fHistClassHandles.empty()) ResolveHistClassHandles();
   
   TIter iterEv1Leg1Pool(leg1Pool);
   TIter iterEv1Leg2Pool(leg2Pool);
@@ -448,10 +464,10 @@ void AliMixingHandler::RunEventMixing(TClonesArray* leg1Pool, TClonesArray* leg2
           if(!IsPairSelected(values, 1)) continue;   // fill histograms only if pair cuts are fulfilled
           for(Int_t ibit=0; ibit<fNParallelCuts; ++ibit) {
             if((testFlags2)&(ULong_t(1)<<ibit)) { 
-              if(fMixingSetup==kMixResonanceLegs) fHistos->FillHistClass(histClassArr->At(ibit*3+1)->GetName(), values);
+              if(fMixingSetup==kMixResonanceLegs) fHistos->FillHistClass(HistClassHandle(ibit*3+1), values);
               if(fMixingSetup==kMixCorrelation) {
                 Int_t pairType = (reinterpret_cast<AliReducedPairInfo*>(ev1Leg1))->PairType();
-                fHistos->FillHistClass(histClassArr->At(ibit*3+pairType)->GetName(), values);
+                fHistos->FillHistClass(HistClassHandle(ibit*3+pairType), values);
               }
             }
           }  
@@ -472,7 +488,7 @@ void AliMixingHandler::RunEventMixing(TClonesArray* leg1Pool, TClonesArray* leg2
           if(!IsPairSelected(values, 0)) continue;   // fill histograms only if pair cuts are fulfilled
 	  for(Int_t ibit=0; ibit<fNParallelCuts; ++ibit) {
             if((testFlags2)&(ULong_t(1)<<ibit)) 
-              fHistos->FillHistClass(histClassArr->At(ibit*3+0)->GetName(), values);
+              fHistos->FillHistClass(HistClassHandle(ibit*3+0), values);
           }  
 	}  // end loop over the ev2-leg1 list
       }  // end loop over the ev1-leg1 list
@@ -500,7 +516,7 @@ void AliMixingHandler::RunEventMixing(TClonesArray* leg1Pool, TClonesArray* leg2
           if(!IsPairSelected(values, 2)) continue;   // fill histograms only if pair cuts are fulfilled
 	  for(Int_t ibit=0; ibit<fNParallelCuts; ++ibit) {
             if((testFlags2)&(ULong_t(1)<<ibit)) 
-              fHistos->FillHistClass(histClassArr->At(ibit*3+2)->GetName(), values);
+              fHistos->FillHistClass(HistClassHandle(ibit*3+2), values);
           }  
 	}  // end loop over the ev2-leg2 list
       }  // end loop over the ev1-leg2 list
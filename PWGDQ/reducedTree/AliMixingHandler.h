@@ -7,6 +7,8 @@
 #ifndef ALIMIXINGHANDLER_H
 #define ALIMIXINGHANDLER_H
 
+#include <vector>
+
 #include <TNamed.h>
 #include <TArrayF.h>
 #include <TArrayI.h>
@@ -66,6 +68,7 @@ public:
   Int_t GetPoolSize(Int_t cut, Int_t eventCategory) const;
   TString GetHistClassNames() const {return fHistClassNames;};
   Int_t GetNMixingVariables() const {return fNMixingVariables;}
+  AliReducedVarManager::Variables GetMixingVariable(Int_t i) const {return fVariables[i];}
   Int_t GetMixingSetup() const {return fMixingSetup;}
   
   void Init();
@@ -103,6 +106,7 @@ private:
   Int_t  fNMixingVariables;
   
   AliHistogramManager* fHistos;    // histogram manager
+  std::vector<Int_t> fHistClassHandles;   //! handles of the classes in fHistClassNames, resolved at the first mixing
   
   TList fCrossPairsCuts;         // cut object for cross pairs 
   TList fLikePairsLeg1Cuts;    // cut object for LEG1 like pairs
@@ -111,8 +115,10 @@ private:
   void RunEventMixing(TClonesArray* leg1Pool, TClonesArray* leg2Pool, ULong_t mixingMask, Int_t type, Float_t* values);
   ULong_t IncrementPoolSizes(TList* list1, TList* list2, Int_t eventCategory);
   void ResetPoolSizes(ULong_t mixingMask, Int_t category);  
+  void ResolveHistClassHandles();
+  Int_t HistClassHandle(Int_t i) const {return (i<(Int_t)fHistClassHandles.size() ? fHistClassHandles[i] : -1);}
   
-  ClassDef(AliMixingHandler,3);
+  ClassDef(AliMixingHandler,4);
 };
 
 #endif
@@ -50,11 +50,17 @@ AliReducedAnalysisJpsi2ee::AliReducedAnalysisJpsi2ee() :
   fJpsiMotherMCcuts(),
   fJpsiElectronMCcuts(),
   fSkipMCEvent(kFALSE),
-  fMCJpsiPtWeights(0x0)
+  fMCJpsiPtWeights(0x0),
+  fHistClassHandlesResolved(kFALSE),
+  fTrackHistClassPrefixes(),
+  fTrackHistClassHandles(),
+  fPairHistClassHandles(),
+  fMCTruthHistClassHandles()
 {
   //
   // default constructor
   //
+   for(Int_t i=0; i<kNFixedHistClasses; ++i) fFixedHistClassHandles[i] = -1;
 }
 
 
@@ -84,11 +90,17 @@ AliReducedAnalysisJpsi2ee::AliReducedAnalysisJpsi2ee(const Char_t* name, const C
   fJpsiMotherMCcuts(),
   fJpsiElectronMCcuts(),
   fSkipMCEvent(kFALSE),
-  fMCJpsiPtWeights(0x0)
+  fMCJpsiPtWeights(0x0),
+  fHistClassHandlesResolved(kFALSE),
+  fTrackHistClassPrefixes(),
+  fTrackHistClassHandles(),
+  fPairHistClassHandles(),
+  fMCTruthHistClassHandles()
 {
   //
   // named constructor
   //
+   for(Int_t i=0; i<kNFixedHistClasses; ++i) fFixedHistClassHandles[i] = -1;
    fEventCuts.SetOwner(kTRUE);
    fTrackCuts.SetOwner(kTRUE);
    fPreFilterTrackCuts.SetOwner(kTRUE);
@@ -227,6 +239,115 @@ void AliReducedAnalysisJpsi2ee::Init() {
    fHistosManager->SetDefaultVarNames(AliReducedVarManager::fgVariableNames,AliReducedVarManager::fgVariableUnits);
    
    fMixingHandler->SetHistogramManager(fHistosManager);
+   ResolveHistClassHandles();
+}
+
+
+//___________________________________________________________________________
+TString AliReducedAnalysisJpsi2ee::TrackHistClassName(const Char_t* trackClass, Int_t histClass, Int_t icut, Int_t iMC /*=-1*/) const {
+   //
+   // name of a track histogram class for a given track cut and, if iMC>=0, leg candidate MC cut
+   //
+   const Char_t* classTypes[kNTrackHistClasses] = {"", "StatusFlags", "ITSclusterMap", "ITSsharedClusterMap", "TPCclusterMap"};
+   TString name = Form("%s%s_%s", trackClass, classTypes[histClass], fTrackCuts.At(icut)->GetName());
+   if(iMC>=0) name += Form("_%s", fLegCandidatesMCcuts.At(iMC)->GetName());
+   return name;
+}
+
+
+//___________________________________________________________________________
+TString AliReducedAnalysisJpsi2ee::PairHistClassName(const Char_t* pairClass, Int_t pairType, Int_t icut, Int_t iMC /*=-1*/) const {
+   //
+   // name of a pair histogram class for a given pair type (++, +-, --), track cut and, if iMC>=0, leg candidate MC cut
+   //
+   const Char_t* typeStr[3] = {"PP", "PM", "MM"};
+   TString name = Form("%s%s_%s", pairClass, typeStr[pairType], fTrackCuts.At(icut)->GetName());
+   if(iMC>=0) name += Form("_%s", fLegCandidatesMCcuts.At(iMC)->GetName());
+   return name;
+}
+
+
+//___________________________________________________________________________
+void AliReducedAnalysisJpsi2ee::ResolveHistClassHandles() {
+   //
+   // retrieve the handles of all histogram classes filled in the event loop
+   // NOTE: the handles of classes which were not defined are -1 and filling them is a no-op
+   //
+   const Char_t* fixedClasses[kNFixedHistClasses] = {
+      "Event_BeforeCuts", "EventTag_BeforeCuts", "EventTriggers_BeforeCuts",
+      "Event_AfterCuts", "EventTag_AfterCuts", "EventTriggers_AfterCuts",
+      "Track_BeforeCuts", "TrackStatusFlags_BeforeCuts", "TrackITSclusterMap_BeforeCuts",
+      "TrackITSsharedClusterMap_BeforeCuts", "TrackTPCclusterMap_BeforeCuts"
+   };
+   for(Int_t i=0; i<kNFixedHistClasses; ++i) fFixedHistClassHandles[i] = fHistosManager->GetClassHandle(fixedClasses[i]);
+   
+   // the "Track" classes; other track class prefixes are resolved at their first use
+   fTrackHistClassPrefixes.clear();
+   fTrackHistClassHandles.clear();
+   GetTrackHistClassPrefix("Track");
+   
+   // one slot without MC selection (iMC=-1) followed by one slot per leg candidate MC cut
+   Int_t nCuts = fTrackCuts.GetEntries();
+   Int_t nMC = fLegCandidatesMCcuts.GetEntries();
+   fPairHistClassHandles.assign(3*nCuts*(nMC+1), -1);
+   for(Int_t icut=0; icut<nCuts; ++icut) {
+      for(Int_t iMC=-1; iMC<nMC; ++iMC) {
+         for(Int_t iType=0; iType<3; ++iType)
+            fPairHistClassHandles[(iType*nCuts+icut)*(nMC+1)+iMC+1] = fHistosManager->GetClassHandle(PairHistClassName("PairSE", iType, icut, iMC).Data());
+      }
+   }
+   
+   fMCTruthHistClassHandles.assign(2*fJpsiMotherMCcuts.GetEntries(), -1);
+   for(Int_t iCut=0; iCut<fJpsiMotherMCcuts.GetEntries(); ++iCut) {
+      fMCTruthHistClassHandles[2*iCut] = fHistosManager->GetClassHandle(Form("%s_PureMCTruth_BeforeSelection", fJpsiMotherMCcuts.At(iCut)->GetName()));
+      fMCTruthHistClassHandles[2*iCut+1] = fHistosManager->GetClassHandle(Form("%s_PureMCTruth_AfterSelection", fJpsiMotherMCcuts.At(iCut)->GetName()));
+   }
+   fHistClassHandlesResolved = kTRUE;
+}
+
+
+//___________________________________________________________________________
+Int_t AliReducedAnalysisJpsi2ee::GetTrackHistClassPrefix(const TString& trackClass) {
+   //
+   // index of a track class prefix (e.g. "Track") for TrackHistClassHandle();
+   // the handles of the classes with this prefix are resolved at the first call
+   //
+   for(UInt_t i=0; i<fTrackHistClassPrefixes.size(); ++i)
+      if(fTrackHistClassPrefixes[i]==trackClass) return i;
+   
+   // one slot without MC selection (iMC=-1) followed by one slot per leg candidate MC cut
+   Int_t nCuts = fTrackCuts.GetEntries();
+   Int_t nMC = fLegCandidatesMCcuts.GetEntries();
+   std::vector<Int_t> handles(nCuts*(nMC+1)*kNTrackHistClasses, -1);
+   for(Int_t icut=0; icut<nCuts; ++icut)
+      for(Int_t iMC=-1; iMC<nMC; ++iMC)
+         for(Int_t iClass=0; iClass<kNTrackHistClasses; ++iClass)
+            handles[(icut*(nMC+1)+iMC+1)*kNTrackHistClasses+iClass] = fHistosManager->GetClassHandle(TrackHistClassName(trackClass.Data(), iClass, icut, iMC).Data());
+   fTrackHistClassPrefixes.push_back(trackClass);
+   fTrackHistClassHandles.push_back(handles);
+   return fTrackHistClassPrefixes.size()-1;
+}
+
+
+//___________________________________________________________________________
+Int_t AliReducedAnalysisJpsi2ee::TrackHistClassHandle(Int_t trackClass, Int_t histClass, Int_t icut, Int_t iMC /*=-1*/) const {
+   //
+   // handle of a track histogram class for a prefix index from GetTrackHistClassPrefix(); -1 if not defined
+   //
+   Int_t nMC = fLegCandidatesMCcuts.GetEntries();
+   if(icut>=fTrackCuts.GetEntries() || iMC>=nMC) return -1;
+   return fTrackHistClassHandles[trackClass][(icut*(nMC+1)+iMC+1)*kNTrackHistClasses+histClass];
+}
+
+
+//___________________________________________________________________________
+Int_t AliReducedAnalysisJpsi2ee::PairHistClassHandle(Int_t pairType, Int_t icut, Int_t iMC /*=-1*/) const {
+   //
+   // handle of a "PairSE" histogram class; -1 if not defined
+   //
+   Int_t nMC = fLegCandidatesMCcuts.GetEntries();
+   if(icut>=fTrackCuts.GetEntries() || iMC>=nMC) return -1;
+   return fPairHistClassHandles[(pairType*fTrackCuts.GetEntries()+icut)*(nMC+1)+iMC+1];
 }
 
 
@@ -251,6 +372,7 @@ void AliReducedAnalysisJpsi2ee::Process() {
        cout << "Event no. " << fEventCounter << endl;
   }
   fEventCounter++;
+  if(!fHistClassHandlesResolved) ResolveHistClassHandles();
   
   AliReducedVarManager::SetEvent(fEvent);
   
@@ -260,14 +382,14 @@ void AliReducedAnalysisJpsi2ee::Process() {
   
   // fill event information before event cuts
   AliReducedVarManager::FillEventInfo(fEvent, fValues);
-  fHistosManager->FillHistClass("Event_BeforeCuts", fValues);
+  fHistosManager->FillHistClass(fFixedHistClassHandles[kHistEventBeforeCuts], fValues);
   for(UShort_t ibit=0; ibit<64; ++ibit) {
      AliReducedVarManager::FillEventTagInput(fEvent, ibit, fValues);
-     fHistosManager->FillHistClass("EventTag_BeforeCuts", fValues);
+     fHistosManager->FillHistClass(fFixedHistClassHandles[kHistEventTagBeforeCuts], fValues);
   }
   for(UShort_t ibit=0; ibit<64; ++ibit) {
       AliReducedVarManager::FillEventOnlineTrigger(ibit, fValues);
-      fHistosManager->FillHistClass("EventTriggers_BeforeCuts", fValues);
+      fHistosManager->FillHistClass(fFixedHistClassHandles[kHistEventTriggersBeforeCuts], fValues);
   }
   
   
@@ -313,14 +435,14 @@ void AliReducedAnalysisJpsi2ee::Process() {
     RunSameEventPairing();
  
   // fill event info histograms after cuts
-  fHistosManager->FillHistClass("Event_AfterCuts", fValues);
+  fHistosManager->FillHistClass(fFixedHistClassHandles[kHistEventAfterCuts], fValues);
   for(UShort_t ibit=0; ibit<64; ++ibit) {
      AliReducedVarManager::FillEventTagInput(fEvent, ibit, fValues);
-     fHistosManager->FillHistClass("EventTag_AfterCuts", fValues);
+     fHistosManager->FillHistClass(fFixedHistClassHandles[kHistEventTagAfterCuts], fValues);
   }
   for(UShort_t ibit=0; ibit<64; ++ibit) {
      AliReducedVarManager::FillEventOnlineTrigger(ibit, fValues);
-     fHistosManager->FillHistClass("EventTriggers_AfterCuts", fValues);
+     fHistosManager->FillHistClass(fFixedHistClassHandles[kHistEventTriggersAfterCuts], fValues);
   }
 }
 
@@ -361,86 +483,79 @@ void AliReducedAnalysisJpsi2ee::FillTrackHistograms(TString trackClass /*= "Trac
 void AliReducedAnalysisJpsi2ee::FillTrackHistograms(AliReducedBaseTrack* track, TString trackClass /*="Track"*/) {
    //
    // fill track level histograms
+   // NOTE: the handles of the "Track" classes are resolved in Init(), those of other prefixes at their first use
    //
    UInt_t mcDecisionMap = 0;
    if(fOptionRunOverMC) mcDecisionMap = CheckReconstructedLegMCTruth(track);      
+   Int_t prefix = (trackClass=="Track" ? 0 : GetTrackHistClassPrefix(trackClass));
    
    for(Int_t icut=0; icut<fTrackCuts.GetEntries(); ++icut) {
       if(track->TestFlag(icut)) {
-         fHistosManager->FillHistClass(Form("%s_%s", trackClass.Data(), fTrackCuts.At(icut)->GetName()), fValues);
-         if(mcDecisionMap) {       // Fill histograms for tracks identified as MC truth
-            for(Int_t iMC=0; iMC<=fLegCandidatesMCcuts.GetEntries(); ++iMC) {
-               if(mcDecisionMap & (UInt_t(1)<<iMC))
-                  fHistosManager->FillHistClass(Form("%s_%s_%s", trackClass.Data(), fTrackCuts.At(icut)->GetName(), 
-                                                                  fLegCandidatesMCcuts.At(iMC)->GetName()), fValues);
-            }
-         }
+         fHistosManager->FillHistClass(TrackHistClassHandle(prefix, kHistTrack, icut), fValues);
+         // Fill histograms for tracks identified as MC truth
+         if(mcDecisionMap) FillTrackMCHistograms(mcDecisionMap, prefix, kHistTrack, icut);
          
          if(track->IsA() != AliReducedTrackInfo::Class()) continue;
          
          AliReducedTrackInfo* trackInfo = dynamic_cast<AliReducedTrackInfo*>(track);
          if(!trackInfo) continue;
          
+         Int_t statusFlagsHandle = TrackHistClassHandle(prefix, kHistTrackStatusFlags, icut);
          for(UInt_t iflag=0; iflag<AliReducedVarManager::kNTrackingFlags; ++iflag) {
             AliReducedVarManager::FillTrackingFlag(trackInfo, iflag, fValues);
-            fHistosManager->FillHistClass(Form("%sStatusFlags_%s", trackClass.Data(), fTrackCuts.At(icut)->GetName()), fValues);
-            if(mcDecisionMap) {
-               for(Int_t iMC=0; iMC<=fLegCandidatesMCcuts.GetEntries(); ++iMC) {
-                  if(mcDecisionMap & (UInt_t(1)<<iMC))
-                     fHistosManager->FillHistClass(Form("%sStatusFlags_%s_%s", trackClass.Data(), fTrackCuts.At(icut)->GetName(),
-                                                                     fLegCandidatesMCcuts.At(iMC)->GetName()), fValues);
-               }
-            }
+            fHistosManager->FillHistClass(statusFlagsHandle, fValues);
+            if(mcDecisionMap) FillTrackMCHistograms(mcDecisionMap, prefix, kHistTrackStatusFlags, icut);
          }
+         Int_t itsClusterMapHandle = TrackHistClassHandle(prefix, kHistTrackITSclusterMap, icut);
+         Int_t itsSharedClusterMapHandle = TrackHistClassHandle(prefix, kHistTrackITSsharedClusterMap, icut);
          for(Int_t iLayer=0; iLayer<6; ++iLayer) {
             AliReducedVarManager::FillITSlayerFlag(trackInfo, iLayer, fValues);
-            fHistosManager->FillHistClass(Form("%sITSclusterMap_%s", trackClass.Data(), fTrackCuts.At(icut)->GetName()), fValues);
-            if(mcDecisionMap) {
-               for(Int_t iMC=0; iMC<=fLegCandidatesMCcuts.GetEntries(); ++iMC) {
-                  if(mcDecisionMap & (UInt_t(1)<<iMC))
-                     fHistosManager->FillHistClass(Form("%sITSclusterMap_%s_%s", trackClass.Data(), fTrackCuts.At(icut)->GetName(),
-                                                                     fLegCandidatesMCcuts.At(iMC)->GetName()), fValues);
-               }
-            }
+            fHistosManager->FillHistClass(itsClusterMapHandle, fValues);
+            if(mcDecisionMap) FillTrackMCHistograms(mcDecisionMap, prefix, kHistTrackITSclusterMap, icut);
             AliReducedVarManager::FillITSsharedLayerFlag(trackInfo, iLayer, fValues);
-            fHistosManager->FillHistClass(Form("%sITSsharedClusterMap_%s", trackClass.Data(), fTrackCuts.At(icut)->GetName()), fValues);
-            if(mcDecisionMap) {
-               for(Int_t iMC=0; iMC<=fLegCandidatesMCcuts.GetEntries(); ++iMC) {
-                  if(mcDecisionMap & (UInt_t(1)<<iMC))
-                     fHistosManager->FillHistClass(Form("%sITSsharedClusterMap_%s_%s", trackClass.Data(), fTrackCuts.At(icut)->GetName(),
-                                                        fLegCandidatesMCcuts.At(iMC)->GetName()), fValues);
-               }
-            }
+            fHistosManager->FillHistClass(itsSharedClusterMapHandle, fValues);
+            if(mcDecisionMap) FillTrackMCHistograms(mcDecisionMap, prefix, kHistTrackITSsharedClusterMap, icut);
          }
+         Int_t tpcClusterMapHandle = TrackHistClassHandle(prefix, kHistTrackTPCclusterMap, icut);
          for(Int_t iLayer=0; iLayer<8; ++iLayer) {
             AliReducedVarManager::FillTPCclusterBitFlag(trackInfo, iLayer, fValues);
-            fHistosManager->FillHistClass(Form("%sTPCclusterMap_%s", trackClass.Data(), fTrackCuts.At(icut)->GetName()), fValues);
-            if(mcDecisionMap) {
-               for(Int_t iMC=0; iMC<=fLegCandidatesMCcuts.GetEntries(); ++iMC) {
-                  if(mcDecisionMap & (UInt_t(1)<<iMC))
-                     fHistosManager->FillHistClass(Form("%sTPCclusterMap_%s_%s", trackClass.Data(), fTrackCuts.At(icut)->GetName(),
-                                                                     fLegCandidatesMCcuts.At(iMC)->GetName()), fValues);
-               }
-            }
+            fHistosManager->FillHistClass(tpcClusterMapHandle, fValues);
+            if(mcDecisionMap) FillTrackMCHistograms(mcDecisionMap, prefix, kHistTrackTPCclusterMap, icut);
          }
       } // end if(track->TestFlag(icut))
    }  // end loop over cuts
 }
 
 
+//___________________________________________________________________________
+void AliReducedAnalysisJpsi2ee::FillTrackMCHistograms(UInt_t mcDecisionMap, Int_t trackClass, Int_t histClass, Int_t icut) {
+   //
+   // fill the track histograms of a given class for all the leg candidate MC cuts fulfilled by the track
+   // NOTE: trackClass is the prefix index from GetTrackHistClassPrefix()
+   //
+   for(Int_t iMC=0; iMC<fLegCandidatesMCcuts.GetEntries(); ++iMC) {
+      if(!(mcDecisionMap & (UInt_t(1)<<iMC))) continue;
+      fHistosManager->FillHistClass(TrackHistClassHandle(trackClass, histClass, icut, iMC), fValues);
+   }
+}
+
+
 //___________________________________________________________________________
 void AliReducedAnalysisJpsi2ee::FillPairHistograms(ULong_t mask, Int_t pairType, TString pairClass /*="PairSE"*/, UInt_t mcDecisions /* = 0*/) {
    //
    // fill pair level histograms
    // NOTE: pairType can be 0,1 or 2 corresponding to ++, +- or -- pairs
-   TString typeStr[3] = {"PP", "PM", "MM"};
+   // NOTE: the handles of the "PairSE" classes are resolved in Init(), other classes are looked up by name
+   Bool_t useHandles = (pairClass=="PairSE");
    for(Int_t icut=0; icut<fTrackCuts.GetEntries(); ++icut) {
       if(mask & (ULong_t(1)<<icut)) {
-         fHistosManager->FillHistClass(Form("%s%s_%s", pairClass.Data(), typeStr[pairType].Data(), fTrackCuts.At(icut)->GetName()), fValues);
+         fHistosManager->FillHistClass(useHandles ? PairHistClassHandle(pairType, icut) :
+                                       fHistosManager->GetClassHandle(PairHistClassName(pairClass.Data(), pairType, icut).Data()), fValues);
          if(mcDecisions && pairType==1) {
-            for(Int_t iMC=0; iMC<=fLegCandidatesMCcuts.GetEntries(); ++iMC) {
+            for(Int_t iMC=0; iMC<fLegCandidatesMCcuts.GetEntries(); ++iMC) {
                if(mcDecisions & (UInt_t(1)<<iMC))
-                  fHistosManager->FillHistClass(Form("%s%s_%s_%s", pairClass.Data(), typeStr[pairType].Data(), fTrackCuts.At(icut)->GetName(), fLegCandidatesMCcuts.At(iMC)->GetName()), fValues);
+                  fHistosManager->FillHistClass(useHandles ? PairHistClassHandle(pairType, icut, iMC) :
+                                                fHistosManager->GetClassHandle(PairHistClassName(pairClass.Data(), pairType, icut, iMC).Data()), fValues);
             }
          }
       }
@@ -481,24 +596,24 @@ void AliReducedAnalysisJpsi2ee::LoopOverTracks(Int_t arrayOption /*=1*/) {
       for(Int_t i=AliReducedVarManager::kNEventVars; i<AliReducedVarManager::kEMCALmatchedEOverP; ++i) fValues[i]=-9999.;
 
       AliReducedVarManager::FillTrackInfo(track, fValues);
-      fHistosManager->FillHistClass("Track_BeforeCuts", fValues);
+      fHistosManager->FillHistClass(fFixedHistClassHandles[kHistTrackBeforeCuts], fValues);
       
       if(track->IsA() == AliReducedTrackInfo::Class()) {
          AliReducedTrackInfo* trackInfo = dynamic_cast<AliReducedTrackInfo*>(track);
          if(trackInfo) {
             for(UInt_t iflag=0; iflag<AliReducedVarManager::kNTrackingStatus; ++iflag) {
                AliReducedVarManager::FillTrackingFlag(trackInfo, iflag, fValues);
-               fHistosManager->FillHistClass("TrackStatusFlags_BeforeCuts", fValues);
+               fHistosManager->FillHistClass(fFixedHistClassHandles[kHistTrackStatusFlagsBeforeCuts], fValues);
             }
             for(Int_t iLayer=0; iLayer<6; ++iLayer) {
                AliReducedVarManager::FillITSlayerFlag(trackInfo, iLayer, fValues);
-               fHistosManager->FillHistClass("TrackITSclusterMap_BeforeCuts", fValues);
+               fHistosManager->FillHistClass(fFixedHistClassHandles[kHistTrackITSclusterMapBeforeCuts], fValues);
                AliReducedVarManager::FillITSsharedLayerFlag(trackInfo, iLayer, fValues);
-               fHistosManager->FillHistClass("TrackITSsharedClusterMap_BeforeCuts", fValues);
+               fHistosManager->FillHistClass(fFixedHistClassHandles[kHistTrackITSsharedClusterMapBeforeCuts], fValues);
             }
             for(Int_t iLayer=0; iLayer<8; ++iLayer) {
                AliReducedVarManager::FillTPCclusterBitFlag(trackInfo, iLayer, fValues);
-               fHistosManager->FillHistClass("TrackTPCclusterMap_BeforeCuts", fValues);
+               fHistosManager->FillHistClass(fFixedHistClassHandles[kHistTrackTPCclusterMapBeforeCuts], fValues);
             }
          }
       }
@@ -795,7 +910,7 @@ void AliReducedAnalysisJpsi2ee::LoopOverMCTracks(Int_t trackArray /*=1*/) {
             pt = fMCJpsiPtWeights->GetXaxis()->GetXmax();
          Double_t weight = fMCJpsiPtWeights->GetBinContent(fMCJpsiPtWeights->FindBin(pt));
          if(weight>1.0) weight = 1.0;
-         Double_t rnd = gRandom->Rndm(); 
+         Double_t rnd = AliReducedVarManager::GetRandom()->Rndm(); 
          if(weight<rnd) {
             fSkipMCEvent = kTRUE;
             return;
@@ -825,7 +940,7 @@ void AliReducedAnalysisJpsi2ee::LoopOverMCTracks(Int_t trackArray /*=1*/) {
       // loop over jpsi mother selections and fill histograms before the kine cuts on electrons
       for(Int_t iCut = 0; iCut<fJpsiMotherMCcuts.GetEntries(); ++iCut) {
          if(!(motherDecisions & (UInt_t(1)<<iCut)))  continue;
-         fHistosManager->FillHistClass(Form("%s_PureMCTruth_BeforeSelection", fJpsiMotherMCcuts.At(iCut)->GetName()), fValues);         
+         fHistosManager->FillHistClass(fMCTruthHistClassHandles[2*iCut], fValues);         
       }
       
       if(!daughter1) continue;
@@ -840,7 +955,7 @@ void AliReducedAnalysisJpsi2ee::LoopOverMCTracks(Int_t trackArray /*=1*/) {
       for(Int_t iCut = 0; iCut<fJpsiMotherMCcuts.GetEntries(); ++iCut) {
          if(!(motherDecisions & (UInt_t(1)<<iCut)))  continue;
          if(!(daughtersDecisions & (UInt_t(1)<<iCut)))  continue;
-         fHistosManager->FillHistClass(Form("%s_PureMCTruth_AfterSelection", fJpsiMotherMCcuts.At(iCut)->GetName()), fValues);         
+         fHistosManager->FillHistClass(fMCTruthHistClassHandles[2*iCut+1], fValues);         
       }
    }  // end loop over tracks
    return;
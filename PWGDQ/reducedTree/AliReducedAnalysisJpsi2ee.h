@@ -5,7 +5,10 @@
 #ifndef ALIREDUCEDANALYSISJPSI2EE_H
 #define ALIREDUCEDANALYSISJPSI2EE_H
 
+#include <vector>
+
 #include <TList.h>
+#include <TString.h>
 
 #include "AliReducedAnalysisTaskSE.h"
 #include "AliReducedInfoCut.h"
@@ -138,13 +141,42 @@ protected:
   void LoopOverTracks(Int_t arrayOption=1);
   void FillTrackHistograms(TString trackClass = "Track");
   void FillTrackHistograms(AliReducedBaseTrack* track, TString trackClass = "Track");
+  void FillTrackMCHistograms(UInt_t mcDecisionMap, Int_t trackClass, Int_t histClass, Int_t icut);
   void FillPairHistograms(ULong_t mask, Int_t pairType, TString pairClass = "PairSE", UInt_t mcDecisions = 0);
   void FillMCTruthHistograms();
 
   Bool_t fSkipMCEvent;          // decision to skip MC event
   TH1F*  fMCJpsiPtWeights;            // weights vs pt to reject events depending on the jpsi true pt (needed to re-weights jpsi Pt distribution)
   
-  ClassDef(AliReducedAnalysisJpsi2ee,6);
+  // Handles of the histogram classes filled in the event loop, see AliHistogramManager::GetClassHandle().
+  // They are resolved in Init(), or at the first event for copies made via the streamer (worker threads),
+  // such that no class name needs to be formatted and looked up per event, track or pair.
+  enum FixedHistClasses {
+     kHistEventBeforeCuts=0, kHistEventTagBeforeCuts, kHistEventTriggersBeforeCuts,
+     kHistEventAfterCuts, kHistEventTagAfterCuts, kHistEventTriggersAfterCuts,
+     kHistTrackBeforeCuts, kHistTrackStatusFlagsBeforeCuts, kHistTrackITSclusterMapBeforeCuts,
+     kHistTrackITSsharedClusterMapBeforeCuts, kHistTrackTPCclusterMapBeforeCuts,
+     kNFixedHistClasses
+  };
+  enum TrackHistClasses {
+     kHistTrack=0, kHistTrackStatusFlags, kHistTrackITSclusterMap, kHistTrackITSsharedClusterMap, kHistTrackTPCclusterMap,
+     kNTrackHistClasses
+  };
+  Bool_t fHistClassHandlesResolved;                       //! true after ResolveHistClassHandles()
+  Int_t fFixedHistClassHandles[kNFixedHistClasses];       //! handles of the event and track before cuts classes
+  std::vector<TString> fTrackHistClassPrefixes;           //! track class prefixes with resolved handles, "Track" first
+  std::vector<std::vector<Int_t> > fTrackHistClassHandles; //! handles of the track classes per prefix, track cut and leg MC cut
+  std::vector<Int_t> fPairHistClassHandles;               //! handles of the "PairSE" classes per pair type, track cut and leg MC cut
+  std::vector<Int_t> fMCTruthHistClassHandles;            //! handles of the pure MC truth classes per jpsi mother MC cut
+  
+  void ResolveHistClassHandles();
+  TString TrackHistClassName(const Char_t* trackClass, Int_t histClass, Int_t icut, Int_t iMC=-1) const;
+  TString PairHistClassName(const Char_t* pairClass, Int_t pairType, Int_t icut, Int_t iMC=-1) const;
+  Int_t GetTrackHistClassPrefix(const TString& trackClass);
+  Int_t TrackHistClassHandle(Int_t trackClass, Int_t histClass, Int_t icut, Int_t iMC=-1) const;
+  Int_t PairHistClassHandle(Int_t pairType, Int_t icut, Int_t iMC=-1) const;
+  
+  ClassDef(AliReducedAnalysisJpsi2ee,8);
 };
 
 #endif
@@ -55,6 +55,9 @@ public:
   Bool_t GetRunCorrelation() {return fOptionRunCorrelation;}
   AliMixingHandler* GetCorrelationMixingHandler() const {return fCorrelationsMixingHandler;};
   Bool_t GetRunCorrelationMixing() const {return fOptionRunCorrelationMixing;}
+  // the events are dispatched to the workers by the categories of the J/psi mixing handler only, which would split the
+  // categories of the correlation mixing handler between workers
+  virtual Bool_t CanRunInWorkers() const {return !(fOptionRunCorrelation && fOptionRunCorrelationMixing);}
   
 protected:
    AliMixingHandler* fCorrelationsMixingHandler;
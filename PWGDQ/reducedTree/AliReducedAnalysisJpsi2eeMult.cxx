@@ -683,8 +683,8 @@ void AliReducedAnalysisJpsi2eeMult::FindJpsiTruthLegs(AliReducedTrackInfo* mothe
 void AliReducedAnalysisJpsi2eeMult::RunTrackRotation(AliReducedTrackInfo &pTrack, AliReducedTrackInfo &nTrack, Int_t pairType){
 
   TString pairClass = "PairTR";
-  Double_t phi1 = TMath::TwoPi() * gRandom->Rndm();
-  Double_t phi2 = TMath::TwoPi() * gRandom->Rndm();
+  Double_t phi1 = TMath::TwoPi() * AliReducedVarManager::GetRandom()->Rndm();
+  Double_t phi2 = TMath::TwoPi() * AliReducedVarManager::GetRandom()->Rndm();
 
   if(pTrack.IsCartesian()){
     pTrack.Px( pTrack.Pt() * TMath::Cos(phi1)  );
@@ -18,6 +18,8 @@
 #include "AliHistogramManager.h"
 #include "AliReducedBaseEvent.h"
 
+class AliMixingHandler;
+
 //________________________________________________________________
 class AliReducedAnalysisTaskSE : public TObject {
   
@@ -54,6 +56,9 @@ public:
   
   // getters
   virtual AliHistogramManager* GetHistogramManager() const = 0;
+  virtual AliMixingHandler* GetMixingHandler() const {return 0x0;}
+  // false if the task cannot be processed by worker threads, see AliAnalysisTaskReducedEventProcessor::SetNWorkers()
+  virtual Bool_t CanRunInWorkers() const {return kTRUE;}
   AliReducedBaseEvent* GetEvent() const {return fEvent;}
   TTree* GetFilteredTree() {return fFilteredTree;}
   Int_t GetFilteredTreeWritingOption() const {return fFilteredTreeWritingOption;}
@@ -16,6 +16,7 @@ using std::endl;
 using std::flush;
 using std::ifstream;
 #include <fstream>
+#include <mutex>
 
 #include <TString.h>
 #include <TMath.h>
@@ -24,6 +25,7 @@ using std::ifstream;
 #include <TH2F.h>
 #include <TProfile.h>
 #include <TRandom.h>
+#include <TRandom3.h>
 #include <TProfile2D.h>
 #include <TFile.h>
 #include <THashList.h>
@@ -127,7 +129,6 @@ const Double_t AliReducedVarManager::fgkVZEROAz = 340.0;   // cm
 const Double_t AliReducedVarManager::fgkVZEROCz = 90.0;    // cm
 const Double_t AliReducedVarManager::fgkVZEROminMult = 0.5;   // minimum VZERO channel multiplicity
 const Float_t  AliReducedVarManager::fgkTPCQvecRapGap = 0.8;    // symmetric interval in the middle of the TPC excluded from EP calculation
-      Float_t  AliReducedVarManager::fgBeamMomentum = 1380.;   // beam momentum in GeV/c
      
 const Double_t AliReducedVarManager::fgkSPDEtaCutsVsVtxZ[20][2] = {
    {-0.5, 1.0}, {-0.6, 1.0}, {-0.8, 1.0}, {-0.9, 1.0}, {-1.0, 1.0},
@@ -136,12 +137,8 @@ const Double_t AliReducedVarManager::fgkSPDEtaCutsVsVtxZ[20][2] = {
    {-1.0, 1.0}, {-1.0, 0.9}, {-1.0, 0.8}, {-1.0, 0.7}, {-1.0, 0.6}
 };
      
-Int_t      AliReducedVarManager::fgCurrentRunNumber = -1;
 TString AliReducedVarManager::fgVariableNames[AliReducedVarManager::kNVars] = {""};
 TString AliReducedVarManager::fgVariableUnits[AliReducedVarManager::kNVars] = {""};
-AliReducedBaseEvent* AliReducedVarManager::fgEvent = 0x0;
-AliReducedEventPlaneInfo* AliReducedVarManager::fgEventPlane = 0x0;
-Bool_t AliReducedVarManager::fgUsedVars[AliReducedVarManager::kNVars] = {kFALSE};
 TH2F* AliReducedVarManager::fgTPCelectronCentroidMap = 0x0;
 TH2F* AliReducedVarManager::fgTPCelectronWidthMap = 0x0;
 AliReducedVarManager::Variables AliReducedVarManager::fgVarDependencyX = kNothing;
@@ -158,23 +155,159 @@ TH1I* AliReducedVarManager::fgRunL3Polarity = 0x0;
 TH1I* AliReducedVarManager::fgRunTimeStart = 0x0;
 TH1I* AliReducedVarManager::fgRunTimeEnd = 0x0;
 std::vector<Int_t>  AliReducedVarManager::fgRunNumbers;
-Int_t AliReducedVarManager::fgRunID = -1;
 TH1* AliReducedVarManager::fgAvgMultVsVtxGlobal      [kNMultiplicityEstimators] = {0x0};
-TH1* AliReducedVarManager::fgAvgMultVsVtxRunwise     [kNMultiplicityEstimators] = {0x0};
 TH1* AliReducedVarManager::fgAvgMultVsRun            [kNMultiplicityEstimators] = {0x0};
 TH2* AliReducedVarManager::fgAvgMultVsVtxAndRun      [kNMultiplicityEstimators] = {0x0};
 
 Double_t AliReducedVarManager::fgRefMultVsVtxGlobal  [kNMultiplicityEstimators] [kNReferenceMultiplicities] = {0.};
-Double_t AliReducedVarManager::fgRefMultVsVtxRunwise [kNMultiplicityEstimators] [kNReferenceMultiplicities] = {0.};
 Double_t AliReducedVarManager::fgRefMultVsRun        [kNMultiplicityEstimators] [kNReferenceMultiplicities] = {0.};
 Double_t AliReducedVarManager::fgRefMultVsVtxAndRun  [kNMultiplicityEstimators] [kNReferenceMultiplicities] = {0.};
 
 TString AliReducedVarManager::fgVZEROCalibrationPath = "";
-TProfile2D* AliReducedVarManager::fgAvgVZEROChannelMult[64] = {0x0};
-TProfile2D* AliReducedVarManager::fgVZEROqVecRecentering[4] = {0x0};
 Bool_t AliReducedVarManager::fgOptionCalibrateVZEROqVec = kFALSE;
 Bool_t AliReducedVarManager::fgOptionRecenterVZEROqVec = kFALSE;
 
+namespace {
+  // context used by all threads which did not bind their own one with AliReducedVarManager::SetContext()
+  AliReducedVarManager::VarContext gDefaultVarContext;
+  thread_local AliReducedVarManager::VarContext* gVarContext = 0x0;
+  // serializes the run-wise updates of the contexts, which create histograms and open calibration files
+  std::mutex gRunInfoMutex;
+}
+
+//__________________________________________________________________
+AliReducedVarManager::VarContext::VarContext() :
+  fCurrentRunNumber(-1),
+  fBeamMomentum(1380.),   // beam momentum in GeV/c
+  fEvent(0x0),
+  fEventPlane(0x0),
+  fUsedVars(),
+  fRunID(-1),
+  fAvgMultVsVtxRunwise(),
+  fRefMultVsVtxRunwise(),
+  fAvgVZEROChannelMult(),
+  fVZEROqVecRecentering(),
+  fCalibrateVZEROqVec(kFALSE),
+  fRecenterVZEROqVec(kFALSE),
+  fRandom(0x0)
+{
+  //
+  // constructor
+  //
+  for(Int_t i=0; i<kNVars; ++i) fUsedVars[i] = kFALSE;
+  ResetRunInfo();
+}
+
+//__________________________________________________________________
+AliReducedVarManager::VarContext::~VarContext() {
+  //
+  // destructor
+  //
+  if(fRandom) delete fRandom;
+}
+
+//__________________________________________________________________
+void AliReducedVarManager::VarContext::ResetRunInfo() {
+  //
+  // forget the current event and everything which was derived for the current run
+  //
+  fCurrentRunNumber = -1;
+  fEvent = 0x0;
+  fEventPlane = 0x0;
+  fRunID = -1;
+  for(Int_t i=0; i<kNMultiplicityEstimators; ++i) {
+    fAvgMultVsVtxRunwise[i] = 0x0;
+    for(Int_t j=0; j<kNReferenceMultiplicities; ++j) fRefMultVsVtxRunwise[i][j] = 0.;
+  }
+  for(Int_t i=0; i<64; ++i) fAvgVZEROChannelMult[i] = 0x0;
+  for(Int_t i=0; i<4; ++i) fVZEROqVecRecentering[i] = 0x0;
+  fCalibrateVZEROqVec = kFALSE;
+  fRecenterVZEROqVec = kFALSE;
+}
+
+//__________________________________________________________________
+AliReducedVarManager::VarContext* AliReducedVarManager::GetContext() {
+  //
+  // context bound to the calling thread
+  //
+  return (gVarContext ? gVarContext : &gDefaultVarContext);
+}
+
+//__________________________________________________________________
+void AliReducedVarManager::SetContext(VarContext* context) {
+  //
+  // bind a context to the calling thread; 0x0 reverts to the default context
+  //
+  gVarContext = context;
+}
+
+//__________________________________________________________________
+AliReducedVarManager::VarContext* AliReducedVarManager::CreateContext(Bool_t copyUsedVars /*=kTRUE*/) {
+  //
+  // create a new context with the configuration (used variables, beam momentum) of the current one,
+  // e.g. for a worker thread. The caller owns the returned object.
+  // If copyUsedVars is false, no variable is flagged as used, such that only the variables needed by the caller
+  // can be enabled with SetUseVariable() while the new context is bound.
+  // The new context gets its own random number generator, seeded from gRandom.
+  //
+  VarContext* context = new VarContext(*GetContext());
+  context->ResetRunInfo();
+  if(!copyUsedVars)
+    for(Int_t i=0; i<kNVars; ++i) context->fUsedVars[i] = kFALSE;
+  context->fRandom = new TRandom3(gRandom->Integer(kMaxUInt));
+  return context;
+}
+
+//__________________________________________________________________
+TRandom* AliReducedVarManager::GetRandom() {
+  //
+  // random number generator to be used while processing events: the one of the context bound to the calling thread,
+  // or gRandom for the default context
+  //
+  VarContext& ctx = *GetContext();
+  return (ctx.fRandom ? ctx.fRandom : gRandom);
+}
+
+//__________________________________________________________________
+void AliReducedVarManager::SetBeamMomentum(Float_t beamMom) {
+  GetContext()->fBeamMomentum = beamMom;
+}
+
+//__________________________________________________________________
+Float_t AliReducedVarManager::GetBeamMomentum() {
+  return GetContext()->fBeamMomentum;
+}
+
+//__________________________________________________________________
+void AliReducedVarManager::SetEvent(AliReducedBaseEvent* const ev) {
+  GetContext()->fEvent = ev;
+}
+
+//__________________________________________________________________
+void AliReducedVarManager::SetEventPlane(AliReducedEventPlaneInfo* const ev) {
+  GetContext()->fEventPlane = ev;
+}
+
+//__________________________________________________________________
+void AliReducedVarManager::SetUseVariable(Variables var) {
+  GetContext()->fUsedVars[var] = kTRUE;
+  SetVariableDependencies();
+}
+
+//__________________________________________________________________
+void AliReducedVarManager::SetUseVars(Bool_t* usedVars) {
+  VarContext& ctx = *GetContext();
+  for(Int_t i=0;i<kNVars;++i) {
+    if(usedVars[i]) ctx.fUsedVars[i]=kTRUE;    // overwrite only the variables that are being used since there are more channels to modify the used variables array, independently
+  }
+  SetVariableDependencies();
+}
+
+//__________________________________________________________________
+Bool_t AliReducedVarManager::GetUsedVar(Variables var) {
+  return GetContext()->fUsedVars[var];
+}
+
 //__________________________________________________________________
 AliReducedVarManager::AliReducedVarManager() :
   TObject()
@@ -207,131 +340,132 @@ void AliReducedVarManager::SetVariableDependencies() {
   //
   // Set as used those variables on which other variables calculation depends
   //
-  if(fgUsedVars[kDeltaVtxZ]) {
-    fgUsedVars[kVtxZ] = kTRUE;
-    fgUsedVars[kVtxZtpc] = kTRUE;
+  VarContext& ctx = *GetContext();
+  if(ctx.fUsedVars[kDeltaVtxZ]) {
+    ctx.fUsedVars[kVtxZ] = kTRUE;
+    ctx.fUsedVars[kVtxZtpc] = kTRUE;
   }
-  if(fgUsedVars[kRap] || fgUsedVars[kRapAbs]) {
-    fgUsedVars[kMass] = kTRUE;
-    fgUsedVars[kP] = kTRUE;
-    fgUsedVars[kEta] = kTRUE;
+  if(ctx.fUsedVars[kRap] || ctx.fUsedVars[kRapAbs]) {
+    ctx.fUsedVars[kMass] = kTRUE;
+    ctx.fUsedVars[kP] = kTRUE;
+    ctx.fUsedVars[kEta] = kTRUE;
   }
-  if(fgUsedVars[kTriggerRap] || fgUsedVars[kTriggerRapAbs]) {
-	  fgUsedVars[kMass] = kTRUE;
-	  fgUsedVars[kP] = kTRUE;
-	  fgUsedVars[kEta] = kTRUE;
+  if(ctx.fUsedVars[kTriggerRap] || ctx.fUsedVars[kTriggerRapAbs]) {
+	  ctx.fUsedVars[kMass] = kTRUE;
+	  ctx.fUsedVars[kP] = kTRUE;
+	  ctx.fUsedVars[kEta] = kTRUE;
   }
 
-  if(fgUsedVars[kEta]) fgUsedVars[kP] = kTRUE;
+  if(ctx.fUsedVars[kEta]) ctx.fUsedVars[kP] = kTRUE;
   
   for(Int_t ih=0; ih<6; ++ih) {
-    if(fgUsedVars[kVZEROQvecX+2*6+ih]) {
-      fgUsedVars[kVZEROQvecX+0*6+ih] = kTRUE;
-      fgUsedVars[kVZEROQvecX+1*6+ih] = kTRUE;
+    if(ctx.fUsedVars[kVZEROQvecX+2*6+ih]) {
+      ctx.fUsedVars[kVZEROQvecX+0*6+ih] = kTRUE;
+      ctx.fUsedVars[kVZEROQvecX+1*6+ih] = kTRUE;
     }
-    if(fgUsedVars[kVZEROQvecY+2*6+ih]) {
-      fgUsedVars[kVZEROQvecY+0*6+ih] = kTRUE;
-      fgUsedVars[kVZEROQvecY+1*6+ih] = kTRUE;
+    if(ctx.fUsedVars[kVZEROQvecY+2*6+ih]) {
+      ctx.fUsedVars[kVZEROQvecY+0*6+ih] = kTRUE;
+      ctx.fUsedVars[kVZEROQvecY+1*6+ih] = kTRUE;
     }
-    if(fgUsedVars[kVZERORP+2*6+ih]) {
-      fgUsedVars[kVZEROQvecX+2*6+ih] = kTRUE; fgUsedVars[kVZEROQvecY+2*6+ih] = kTRUE;
-      fgUsedVars[kVZEROQvecX+0*6+ih] = kTRUE; fgUsedVars[kVZEROQvecX+1*6+ih] = kTRUE;
-      fgUsedVars[kVZEROQvecY+0*6+ih] = kTRUE; fgUsedVars[kVZEROQvecY+1*6+ih] = kTRUE;
+    if(ctx.fUsedVars[kVZERORP+2*6+ih]) {
+      ctx.fUsedVars[kVZEROQvecX+2*6+ih] = kTRUE; ctx.fUsedVars[kVZEROQvecY+2*6+ih] = kTRUE;
+      ctx.fUsedVars[kVZEROQvecX+0*6+ih] = kTRUE; ctx.fUsedVars[kVZEROQvecX+1*6+ih] = kTRUE;
+      ctx.fUsedVars[kVZEROQvecY+0*6+ih] = kTRUE; ctx.fUsedVars[kVZEROQvecY+1*6+ih] = kTRUE;
     }
-    if(fgUsedVars[kVZEROQaQcSP+ih] || fgUsedVars[kVZEROQaQcSPsine+ih]) {
-      fgUsedVars[kVZERORP+0*6+ih]    = kTRUE; fgUsedVars[kVZERORP+1*6+ih]    = kTRUE;
-      fgUsedVars[kVZEROQvecX+0*6+ih] = kTRUE; fgUsedVars[kVZEROQvecX+1*6+ih] = kTRUE;
-      fgUsedVars[kVZEROQvecY+0*6+ih] = kTRUE; fgUsedVars[kVZEROQvecY+1*6+ih] = kTRUE;
+    if(ctx.fUsedVars[kVZEROQaQcSP+ih] || ctx.fUsedVars[kVZEROQaQcSPsine+ih]) {
+      ctx.fUsedVars[kVZERORP+0*6+ih]    = kTRUE; ctx.fUsedVars[kVZERORP+1*6+ih]    = kTRUE;
+      ctx.fUsedVars[kVZEROQvecX+0*6+ih] = kTRUE; ctx.fUsedVars[kVZEROQvecX+1*6+ih] = kTRUE;
+      ctx.fUsedVars[kVZEROQvecY+0*6+ih] = kTRUE; ctx.fUsedVars[kVZEROQvecY+1*6+ih] = kTRUE;
     }
-    if(fgUsedVars[kRPXtpcXvzeroa+ih]) {
-      fgUsedVars[kTPCQvecX+ih] = kTRUE; fgUsedVars[kVZEROQvecX+ih] = kTRUE;
+    if(ctx.fUsedVars[kRPXtpcXvzeroa+ih]) {
+      ctx.fUsedVars[kTPCQvecX+ih] = kTRUE; ctx.fUsedVars[kVZEROQvecX+ih] = kTRUE;
     }
-    if(fgUsedVars[kRPXtpcXvzeroc+ih]) {
-      fgUsedVars[kTPCQvecX+ih] = kTRUE; fgUsedVars[kVZEROQvecX+6+ih] = kTRUE;
+    if(ctx.fUsedVars[kRPXtpcXvzeroc+ih]) {
+      ctx.fUsedVars[kTPCQvecX+ih] = kTRUE; ctx.fUsedVars[kVZEROQvecX+6+ih] = kTRUE;
     }
-    if(fgUsedVars[kRPYtpcYvzeroa+ih]) {
-      fgUsedVars[kTPCQvecY+ih] = kTRUE; fgUsedVars[kVZEROQvecY+ih] = kTRUE;
+    if(ctx.fUsedVars[kRPYtpcYvzeroa+ih]) {
+      ctx.fUsedVars[kTPCQvecY+ih] = kTRUE; ctx.fUsedVars[kVZEROQvecY+ih] = kTRUE;
     }
-    if(fgUsedVars[kRPYtpcYvzeroc+ih]) {
-      fgUsedVars[kTPCQvecY+ih] = kTRUE; fgUsedVars[kVZEROQvecY+6+ih] = kTRUE;
+    if(ctx.fUsedVars[kRPYtpcYvzeroc+ih]) {
+      ctx.fUsedVars[kTPCQvecY+ih] = kTRUE; ctx.fUsedVars[kVZEROQvecY+6+ih] = kTRUE;
     }  
-    if(fgUsedVars[kRPXtpcYvzeroa+ih]) {
-      fgUsedVars[kTPCQvecX+ih] = kTRUE; fgUsedVars[kVZEROQvecY+ih] = kTRUE;
+    if(ctx.fUsedVars[kRPXtpcYvzeroa+ih]) {
+      ctx.fUsedVars[kTPCQvecX+ih] = kTRUE; ctx.fUsedVars[kVZEROQvecY+ih] = kTRUE;
     }  
-    if(fgUsedVars[kRPXtpcYvzeroc+ih]) {
-      fgUsedVars[kTPCQvecX+ih] = kTRUE; fgUsedVars[kVZEROQvecY+6+ih] = kTRUE;
+    if(ctx.fUsedVars[kRPXtpcYvzeroc+ih]) {
+      ctx.fUsedVars[kTPCQvecX+ih] = kTRUE; ctx.fUsedVars[kVZEROQvecY+6+ih] = kTRUE;
     }  
-    if(fgUsedVars[kRPYtpcXvzeroa+ih]) {
-      fgUsedVars[kTPCQvecY+ih] = kTRUE; fgUsedVars[kVZEROQvecX+ih] = kTRUE;
+    if(ctx.fUsedVars[kRPYtpcXvzeroa+ih]) {
+      ctx.fUsedVars[kTPCQvecY+ih] = kTRUE; ctx.fUsedVars[kVZEROQvecX+ih] = kTRUE;
     }  
-    if(fgUsedVars[kRPYtpcXvzeroc+ih]) {
-      fgUsedVars[kTPCQvecY+ih] = kTRUE; fgUsedVars[kVZEROQvecX+6+ih] = kTRUE;
+    if(ctx.fUsedVars[kRPYtpcXvzeroc+ih]) {
+      ctx.fUsedVars[kTPCQvecY+ih] = kTRUE; ctx.fUsedVars[kVZEROQvecX+6+ih] = kTRUE;
     }  
-    if(fgUsedVars[kRPdeltaVZEROAtpc+ih]) {
-      fgUsedVars[kVZERORP+0*6+ih] = kTRUE; fgUsedVars[kTPCRP+ih] = kTRUE;
+    if(ctx.fUsedVars[kRPdeltaVZEROAtpc+ih]) {
+      ctx.fUsedVars[kVZERORP+0*6+ih] = kTRUE; ctx.fUsedVars[kTPCRP+ih] = kTRUE;
     }
-    if(fgUsedVars[kRPdeltaVZEROCtpc+ih]) {
-      fgUsedVars[kVZERORP+1*6+ih] = kTRUE; fgUsedVars[kTPCRP+ih] = kTRUE;
+    if(ctx.fUsedVars[kRPdeltaVZEROCtpc+ih]) {
+      ctx.fUsedVars[kVZERORP+1*6+ih] = kTRUE; ctx.fUsedVars[kTPCRP+ih] = kTRUE;
     }
-    if(fgUsedVars[kTPCsubResCos+ih]) {
-      fgUsedVars[kTPCRPleft+ih] = kTRUE; fgUsedVars[kTPCRPright+ih] = kTRUE;
+    if(ctx.fUsedVars[kTPCsubResCos+ih]) {
+      ctx.fUsedVars[kTPCRPleft+ih] = kTRUE; ctx.fUsedVars[kTPCRPright+ih] = kTRUE;
     }
     for(Int_t iVZEROside=0; iVZEROside<3; ++iVZEROside) {
-      if(fgUsedVars[kVZEROFlowVn+iVZEROside*6+ih] || fgUsedVars[kVZEROFlowSine+iVZEROside*6+ih] ||
-	 fgUsedVars[kVZEROuQ+iVZEROside*6+ih] || fgUsedVars[kVZEROuQsine+iVZEROside*6+ih]) {
-	fgUsedVars[kPhi] = kTRUE; fgUsedVars[kVZERORP+iVZEROside*6+ih] = kTRUE;
-	if(iVZEROside<2 && (fgUsedVars[kVZEROuQ+iVZEROside*6+ih] || fgUsedVars[kVZEROuQsine+iVZEROside*6+ih])) {
-	  fgUsedVars[kVZEROQvecX+0*6+ih] = kTRUE; fgUsedVars[kVZEROQvecX+1*6+ih] = kTRUE;
-          fgUsedVars[kVZEROQvecY+0*6+ih] = kTRUE; fgUsedVars[kVZEROQvecY+1*6+ih] = kTRUE;
+      if(ctx.fUsedVars[kVZEROFlowVn+iVZEROside*6+ih] || ctx.fUsedVars[kVZEROFlowSine+iVZEROside*6+ih] ||
+	 ctx.fUsedVars[kVZEROuQ+iVZEROside*6+ih] || ctx.fUsedVars[kVZEROuQsine+iVZEROside*6+ih]) {
+	ctx.fUsedVars[kPhi] = kTRUE; ctx.fUsedVars[kVZERORP+iVZEROside*6+ih] = kTRUE;
+	if(iVZEROside<2 && (ctx.fUsedVars[kVZEROuQ+iVZEROside*6+ih] || ctx.fUsedVars[kVZEROuQsine+iVZEROside*6+ih])) {
+	  ctx.fUsedVars[kVZEROQvecX+0*6+ih] = kTRUE; ctx.fUsedVars[kVZEROQvecX+1*6+ih] = kTRUE;
+          ctx.fUsedVars[kVZEROQvecY+0*6+ih] = kTRUE; ctx.fUsedVars[kVZEROQvecY+1*6+ih] = kTRUE;
 	}
         if(iVZEROside==2) {
-	  fgUsedVars[kVZEROQvecX+2*6+ih] = kTRUE; fgUsedVars[kVZEROQvecY+2*6+ih] = kTRUE;
-          fgUsedVars[kVZEROQvecX+0*6+ih] = kTRUE; fgUsedVars[kVZEROQvecX+1*6+ih] = kTRUE;
-          fgUsedVars[kVZEROQvecY+0*6+ih] = kTRUE; fgUsedVars[kVZEROQvecY+1*6+ih] = kTRUE;
+	  ctx.fUsedVars[kVZEROQvecX+2*6+ih] = kTRUE; ctx.fUsedVars[kVZEROQvecY+2*6+ih] = kTRUE;
+          ctx.fUsedVars[kVZEROQvecX+0*6+ih] = kTRUE; ctx.fUsedVars[kVZEROQvecX+1*6+ih] = kTRUE;
+          ctx.fUsedVars[kVZEROQvecY+0*6+ih] = kTRUE; ctx.fUsedVars[kVZEROQvecY+1*6+ih] = kTRUE;
 	}
       }
     }
-    if(fgUsedVars[kTPCFlowVn+ih] || fgUsedVars[kTPCFlowSine+ih] || fgUsedVars[kTPCuQ+ih] || fgUsedVars[kTPCuQsine+ih]) {
-      fgUsedVars[kPhi] = kTRUE;
-      fgUsedVars[kTPCQvecXtotal+ih] = kTRUE;
-      fgUsedVars[kTPCQvecYtotal+ih] = kTRUE;
+    if(ctx.fUsedVars[kTPCFlowVn+ih] || ctx.fUsedVars[kTPCFlowSine+ih] || ctx.fUsedVars[kTPCuQ+ih] || ctx.fUsedVars[kTPCuQsine+ih]) {
+      ctx.fUsedVars[kPhi] = kTRUE;
+      ctx.fUsedVars[kTPCQvecXtotal+ih] = kTRUE;
+      ctx.fUsedVars[kTPCQvecYtotal+ih] = kTRUE;
     }
    
   } // end loop over harmonics
   for(Int_t ich=0; ich<64; ++ich) {
-    if(fgUsedVars[kVZEROflowV2TPC+ich]) {
-      fgUsedVars[kVZEROChannelMult+ich] = kTRUE; fgUsedVars[kTPCRP+1] = kTRUE;
+    if(ctx.fUsedVars[kVZEROflowV2TPC+ich]) {
+      ctx.fUsedVars[kVZEROChannelMult+ich] = kTRUE; ctx.fUsedVars[kTPCRP+1] = kTRUE;
     }
   }
-  if(fgUsedVars[kPtSquared]) fgUsedVars[kPt]=kTRUE;  
-  if(fgUsedVars[kTPCnSigCorrected+kElectron]) {
-     fgUsedVars[kTPCnSig+kElectron] = kTRUE; 
-     fgUsedVars[fgVarDependencyX] = kTRUE; 
-     fgUsedVars[fgVarDependencyY] = kTRUE;
+  if(ctx.fUsedVars[kPtSquared]) ctx.fUsedVars[kPt]=kTRUE;  
+  if(ctx.fUsedVars[kTPCnSigCorrected+kElectron]) {
+     ctx.fUsedVars[kTPCnSig+kElectron] = kTRUE; 
+     ctx.fUsedVars[fgVarDependencyX] = kTRUE; 
+     ctx.fUsedVars[fgVarDependencyY] = kTRUE;
   }
-  if(fgUsedVars[kPairEff] || fgUsedVars[kOneOverPairEff] || fgUsedVars[kOneOverPairEffSq]){
-    fgUsedVars[fgEffMapVarDependencyX] = kTRUE;
-    fgUsedVars[fgEffMapVarDependencyY] = kTRUE;
+  if(ctx.fUsedVars[kPairEff] || ctx.fUsedVars[kOneOverPairEff] || ctx.fUsedVars[kOneOverPairEffSq]){
+    ctx.fUsedVars[fgEffMapVarDependencyX] = kTRUE;
+    ctx.fUsedVars[fgEffMapVarDependencyY] = kTRUE;
   }
-  if(fgUsedVars[kNTracksITSoutVsSPDtracklets] || fgUsedVars[kNTracksTPCoutVsSPDtracklets] ||
-     fgUsedVars[kNTracksTOFoutVsSPDtracklets] || fgUsedVars[kNTracksTRDoutVsSPDtracklets])
-     fgUsedVars[kSPDntracklets] = kTRUE;
+  if(ctx.fUsedVars[kNTracksITSoutVsSPDtracklets] || ctx.fUsedVars[kNTracksTPCoutVsSPDtracklets] ||
+     ctx.fUsedVars[kNTracksTOFoutVsSPDtracklets] || ctx.fUsedVars[kNTracksTRDoutVsSPDtracklets])
+     ctx.fUsedVars[kSPDntracklets] = kTRUE;
   
-  if(fgUsedVars[kRapMC] || fgUsedVars[kRapMCAbs]) fgUsedVars[kMassMC] = kTRUE;
+  if(ctx.fUsedVars[kRapMC] || ctx.fUsedVars[kRapMCAbs]) ctx.fUsedVars[kMassMC] = kTRUE;
 
-  if(fgUsedVars[kPairPhiV]){
-    fgUsedVars[kL3Polarity] = kTRUE;
+  if(ctx.fUsedVars[kPairPhiV]){
+    ctx.fUsedVars[kL3Polarity] = kTRUE;
   }
-  if(fgUsedVars[kMassDcaPtCorr] ) {
-    fgUsedVars[kMass]          = kTRUE;
-    fgUsedVars[kPt]            = kTRUE;
-    fgUsedVars[kPairDcaXYSqrt] = kTRUE;
+  if(ctx.fUsedVars[kMassDcaPtCorr] ) {
+    ctx.fUsedVars[kMass]          = kTRUE;
+    ctx.fUsedVars[kPt]            = kTRUE;
+    ctx.fUsedVars[kPairDcaXYSqrt] = kTRUE;
   }
-  if(fgUsedVars[kOpAngDcaPtCorr] ) {
-    fgUsedVars[kPairOpeningAngle] = kTRUE;
-    fgUsedVars[kOneOverSqrtPt]    = kTRUE;
-    fgUsedVars[kPt]               = kTRUE;
-    fgUsedVars[kPairDcaXYSqrt]    = kTRUE;
+  if(ctx.fUsedVars[kOpAngDcaPtCorr] ) {
+    ctx.fUsedVars[kPairOpeningAngle] = kTRUE;
+    ctx.fUsedVars[kOneOverSqrtPt]    = kTRUE;
+    ctx.fUsedVars[kPt]               = kTRUE;
+    ctx.fUsedVars[kPairDcaXYSqrt]    = kTRUE;
   }
 }
 
@@ -340,7 +474,8 @@ void AliReducedVarManager::FillEventInfo(Float_t* values) {
   //
   // Fill event information
   //
-  FillEventInfo(fgEvent, values, fgEventPlane);
+  VarContext& ctx = *GetContext();
+  FillEventInfo(ctx.fEvent, values, ctx.fEventPlane);
 }
 
 void AliReducedVarManager::FillMCEventInfo(AliReducedEventInfo* event, Float_t* values) {
@@ -356,6 +491,7 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
   // fill event wise info
   //
   // Basic event information
+  VarContext& ctx = *GetContext();
 
   values[kVtxX]                      = baseEvent->Vertex(0);
   values[kVtxY]                       = baseEvent->Vertex(1);
@@ -381,111 +517,89 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
   EVENT* event = (EVENT*)baseEvent;
   
   // Update run wise information if available (needed for the first event filled and whenever the run changes)
-  if(fgCurrentRunNumber!=baseEvent->RunNo()) {
-    fgCurrentRunNumber = baseEvent->RunNo();
+  // NOTE: this is done under a lock since it creates histograms and opens files, which is not safe from several threads.
+  //       The global multiplicity references are computed in SetMultiplicityProfile(), before any event is filled.
+  if(ctx.fCurrentRunNumber!=baseEvent->RunNo()) {
+    std::lock_guard<std::mutex> lock(gRunInfoMutex);
+    ctx.fCurrentRunNumber = baseEvent->RunNo();
     // GRP and LHC information
-    if(fgRunTotalLuminosity) values[kTotalLuminosity] = fgRunTotalLuminosity->GetBinContent(fgRunTotalLuminosity->GetXaxis()->FindBin(Form("%d",fgCurrentRunNumber)));
-    if(fgRunTotalIntensity0) values[kBeamIntensity0] = fgRunTotalIntensity0->GetBinContent(fgRunTotalIntensity0->GetXaxis()->FindBin(Form("%d",fgCurrentRunNumber)));
-    if(fgRunTotalIntensity1) values[kBeamIntensity1] = fgRunTotalIntensity1->GetBinContent(fgRunTotalIntensity1->GetXaxis()->FindBin(Form("%d",fgCurrentRunNumber)));
-    if(fgRunLHCFillNumber) values[kLHCFillNumber] = fgRunLHCFillNumber->GetBinContent(fgRunLHCFillNumber->GetXaxis()->FindBin(Form("%d",fgCurrentRunNumber)));
-    if(fgRunDipolePolarity) values[kDipolePolarity] = fgRunDipolePolarity->GetBinContent(fgRunDipolePolarity->GetXaxis()->FindBin(Form("%d",fgCurrentRunNumber)));
-    if(fgRunL3Polarity) values[kL3Polarity] = fgRunL3Polarity->GetBinContent(fgRunL3Polarity->GetXaxis()->FindBin(Form("%d",fgCurrentRunNumber)));
-    if(fgRunTimeStart) values[kRunTimeStart] = fgRunTimeStart->GetBinContent(fgRunTimeStart->GetXaxis()->FindBin(Form("%d",fgCurrentRunNumber)));
-    if(fgRunTimeEnd) values[kRunTimeEnd] = fgRunTimeEnd->GetBinContent(fgRunTimeEnd->GetXaxis()->FindBin(Form("%d",fgCurrentRunNumber)));
+    if(fgRunTotalLuminosity) values[kTotalLuminosity] = fgRunTotalLuminosity->GetBinContent(fgRunTotalLuminosity->GetXaxis()->FindBin(Form("%d",ctx.fCurrentRunNumber)));
+    if(fgRunTotalIntensity0) values[kBeamIntensity0] = fgRunTotalIntensity0->GetBinContent(fgRunTotalIntensity0->GetXaxis()->FindBin(Form("%d",ctx.fCurrentRunNumber)));
+    if(fgRunTotalIntensity1) values[kBeamIntensity1] = fgRunTotalIntensity1->GetBinContent(fgRunTotalIntensity1->GetXaxis()->FindBin(Form("%d",ctx.fCurrentRunNumber)));
+    if(fgRunLHCFillNumber) values[kLHCFillNumber] = fgRunLHCFillNumber->GetBinContent(fgRunLHCFillNumber->GetXaxis()->FindBin(Form("%d",ctx.fCurrentRunNumber)));
+    if(fgRunDipolePolarity) values[kDipolePolarity] = fgRunDipolePolarity->GetBinContent(fgRunDipolePolarity->GetXaxis()->FindBin(Form("%d",ctx.fCurrentRunNumber)));
+    if(fgRunL3Polarity) values[kL3Polarity] = fgRunL3Polarity->GetBinContent(fgRunL3Polarity->GetXaxis()->FindBin(Form("%d",ctx.fCurrentRunNumber)));
+    if(fgRunTimeStart) values[kRunTimeStart] = fgRunTimeStart->GetBinContent(fgRunTimeStart->GetXaxis()->FindBin(Form("%d",ctx.fCurrentRunNumber)));
+    if(fgRunTimeEnd) values[kRunTimeEnd] = fgRunTimeEnd->GetBinContent(fgRunTimeEnd->GetXaxis()->FindBin(Form("%d",ctx.fCurrentRunNumber)));
     
-    // VZERO calibration
+    // VZERO calibration; if the calibration is not available for this run, this context runs uncalibrated until the next run
+    // the profiles of the previous run are owned by the context
+    for(Int_t iCh=0; iCh<64; ++iCh) {
+      if(ctx.fAvgVZEROChannelMult[iCh]) delete ctx.fAvgVZEROChannelMult[iCh];
+      ctx.fAvgVZEROChannelMult[iCh] = 0x0;
+    }
+    for(Int_t i=0; i<4; ++i) {
+      if(ctx.fVZEROqVecRecentering[i]) delete ctx.fVZEROqVecRecentering[i];
+      ctx.fVZEROqVecRecentering[i] = 0x0;
+    }
+    ctx.fCalibrateVZEROqVec = fgOptionCalibrateVZEROqVec;
+    ctx.fRecenterVZEROqVec = fgOptionRecenterVZEROqVec;
     if(fgVZEROCalibrationPath.Data()[0]!='\0') {
        cout << "AliReducedVarManager::Info  Attempting to load VZERO calibration and/or recentering histograms from path: " << endl << fgVZEROCalibrationPath.Data() << endl;
-      TFile* calibFile = TFile::Open(Form("%s/000%d/dstAnalysisHistograms.root", fgVZEROCalibrationPath.Data(), fgCurrentRunNumber));
+      TFile* calibFile = TFile::Open(Form("%s/000%d/dstAnalysisHistograms.root", fgVZEROCalibrationPath.Data(), ctx.fCurrentRunNumber));
       THashList* mainList = (THashList*)calibFile->Get("jpsi2eeHistos");
       THashList* calibList = (THashList*)mainList->FindObject("Event_AfterCuts");
       if(!calibList) {
-         cout << "AliReducedVarManager::Info  Cannot open calibration file for run " << fgCurrentRunNumber << endl;
+         cout << "AliReducedVarManager::Info  Cannot open calibration file for run " << ctx.fCurrentRunNumber << endl;
          cout << "                        Will run uncalibrated and not-recentered!" << endl;
-         fgOptionCalibrateVZEROqVec = kFALSE;
-         fgOptionRecenterVZEROqVec = kFALSE;
+         ctx.fCalibrateVZEROqVec = kFALSE;
+         ctx.fRecenterVZEROqVec = kFALSE;
       }
-      cout << "AliReducedVarManager::Info  Loading VZERO calibration and/or recentering parameters for run " << fgCurrentRunNumber << endl;
-      if(fgOptionCalibrateVZEROqVec) {
+      cout << "AliReducedVarManager::Info  Loading VZERO calibration and/or recentering parameters for run " << ctx.fCurrentRunNumber << endl;
+      if(ctx.fCalibrateVZEROqVec) {
         for(Int_t iCh=0; iCh<64; ++iCh) {
            
-           fgAvgVZEROChannelMult[iCh] = (TProfile2D*)calibList->FindObject(Form("VZEROmult_ch%d_VtxCent_prof", iCh))->Clone(Form("run%d_ch%d", fgCurrentRunNumber, iCh));
-           fgAvgVZEROChannelMult[iCh]->SetDirectory(0x0);
+           ctx.fAvgVZEROChannelMult[iCh] = (TProfile2D*)calibList->FindObject(Form("VZEROmult_ch%d_VtxCent_prof", iCh))->Clone(Form("run%d_ch%d", ctx.fCurrentRunNumber, iCh));
+           ctx.fAvgVZEROChannelMult[iCh]->SetDirectory(0x0);
         }
       }
-      if(fgOptionRecenterVZEROqVec) {
-         fgVZEROqVecRecentering[0] = (TProfile2D*)calibList->FindObject(Form("QvecX_sideA_h2_CentSPDVtxZ_prof"))->Clone(Form("run%d_QvecX_VZEROA", fgCurrentRunNumber));
-         fgVZEROqVecRecentering[0]->SetDirectory(0x0);
-         fgVZEROqVecRecentering[1] = (TProfile2D*)calibList->FindObject(Form("QvecY_sideA_h2_CentSPDVtxZ_prof"))->Clone(Form("run%d_QvecY_VZEROA", fgCurrentRunNumber));
-         fgVZEROqVecRecentering[1]->SetDirectory(0x0);
-         fgVZEROqVecRecentering[2] = (TProfile2D*)calibList->FindObject(Form("QvecX_sideC_h2_CentSPDVtxZ_prof"))->Clone(Form("run%d_QvecX_VZEROC", fgCurrentRunNumber));
-         fgVZEROqVecRecentering[2]->SetDirectory(0x0);
-         fgVZEROqVecRecentering[3] = (TProfile2D*)calibList->FindObject(Form("QvecY_sideC_h2_CentSPDVtxZ_prof"))->Clone(Form("run%d_QvecY_VZEROC", fgCurrentRunNumber));
-         fgVZEROqVecRecentering[3]->SetDirectory(0x0);
+      if(ctx.fRecenterVZEROqVec) {
+         ctx.fVZEROqVecRecentering[0] = (TProfile2D*)calibList->FindObject(Form("QvecX_sideA_h2_CentSPDVtxZ_prof"))->Clone(Form("run%d_QvecX_VZEROA", ctx.fCurrentRunNumber));
+         ctx.fVZEROqVecRecentering[0]->SetDirectory(0x0);
+         ctx.fVZEROqVecRecentering[1] = (TProfile2D*)calibList->FindObject(Form("QvecY_sideA_h2_CentSPDVtxZ_prof"))->Clone(Form("run%d_QvecY_VZEROA", ctx.fCurrentRunNumber));
+         ctx.fVZEROqVecRecentering[1]->SetDirectory(0x0);
+         ctx.fVZEROqVecRecentering[2] = (TProfile2D*)calibList->FindObject(Form("QvecX_sideC_h2_CentSPDVtxZ_prof"))->Clone(Form("run%d_QvecX_VZEROC", ctx.fCurrentRunNumber));
+         ctx.fVZEROqVecRecentering[2]->SetDirectory(0x0);
+         ctx.fVZEROqVecRecentering[3] = (TProfile2D*)calibList->FindObject(Form("QvecY_sideC_h2_CentSPDVtxZ_prof"))->Clone(Form("run%d_QvecY_VZEROC", ctx.fCurrentRunNumber));
+         ctx.fVZEROqVecRecentering[3]->SetDirectory(0x0);
       }
       calibFile->Close();
     }
 
-    if(fgUsedVars[kRunID] && fgRunNumbers.size() && fgRunID < 0  ){
-      for( fgRunID = 0; fgRunNumbers[ fgRunID ] != fgCurrentRunNumber && fgRunID< (Int_t) fgRunNumbers.size() ; ++fgRunID );
+    if(ctx.fUsedVars[kRunID] && fgRunNumbers.size() && ctx.fRunID < 0  ){
+      for( ctx.fRunID = 0; fgRunNumbers[ ctx.fRunID ] != ctx.fCurrentRunNumber && ctx.fRunID< (Int_t) fgRunNumbers.size() ; ++ctx.fRunID );
     }
     for( int iEstimator =0 ; iEstimator < kNMultiplicityEstimators ; ++iEstimator ){
       if( fgAvgMultVsVtxAndRun[iEstimator] ){
-        Bool_t fillGlobal = !fgAvgMultVsVtxGlobal[iEstimator];
-        fgAvgMultVsVtxRunwise  [iEstimator] = fgAvgMultVsVtxAndRun[iEstimator]->ProjectionY( Form("AvgMultVsVtxRunwise%d",iEstimator ), fgRunID, fgRunID );
-        if( fillGlobal ){
-          fgAvgMultVsVtxGlobal [iEstimator] = fgAvgMultVsVtxAndRun[iEstimator]->ProjectionY( Form("AvgMultVsVtxGlobal%d", iEstimator) );
-          fgAvgMultVsVtxGlobal [iEstimator] -> Scale(1. / fgAvgMultVsVtxAndRun[iEstimator]->GetXaxis()->GetNbins());
-          fgAvgMultVsRun       [iEstimator] = fgAvgMultVsVtxAndRun[iEstimator]->ProjectionX( Form("AvgMultVsRun%d", iEstimator)  );
-          fgAvgMultVsRun       [iEstimator] -> Scale(1. / fgAvgMultVsVtxAndRun[iEstimator]->GetYaxis()->GetNbins());
-        }
-        for( int iReference = 0; iReference < kNReferenceMultiplicities; ++ iReference  ){
-          Double_t refVsVtx, refVsVtxGlobal, refVsRun, refVsVtxAndRun;
-          switch ( iReference ){
-            case kMaximumMultiplicity :
-              refVsVtx = fgAvgMultVsVtxRunwise[iEstimator]->GetMaximum();
-              if( fillGlobal ){
-                refVsVtxGlobal = fgAvgMultVsVtxGlobal[iEstimator]->GetMaximum();
-                refVsRun       = fgAvgMultVsRun[iEstimator]->GetMaximum();
-                refVsVtxAndRun = fgAvgMultVsVtxAndRun[iEstimator]->GetMaximum();
-              }
-              break;
-            case kMinimumMultiplicity :
-              refVsVtx = fgAvgMultVsVtxRunwise[iEstimator]->GetMinimum();
-              if( fillGlobal ){
-                refVsVtxGlobal = fgAvgMultVsVtxGlobal[iEstimator]->GetMinimum();
-                refVsRun       = fgAvgMultVsRun[iEstimator]->GetMinimum();
-                refVsVtxAndRun = fgAvgMultVsVtxAndRun[iEstimator]->GetMinimum();
-              }
-              break;
-            case kMeanMultiplicity :
-              refVsVtx = 0.5 * ( fgAvgMultVsVtxRunwise[iEstimator]->GetMaximum() +  fgAvgMultVsVtxRunwise[iEstimator]->GetMinimum() );
-              if( fillGlobal ){
-                refVsVtxGlobal = 0.5 * ( fgAvgMultVsVtxGlobal[iEstimator]->GetMaximum() + fgAvgMultVsVtxGlobal[iEstimator]->GetMinimum() ) ;
-                refVsRun       = 0.5 * ( fgAvgMultVsRun[iEstimator]->GetMaximum() + fgAvgMultVsRun[iEstimator]->GetMinimum() );
-                refVsVtxAndRun = 0.5 * ( fgAvgMultVsVtxAndRun[iEstimator]->GetMaximum() + fgAvgMultVsVtxAndRun[iEstimator]->GetMinimum() );
-              }
-              break;
-          }
-          fgRefMultVsVtxRunwise  [iEstimator][iReference] = refVsVtx;
-          if(fillGlobal){
-            fgRefMultVsVtxGlobal [iEstimator][iReference] = refVsVtxGlobal;
-            fgRefMultVsRun       [iEstimator][iReference] = refVsRun;
-            fgRefMultVsVtxAndRun [iEstimator][iReference] = refVsVtxAndRun;
-          }
-        }
+        // the projection is owned by the context; its name is unique per context such that ROOT does not hand out the histogram of another context
+        if( ctx.fAvgMultVsVtxRunwise[iEstimator] ) delete ctx.fAvgMultVsVtxRunwise[iEstimator];
+        ctx.fAvgMultVsVtxRunwise  [iEstimator] = fgAvgMultVsVtxAndRun[iEstimator]->ProjectionY( Form("AvgMultVsVtxRunwise%d_%p",iEstimator, (void*)&ctx ), ctx.fRunID, ctx.fRunID );
+        ctx.fAvgMultVsVtxRunwise  [iEstimator]->SetDirectory(0x0);
+        ctx.fRefMultVsVtxRunwise  [iEstimator][kMaximumMultiplicity] = ctx.fAvgMultVsVtxRunwise[iEstimator]->GetMaximum();
+        ctx.fRefMultVsVtxRunwise  [iEstimator][kMinimumMultiplicity] = ctx.fAvgMultVsVtxRunwise[iEstimator]->GetMinimum();
+        ctx.fRefMultVsVtxRunwise  [iEstimator][kMeanMultiplicity]    = 0.5 * ( ctx.fAvgMultVsVtxRunwise[iEstimator]->GetMaximum() +  ctx.fAvgMultVsVtxRunwise[iEstimator]->GetMinimum() );
       }
     }
   }
 
-  values[kRunNo] = fgCurrentRunNumber;
-  values[kRunID] = fgRunID;
+  values[kRunNo] = ctx.fCurrentRunNumber;
+  values[kRunID] = ctx.fRunID;
   
   values[kEventNumberInFile]    = event->EventNumberInFile();
   values[kBC]                   = event->BC();
   values[kTimeStamp]            = event->TimeStamp();
-  if(fgUsedVars[kTimeRelativeSOR]) values[kTimeRelativeSOR] = (event->TimeStamp() - values[kRunTimeStart]) / 60.;
-  if(fgUsedVars[kTimeRelativeSORfraction] && 
+  if(ctx.fUsedVars[kTimeRelativeSOR]) values[kTimeRelativeSOR] = (event->TimeStamp() - values[kRunTimeStart]) / 60.;
+  if(ctx.fUsedVars[kTimeRelativeSORfraction] && 
      (values[kRunTimeEnd]-values[kRunTimeStart])>1.)   // the run should be longer than 1 second ... 
     values[kTimeRelativeSORfraction] = (event->TimeStamp() - values[kRunTimeStart]) / (values[kRunTimeEnd] - values[kRunTimeStart]);
   values[kEventType]            = event->EventType();
@@ -515,27 +629,27 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
   values[kVtxZspd]              = event->VertexSPD(2);
   values[kNVtxSPDContributors]  = event->VertexSPDContributors();
   
-  if(fgUsedVars[kDeltaVtxZ]) values[kDeltaVtxZ] = values[kVtxZ] - values[kVtxZtpc];
-  if(fgUsedVars[kDeltaVtxZspd]) values[kDeltaVtxZspd] = values[kVtxZ] - values[kVtxZspd];
+  if(ctx.fUsedVars[kDeltaVtxZ]) values[kDeltaVtxZ] = values[kVtxZ] - values[kVtxZtpc];
+  if(ctx.fUsedVars[kDeltaVtxZspd]) values[kDeltaVtxZspd] = values[kVtxZ] - values[kVtxZspd];
   
   for(Int_t iflag=0;iflag<32;++iflag) 
     values[kNTracksPerTrackingStatus+iflag] = event->TracksPerTrackingFlag(iflag);
   
-  // set the fgUsedVars to true as these might have been set to false in the previous event
-  fgUsedVars[kNTracksTPCoutVsITSout] = kTRUE;
-  fgUsedVars[kNTracksTRDoutVsITSout] = kTRUE;
-  fgUsedVars[kNTracksTOFoutVsITSout] = kTRUE;
-  fgUsedVars[kNTracksTRDoutVsTPCout] = kTRUE;
-  fgUsedVars[kNTracksTOFoutVsTPCout] = kTRUE;
-  fgUsedVars[kNTracksTOFoutVsTRDout] = kTRUE;
+  // set the ctx.fUsedVars to true as these might have been set to false in the previous event
+  ctx.fUsedVars[kNTracksTPCoutVsITSout] = kTRUE;
+  ctx.fUsedVars[kNTracksTRDoutVsITSout] = kTRUE;
+  ctx.fUsedVars[kNTracksTOFoutVsITSout] = kTRUE;
+  ctx.fUsedVars[kNTracksTRDoutVsTPCout] = kTRUE;
+  ctx.fUsedVars[kNTracksTOFoutVsTPCout] = kTRUE;
+  ctx.fUsedVars[kNTracksTOFoutVsTRDout] = kTRUE;
   if(TMath::Abs(values[kNTracksPerTrackingStatus+kITSout])>0.01) {
     values[kNTracksTPCoutVsITSout] = values[kNTracksPerTrackingStatus+kTPCout]/values[kNTracksPerTrackingStatus+kITSout];
     values[kNTracksTRDoutVsITSout] = values[kNTracksPerTrackingStatus+kTRDout]/values[kNTracksPerTrackingStatus+kITSout]; 
     values[kNTracksTOFoutVsITSout] = values[kNTracksPerTrackingStatus+kTOFout]/values[kNTracksPerTrackingStatus+kITSout];
   }
   else {
-     // if these values are undefined, set fgUsedVars as false such that the values are not filled in histograms
-     fgUsedVars[kNTracksTPCoutVsITSout] = kFALSE; fgUsedVars[kNTracksTRDoutVsITSout] = kFALSE; fgUsedVars[kNTracksTOFoutVsITSout] = kFALSE;
+     // if these values are undefined, set ctx.fUsedVars as false such that the values are not filled in histograms
+     ctx.fUsedVars[kNTracksTPCoutVsITSout] = kFALSE; ctx.fUsedVars[kNTracksTRDoutVsITSout] = kFALSE; ctx.fUsedVars[kNTracksTOFoutVsITSout] = kFALSE;
   }
   
   if(TMath::Abs(values[kNTracksPerTrackingStatus+kTPCout])>0.01) {
@@ -543,13 +657,13 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
     values[kNTracksTOFoutVsTPCout] = values[kNTracksPerTrackingStatus+kTOFout]/values[kNTracksPerTrackingStatus+kTPCout];
   }
   else {
-     fgUsedVars[kNTracksTRDoutVsTPCout] = kFALSE; fgUsedVars[kNTracksTOFoutVsTPCout] = kFALSE; 
+     ctx.fUsedVars[kNTracksTRDoutVsTPCout] = kFALSE; ctx.fUsedVars[kNTracksTOFoutVsTPCout] = kFALSE; 
   }
   
   if(TMath::Abs(values[kNTracksPerTrackingStatus+kTRDout])>0.01)
     values[kNTracksTOFoutVsTRDout] = values[kNTracksPerTrackingStatus+kTOFout]/values[kNTracksPerTrackingStatus+kTRDout];
   else
-     fgUsedVars[kNTracksTOFoutVsTRDout] = kFALSE;
+     ctx.fUsedVars[kNTracksTOFoutVsTRDout] = kFALSE;
 
   // Multiplicity estimators
 
@@ -592,7 +706,7 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
             Double_t refMult  = fgRefMultVsVtxAndRun[iEstimator][iReference];
             multCorr *=  localAvg ?  refMult / localAvg : 1.;
             Double_t deltaM =  localAvg ?  multRaw * ( refMult/localAvg - 1) : 0.;
-            multCorrSmeared += (deltaM>0 ? 1. : -1.) * gRandom->Poisson(TMath::Abs(deltaM));
+            multCorrSmeared += (deltaM>0 ? 1. : -1.) * GetRandom()->Poisson(TMath::Abs(deltaM));
           }
           else{
     // first apply vertex correction
@@ -605,8 +719,8 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
                 break;
               case kVertexCorrectionRunwise:
               case kVertexCorrectionRunwiseGainLoss:
-                localAvgVsVtx = fgAvgMultVsVtxRunwise[iEstimator]->GetBinContent( vtxBin );
-                refMultVsVtx  = fgRefMultVsVtxRunwise[iEstimator][iReference];
+                localAvgVsVtx = ctx.fAvgMultVsVtxRunwise[iEstimator]->GetBinContent( vtxBin );
+                refMultVsVtx  = ctx.fRefMultVsVtxRunwise[iEstimator][iReference];
                 break;
               default:
                 localAvgVsVtx = 0.;
@@ -615,7 +729,7 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
             }
             multCorr        *= localAvgVsVtx > 0. ? refMultVsVtx / localAvgVsVtx : 1.;
             Double_t deltaM  = localAvgVsVtx > 0. ? multRaw  * ( refMultVsVtx/localAvgVsVtx - 1) : 0.;
-            multCorrSmeared += (deltaM>0 ? 1. : -1.) * gRandom->Poisson(TMath::Abs(deltaM));
+            multCorrSmeared += (deltaM>0 ? 1. : -1.) * GetRandom()->Poisson(TMath::Abs(deltaM));
     // then apply gain loss correction
             if( iCorrection == kVertexCorrectionGlobalGainLoss || 
                 iCorrection == kVertexCorrectionRunwiseGainLoss || 
@@ -624,13 +738,13 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
               Double_t refMultVsRun  = fgRefMultVsRun[iEstimator][iReference];
               multCorr        *= localAvgVsRun ? refMultVsRun / localAvgVsRun : 1.;
               deltaM           = localAvgVsRun ? multCorrSmeared  * ( refMultVsRun/localAvgVsRun - 1) : 0;
-              multCorrSmeared += (deltaM>0 ? 1. : -1.) * gRandom->Poisson(TMath::Abs(deltaM));
+              multCorrSmeared += (deltaM>0 ? 1. : -1.) * GetRandom()->Poisson(TMath::Abs(deltaM));
             }
           }
           values[ indexNotSmeared ] = multCorr;
           values[ indexSmeared ]    = multCorrSmeared;
-          fgUsedVars [indexNotSmeared] = kTRUE;
-          fgUsedVars [indexSmeared] = kTRUE;
+          ctx.fUsedVars [indexNotSmeared] = kTRUE;
+          ctx.fUsedVars [indexSmeared] = kTRUE;
         }
       }
     }
@@ -648,8 +762,8 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
               if( fgAvgMultVsVtxGlobal[kSPDntrackletsEtaBin+ieta-kMultiplicity]->GetBinContent( vtxBin ) > .3 ){
                 Int_t indexBinNotSmeared = GetCorrectedMultiplicity( kSPDntrackletsEtaBin+ieta, iCorrection, iReference, kNoSmearing );
                 Int_t indexBinSmeared    = GetCorrectedMultiplicity( kSPDntrackletsEtaBin+ieta, iCorrection, iReference, kPoissonSmearing );
-                if( fgUsedVars[indexBinNotSmeared]) values[ indexNotSmeared ] += values[ indexBinNotSmeared ];
-                if( fgUsedVars[indexBinSmeared]) values[ indexSmeared ] += values[ indexBinSmeared ];
+                if( ctx.fUsedVars[indexBinNotSmeared]) values[ indexNotSmeared ] += values[ indexBinNotSmeared ];
+                if( ctx.fUsedVars[indexBinSmeared]) values[ indexSmeared ] += values[ indexBinSmeared ];
               }
             }
           }
@@ -668,10 +782,10 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
     }
   }
 
-  fgUsedVars[kNTracksITSoutVsSPDtracklets] = kTRUE;  
-  fgUsedVars[kNTracksTPCoutVsSPDtracklets] = kTRUE;
-  fgUsedVars[kNTracksTRDoutVsSPDtracklets] = kTRUE;
-  fgUsedVars[kNTracksTOFoutVsSPDtracklets] = kTRUE;
+  ctx.fUsedVars[kNTracksITSoutVsSPDtracklets] = kTRUE;  
+  ctx.fUsedVars[kNTracksTPCoutVsSPDtracklets] = kTRUE;
+  ctx.fUsedVars[kNTracksTRDoutVsSPDtracklets] = kTRUE;
+  ctx.fUsedVars[kNTracksTOFoutVsSPDtracklets] = kTRUE;
   if(values[kSPDntracklets]>0.01) {
     values[kNTracksITSoutVsSPDtracklets] = values[kNTracksPerTrackingStatus+kITSout] / values[kSPDntracklets];
     values[kNTracksTPCoutVsSPDtracklets] = values[kNTracksPerTrackingStatus+kTPCout] / values[kSPDntracklets];
@@ -679,10 +793,10 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
     values[kNTracksTOFoutVsSPDtracklets] = values[kNTracksPerTrackingStatus+kTOFout] / values[kSPDntracklets];
   }
   else {
-     fgUsedVars[kNTracksITSoutVsSPDtracklets] = kFALSE;  
-     fgUsedVars[kNTracksTPCoutVsSPDtracklets] = kFALSE;
-     fgUsedVars[kNTracksTRDoutVsSPDtracklets] = kFALSE;
-     fgUsedVars[kNTracksTOFoutVsSPDtracklets] = kFALSE;
+     ctx.fUsedVars[kNTracksITSoutVsSPDtracklets] = kFALSE;  
+     ctx.fUsedVars[kNTracksTPCoutVsSPDtracklets] = kFALSE;
+     ctx.fUsedVars[kNTracksTRDoutVsSPDtracklets] = kFALSE;
+     ctx.fUsedVars[kNTracksTOFoutVsSPDtracklets] = kFALSE;
   }
     
   values[kNCaloClusters]   = event->GetNCaloClusters();
@@ -695,45 +809,45 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
   values[kSPDnSingleClusters] = event->SPDnSingleClusters();
 
   //VZERO detector information
-  fgUsedVars[kNTracksTPCoutVsVZEROTotalMult] = kTRUE;
+  ctx.fUsedVars[kNTracksTPCoutVsVZEROTotalMult] = kTRUE;
   if(values[kVZEROTotalMult]>1.0e-5)
      values[kNTracksTPCoutVsVZEROTotalMult] = values[kNTracksPerTrackingStatus+kTPCout] / values[kVZEROTotalMult];
   else
-     fgUsedVars[kNTracksTPCoutVsVZEROTotalMult] = kFALSE;
+     ctx.fUsedVars[kNTracksTPCoutVsVZEROTotalMult] = kFALSE;
   
   values[kVZEROAemptyChannels] = 0;
   values[kVZEROCemptyChannels] = 0;
-  for(Int_t ich=0;ich<64;++ich) fgUsedVars[kVZEROChannelMult+ich] = kTRUE; 
+  for(Int_t ich=0;ich<64;++ich) ctx.fUsedVars[kVZEROChannelMult+ich] = kTRUE; 
   Float_t theta=0.0;
   for(Int_t ich=0;ich<64;++ich) {
-    if(fgUsedVars[kVZEROChannelMult+ich]) {
+    if(ctx.fUsedVars[kVZEROChannelMult+ich]) {
       values[kVZEROChannelMult+ich] = event->MultChannelVZERO(ich);
       if(values[kVZEROChannelMult+ich]<fgkVZEROminMult) {
-        fgUsedVars[kVZEROChannelMult+ich] = kFALSE;   // will not be filled in histograms by the histogram manager
+        ctx.fUsedVars[kVZEROChannelMult+ich] = kFALSE;   // will not be filled in histograms by the histogram manager
         if(ich<32) values[kVZEROCemptyChannels] += 1;
         else values[kVZEROAemptyChannels] += 1;
       }
     }
-    if(fgUsedVars[kVZEROChannelEta+ich]) {
+    if(ctx.fUsedVars[kVZEROChannelEta+ich]) {
       if(ich<32) theta = TMath::ATan(fgkVZEROChannelRadii[ich]/(fgkVZEROCz-values[kVtxZ]));
       else theta = TMath::Pi()-TMath::ATan(fgkVZEROChannelRadii[ich]/(fgkVZEROAz-values[kVtxZ]));
       values[kVZEROChannelEta+ich] = -1.0*TMath::Log(TMath::Tan(theta/2.0));
     }
   }
   
-  fgUsedVars[kNTracksTPCoutFromPileup] = kTRUE;
+  ctx.fUsedVars[kNTracksTPCoutFromPileup] = kTRUE;
   if(values[kVZEROTotalMult]>0.0)
      values[kNTracksTPCoutFromPileup] = values[kNTracksPerTrackingStatus+kTPCout] - (-2.55+TMath::Sqrt(2.55*2.55+4.0e-5*values[kVZEROTotalMult])) / 2.0e-5;
-  else fgUsedVars[kNTracksTPCoutFromPileup] = kFALSE;
+  else ctx.fUsedVars[kNTracksTPCoutFromPileup] = kFALSE;
   
-  if(!eventF && (fgUsedVars[kVZEROQvecX+0*6+1] || fgUsedVars[kVZEROQvecY+0*6+1] || fgUsedVars[kVZERORP+0*6+1])) {
+  if(!eventF && (ctx.fUsedVars[kVZEROQvecX+0*6+1] || ctx.fUsedVars[kVZEROQvecY+0*6+1] || ctx.fUsedVars[kVZERORP+0*6+1])) {
     Double_t qvecVZEROA[EVENTPLANE::fgkNMaxHarmonics][2] = {{0.0}};
     Double_t qvecVZEROC[EVENTPLANE::fgkNMaxHarmonics][2] = {{0.0}};
-    if(fgOptionCalibrateVZEROqVec && fgAvgVZEROChannelMult[0]) {
+    if(ctx.fCalibrateVZEROqVec && ctx.fAvgVZEROChannelMult[0]) {
       Float_t calibVZEROMult[64] = {0.};
       for(Int_t iCh=0; iCh<64; ++iCh) {
          if(event->MultChannelVZERO(iCh)>=fgkVZEROminMult) {
-            Float_t avMult = fgAvgVZEROChannelMult[iCh]->GetBinContent(fgAvgVZEROChannelMult[iCh]->FindBin(event->Vertex(2), event->CentralitySPD()));
+            Float_t avMult = ctx.fAvgVZEROChannelMult[iCh]->GetBinContent(ctx.fAvgVZEROChannelMult[iCh]->FindBin(event->Vertex(2), event->CentralitySPD()));
             calibVZEROMult[iCh] = event->MultChannelVZERO(iCh) / (avMult>1.0e-6 ? avMult : 1.0);
          }
       }
@@ -744,14 +858,14 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
       event->GetVZEROQvector(qvecVZEROA, EVENTPLANE::kVZEROA);
       event->GetVZEROQvector(qvecVZEROC, EVENTPLANE::kVZEROC);
     }
-    if(fgOptionRecenterVZEROqVec && fgVZEROqVecRecentering[0]) {
-       Float_t recenterOffset = fgVZEROqVecRecentering[0]->GetBinContent(fgVZEROqVecRecentering[0]->FindBin(event->CentralitySPD(), event->Vertex(2)));
+    if(ctx.fRecenterVZEROqVec && ctx.fVZEROqVecRecentering[0]) {
+       Float_t recenterOffset = ctx.fVZEROqVecRecentering[0]->GetBinContent(ctx.fVZEROqVecRecentering[0]->FindBin(event->CentralitySPD(), event->Vertex(2)));
        qvecVZEROA[1][0] -= recenterOffset;
-       recenterOffset = fgVZEROqVecRecentering[1]->GetBinContent(fgVZEROqVecRecentering[1]->FindBin(event->CentralitySPD(), event->Vertex(2)));
+       recenterOffset = ctx.fVZEROqVecRecentering[1]->GetBinContent(ctx.fVZEROqVecRecentering[1]->FindBin(event->CentralitySPD(), event->Vertex(2)));
        qvecVZEROA[1][1] -= recenterOffset;
-       recenterOffset = fgVZEROqVecRecentering[2]->GetBinContent(fgVZEROqVecRecentering[2]->FindBin(event->CentralitySPD(), event->Vertex(2)));
+       recenterOffset = ctx.fVZEROqVecRecentering[2]->GetBinContent(ctx.fVZEROqVecRecentering[2]->FindBin(event->CentralitySPD(), event->Vertex(2)));
        qvecVZEROC[1][0] -= recenterOffset;
-       recenterOffset = fgVZEROqVecRecentering[3]->GetBinContent(fgVZEROqVecRecentering[3]->FindBin(event->CentralitySPD(), event->Vertex(2)));
+       recenterOffset = ctx.fVZEROqVecRecentering[3]->GetBinContent(ctx.fVZEROqVecRecentering[3]->FindBin(event->CentralitySPD(), event->Vertex(2)));
        qvecVZEROC[1][1] -= recenterOffset;
     }
     for(Int_t ih=1; ih<2; ++ih) {
@@ -766,7 +880,7 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
        values[kVZEROQvecY+2*6+ih] = qvecVZEROA[ih][1] + qvecVZEROC[ih][1];
        values[kVZERORP   +2*6+ih] = TMath::ATan2(values[kVZEROQvecY+2*6+ih], values[kVZEROQvecX+2*6+ih])/Double_t(ih+1);
      
-       if(fgUsedVars[kVZEROQaQcSP+ih]) {
+       if(ctx.fUsedVars[kVZEROQaQcSP+ih]) {
           values[kVZEROQaQcSP+ih] = TMath::Cos((ih+1)*(values[kVZERORP+0*6+ih]-values[kVZERORP+1*6+ih]));
           values[kVZEROQaQcSP+ih] *= TMath::Sqrt(values[kVZEROQvecX+0*6+ih]*values[kVZEROQvecX+0*6+ih]+
           values[kVZEROQvecY+0*6+ih]*values[kVZEROQvecY+0*6+ih]);
@@ -780,25 +894,25 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
        values[kVZEROQvecY+1*6+ih]*values[kVZEROQvecY+1*6+ih]);
        values[kVZERORP   +2*6+ih] = TMath::ATan2(values[kVZEROQvecY+2*6+ih],values[kVZEROQvecX+2*6+ih])/Double_t(ih+1);
        // cos (n*(psi_A-psi_C))
-       if(fgUsedVars[kVZERORPres + ih]) {
+       if(ctx.fUsedVars[kVZERORPres + ih]) {
           values[kVZERORPres + ih] = DeltaPhi(values[kVZERORP+0*6+ih], values[kVZERORP+1*6+ih]);
           values[kVZERORPres + ih] = TMath::Cos(values[kVZERORPres + ih]*(ih+1));
        }
        // Qx,Qy correlations for VZERO
-       if(fgUsedVars[kVZEROXaXc+ih]) 
+       if(ctx.fUsedVars[kVZEROXaXc+ih]) 
           values[kVZEROXaXc+ih] = qvecVZEROA[ih][0]*qvecVZEROC[ih][0];
-       if(fgUsedVars[kVZEROXaYa+ih]) 
+       if(ctx.fUsedVars[kVZEROXaYa+ih]) 
           values[kVZEROXaYa+ih] = qvecVZEROA[ih][0]*qvecVZEROA[ih][1];
-       if(fgUsedVars[kVZEROXaYc+ih]) 
+       if(ctx.fUsedVars[kVZEROXaYc+ih]) 
           values[kVZEROXaYc+ih] = qvecVZEROA[ih][0]*qvecVZEROC[ih][1];
-       if(fgUsedVars[kVZEROYaXc+ih]) 
+       if(ctx.fUsedVars[kVZEROYaXc+ih]) 
           values[kVZEROYaXc+ih] = qvecVZEROA[ih][1]*qvecVZEROC[ih][0];
-       if(fgUsedVars[kVZEROYaYc+ih]) 
+       if(ctx.fUsedVars[kVZEROYaYc+ih]) 
           values[kVZEROYaYc+ih] = qvecVZEROA[ih][1]*qvecVZEROC[ih][1];
-       if(fgUsedVars[kVZEROXcYc+ih]) 
+       if(ctx.fUsedVars[kVZEROXcYc+ih]) 
           values[kVZEROXcYc+ih] = qvecVZEROC[ih][0]*qvecVZEROC[ih][1];
        // Psi_A - Psi_C
-       if(fgUsedVars[kVZEROdeltaRPac+ih])
+       if(ctx.fUsedVars[kVZEROdeltaRPac+ih])
           values[kVZEROdeltaRPac+ih] = DeltaPhi(values[kVZERORP+0*6+ih], values[kVZERORP+1*6+ih]);
     }    // end loop over harmonics
   }
@@ -812,20 +926,20 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
       for(Int_t iVZEROside=0; iVZEROside<2; ++iVZEROside) {
         values[kVZEROQvecX+iVZEROside*6+ih] = eventF->Qx(EVENTPLANE::kVZEROA+iVZEROside, ih+1);
         values[kVZEROQvecY+iVZEROside*6+ih] = eventF->Qy(EVENTPLANE::kVZEROA+iVZEROside, ih+1);
-        if(fgUsedVars[kVZERORP+iVZEROside*6+ih]) 
+        if(ctx.fUsedVars[kVZERORP+iVZEROside*6+ih]) 
 	  values[kVZERORP+iVZEROside*6+ih] = eventF->EventPlane(EVENTPLANE::kVZEROA+iVZEROside, ih+1);
-	if(fgUsedVars[kVZEROQvecX+2*6+ih])
+	if(ctx.fUsedVars[kVZEROQvecX+2*6+ih])
 	  values[kVZEROQvecX+2*6+ih] += values[kVZEROQvecX+iVZEROside*6+ih];
-	if(fgUsedVars[kVZEROQvecY+2*6+ih])
+	if(ctx.fUsedVars[kVZEROQvecY+2*6+ih])
 	  values[kVZEROQvecY+2*6+ih] += values[kVZEROQvecY+iVZEROside*6+ih];
 	// cos(n(EPtpc-EPvzero A/C))	
-        if(fgUsedVars[kTPCRPres+iVZEROside*6+ih]) {
+        if(ctx.fUsedVars[kTPCRPres+iVZEROside*6+ih]) {
 	  values[kTPCRPres+iVZEROside*6+ih] = DeltaPhi(eventF->EventPlane(EVENTPLANE::kTPC, ih+1), eventF->EventPlane(EVENTPLANE::kVZEROA+iVZEROside, ih+1));
           values[kTPCRPres+iVZEROside*6+ih] = TMath::Cos(values[kTPCRPres+iVZEROside*6+ih]*(ih+1));
 	}
       }
       
-      if(fgUsedVars[kVZEROQaQcSP+ih]) {
+      if(ctx.fUsedVars[kVZEROQaQcSP+ih]) {
         values[kVZEROQaQcSP+ih] = TMath::Cos((ih+1)*(values[kVZERORP+0*6+ih]-values[kVZERORP+1*6+ih]));
         values[kVZEROQaQcSP+ih] *= TMath::Sqrt(values[kVZEROQvecX+0*6+ih]*values[kVZEROQvecX+0*6+ih]+
                                                values[kVZEROQvecY+0*6+ih]*values[kVZEROQvecY+0*6+ih]);
@@ -839,66 +953,66 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
                                              values[kVZEROQvecY+1*6+ih]*values[kVZEROQvecY+1*6+ih]);
       values[kVZERORP   +2*6+ih] = TMath::ATan2(values[kVZEROQvecY+2*6+ih],values[kVZEROQvecX+2*6+ih])/Double_t(ih+1);
       // cos (n*(psi_A-psi_C))
-      if(fgUsedVars[kVZERORPres + ih]) {
+      if(ctx.fUsedVars[kVZERORPres + ih]) {
 	values[kVZERORPres + ih] = DeltaPhi(eventF->EventPlane(EVENTPLANE::kVZEROA, ih+1), 
 					    eventF->EventPlane(EVENTPLANE::kVZEROC, ih+1));
         values[kVZERORPres + ih] = TMath::Cos(values[kVZERORPres + ih]*(ih+1));
       }
       // Qx,Qy correlations for VZERO
-      if(fgUsedVars[kVZEROXaXc+ih]) 
+      if(ctx.fUsedVars[kVZEROXaXc+ih]) 
 	values[kVZEROXaXc+ih] = eventF->Qx(EVENTPLANE::kVZEROA, ih+1)*eventF->Qx(EVENTPLANE::kVZEROC, ih+1);
-      if(fgUsedVars[kVZEROXaYa+ih]) 
+      if(ctx.fUsedVars[kVZEROXaYa+ih]) 
 	values[kVZEROXaYa+ih] = eventF->Qx(EVENTPLANE::kVZEROA, ih+1)*eventF->Qy(EVENTPLANE::kVZEROA, ih+1);
-      if(fgUsedVars[kVZEROXaYc+ih]) 
+      if(ctx.fUsedVars[kVZEROXaYc+ih]) 
 	values[kVZEROXaYc+ih] = eventF->Qx(EVENTPLANE::kVZEROA, ih+1)*eventF->Qy(EVENTPLANE::kVZEROC, ih+1);
-      if(fgUsedVars[kVZEROYaXc+ih]) 
+      if(ctx.fUsedVars[kVZEROYaXc+ih]) 
 	values[kVZEROYaXc+ih] = eventF->Qy(EVENTPLANE::kVZEROA, ih+1)*eventF->Qx(EVENTPLANE::kVZEROC, ih+1);
-      if(fgUsedVars[kVZEROYaYc+ih]) 
+      if(ctx.fUsedVars[kVZEROYaYc+ih]) 
 	values[kVZEROYaYc+ih] = eventF->Qy(EVENTPLANE::kVZEROA, ih+1)*eventF->Qy(EVENTPLANE::kVZEROC, ih+1);
-      if(fgUsedVars[kVZEROXcYc+ih]) 
+      if(ctx.fUsedVars[kVZEROXcYc+ih]) 
 	values[kVZEROXcYc+ih] = eventF->Qx(EVENTPLANE::kVZEROC, ih+1)*eventF->Qy(EVENTPLANE::kVZEROC, ih+1);
       // Psi_A - Psi_C
-      if(fgUsedVars[kVZEROdeltaRPac+ih])
+      if(ctx.fUsedVars[kVZEROdeltaRPac+ih])
         values[kVZEROdeltaRPac+ih] = DeltaPhi(eventF->EventPlane(EVENTPLANE::kVZEROA, ih+1), 
 	  				      eventF->EventPlane(EVENTPLANE::kVZEROC, ih+1));
       
       // TPC event plane
       values[kTPCQvecX+ih] = eventF->Qx(EVENTPLANE::kTPC, ih+1);
       values[kTPCQvecY+ih] = eventF->Qy(EVENTPLANE::kTPC, ih+1);
-      if(fgUsedVars[kTPCRP+ih]) 
+      if(ctx.fUsedVars[kTPCRP+ih]) 
 	values[kTPCRP+ih] = eventF->EventPlane(EVENTPLANE::kTPC, ih+1);
       // TPC VZERO Q-vector correlations
-      if(fgUsedVars[kRPXtpcXvzeroa+ih]) 
+      if(ctx.fUsedVars[kRPXtpcXvzeroa+ih]) 
 	values[kRPXtpcXvzeroa+ih] = values[kTPCQvecX+ih]*values[kVZEROQvecX+ih];
-      if(fgUsedVars[kRPXtpcXvzeroc+ih]) 
+      if(ctx.fUsedVars[kRPXtpcXvzeroc+ih]) 
 	values[kRPXtpcXvzeroc+ih] = values[kTPCQvecX+ih]*values[kVZEROQvecX+6+ih];
-      if(fgUsedVars[kRPYtpcYvzeroa+ih]) 
+      if(ctx.fUsedVars[kRPYtpcYvzeroa+ih]) 
 	values[kRPYtpcYvzeroa+ih] = values[kTPCQvecY+ih]*values[kVZEROQvecY+ih];
-      if(fgUsedVars[kRPYtpcYvzeroc+ih]) 
+      if(ctx.fUsedVars[kRPYtpcYvzeroc+ih]) 
 	values[kRPYtpcYvzeroc+ih] = values[kTPCQvecY+ih]*values[kVZEROQvecY+6+ih];
-      if(fgUsedVars[kRPXtpcYvzeroa+ih]) 
+      if(ctx.fUsedVars[kRPXtpcYvzeroa+ih]) 
 	values[kRPXtpcYvzeroa+ih] = values[kTPCQvecX+ih]*values[kVZEROQvecY+ih];
-      if(fgUsedVars[kRPXtpcYvzeroc+ih]) 
+      if(ctx.fUsedVars[kRPXtpcYvzeroc+ih]) 
 	values[kRPXtpcYvzeroc+ih] = values[kTPCQvecX+ih]*values[kVZEROQvecY+6+ih];
-      if(fgUsedVars[kRPYtpcXvzeroa+ih]) 
+      if(ctx.fUsedVars[kRPYtpcXvzeroa+ih]) 
 	values[kRPYtpcXvzeroa+ih] = values[kTPCQvecY+ih]*values[kVZEROQvecX+ih];
-      if(fgUsedVars[kRPYtpcXvzeroc+ih]) 
+      if(ctx.fUsedVars[kRPYtpcXvzeroc+ih]) 
 	values[kRPYtpcXvzeroc+ih] = values[kTPCQvecY+ih]*values[kVZEROQvecX+6+ih];
       // Psi_TPC - Psi_VZERO A/C      
-      if(fgUsedVars[kRPdeltaVZEROAtpc+ih]) 
+      if(ctx.fUsedVars[kRPdeltaVZEROAtpc+ih]) 
 	values[kRPdeltaVZEROAtpc+ih] = DeltaPhi(values[kVZERORP+0*6+ih], values[kTPCRP+ih]);
-      if(fgUsedVars[kRPdeltaVZEROCtpc+ih])
+      if(ctx.fUsedVars[kRPdeltaVZEROCtpc+ih])
         values[kRPdeltaVZEROCtpc+ih] = DeltaPhi(values[kVZERORP+1*6+ih], values[kTPCRP+ih]);
       // TPC event planes with sub-event method
       values[kTPCQvecXleft+ih] = eventF->Qx(EVENTPLANE::kTPCneg, ih+1);
       values[kTPCQvecYleft+ih] = eventF->Qy(EVENTPLANE::kTPCneg, ih+1);
-      if(fgUsedVars[kTPCRPleft+ih])
+      if(ctx.fUsedVars[kTPCRPleft+ih])
 	values[kTPCRPleft+ih] = eventF->EventPlane(EVENTPLANE::kTPCneg, ih+1);
       values[kTPCQvecXright+ih] = eventF->Qx(EVENTPLANE::kTPCpos, ih+1);
       values[kTPCQvecYright+ih] = eventF->Qy(EVENTPLANE::kTPCpos, ih+1);
-      if(fgUsedVars[kTPCRPright+ih])
+      if(ctx.fUsedVars[kTPCRPright+ih])
         values[kTPCRPright+ih] = eventF->EventPlane(EVENTPLANE::kTPCpos, ih+1); 
-      if(fgUsedVars[kTPCsubResCos+ih]) 
+      if(ctx.fUsedVars[kTPCsubResCos+ih]) 
 	values[kTPCsubResCos+ih] = TMath::Cos(Double_t(ih+1)*(values[kTPCRPleft+ih]-values[kTPCRPright+ih]));
     }  // end loop over harmonics
     
@@ -906,7 +1020,7 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
     Double_t vzeroChannelPhi[8] = {0.3927, 1.1781, 1.9635, 2.7489, -2.7489, -1.9635, -1.1781, -0.3927};
     
     for(Int_t ich=0; ich<64; ++ich) {
-      if(fgUsedVars[kVZEROflowV2TPC+ich])
+      if(ctx.fUsedVars[kVZEROflowV2TPC+ich])
 	values[kVZEROflowV2TPC+ich] = values[kVZEROChannelMult+ich]*
                                       TMath::Cos(2.0*DeltaPhi(vzeroChannelPhi[ich%8],values[kTPCRP+1]));
     } 
@@ -957,8 +1071,9 @@ void AliReducedVarManager::FillITSlayerFlag(TRACK* track, Int_t layer, Float_t*
   //
   // fill the ITS layer hit
   //
+  VarContext& ctx = *GetContext();
   values[kITSlayerHit] = -1.0*(layer+1);
-  if(fgUsedVars[kITSlayerHit] && track->ITSLayerHit(layer)) values[kITSlayerHit] = layer+1;
+  if(ctx.fUsedVars[kITSlayerHit] && track->ITSLayerHit(layer)) values[kITSlayerHit] = layer+1;
 }
 
 //_________________________________________________________________
@@ -966,8 +1081,9 @@ void AliReducedVarManager::FillITSsharedLayerFlag(TRACK* track, Int_t layer, Flo
    //
    // fill the ITS layer having shared cluster
    //
+  VarContext& ctx = *GetContext();
    values[kITSlayerShared] = -1.0*(layer+1);
-   if(fgUsedVars[kITSlayerShared] && track->ITSLayerHit(layer) && track->ITSClusterIsShared(layer)) values[kITSlayerShared] = layer+1;
+   if(ctx.fUsedVars[kITSlayerShared] && track->ITSLayerHit(layer) && track->ITSClusterIsShared(layer)) values[kITSlayerShared] = layer+1;
 }
 
 //_________________________________________________________________
@@ -975,10 +1091,11 @@ void AliReducedVarManager::FillL0TriggerInputs(EVENT* event, Int_t input, Float_
   //
   // fill the L0 trigger inputs
   //
+  VarContext& ctx = *GetContext();
   values[kL0TriggerInput] = -1.0;
-  if(fgUsedVars[kL0TriggerInput] && event->L0TriggerInput(input)) values[kL0TriggerInput] = input;
+  if(ctx.fUsedVars[kL0TriggerInput] && event->L0TriggerInput(input)) values[kL0TriggerInput] = input;
   values[kL0TriggerInput2] = -1.0;
-  if(fgUsedVars[kL0TriggerInput2] && event->L0TriggerInput(input2)) values[kL0TriggerInput2] = input2;
+  if(ctx.fUsedVars[kL0TriggerInput2] && event->L0TriggerInput(input2)) values[kL0TriggerInput2] = input2;
 }
 
 
@@ -987,10 +1104,11 @@ void AliReducedVarManager::FillL1TriggerInputs(EVENT* event, Int_t input, Float_
   //
   // fill the L1 trigger inputs
   //
+  VarContext& ctx = *GetContext();
   values[kL1TriggerInput] = -1.0;
-  if(fgUsedVars[kL1TriggerInput] && event->L1TriggerInput(input)) values[kL1TriggerInput] = input;
+  if(ctx.fUsedVars[kL1TriggerInput] && event->L1TriggerInput(input)) values[kL1TriggerInput] = input;
   values[kL1TriggerInput2] = -1.0;
-  if(fgUsedVars[kL1TriggerInput2] && event->L1TriggerInput(input2)) values[kL1TriggerInput2] = input2;
+  if(ctx.fUsedVars[kL1TriggerInput2] && event->L1TriggerInput(input2)) values[kL1TriggerInput2] = input2;
 }
 
 //_________________________________________________________________
@@ -998,10 +1116,11 @@ void AliReducedVarManager::FillL2TriggerInputs(EVENT* event, Int_t input, Float_
   //
   // fill the L2 trigger inputs
   //
+  VarContext& ctx = *GetContext();
   values[kL2TriggerInput] = -1.0;
-  if(fgUsedVars[kL2TriggerInput] && event->L2TriggerInput(input)) values[kL2TriggerInput] = input;
+  if(ctx.fUsedVars[kL2TriggerInput] && event->L2TriggerInput(input)) values[kL2TriggerInput] = input;
   values[kL2TriggerInput2] = -1.0;
-  if(fgUsedVars[kL2TriggerInput2] && event->L2TriggerInput(input2)) values[kL2TriggerInput2] = input2;
+  if(ctx.fUsedVars[kL2TriggerInput2] && event->L2TriggerInput(input2)) values[kL2TriggerInput2] = input2;
 }
 
 //_________________________________________________________________
@@ -1009,8 +1128,9 @@ void AliReducedVarManager::FillEventTagInput(BASEEVENT* event, Int_t input, Floa
   //
   // fill the event tag inputs
   //
+  VarContext& ctx = *GetContext();
   values[kEventTag] = -1.0;
-  if(fgUsedVars[kEventTag] && event->EventTag(input)) values[kEventTag] = input;
+  if(ctx.fUsedVars[kEventTag] && event->EventTag(input)) values[kEventTag] = input;
 }
 
 //_________________________________________________________________
@@ -1018,8 +1138,9 @@ void AliReducedVarManager::FillTPCclusterBitFlag(TRACK* track, Int_t bit, Float_
   //
   // fill the TPC cluster map
   //
+  VarContext& ctx = *GetContext();
   values[kTPCclusBitFired] = -1;
-  if(fgUsedVars[kTPCclusBitFired] && track->TPCClusterMapBitFired(bit)) values[kTPCclusBitFired] = bit;
+  if(ctx.fUsedVars[kTPCclusBitFired] && track->TPCClusterMapBitFired(bit)) values[kTPCclusBitFired] = bit;
 }
 
 
@@ -1104,13 +1225,14 @@ void AliReducedVarManager::FillEventOnlineTrigger(UShort_t triggerBit, Float_t*
   // fill the trigger bit input
   //  The second trigger bit (triggerBit2) is used for correlation histograms between the different trigger inputs
   //
+  VarContext& ctx = *GetContext();
   if(triggerBit>=64) return;
-  if(!fgEvent) return;
+  if(!ctx.fEvent) return;
   values[kOnlineTrigger] = triggerBit;
-  values[kOnlineTriggerFired] = (((AliReducedEventInfo*)fgEvent)->TriggerMask()&(ULong_t(1)<<triggerBit) ? triggerBit : -1.0);
+  values[kOnlineTriggerFired] = (((AliReducedEventInfo*)ctx.fEvent)->TriggerMask()&(ULong_t(1)<<triggerBit) ? triggerBit : -1.0);
   values[kOnlineTriggerFired2] = 0.0;
   if(triggerBit<64)
-     values[kOnlineTriggerFired2] = (((AliReducedEventInfo*)fgEvent)->TriggerMask()&(ULong_t(1)<<triggerBit2) ? triggerBit2 : -1.0);
+     values[kOnlineTriggerFired2] = (((AliReducedEventInfo*)ctx.fEvent)->TriggerMask()&(ULong_t(1)<<triggerBit2) ? triggerBit2 : -1.0);
 }
 
 //_________________________________________________________________
@@ -1118,30 +1240,31 @@ void AliReducedVarManager::FillMCTruthInfo(TRACK* p, Float_t* values, TRACK* leg
    //
    //  Fill pure MC truth information
    //
-   if(fgUsedVars[kPtMC]) values[kPtMC] = p->PtMC();
-   if(fgUsedVars[kPMC]) values[kPMC] = p->PMC();
+  VarContext& ctx = *GetContext();
+   if(ctx.fUsedVars[kPtMC]) values[kPtMC] = p->PtMC();
+   if(ctx.fUsedVars[kPMC]) values[kPMC] = p->PMC();
    values[kPxMC] = p->MCmom(0);
    values[kPyMC] = p->MCmom(1);
    values[kPzMC] = p->MCmom(2);
-   if(fgUsedVars[kThetaMC]) values[kThetaMC] = p->ThetaMC();
-   if(fgUsedVars[kEtaMC]) values[kEtaMC] = p->EtaMC();
-   if(fgUsedVars[kPhiMC]) values[kPhiMC] = p->PhiMC();
-   if(fgUsedVars[kMassMC]) {
+   if(ctx.fUsedVars[kThetaMC]) values[kThetaMC] = p->ThetaMC();
+   if(ctx.fUsedVars[kEtaMC]) values[kEtaMC] = p->EtaMC();
+   if(ctx.fUsedVars[kPhiMC]) values[kPhiMC] = p->PhiMC();
+   if(ctx.fUsedVars[kMassMC]) {
       if(TMath::Abs(p->MCPdg(0))==443)
       values[kMassMC] = fgkPairMass[AliReducedPairInfo::kJpsiToEE];  
    }
-   if(fgUsedVars[kRapMC]) {
+   if(ctx.fUsedVars[kRapMC]) {
       if(TMath::Abs(p->MCPdg(0))==443)
          values[kRapMC] = p->RapidityMC(fgkPairMass[AliReducedPairInfo::kJpsiToEE]); 
    }
-  if(fgUsedVars[kRapMCAbs]) {
+  if(ctx.fUsedVars[kRapMCAbs]) {
     if(TMath::Abs(p->MCPdg(0))==443)
       values[kRapMCAbs] = TMath::Abs(p->RapidityMC(fgkPairMass[AliReducedPairInfo::kJpsiToEE]));
   }
 
-  if(fgUsedVars[kPseudoProperDecayTimeMC]){
-     if(fgEvent->IsA()==EVENT::Class()){
-     EVENT* eventInfo = (EVENT*)fgEvent;
+  if(ctx.fUsedVars[kPseudoProperDecayTimeMC]){
+     if(ctx.fEvent->IsA()==EVENT::Class()){
+     EVENT* eventInfo = (EVENT*)ctx.fEvent;
      Double_t lxyMC = ( (p->MCFreezeout(0) - eventInfo->VertexMC(0)) * p->MCmom(0) + (p->MCFreezeout(1) - eventInfo->VertexMC(1)) * p->MCmom(1) ) / p->PtMC();
      values[kPseudoProperDecayTimeMC] = lxyMC * (fgkPairMass[AliReducedPairInfo::kJpsiToEE])/p->PtMC();
      }
@@ -1149,11 +1272,11 @@ void AliReducedVarManager::FillMCTruthInfo(TRACK* p, Float_t* values, TRACK* leg
    // compute MC truth variables from decay legs, e.g. from the 2 electrons of a J/psi decay
    // NOTE: this may be different from the kinematics of the mother, if not all decay legs are considered / tracked
    Bool_t requestMCfromLegs = kFALSE;
-   if(fgUsedVars[kPtMCfromLegs] || fgUsedVars[kPMCfromLegs] || 
-      fgUsedVars[kPxMCfromLegs] || fgUsedVars[kPyMCfromLegs] || fgUsedVars[kPzMCfromLegs] ||
-      fgUsedVars[kThetaMCfromLegs] || fgUsedVars[kEtaMCfromLegs] || fgUsedVars[kPhiMCfromLegs] ||
-      fgUsedVars[kMassMCfromLegs] || fgUsedVars[kRapMCfromLegs] ||
-      fgUsedVars[kPairLegPtMC] || fgUsedVars[kPairLegPtMC+1] || fgUsedVars[kPairLegPtMCSum]) 
+   if(ctx.fUsedVars[kPtMCfromLegs] || ctx.fUsedVars[kPMCfromLegs] || 
+      ctx.fUsedVars[kPxMCfromLegs] || ctx.fUsedVars[kPyMCfromLegs] || ctx.fUsedVars[kPzMCfromLegs] ||
+      ctx.fUsedVars[kThetaMCfromLegs] || ctx.fUsedVars[kEtaMCfromLegs] || ctx.fUsedVars[kPhiMCfromLegs] ||
+      ctx.fUsedVars[kMassMCfromLegs] || ctx.fUsedVars[kRapMCfromLegs] ||
+      ctx.fUsedVars[kPairLegPtMC] || ctx.fUsedVars[kPairLegPtMC+1] || ctx.fUsedVars[kPairLegPtMCSum]) 
       requestMCfromLegs = kTRUE;
    
    if(leg1 && leg2 && requestMCfromLegs) {
@@ -1201,7 +1324,7 @@ void AliReducedVarManager::FillMCTruthInfo(TRACK* p, Float_t* values, TRACK* leg
    
    // polarization variables
    Bool_t usePolarization=kFALSE;
-   if(leg1 && leg2 && (fgUsedVars[kPairThetaCS] || fgUsedVars[kPairThetaHE] || fgUsedVars[kPairPhiCS] || fgUsedVars[kPairPhiHE]))
+   if(leg1 && leg2 && (ctx.fUsedVars[kPairThetaCS] || ctx.fUsedVars[kPairThetaHE] || ctx.fUsedVars[kPairPhiCS] || ctx.fUsedVars[kPairPhiHE]))
       usePolarization = kTRUE;
    if(usePolarization)
       GetThetaPhiCM(leg1, leg2, values[kPairThetaHE], values[kPairPhiHE], values[kPairThetaCS], values[kPairPhiCS]);
@@ -1212,27 +1335,28 @@ void AliReducedVarManager::FillTrackInfo(BASETRACK* p, Float_t* values) {
   //
   // fill track information
   //
+  VarContext& ctx = *GetContext();
   
   // Fill base track information
-  if(fgUsedVars[kPt])        values[kPt]        = p->Pt();
-  if(fgUsedVars[kPtSquared]) values[kPtSquared] = values[kPt]*values[kPt];
-  if(fgUsedVars[kOneOverSqrtPt]) {
+  if(ctx.fUsedVars[kPt])        values[kPt]        = p->Pt();
+  if(ctx.fUsedVars[kPtSquared]) values[kPtSquared] = values[kPt]*values[kPt];
+  if(ctx.fUsedVars[kOneOverSqrtPt]) {
     values[kOneOverSqrtPt] = values[kPt] > 0. ? 1./TMath::Sqrt(values[kPt]) : 999.;
   }
-  if(fgUsedVars[kP])         values[kP]         = p->P();
-  if(fgUsedVars[kPx])        values[kPx]        = p->Px();
-  if(fgUsedVars[kPy])        values[kPy]        = p->Py();
-  if(fgUsedVars[kPz])        values[kPz]        = p->Pz();
-  if(fgUsedVars[kTheta])     values[kTheta]     = p->Theta();
-  if(fgUsedVars[kPhi])       values[kPhi]       = p->Phi();
-  if(fgUsedVars[kEta])       values[kEta]       = p->Eta();
+  if(ctx.fUsedVars[kP])         values[kP]         = p->P();
+  if(ctx.fUsedVars[kPx])        values[kPx]        = p->Px();
+  if(ctx.fUsedVars[kPy])        values[kPy]        = p->Py();
+  if(ctx.fUsedVars[kPz])        values[kPz]        = p->Pz();
+  if(ctx.fUsedVars[kTheta])     values[kTheta]     = p->Theta();
+  if(ctx.fUsedVars[kPhi])       values[kPhi]       = p->Phi();
+  if(ctx.fUsedVars[kEta])       values[kEta]       = p->Eta();
   for(Int_t ih=1; ih<=6; ++ih) {
-     if(fgUsedVars[kCosNPhi+ih-1]) values[kCosNPhi+ih-1] = TMath::Cos(p->Phi()*ih);
-     if(fgUsedVars[kSinNPhi+ih-1]) values[kSinNPhi+ih-1] = TMath::Sin(p->Phi()*ih);
+     if(ctx.fUsedVars[kCosNPhi+ih-1]) values[kCosNPhi+ih-1] = TMath::Cos(p->Phi()*ih);
+     if(ctx.fUsedVars[kSinNPhi+ih-1]) values[kSinNPhi+ih-1] = TMath::Sin(p->Phi()*ih);
   }
 
   //pair efficiency variables
-  if((fgUsedVars[kPairEff] || fgUsedVars[kOneOverPairEff] || fgUsedVars[kOneOverPairEffSq]) && fgPairEffMap) {
+  if((ctx.fUsedVars[kPairEff] || ctx.fUsedVars[kOneOverPairEff] || ctx.fUsedVars[kOneOverPairEffSq]) && fgPairEffMap) {
     Int_t binX = fgPairEffMap->GetXaxis()->FindBin(values[fgEffMapVarDependencyX]);
     if(binX==0) binX = 1;
     if(binX==fgPairEffMap->GetXaxis()->GetNbins()+1) binX -= 1;
@@ -1250,17 +1374,17 @@ void AliReducedVarManager::FillTrackInfo(BASETRACK* p, Float_t* values) {
   // Fill VZERO flow variables
   for(Int_t iVZEROside=0; iVZEROside<3; ++iVZEROside) {
      for(Int_t ih=0; ih<6; ++ih) {
-        if(fgUsedVars[kVZEROFlowVn+iVZEROside*6+ih])
+        if(ctx.fUsedVars[kVZEROFlowVn+iVZEROside*6+ih])
            values[kVZEROFlowVn+iVZEROside*6+ih] = TMath::Cos((values[kPhi]-values[kVZERORP+iVZEROside*6+ih])*(ih+1));
-        if(fgUsedVars[kVZEROFlowSine+iVZEROside*6+ih])
+        if(ctx.fUsedVars[kVZEROFlowSine+iVZEROside*6+ih])
            values[kVZEROFlowSine+iVZEROside*6+ih] = TMath::Sin((values[kPhi]-values[kVZERORP+iVZEROside*6+ih])*(ih+1));
         if(iVZEROside<2) {
-           if(fgUsedVars[kVZEROuQ+iVZEROside*6+ih]) {
+           if(ctx.fUsedVars[kVZEROuQ+iVZEROside*6+ih]) {
               values[kVZEROuQ+iVZEROside*6+ih] = TMath::Cos((values[kPhi]-values[kVZERORP+iVZEROside*6+ih])*(ih+1));
               values[kVZEROuQ+iVZEROside*6+ih] *= TMath::Sqrt(values[kVZEROQvecX+iVZEROside*6+ih]*values[kVZEROQvecX+iVZEROside*6+ih] +
               values[kVZEROQvecY+iVZEROside*6+ih]*values[kVZEROQvecY+iVZEROside*6+ih]); 
            }
-           if(fgUsedVars[kVZEROuQsine+iVZEROside*6+ih]) {
+           if(ctx.fUsedVars[kVZEROuQsine+iVZEROside*6+ih]) {
               values[kVZEROuQsine+iVZEROside*6+ih] = TMath::Sin((values[kPhi]-values[kVZERORP+iVZEROside*6+ih])*(ih+1));
               values[kVZEROuQsine+iVZEROside*6+ih] *= TMath::Sqrt(values[kVZEROQvecX+iVZEROside*6+ih]*values[kVZEROQvecX+iVZEROside*6+ih] +
               values[kVZEROQvecY+iVZEROside*6+ih]*values[kVZEROQvecY+iVZEROside*6+ih]); 
@@ -1273,10 +1397,10 @@ void AliReducedVarManager::FillTrackInfo(BASETRACK* p, Float_t* values) {
   // Subtract the q vector of the track or of the pair legs from the event q-vector 
   Bool_t tpcEPUsed = kFALSE;
   for(Int_t ih=0; ih<6; ++ih) {
-     if(fgUsedVars[kTPCFlowVn+ih]) {tpcEPUsed = kTRUE; break;}
-     if(fgUsedVars[kTPCFlowSine+ih]) {tpcEPUsed = kTRUE; break;}
-     if(fgUsedVars[kTPCuQ+ih]) {tpcEPUsed = kTRUE; break;}
-     if(fgUsedVars[kTPCuQsine+ih]) {tpcEPUsed = kTRUE; break;}
+     if(ctx.fUsedVars[kTPCFlowVn+ih]) {tpcEPUsed = kTRUE; break;}
+     if(ctx.fUsedVars[kTPCFlowSine+ih]) {tpcEPUsed = kTRUE; break;}
+     if(ctx.fUsedVars[kTPCuQ+ih]) {tpcEPUsed = kTRUE; break;}
+     if(ctx.fUsedVars[kTPCuQsine+ih]) {tpcEPUsed = kTRUE; break;}
   }
 
   if(tpcEPUsed) {
@@ -1284,7 +1408,7 @@ void AliReducedVarManager::FillTrackInfo(BASETRACK* p, Float_t* values) {
      Double_t qVec[6][2] = {{0.0}};
      for(Int_t ih=0; ih<6; ++ih) {qVec[ih][0]=values[kTPCQvecXtotal+ih]; qVec[ih][1]=values[kTPCQvecYtotal+ih];}
      EVENT* eventInfo = NULL;
-     if(fgEvent->IsA()==EVENT::Class()) eventInfo = (EVENT*)fgEvent;
+     if(ctx.fEvent->IsA()==EVENT::Class()) eventInfo = (EVENT*)ctx.fEvent;
      if((p->IsA() == AliReducedTrackInfo::Class()) && eventInfo) {
         eventInfo->SubtractParticleFromQvector((AliReducedTrackInfo*)p,qVec,EVENTPLANE::kTPC,-0.8,-0.5*fgkTPCQvecRapGap);
         eventInfo->SubtractParticleFromQvector((AliReducedTrackInfo*)p,qVec,EVENTPLANE::kTPC,0.5*fgkTPCQvecRapGap,0.8);
@@ -1304,15 +1428,15 @@ void AliReducedVarManager::FillTrackInfo(BASETRACK* p, Float_t* values) {
         tpcEPsubtracted[ih] = TMath::ATan2(qVec[ih][1], qVec[ih][0])/Double_t(ih+1);
      for(Int_t ih=0; ih<6; ++ih) {
         // vn using Psi_n
-        if(fgUsedVars[kTPCFlowVn+ih])
+        if(ctx.fUsedVars[kTPCFlowVn+ih])
            values[kTPCFlowVn+ih] = TMath::Cos(DeltaPhi(values[kPhi],tpcEPsubtracted[ih])*(ih+1));
-        if(fgUsedVars[kTPCFlowSine+ih]) 
+        if(ctx.fUsedVars[kTPCFlowSine+ih]) 
            values[kTPCFlowSine+ih] = TMath::Sin(DeltaPhi(values[kPhi],tpcEPsubtracted[ih])*(ih+1));
-        if(fgUsedVars[kTPCuQ+ih]) {
+        if(ctx.fUsedVars[kTPCuQ+ih]) {
            values[kTPCuQ+ih] = TMath::Cos((values[kPhi]-tpcEPsubtracted[ih])*(ih+1));
            values[kTPCuQ+ih] *= TMath::Sqrt(qVec[ih][0]*qVec[ih][0] + qVec[ih][1]*qVec[ih][1]);
         }
-        if(fgUsedVars[kTPCuQsine+ih]) {
+        if(ctx.fUsedVars[kTPCuQsine+ih]) {
            values[kTPCuQsine+ih] = TMath::Sin((values[kPhi]-tpcEPsubtracted[ih])*(ih+1));
            values[kTPCuQsine+ih] *= TMath::Sqrt(qVec[ih][0]*qVec[ih][0] + qVec[ih][1]*qVec[ih][1]);
         }
@@ -1335,34 +1459,34 @@ void AliReducedVarManager::FillTrackInfo(BASETRACK* p, Float_t* values) {
   values[kDcaZTPC]     = pinfo->DCAzTPC();
   values[kCharge]      = pinfo->Charge();
 
-  if(fgUsedVars[kITSncls]) values[kITSncls] = pinfo->ITSncls();
+  if(ctx.fUsedVars[kITSncls]) values[kITSncls] = pinfo->ITSncls();
   values[kITSsignal] = pinfo->ITSsignal();
   values[kITSchi2] = pinfo->ITSchi2();
 
-  if(fgUsedVars[kITSnclsShared]) values[kITSnclsShared] = pinfo->ITSnSharedCls();
+  if(ctx.fUsedVars[kITSnclsShared]) values[kITSnclsShared] = pinfo->ITSnSharedCls();
   values[kTPCncls] = pinfo->TPCncls();
 
-  if(fgUsedVars[kNclsSFracITS])
+  if(ctx.fUsedVars[kNclsSFracITS])
   values[kNclsSFracITS] = (pinfo-> ITSncls()>0 ? Float_t (pinfo->ITSnSharedCls())/Float_t(pinfo->ITSncls()) :0.0) ;
-  if(fgUsedVars[kTPCnclsRatio]) 
+  if(ctx.fUsedVars[kTPCnclsRatio]) 
     values[kTPCnclsRatio] = (pinfo->TPCFindableNcls()>0 ? Float_t(pinfo->TPCncls())/Float_t(pinfo->TPCFindableNcls()) : 0.0);
-  if(fgUsedVars[kTPCnclsRatio2]) 
+  if(ctx.fUsedVars[kTPCnclsRatio2]) 
     values[kTPCnclsRatio2] = (pinfo->TPCCrossedRows()>0 ? Float_t(pinfo->TPCncls())/Float_t(pinfo->TPCCrossedRows()) : 0.0);
 
-  if(fgUsedVars[kTPCcrossedRowsOverFindableClusters]) { 
+  if(ctx.fUsedVars[kTPCcrossedRowsOverFindableClusters]) { 
      if(pinfo->TPCFindableNcls()>0)
        values[kTPCcrossedRowsOverFindableClusters] = Float_t(pinfo->TPCCrossedRows()) / Float_t(pinfo->TPCFindableNcls());
      else 
         values[kTPCcrossedRowsOverFindableClusters] = 0.0;
   }
-  if(fgUsedVars[kTPCnclsSharedRatio]) {
+  if(ctx.fUsedVars[kTPCnclsSharedRatio]) {
      if(pinfo->TPCncls()>0) 
         values[kTPCnclsSharedRatio] = Float_t(pinfo->TPCnclsShared()) / Float_t(pinfo->TPCncls());
      else
         values[kTPCnclsSharedRatio] = 0.0;
   }
 
-  if(fgUsedVars[kTPCnclsRatio3])
+  if(ctx.fUsedVars[kTPCnclsRatio3])
     values[kTPCnclsRatio3] = (pinfo->TPCFindableNcls()>0 ? Float_t(pinfo->TPCCrossedRows())/Float_t(pinfo->TPCFindableNcls()) : 0.0);
 
   values[kTPCnclsF]       = pinfo->TPCFindableNcls();
@@ -1371,8 +1495,8 @@ void AliReducedVarManager::FillTrackInfo(BASETRACK* p, Float_t* values) {
   values[kTPCsignal]      = pinfo->TPCsignal();
   values[kTPCsignalN]     = pinfo->TPCsignalN();
   values[kTPCchi2] = pinfo->TPCchi2();
-  if(fgUsedVars[kTPCNclusBitsFired]) values[kTPCNclusBitsFired] = pinfo->TPCClusterMapBitsFired();
-  if(fgUsedVars[kTPCclustersPerBit]) {
+  if(ctx.fUsedVars[kTPCNclusBitsFired]) values[kTPCNclusBitsFired] = pinfo->TPCClusterMapBitsFired();
+  if(ctx.fUsedVars[kTPCclustersPerBit]) {
     Int_t nbits = pinfo->TPCClusterMapBitsFired();
     values[kTPCclustersPerBit] = (nbits>0 ? values[kTPCncls]/Float_t(nbits) : 0.0);
   }
@@ -1391,7 +1515,7 @@ void AliReducedVarManager::FillTrackInfo(BASETRACK* p, Float_t* values) {
     values[kTOFnSig+specie] = pinfo->TOFnSig(specie);
     values[kBayes+specie]   = pinfo->GetBayesProb(specie);
   }
-  if(fgUsedVars[kTPCnSigCorrected+kElectron] && fgTPCelectronCentroidMap && fgTPCelectronWidthMap) {
+  if(ctx.fUsedVars[kTPCnSigCorrected+kElectron] && fgTPCelectronCentroidMap && fgTPCelectronWidthMap) {
      Int_t binX = fgTPCelectronCentroidMap->GetXaxis()->FindBin(values[fgVarDependencyX]);
      if(binX==0) binX = 1;
      if(binX==fgTPCelectronCentroidMap->GetXaxis()->GetNbins()+1) binX -= 1;
@@ -1423,10 +1547,10 @@ void AliReducedVarManager::FillTrackInfo(BASETRACK* p, Float_t* values) {
   values[kTRDGTUPID]         = pinfo->TRDGTUPID();
 
 
-  if(fgUsedVars[kEMCALmatchedEnergy] || fgUsedVars[kEMCALmatchedEOverP]) {
+  if(ctx.fUsedVars[kEMCALmatchedEnergy] || ctx.fUsedVars[kEMCALmatchedEOverP]) {
     values[kEMCALmatchedClusterId] = pinfo->CaloClusterId();
-    if(fgEvent && (fgEvent->IsA()==EVENT::Class())){
-      CLUSTER* cluster = ((EVENT*)fgEvent)->GetCaloCluster(pinfo->CaloClusterId());
+    if(ctx.fEvent && (ctx.fEvent->IsA()==EVENT::Class())){
+      CLUSTER* cluster = ((EVENT*)ctx.fEvent)->GetCaloCluster(pinfo->CaloClusterId());
       values[kEMCALmatchedEnergy] = (cluster ? cluster->Energy() : -999.0);
       Float_t mom = pinfo->P();
       values[kEMCALmatchedEOverP] = (TMath::Abs(mom)>1.e-8 && cluster ? values[kEMCALmatchedEnergy]/mom : -999.0);
@@ -1436,25 +1560,25 @@ void AliReducedVarManager::FillTrackInfo(BASETRACK* p, Float_t* values) {
   FillTrackingStatus(pinfo,values);
   //FillTrackingFlags(pinfo,values);
 
-  if(fgUsedVars[kPtMC]) values[kPtMC] = pinfo->PtMC();
-  if(fgUsedVars[kPMC]) values[kPMC] = pinfo->PMC();
+  if(ctx.fUsedVars[kPtMC]) values[kPtMC] = pinfo->PtMC();
+  if(ctx.fUsedVars[kPMC]) values[kPMC] = pinfo->PMC();
   values[kPxMC] = pinfo->MCmom(0);
   values[kPyMC] = pinfo->MCmom(1);
   values[kPzMC] = pinfo->MCmom(2);
-  if(fgUsedVars[kThetaMC]) values[kThetaMC] = pinfo->ThetaMC();
-  if(fgUsedVars[kEtaMC]) values[kEtaMC] = pinfo->EtaMC();
-  if(fgUsedVars[kPhiMC]) values[kPhiMC] = pinfo->PhiMC();
+  if(ctx.fUsedVars[kThetaMC]) values[kThetaMC] = pinfo->ThetaMC();
+  if(ctx.fUsedVars[kEtaMC]) values[kEtaMC] = pinfo->EtaMC();
+  if(ctx.fUsedVars[kPhiMC]) values[kPhiMC] = pinfo->PhiMC();
   //TODO: add also the massMC and RapMC   
   values[kPdgMC] = pinfo->MCPdg(0);
   values[kPdgMC+1] = pinfo->MCPdg(1);
   values[kPdgMC+2] = pinfo->MCPdg(2);
   values[kPdgMC+3] = pinfo->MCPdg(3);
   
-  if(fgUsedVars[kRap] && pinfo->IsMCKineParticle())  {
+  if(ctx.fUsedVars[kRap] && pinfo->IsMCKineParticle())  {
      if(pinfo->MCPdg(0)==443) values[kRap] = p->Rapidity(fgkPairMass[AliReducedPairInfo::kJpsiToEE]);
      if(TMath::Abs(pinfo->MCPdg(0))==11) values[kRap] = p->Rapidity(fgkParticleMass[AliReducedVarManager::kElectron]);
   }
-  if(fgUsedVars[kRapAbs] && pinfo->IsMCKineParticle())  {
+  if(ctx.fUsedVars[kRapAbs] && pinfo->IsMCKineParticle())  {
     if(pinfo->MCPdg(0)==443) values[kRapAbs] = TMath::Abs(p->Rapidity(fgkPairMass[AliReducedPairInfo::kJpsiToEE]));
     if(TMath::Abs(pinfo->MCPdg(0))==11) values[kRapAbs] = TMath::Abs(p->Rapidity(fgkParticleMass[AliReducedVarManager::kElectron]));
   }
@@ -1542,13 +1666,14 @@ void AliReducedVarManager::FillPairInfo(PAIR* p, Float_t* values) {
   //
   // fill pair information
   //
+  VarContext& ctx = *GetContext();
   FillTrackInfo(p, values);
   
   values[kCandidateId]   = p->CandidateId();
   values[kPairType]      = p->PairType();
   values[kPairTypeSPD]      = p->PairTypeSPD();
   values[kPairChisquare] = p->Chi2();
-  if(fgUsedVars[kMass]) {
+  if(ctx.fUsedVars[kMass]) {
     values[kMass] = p->Mass();
     if(p->CandidateId()==PAIR::kLambda0ToPPi)  values[kMass] = p->Mass(1);
     if(p->CandidateId()==PAIR::kALambda0ToPPi) values[kMass] = p->Mass(2);
@@ -1563,18 +1688,18 @@ void AliReducedVarManager::FillPairInfo(PAIR* p, Float_t* values) {
   values[kMassV0+2] = p->Mass(2);
   values[kMassV0+3] = p->Mass(3);
   
-  if(fgUsedVars[kRap])    values[kRap]              = p->Rapidity();
-  if(fgUsedVars[kRapAbs]) values[kRapAbs]           = TMath::Abs(p->Rapidity());
+  if(ctx.fUsedVars[kRap])    values[kRap]              = p->Rapidity();
+  if(ctx.fUsedVars[kRapAbs]) values[kRapAbs]           = TMath::Abs(p->Rapidity());
                           values[kPairLxy]          = p->Lxy();
                           values[kPairPointingAngle]= p->PointingAngle();
 
   // polarization variables
   Bool_t usePolarization=kFALSE;
-  if(fgUsedVars[kPairThetaCS] || fgUsedVars[kPairThetaHE] || fgUsedVars[kPairPhiCS] || fgUsedVars[kPairPhiHE])
+  if(ctx.fUsedVars[kPairThetaCS] || ctx.fUsedVars[kPairThetaHE] || ctx.fUsedVars[kPairPhiCS] || ctx.fUsedVars[kPairPhiHE])
     usePolarization = kTRUE;
   if(usePolarization)
-    GetThetaPhiCM(fgEvent->GetTrack(((AliReducedPairInfo*)p)->LegId(0)), 
-		  fgEvent->GetTrack(((AliReducedPairInfo*)p)->LegId(1)), 
+    GetThetaPhiCM(ctx.fEvent->GetTrack(((AliReducedPairInfo*)p)->LegId(0)), 
+		  ctx.fEvent->GetTrack(((AliReducedPairInfo*)p)->LegId(1)), 
 		  values[kPairThetaHE], values[kPairPhiHE], values[kPairThetaCS], values[kPairPhiCS], m1, m2);
 }
 
@@ -1587,6 +1712,7 @@ void AliReducedVarManager::FillPairInfo(BASETRACK* t1, BASETRACK* t2, Int_t type
   // type - Parameter encoding the resonance type 
   //        This is needed for making a mass assumption on the legs
   //
+  VarContext& ctx = *GetContext();
   PAIR p;
   p.PxPyPz(t1->Px()+t2->Px(), t1->Py()+t2->Py(), t1->Pz()+t2->Pz());
   p.CandidateId(type);
@@ -1607,7 +1733,7 @@ void AliReducedVarManager::FillPairInfo(BASETRACK* t1, BASETRACK* t2, Int_t type
   Float_t m1 = 0.0; Float_t m2 = 0.0;
   GetLegMassAssumption(type,m1,m2); 
     
-  if(fgUsedVars[kMass]) {     
+  if(ctx.fUsedVars[kMass]) {     
     values[kMass] = m1*m1+m2*m2 + 
                     2.0*(TMath::Sqrt(m1*m1+t1->P()*t1->P())*TMath::Sqrt(m2*m2+t2->P()*t2->P()) - 
                          t1->Px()*t2->Px() - t1->Py()*t2->Py() - t1->Pz()*t2->Pz());
@@ -1624,8 +1750,8 @@ void AliReducedVarManager::FillPairInfo(BASETRACK* t1, BASETRACK* t2, Int_t type
     p.SetMass(values[kMass]);
   }
 
-  if(fgUsedVars[kRap])    values[kRap]    = p.Rapidity();
-  if(fgUsedVars[kRapAbs]) values[kRapAbs] = TMath::Abs(p.Rapidity());
+  if(ctx.fUsedVars[kRap])    values[kRap]    = p.Rapidity();
+  if(ctx.fUsedVars[kRapAbs]) values[kRapAbs] = TMath::Abs(p.Rapidity());
   values[kPairLegPt+0] = t1->Pt();
   values[kPairLegPt+1] = t2->Pt();
   values[kPairLegPtSum] = t1->Pt()+t2->Pt();
@@ -1639,39 +1765,39 @@ void AliReducedVarManager::FillPairInfo(BASETRACK* t1, BASETRACK* t2, Int_t type
   
   // polarization variables
   Bool_t usePolarization=kFALSE;
-  if(fgUsedVars[kPairThetaCS] || fgUsedVars[kPairThetaHE] || fgUsedVars[kPairPhiCS] || fgUsedVars[kPairPhiHE])
+  if(ctx.fUsedVars[kPairThetaCS] || ctx.fUsedVars[kPairThetaHE] || ctx.fUsedVars[kPairPhiCS] || ctx.fUsedVars[kPairPhiHE])
     usePolarization = kTRUE;
   if(usePolarization)
     GetThetaPhiCM(t1, t2, values[kPairThetaHE], values[kPairPhiHE], values[kPairThetaCS], values[kPairPhiCS]);
   
-  if(fgUsedVars[kDMA] && (t1->IsA()==TRACK::Class()) && (t2->IsA()==TRACK::Class())) {
+  if(ctx.fUsedVars[kDMA] && (t1->IsA()==TRACK::Class()) && (t2->IsA()==TRACK::Class())) {
      TRACK* ti1=(TRACK*)t1; TRACK* ti2=(TRACK*)t2;
      values[kDMA]=TMath::Sqrt((ti1->HelixX()-ti2->HelixX())*(ti1->HelixX()-ti2->HelixX())+(ti1->HelixY()-ti2->HelixY())*(ti1->HelixY()-ti2->HelixY()))-ti1->HelixR()-ti2->HelixR();   
   }
   
-  if((fgUsedVars[kPairLegTPCchi2] || fgUsedVars[kPairLegTPCchi2+1]) && (t1->IsA()==TRACK::Class()) && (t2->IsA()==TRACK::Class())) {
+  if((ctx.fUsedVars[kPairLegTPCchi2] || ctx.fUsedVars[kPairLegTPCchi2+1]) && (t1->IsA()==TRACK::Class()) && (t2->IsA()==TRACK::Class())) {
      TRACK* ti1=(TRACK*)t1; TRACK* ti2=(TRACK*)t2;
      values[kPairLegTPCchi2] = ti1->TPCchi2();
      values[kPairLegTPCchi2+1] = ti2->TPCchi2();
   }
-  if((fgUsedVars[kPairLegITSchi2] || fgUsedVars[kPairLegITSchi2+1]) && (t1->IsA()==TRACK::Class()) && (t2->IsA()==TRACK::Class())) {
+  if((ctx.fUsedVars[kPairLegITSchi2] || ctx.fUsedVars[kPairLegITSchi2+1]) && (t1->IsA()==TRACK::Class()) && (t2->IsA()==TRACK::Class())) {
      TRACK* ti1=(TRACK*)t1; TRACK* ti2=(TRACK*)t2;
     values[kPairLegITSchi2] = ti1->ITSchi2();
     values[kPairLegITSchi2+1] = ti2->ITSchi2();
   }
   
-  if((fgUsedVars[kPseudoProperDecayTime] || fgUsedVars[kPairLxy]) &&  
+  if((ctx.fUsedVars[kPseudoProperDecayTime] || ctx.fUsedVars[kPairLxy]) &&  
      (t1->IsA()==TRACK::Class()) && (t2->IsA()==TRACK::Class()) && 
-     (fgEvent->IsA()==EVENT::Class())) {
+     (ctx.fEvent->IsA()==EVENT::Class())) {
      TRACK* ti1=(TRACK*)t1; 
      TRACK* ti2=(TRACK*)t2;
      AliKFParticle pairKF = BuildKFcandidate(ti1,m1,ti2,m2);
      Double_t errPseudoProperTime2;
-     EVENT* eventInfo = (EVENT*)fgEvent;
+     EVENT* eventInfo = (EVENT*)ctx.fEvent;
      AliKFParticle primVtx = BuildKFvertex(eventInfo);
-     if(fgUsedVars[kPseudoProperDecayTime]) 
+     if(ctx.fUsedVars[kPseudoProperDecayTime]) 
         values[kPseudoProperDecayTime] = pairKF.GetPseudoProperDecayTime(primVtx, fgkPairMass[type], &errPseudoProperTime2);
-     if(fgUsedVars[kPairLxy]) values[kPairLxy] =  ( (pairKF.X() - primVtx.X())*p.Px() + (pairKF.Y() - primVtx.Y())*p.Py() )/p.Pt(); // = values[kPseudoProperDecayTime]*(p.Pt()/PAIR::fgkPairMass[type]);
+     if(ctx.fUsedVars[kPairLxy]) values[kPairLxy] =  ( (pairKF.X() - primVtx.X())*p.Px() + (pairKF.Y() - primVtx.Y())*p.Py() )/p.Pt(); // = values[kPseudoProperDecayTime]*(p.Pt()/PAIR::fgkPairMass[type]);
   }
   
   // fill MC information
@@ -1687,15 +1813,15 @@ void AliReducedVarManager::FillPairInfo(BASETRACK* t1, BASETRACK* t2, Int_t type
      else
         pMC.PxPyPz(t1->Px()+t2->Px(), t1->Py()+t2->Py(), t1->Pz()+t2->Pz());
      pMC.CandidateId(type);
-     if(fgUsedVars[kPtMC]) values[kPtMC] = pMC.Pt();
-     if(fgUsedVars[kPMC]) values[kPMC] = pMC.P();
+     if(ctx.fUsedVars[kPtMC]) values[kPtMC] = pMC.Pt();
+     if(ctx.fUsedVars[kPMC]) values[kPMC] = pMC.P();
      values[kPxMC] = pMC.Px();
      values[kPyMC] = pMC.Py();
      values[kPzMC] = pMC.Pz();
-     if(fgUsedVars[kThetaMC]) values[kThetaMC] = pMC.Theta();
-     if(fgUsedVars[kEtaMC]) values[kEtaMC] = pMC.Eta();
-     if(fgUsedVars[kPhiMC]) values[kPhiMC] = pMC.Phi();
-     if(fgUsedVars[kMassMC]) {
+     if(ctx.fUsedVars[kThetaMC]) values[kThetaMC] = pMC.Theta();
+     if(ctx.fUsedVars[kEtaMC]) values[kEtaMC] = pMC.Eta();
+     if(ctx.fUsedVars[kPhiMC]) values[kPhiMC] = pMC.Phi();
+     if(ctx.fUsedVars[kMassMC]) {
         if(pinfo1 && pinfo2 && !pinfo1->IsMCTruth() && !pinfo2->IsMCTruth())
            values[kMassMC] = m1*m1+m2*m2 + 
               2.0*(TMath::Sqrt(m1*m1+pinfo1->PMC()*pinfo1->PMC())*TMath::Sqrt(m2*m2+pinfo2->PMC()*pinfo2->PMC()) - 
@@ -1715,14 +1841,14 @@ void AliReducedVarManager::FillPairInfo(BASETRACK* t1, BASETRACK* t2, Int_t type
      }
      
      // TODO: think about whether to use the PDG mass or the calculated mass from the legs for rapidity
-     if(fgUsedVars[kRapMC]) {
+     if(ctx.fUsedVars[kRapMC]) {
        pMC.SetMass(values[kMassMC]);
        values[kRapMC] = pMC.Rapidity();   
      }
-     if(fgUsedVars[kRapMCAbs]) values[kRapMCAbs] = TMath::Abs(pMC.Rapidity());
+     if(ctx.fUsedVars[kRapMCAbs]) values[kRapMCAbs] = TMath::Abs(pMC.Rapidity());
   }
 
-   if( fgUsedVars[kPairPhiV] ){
+   if( ctx.fUsedVars[kPairPhiV] ){
     // implementation taken from AliDielectronPair.cxx
     Double_t px1=-9999.,py1=-9999.,pz1=-9999.;
     Double_t px2=-9999.,py2=-9999.,pz2=-9999.;
@@ -1833,7 +1959,7 @@ void AliReducedVarManager::FillPairInfo(BASETRACK* t1, BASETRACK* t2, Int_t type
     values[kPairPhiV] = phiv;
   }
 
-  if( fgUsedVars[kPairOpeningAngle] ){
+  if( ctx.fUsedVars[kPairOpeningAngle] ){
     TVector3 v1(t1->Px(), t1->Py(), t1->Pz());
     TVector3 v2(t2->Px(), t2->Py(), t2->Pz());
     values[kPairOpeningAngle] = v1.Angle(v2);
@@ -1843,22 +1969,22 @@ void AliReducedVarManager::FillPairInfo(BASETRACK* t1, BASETRACK* t2, Int_t type
     TRACK* ti1=(TRACK*)t1;
     TRACK* ti2=(TRACK*)t2;
 
-    if( fgUsedVars[kPairDca]   ) values[kPairDca]   = TMath::Sqrt(ti1->DCAxy() * ti1->DCAxy() + ti2->DCAxy() * ti2->DCAxy() + ti1->DCAz() * ti1->DCAz() + ti2->DCAz() * ti2->DCAz());
-    if( fgUsedVars[kPairDcaXY] ) values[kPairDcaXY] = TMath::Sqrt( ti1->DCAxy() * ti1->DCAxy() + ti2->DCAxy() * ti2->DCAxy() );
-    if( fgUsedVars[kPairDcaZ]  ) values[kPairDcaZ]  = TMath::Sqrt(ti1->DCAz() * ti1->DCAz() + ti2->DCAz() * ti2->DCAz() );
+    if( ctx.fUsedVars[kPairDca]   ) values[kPairDca]   = TMath::Sqrt(ti1->DCAxy() * ti1->DCAxy() + ti2->DCAxy() * ti2->DCAxy() + ti1->DCAz() * ti1->DCAz() + ti2->DCAz() * ti2->DCAz());
+    if( ctx.fUsedVars[kPairDcaXY] ) values[kPairDcaXY] = TMath::Sqrt( ti1->DCAxy() * ti1->DCAxy() + ti2->DCAxy() * ti2->DCAxy() );
+    if( ctx.fUsedVars[kPairDcaZ]  ) values[kPairDcaZ]  = TMath::Sqrt(ti1->DCAz() * ti1->DCAz() + ti2->DCAz() * ti2->DCAz() );
 
-    if( fgUsedVars[kPairDcaSqrt]   ) values[kPairDcaSqrt]   = TMath::Power(ti1->DCAxy() * ti1->DCAxy() + ti2->DCAxy() * ti2->DCAxy() + ti1->DCAz() * ti1->DCAz() + ti2->DCAz() * ti2->DCAz(), 0.25);
-    if( fgUsedVars[kPairDcaXYSqrt] ) values[kPairDcaXYSqrt] = TMath::Power( ti1->DCAxy() * ti1->DCAxy() + ti2->DCAxy() * ti2->DCAxy(), 0.25);
-    if( fgUsedVars[kPairDcaZSqrt]  ) values[kPairDcaZSqrt]  = TMath::Power(ti1->DCAz() * ti1->DCAz() + ti2->DCAz() * ti2->DCAz(), 0.25);
+    if( ctx.fUsedVars[kPairDcaSqrt]   ) values[kPairDcaSqrt]   = TMath::Power(ti1->DCAxy() * ti1->DCAxy() + ti2->DCAxy() * ti2->DCAxy() + ti1->DCAz() * ti1->DCAz() + ti2->DCAz() * ti2->DCAz(), 0.25);
+    if( ctx.fUsedVars[kPairDcaXYSqrt] ) values[kPairDcaXYSqrt] = TMath::Power( ti1->DCAxy() * ti1->DCAxy() + ti2->DCAxy() * ti2->DCAxy(), 0.25);
+    if( ctx.fUsedVars[kPairDcaZSqrt]  ) values[kPairDcaZSqrt]  = TMath::Power(ti1->DCAz() * ti1->DCAz() + ti2->DCAz() * ti2->DCAz(), 0.25);
 
-    if( fgUsedVars[kOpAngDcaPtCorr] ) {
+    if( ctx.fUsedVars[kOpAngDcaPtCorr] ) {
       Float_t a = -1.56316e-03;
       Float_t b =  1.22515e-02;
       Float_t c =  3.39455e-03;
       Float_t d =  1.00681e-01;
       values[kOpAngDcaPtCorr] = values[kPairOpeningAngle] - a - b * values[kPairDcaXYSqrt] - c * values[kOneOverSqrtPt] -  d * values[kPairDcaXYSqrt]  * values[kOneOverSqrtPt];
     }
-    if( fgUsedVars[kMassDcaPtCorr] ) {
+    if( ctx.fUsedVars[kMassDcaPtCorr] ) {
       Float_t a =  1.87774e-03;
       Float_t b =  4.53156e-02;
       Float_t c = -9.72947e-05;
@@ -1878,6 +2004,7 @@ void AliReducedVarManager::FillPairInfoME(BASETRACK* t1, BASETRACK* t2, Int_t ty
   // type - Parameter encoding the resonance type 
   //        This is needed for making a mass assumption on the legs
   //
+  VarContext& ctx = *GetContext();
   PAIR p;
   p.PxPyPz(t1->Px()+t2->Px(), t1->Py()+t2->Py(), t1->Pz()+t2->Pz());
   p.CandidateId(type);
@@ -1898,7 +2025,7 @@ void AliReducedVarManager::FillPairInfoME(BASETRACK* t1, BASETRACK* t2, Int_t ty
   Float_t m1 = 0.0; Float_t m2 = 0.0;
   GetLegMassAssumption(type,m1,m2); 
     
-  if(fgUsedVars[kMass]) {     
+  if(ctx.fUsedVars[kMass]) {     
     values[kMass] = m1*m1+m2*m2 + 
                     2.0*(TMath::Sqrt(m1*m1+t1->P()*t1->P())*TMath::Sqrt(m2*m2+t2->P()*t2->P()) - 
                     t1->Px()*t2->Px() - t1->Py()*t2->Py() - t1->Pz()*t2->Pz());
@@ -1918,21 +2045,21 @@ void AliReducedVarManager::FillPairInfoME(BASETRACK* t1, BASETRACK* t2, Int_t ty
   values[kPx] = p.Px();
   values[kPy] = p.Py();
   values[kPz] = p.Pz();
-  if(fgUsedVars[kPt] || fgUsedVars[kPtSquared]) {
+  if(ctx.fUsedVars[kPt] || ctx.fUsedVars[kPtSquared]) {
     values[kPt] = p.Pt();
-    if(fgUsedVars[kPtSquared]) values[kPtSquared] = values[kPt]*values[kPt];
+    if(ctx.fUsedVars[kPtSquared]) values[kPtSquared] = values[kPt]*values[kPt];
   }
   values[kPairLegPt] = t1->Pt();
   values[kPairLegPt+1] = t2->Pt();
   values[kPairLegPtSum] = t1->Pt() + t2->Pt();
-  if(fgUsedVars[kP])      values[kP]      = p.P();
-  if(fgUsedVars[kEta])    values[kEta]    = p.Eta();
-  if(fgUsedVars[kRap])    values[kRap]    = p.Rapidity();
-  if(fgUsedVars[kRapAbs]) values[kRapAbs] = TMath::Abs(p.Rapidity());
-  if(fgUsedVars[kPhi])    values[kPhi]    = p.Phi();
-  if(fgUsedVars[kTheta])  values[kTheta]  = p.Theta();
-  
-  if((fgUsedVars[kPairEff] || fgUsedVars[kOneOverPairEff] || fgUsedVars[kOneOverPairEffSq]) && fgPairEffMap) {
+  if(ctx.fUsedVars[kP])      values[kP]      = p.P();
+  if(ctx.fUsedVars[kEta])    values[kEta]    = p.Eta();
+  if(ctx.fUsedVars[kRap])    values[kRap]    = p.Rapidity();
+  if(ctx.fUsedVars[kRapAbs]) values[kRapAbs] = TMath::Abs(p.Rapidity());
+  if(ctx.fUsedVars[kPhi])    values[kPhi]    = p.Phi();
+  if(ctx.fUsedVars[kTheta])  values[kTheta]  = p.Theta();
+  
+  if((ctx.fUsedVars[kPairEff] || ctx.fUsedVars[kOneOverPairEff] || ctx.fUsedVars[kOneOverPairEffSq]) && fgPairEffMap) {
     Int_t binX = fgPairEffMap->GetXaxis()->FindBin(values[fgEffMapVarDependencyX]); //make sure the values[XVar] are filled for EM
     if(binX==0) binX = 1;
     if(binX==fgPairEffMap->GetXaxis()->GetNbins()+1) binX -= 1;
@@ -1958,6 +2085,7 @@ void AliReducedVarManager::FillPairInfo(PAIR* t1, BASETRACK* t2, Int_t type, Flo
   // type - Parameter encoding the resonance type 
   //        This is needed for making a mass assumption on the legs
   //
+  VarContext& ctx = *GetContext();
   PAIR p;
   p.PxPyPz(t1->Px()+t2->Px(), t1->Py()+t2->Py(), t1->Pz()+t2->Pz());
   p.CandidateId(type);
@@ -1969,7 +2097,7 @@ void AliReducedVarManager::FillPairInfo(PAIR* t1, BASETRACK* t2, Int_t type, Flo
   Float_t m1 = 0.0; Float_t m2 = 0.0;
   GetLegMassAssumption(type,m1,m2); 
   
-  if(fgUsedVars[kMass]) {     
+  if(ctx.fUsedVars[kMass]) {     
     values[kMass] = m1*m1+m2*m2 + 
                     2.0*(TMath::Sqrt(m1*m1+t1->P()*t1->P())*TMath::Sqrt(m2*m2+t2->P()*t2->P()) - 
                     t1->Px()*t2->Px() - t1->Py()*t2->Py() - t1->Pz()*t2->Pz());
@@ -2000,28 +2128,29 @@ void AliReducedVarManager::FillCorrelationInfo(BASETRACK* trig, BASETRACK* assoc
   // fill pair-track correlation information
   // NOTE:  Add here only NEEDED information because this function is called during event mixing in the innermost loop
   //
-  if(fgUsedVars[kTriggerPt]) values[kTriggerPt] = trig->Pt();
-  if(fgUsedVars[kTriggerRap] && (trig->IsA()==PAIR::Class())) 	  values[kTriggerRap]     = ((PAIR*)trig)->Rapidity();
-  if(fgUsedVars[kTriggerRapAbs] && (trig->IsA()==PAIR::Class()))  values[kTriggerRapAbs]  = TMath::Abs(((PAIR*)trig)->Rapidity());
-  if(fgUsedVars[kAssociatedPt]) values[kAssociatedPt] = assoc->Pt();
+  VarContext& ctx = *GetContext();
+  if(ctx.fUsedVars[kTriggerPt]) values[kTriggerPt] = trig->Pt();
+  if(ctx.fUsedVars[kTriggerRap] && (trig->IsA()==PAIR::Class())) 	  values[kTriggerRap]     = ((PAIR*)trig)->Rapidity();
+  if(ctx.fUsedVars[kTriggerRapAbs] && (trig->IsA()==PAIR::Class()))  values[kTriggerRapAbs]  = TMath::Abs(((PAIR*)trig)->Rapidity());
+  if(ctx.fUsedVars[kAssociatedPt]) values[kAssociatedPt] = assoc->Pt();
 
-  if(fgUsedVars[kDeltaPhi]) {
+  if(ctx.fUsedVars[kDeltaPhi]) {
     Double_t delta = trig->Phi() - assoc->Phi();
     if(delta>3.0/2.0*TMath::Pi()) delta -= 2.0*TMath::Pi();
     if(delta<-0.5*TMath::Pi()) delta += 2.0*TMath::Pi();
     values[kDeltaPhi] = delta;
   }
-  if(fgUsedVars[kDeltaPhiSym]) {
+  if(ctx.fUsedVars[kDeltaPhiSym]) {
     Double_t delta = TMath::Abs(trig->Phi() - assoc->Phi());
     if(delta>TMath::Pi()) delta = 2*TMath::Pi()-delta;
     values[kDeltaPhiSym] = delta;
   }
 
-  if(fgUsedVars[kDeltaTheta]) values[kDeltaTheta] = trig->Theta() - assoc->Theta();
+  if(ctx.fUsedVars[kDeltaTheta]) values[kDeltaTheta] = trig->Theta() - assoc->Theta();
   
-  if(fgUsedVars[kDeltaEta])     values[kDeltaEta]     = trig->Eta() - assoc->Eta();
-  if(fgUsedVars[kDeltaEtaAbs])  values[kDeltaEtaAbs]  = TMath::Abs(trig->Eta() - assoc->Eta());
-  if(fgUsedVars[kMass] && (trig->IsA()==PAIR::Class())) values[kMass] = ((PAIR*)trig)->Mass();
+  if(ctx.fUsedVars[kDeltaEta])     values[kDeltaEta]     = trig->Eta() - assoc->Eta();
+  if(ctx.fUsedVars[kDeltaEtaAbs])  values[kDeltaEtaAbs]  = TMath::Abs(trig->Eta() - assoc->Eta());
+  if(ctx.fUsedVars[kMass] && (trig->IsA()==PAIR::Class())) values[kMass] = ((PAIR*)trig)->Mass();
 }
 
 
@@ -2052,12 +2181,13 @@ void AliReducedVarManager::GetThetaPhiCM(BASETRACK* leg1, BASETRACK* leg2,
   //
   // Calculate theta and phi in helicity and Collins-Soper coordinate frame
   //
+  VarContext& ctx = *GetContext();
   if(!leg1||!leg2) {cout<<"AliReducedVarManager::GetThetaPhiCM:  base leg doesn't exist"<<endl; return;}
   Double_t pxyz1[3]={leg1->Px(),leg1->Py(),leg1->Pz()};
   Double_t pxyz2[3]={leg2->Px(),leg2->Py(),leg2->Pz()};
     
-  TLorentzVector projMom(0.,0.,-fgBeamMomentum,TMath::Sqrt(fgBeamMomentum*fgBeamMomentum+fgkParticleMass[kProton]*fgkParticleMass[kProton]));
-  TLorentzVector targMom(0.,0., fgBeamMomentum,TMath::Sqrt(fgBeamMomentum*fgBeamMomentum+fgkParticleMass[kProton]*fgkParticleMass[kProton]));
+  TLorentzVector projMom(0.,0.,-ctx.fBeamMomentum,TMath::Sqrt(ctx.fBeamMomentum*ctx.fBeamMomentum+fgkParticleMass[kProton]*fgkParticleMass[kProton]));
+  TLorentzVector targMom(0.,0., ctx.fBeamMomentum,TMath::Sqrt(ctx.fBeamMomentum*ctx.fBeamMomentum+fgkParticleMass[kProton]*fgkParticleMass[kProton]));
   
   // first & second daughter 4-mom
   TLorentzVector p1Mom(pxyz1[0],pxyz1[1],pxyz1[2],
@@ -2912,6 +3042,26 @@ void AliReducedVarManager::SetMultiplicityProfile(TH2* profile, Int_t estimator)
   }
   fgAvgMultVsVtxAndRun[iEstimator] = (TH2*)profile->Clone( Form("profile_%d", estimator  ));
   fgAvgMultVsVtxAndRun[iEstimator]->SetDirectory(0x0);
+  
+  // global references, computed here once since the profiles are shared by all contexts (and threads)
+  if( fgAvgMultVsVtxGlobal[iEstimator] ) delete fgAvgMultVsVtxGlobal[iEstimator];
+  if( fgAvgMultVsRun[iEstimator] ) delete fgAvgMultVsRun[iEstimator];
+  fgAvgMultVsVtxGlobal [iEstimator] = fgAvgMultVsVtxAndRun[iEstimator]->ProjectionY( Form("AvgMultVsVtxGlobal%d", iEstimator) );
+  fgAvgMultVsVtxGlobal [iEstimator] -> SetDirectory(0x0);
+  fgAvgMultVsVtxGlobal [iEstimator] -> Scale(1. / fgAvgMultVsVtxAndRun[iEstimator]->GetXaxis()->GetNbins());
+  fgAvgMultVsRun       [iEstimator] = fgAvgMultVsVtxAndRun[iEstimator]->ProjectionX( Form("AvgMultVsRun%d", iEstimator)  );
+  fgAvgMultVsRun       [iEstimator] -> SetDirectory(0x0);
+  fgAvgMultVsRun       [iEstimator] -> Scale(1. / fgAvgMultVsVtxAndRun[iEstimator]->GetYaxis()->GetNbins());
+  
+  fgRefMultVsVtxGlobal [iEstimator][kMaximumMultiplicity] = fgAvgMultVsVtxGlobal[iEstimator]->GetMaximum();
+  fgRefMultVsRun       [iEstimator][kMaximumMultiplicity] = fgAvgMultVsRun[iEstimator]->GetMaximum();
+  fgRefMultVsVtxAndRun [iEstimator][kMaximumMultiplicity] = fgAvgMultVsVtxAndRun[iEstimator]->GetMaximum();
+  fgRefMultVsVtxGlobal [iEstimator][kMinimumMultiplicity] = fgAvgMultVsVtxGlobal[iEstimator]->GetMinimum();
+  fgRefMultVsRun       [iEstimator][kMinimumMultiplicity] = fgAvgMultVsRun[iEstimator]->GetMinimum();
+  fgRefMultVsVtxAndRun [iEstimator][kMinimumMultiplicity] = fgAvgMultVsVtxAndRun[iEstimator]->GetMinimum();
+  fgRefMultVsVtxGlobal [iEstimator][kMeanMultiplicity]    = 0.5 * ( fgAvgMultVsVtxGlobal[iEstimator]->GetMaximum() + fgAvgMultVsVtxGlobal[iEstimator]->GetMinimum() );
+  fgRefMultVsRun       [iEstimator][kMeanMultiplicity]    = 0.5 * ( fgAvgMultVsRun[iEstimator]->GetMaximum() + fgAvgMultVsRun[iEstimator]->GetMinimum() );
+  fgRefMultVsVtxAndRun [iEstimator][kMeanMultiplicity]    = 0.5 * ( fgAvgMultVsVtxAndRun[iEstimator]->GetMaximum() + fgAvgMultVsVtxAndRun[iEstimator]->GetMinimum() );
 }
 
 //____________________________________________________________________________________
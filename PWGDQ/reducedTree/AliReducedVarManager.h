@@ -14,6 +14,8 @@
 #include <TH2F.h>
 #include <TProfile2D.h>
 
+#include <vector>
+
 #include <AliReducedPairInfo.h>
 
 class AliReducedBaseEvent;
@@ -23,6 +25,7 @@ class AliReducedBaseTrack;
 class AliReducedTrackInfo;
 class AliReducedCaloClusterInfo;
 class AliKFParticle;
+class TRandom;
 
 //_____________________________________________________________________
 class AliReducedVarManager : public TObject {
@@ -614,19 +617,43 @@ class AliReducedVarManager : public TObject {
   AliReducedVarManager(const Char_t* name);
   virtual ~AliReducedVarManager();
   
-  static void SetBeamMomentum(Float_t beamMom) {fgBeamMomentum = beamMom;}
-  static Float_t GetBeamMomentum() {return fgBeamMomentum;}
+  // State used while filling the variables. The static Fill*() functions operate on the context bound to the
+  // calling thread, or on a default context shared by all threads which did not bind one. With one context per
+  // worker thread, several events can be processed concurrently. The correction maps, calibration settings and
+  // run lists set with the static Set*() functions below are shared and must be configured before starting the threads.
+  // The context owns its random number generator; contexts are copied only by CreateContext(), which gives the copy its own.
+  struct VarContext {
+    VarContext();
+    ~VarContext();
+    void ResetRunInfo();
+    
+    Int_t fCurrentRunNumber;                   // current run number
+    Float_t fBeamMomentum;                     // beam energy (needed when calculating polarization angles)
+    AliReducedBaseEvent* fEvent;               // pointer to the current event
+    AliReducedEventPlaneInfo* fEventPlane;     // pointer to the current event plane
+    Bool_t fUsedVars[kNVars];                  // array of flags toggled when the corresponding variable is required (e.g., in the histogram manager, in cuts, mixing handler, etc.)
+    Int_t fRunID;                              // run ID
+    TH1* fAvgMultVsVtxRunwise[kNMultiplicityEstimators];                                  // average multiplicity vs. z-vertex position (run-by-run)
+    Double_t fRefMultVsVtxRunwise[kNMultiplicityEstimators][kNReferenceMultiplicities];   // reference multiplicity for z-vertex correction (run-by-run)
+    TProfile2D* fAvgVZEROChannelMult[64];      // average multiplicity in VZERO channels vs (vtxZ,centSPD), current run
+    TProfile2D* fVZEROqVecRecentering[4];      // (vtxZ,centSPD) maps of the VZERO A and C recentering Qvector offsets, current run
+    Bool_t fCalibrateVZEROqVec;                // calibrate the VZERO Q-vector in the current run (false if no calibration was found)
+    Bool_t fRecenterVZEROqVec;                 // recenter the VZERO Q-vector in the current run (false if no calibration was found)
+    TRandom* fRandom;                          // random number generator of the thread, 0x0 to use gRandom
+  };
+  static VarContext* GetContext();
+  static void SetContext(VarContext* context);
+  static VarContext* CreateContext(Bool_t copyUsedVars=kTRUE);
+  static TRandom* GetRandom();
+  
+  static void SetBeamMomentum(Float_t beamMom);
+  static Float_t GetBeamMomentum();
   
-  static void SetEvent(AliReducedBaseEvent* const ev) {fgEvent = ev;};
-  static void SetEventPlane(AliReducedEventPlaneInfo* const ev) {fgEventPlane = ev;};
-  static void SetUseVariable(Variables var) {fgUsedVars[var] = kTRUE; SetVariableDependencies();}
-  static void SetUseVars(Bool_t* usedVars) {
-    for(Int_t i=0;i<kNVars;++i) {
-      if(usedVars[i]) fgUsedVars[i]=kTRUE;    // overwrite only the variables that are being used since there are more channels to modify the used variables array, independently
-    }
-    SetVariableDependencies();
-  }
-  static Bool_t GetUsedVar(Variables var) {return fgUsedVars[var];}
+  static void SetEvent(AliReducedBaseEvent* const ev);
+  static void SetEventPlane(AliReducedEventPlaneInfo* const ev);
+  static void SetUseVariable(Variables var);
+  static void SetUseVars(Bool_t* usedVars);
+  static Bool_t GetUsedVar(Variables var);
   
   static void FillEventInfo(Float_t* values);
   static void FillEventInfo(AliReducedBaseEvent* event, Float_t* values, AliReducedEventPlaneInfo* eventPlane=0x0);
@@ -679,12 +706,6 @@ class AliReducedVarManager : public TObject {
   static Int_t GetCorrectedMultiplicity( Int_t estimator = kMultiplicity, Int_t correction = 0, Int_t reference = 0, Int_t smearing = 0 );
   
  private:
-  static Int_t     fgCurrentRunNumber;               // current run number
-  static Float_t fgBeamMomentum;                  // beam energy (needed when calculating polarization angles) 
-  static AliReducedBaseEvent* fgEvent;            // pointer to the current event
-  static AliReducedEventPlaneInfo* fgEventPlane;  // pointer to the current event plane
-  static Bool_t fgUsedVars[kNVars];              // array of flags toggled when the corresponding variable is required (e.g., in the histogram manager, in cuts, mixing handler, etc.) 
-                                                 //   when a variable is used
   static void SetVariableDependencies();       // toggle those variables on which other used variables might depend 
   
 
@@ -714,25 +735,20 @@ class AliReducedVarManager : public TObject {
   static TH1I* fgRunTimeStart;                // run start time, GRP/GRP/Data::GetTimeStart()
   static TH1I* fgRunTimeEnd;                  // run stop time, GRP/GRP/Data::GetTimeEnd()
   static std::vector<Int_t> fgRunNumbers;     // vector with run numbers (for histograms vs. run number)
-  static Int_t fgRunID;                       // run ID
   static TH1* fgAvgMultVsVtxGlobal      [kNMultiplicityEstimators];        // average multiplicity vs. z-vertex position (global)
-  static TH1* fgAvgMultVsVtxRunwise     [kNMultiplicityEstimators];        // average multiplicity vs. z-vertex position (run-by-run)
   static TH1* fgAvgMultVsRun            [kNMultiplicityEstimators];           // average multiplicity vs. run number
   static TH2* fgAvgMultVsVtxAndRun      [kNMultiplicityEstimators];  // 2D : average multiplicity vs. run number and z-vertex position
   static Double_t fgRefMultVsVtxGlobal  [kNMultiplicityEstimators] [kNReferenceMultiplicities];  // reference multiplicity for z-vertex correction (global)
-  static Double_t fgRefMultVsVtxRunwise [kNMultiplicityEstimators] [kNReferenceMultiplicities];  // reference multiplicity for z-vertex correction (run-by-run)
   static Double_t fgRefMultVsRun        [kNMultiplicityEstimators] [kNReferenceMultiplicities];  // reference multiplicity for run correction
   static Double_t fgRefMultVsVtxAndRun  [kNMultiplicityEstimators] [kNReferenceMultiplicities];  // reference multiplicity for run, vtx correction
   static TString fgVZEROCalibrationPath;       // path to the VZERO calibration histograms
-  static TProfile2D* fgAvgVZEROChannelMult[64];       // average multiplicity in VZERO channels vs (vtxZ,centSPD)
-  static TProfile2D* fgVZEROqVecRecentering[4];       // (vtxZ,centSPD) maps of the VZERO A and C recentering Qvector offsets
   static Bool_t fgOptionCalibrateVZEROqVec;
   static Bool_t fgOptionRecenterVZEROqVec;
   
   AliReducedVarManager(AliReducedVarManager const&);
   AliReducedVarManager& operator=(AliReducedVarManager const&);  
   
-  ClassDef(AliReducedVarManager, 4);
+  ClassDef(AliReducedVarManager, 5);
 };
 
 #endif
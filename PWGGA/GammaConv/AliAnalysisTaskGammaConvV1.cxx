@@ -3661,122 +3661,84 @@ void AliAnalysisTaskGammaConvV1::CalculateBackground(){
   if(((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))->UseRotationMethod()){
 
     for(Int_t iCurrent=0;iCurrent<fGammaCandidates->GetEntries();iCurrent++){
-      AliAODConversionPhoton currentEventGoodV0 = *(AliAODConversionPhoton*)(fGammaCandidates->At(iCurrent));
+      AliAODConversionPhoton *currentEventGoodV0 = (AliAODConversionPhoton*)(fGammaCandidates->At(iCurrent));
       for(Int_t iCurrent2=iCurrent+1;iCurrent2<fGammaCandidates->GetEntries();iCurrent2++){
         for(Int_t nRandom=0;nRandom<((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))->GetNumberOfBGEvents();nRandom++){
         AliAODConversionPhoton currentEventGoodV02 = *(AliAODConversionPhoton*)(fGammaCandidates->At(iCurrent2));
 
         if(((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))->DoBGProbability()){
-          AliAODConversionMother *backgroundCandidateProb = new AliAODConversionMother(&currentEventGoodV0,&currentEventGoodV02);
-          Double_t massBGprob = backgroundCandidateProb->M();
+          // invariant mass of the pair, as of the AliAODConversionMother built from it
+          TLorentzVector backgroundCandidateProb(currentEventGoodV0->Px()+currentEventGoodV02.Px(),currentEventGoodV0->Py()+currentEventGoodV02.Py(),
+                                                 currentEventGoodV0->Pz()+currentEventGoodV02.Pz(),currentEventGoodV0->E()+currentEventGoodV02.E());
+          Double_t massBGprob = backgroundCandidateProb.M();
           if(massBGprob>0.1 && massBGprob<0.14){
             if(fRandom.Rndm()>fBGHandler[fiCut]->GetBGProb(zbin,mbin)){
-              delete backgroundCandidateProb;
               continue;
             }
           }
-          delete backgroundCandidateProb;
-          backgroundCandidateProb = 0x0;
         }
 
         RotateParticle(&currentEventGoodV02);
-        AliAODConversionMother *backgroundCandidate = new AliAODConversionMother(&currentEventGoodV0,&currentEventGoodV02);
-        backgroundCandidate->CalculateDistanceOfClossetApproachToPrimVtx(fInputEvent->GetPrimaryVertex());
-        if((((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))
-          ->MesonIsSelected(backgroundCandidate,kFALSE,((AliConvEventCuts*)fEventCutArray->At(fiCut))->GetEtaShift()))){
-          if(fDoCentralityFlat > 0) fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(), fWeightCentrality[fiCut]*fWeightJetJetMC);
-          else fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(),fWeightJetJetMC);
-          if(fDoTHnSparse){
-            Double_t sparesFill[4] = {backgroundCandidate->M(),backgroundCandidate->Pt(),(Double_t)zbin,(Double_t)mbin};
-            if(fDoCentralityFlat > 0) sESDMotherBackInvMassPtZM[fiCut]->Fill(sparesFill, fWeightCentrality[fiCut]*fWeightJetJetMC); //instead of weight 1
-            else sESDMotherBackInvMassPtZM[fiCut]->Fill(sparesFill, fWeightJetJetMC);
-          }
-        }
-        delete backgroundCandidate;
-        backgroundCandidate = 0x0;
+        FillBackgroundPair(currentEventGoodV0,&currentEventGoodV02,zbin,mbin);
         }
       }
     }
   } else {
     AliGammaConversionAODBGHandler::GammaConversionVertex *bgEventVertex = NULL;
-
-    if(((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))->UseTrackMultiplicity()){
-      for(Int_t nEventsInBG=0;nEventsInBG<fBGHandler[fiCut]->GetNBGEvents();nEventsInBG++){
-        AliGammaConversionAODVector *previousEventV0s = fBGHandler[fiCut]->GetBGGoodV0s(zbin,mbin,nEventsInBG);
-        if(fMoveParticleAccordingToVertex == kTRUE || ((AliConversionPhotonCuts*)fCutArray->At(fiCut))->GetInPlaneOutOfPlaneCut() != 0){
-          bgEventVertex = fBGHandler[fiCut]->GetBGEventVertex(zbin,mbin,nEventsInBG);
-        }
-
-        for(Int_t iCurrent=0;iCurrent<fGammaCandidates->GetEntries();iCurrent++){
-        AliAODConversionPhoton currentEventGoodV0 = *(AliAODConversionPhoton*)(fGammaCandidates->At(iCurrent));
+    Bool_t rotateAccordingToEP = ((AliConversionPhotonCuts*)fCutArray->At(fiCut))->GetInPlaneOutOfPlaneCut() != 0;
+    Bool_t moveOrRotate = fMoveParticleAccordingToVertex == kTRUE || rotateAccordingToEP;
+    // copies of the photons of the background event, moved/rotated to the current event
+    std::vector<AliAODConversionPhoton> movedPreviousEventV0s;
+
+    for(Int_t nEventsInBG=0;nEventsInBG<fBGHandler[fiCut]->GetNBGEvents();nEventsInBG++){
+      AliGammaConversionAODVector *previousEventV0s = fBGHandler[fiCut]->GetBGGoodV0s(zbin,mbin,nEventsInBG);
+      if(!previousEventV0s) continue;
+      if(moveOrRotate){
+        bgEventVertex = fBGHandler[fiCut]->GetBGEventVertex(zbin,mbin,nEventsInBG);
+        // once per background event, not once per photon of the current event
+        movedPreviousEventV0s.clear();
         for(UInt_t iPrevious=0;iPrevious<previousEventV0s->size();iPrevious++){
-          AliAODConversionPhoton previousGoodV0 = (AliAODConversionPhoton)(*(previousEventV0s->at(iPrevious)));
+          movedPreviousEventV0s.push_back(*(previousEventV0s->at(iPrevious)));
+          AliAODConversionPhoton *previousGoodV0 = &movedPreviousEventV0s.back();
           if(fMoveParticleAccordingToVertex == kTRUE){
-            MoveParticleAccordingToVertex(&previousGoodV0,bgEventVertex);
+            MoveParticleAccordingToVertex(previousGoodV0,bgEventVertex);
           }
-          if(((AliConversionPhotonCuts*)fCutArray->At(fiCut))->GetInPlaneOutOfPlaneCut() != 0){
-            RotateParticleAccordingToEP(&previousGoodV0,bgEventVertex->fEP,fEventPlaneAngle);
+          if(rotateAccordingToEP){
+            RotateParticleAccordingToEP(previousGoodV0,bgEventVertex->fEP,fEventPlaneAngle);
           }
-
-          AliAODConversionMother *backgroundCandidate = new AliAODConversionMother(&currentEventGoodV0,&previousGoodV0);
-          backgroundCandidate->CalculateDistanceOfClossetApproachToPrimVtx(fInputEvent->GetPrimaryVertex());
-          if((((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))
-            ->MesonIsSelected(backgroundCandidate,kFALSE,((AliConvEventCuts*)fEventCutArray->At(fiCut))->GetEtaShift()))){
-            if(fDoCentralityFlat > 0) fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(), fWeightCentrality[fiCut]*fWeightJetJetMC);
-            else fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(),fWeightJetJetMC);
-            if(fDoTHnSparse){
-              Double_t sparesFill[4] = {backgroundCandidate->M(),backgroundCandidate->Pt(),(Double_t)zbin,(Double_t)mbin};
-              if(fDoCentralityFlat > 0) sESDMotherBackInvMassPtZM[fiCut]->Fill(sparesFill, fWeightCentrality[fiCut]*fWeightJetJetMC); //instead of weight 1
-              else sESDMotherBackInvMassPtZM[fiCut]->Fill(sparesFill, fWeightJetJetMC);
-            }
-          }
-          delete backgroundCandidate;
-          backgroundCandidate = 0x0;
-        }
         }
       }
-    } else {
-      for(Int_t nEventsInBG=0;nEventsInBG <fBGHandler[fiCut]->GetNBGEvents();nEventsInBG++){
-        AliGammaConversionAODVector *previousEventV0s = fBGHandler[fiCut]->GetBGGoodV0s(zbin,mbin,nEventsInBG);
-        if(previousEventV0s){
-        if(fMoveParticleAccordingToVertex == kTRUE || ((AliConversionPhotonCuts*)fCutArray->At(fiCut))->GetInPlaneOutOfPlaneCut() != 0){
-          bgEventVertex = fBGHandler[fiCut]->GetBGEventVertex(zbin,mbin,nEventsInBG);
-        }
-        for(Int_t iCurrent=0;iCurrent<fGammaCandidates->GetEntries();iCurrent++){
-          AliAODConversionPhoton currentEventGoodV0 = *(AliAODConversionPhoton*)(fGammaCandidates->At(iCurrent));
-          for(UInt_t iPrevious=0;iPrevious<previousEventV0s->size();iPrevious++){
 
-            AliAODConversionPhoton previousGoodV0 = (AliAODConversionPhoton)(*(previousEventV0s->at(iPrevious)));
-
-            if(fMoveParticleAccordingToVertex == kTRUE){
-              MoveParticleAccordingToVertex(&previousGoodV0,bgEventVertex);
-            }
-            if(((AliConversionPhotonCuts*)fCutArray->At(fiCut))->GetInPlaneOutOfPlaneCut() != 0){
-              RotateParticleAccordingToEP(&previousGoodV0,bgEventVertex->fEP,fEventPlaneAngle);
-            }
-
-
-            AliAODConversionMother *backgroundCandidate = new AliAODConversionMother(&currentEventGoodV0,&previousGoodV0);
-            backgroundCandidate->CalculateDistanceOfClossetApproachToPrimVtx(fInputEvent->GetPrimaryVertex());
-            if((((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))
-              ->MesonIsSelected(backgroundCandidate,kFALSE,((AliConvEventCuts*)fEventCutArray->At(fiCut))->GetEtaShift()))){
-              if(fDoCentralityFlat > 0) fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(), fWeightCentrality[fiCut]*fWeightJetJetMC);
-              else fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(),fWeightJetJetMC);
-              if(fDoTHnSparse){
-                Double_t sparesFill[4] = {backgroundCandidate->M(),backgroundCandidate->Pt(),(Double_t)zbin,(Double_t)mbin};
-                if(fDoCentralityFlat > 0) sESDMotherBackInvMassPtZM[fiCut]->Fill(sparesFill, fWeightCentrality[fiCut]*fWeightJetJetMC); //instead of weight 1
-                else sESDMotherBackInvMassPtZM[fiCut]->Fill(sparesFill, fWeightJetJetMC);
-              }
-            }
-            delete backgroundCandidate;
-            backgroundCandidate = 0x0;
-          }
-        }
+      for(Int_t iCurrent=0;iCurrent<fGammaCandidates->GetEntries();iCurrent++){
+        AliAODConversionPhoton *currentEventGoodV0 = (AliAODConversionPhoton*)(fGammaCandidates->At(iCurrent));
+        for(UInt_t iPrevious=0;iPrevious<previousEventV0s->size();iPrevious++){
+          const AliAODConversionPhoton *previousGoodV0 = moveOrRotate ? &movedPreviousEventV0s[iPrevious] : previousEventV0s->at(iPrevious);
+          FillBackgroundPair(currentEventGoodV0,previousGoodV0,zbin,mbin);
         }
       }
     }
   }
 }
+
+//________________________________________________________________________
+void AliAnalysisTaskGammaConvV1::FillBackgroundPair(const AliAODConversionPhoton *gamma0, const AliAODConversionPhoton *gamma1, Int_t zbin, Int_t mbin){
+  // Builds the background candidate of a mixed or rotated photon pair on the stack,
+  // applies the meson cuts and fills the background histograms
+
+  AliAODConversionMother backgroundCandidate(gamma0,gamma1);
+  backgroundCandidate.CalculateDistanceOfClossetApproachToPrimVtx(fInputEvent->GetPrimaryVertex());
+  if(!((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))
+    ->MesonIsSelected(&backgroundCandidate,kFALSE,((AliConvEventCuts*)fEventCutArray->At(fiCut))->GetEtaShift())) return;
+
+  Double_t mass = backgroundCandidate.M();
+  Double_t pt = backgroundCandidate.Pt();
+  Double_t weight = fDoCentralityFlat > 0 ? fWeightCentrality[fiCut]*fWeightJetJetMC : fWeightJetJetMC;
+  fHistoMotherBackInvMassPt[fiCut]->Fill(mass,pt,weight);
+  if(fDoTHnSparse){
+    Double_t sparesFill[4] = {mass,pt,(Double_t)zbin,(Double_t)mbin};
+    sESDMotherBackInvMassPtZM[fiCut]->Fill(sparesFill,weight);
+  }
+}
 //________________________________________________________________________
 void AliAnalysisTaskGammaConvV1::CalculateBackgroundRP(){
 
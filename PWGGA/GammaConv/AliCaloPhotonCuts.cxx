@@ -170,6 +170,7 @@ AliCaloPhotonCuts::AliCaloPhotonCuts(Int_t isMC, const char *name,const char *ti
   fUseNonLinearity(kFALSE),
   fIsPureCalo(0),
   fVectorMatchedClusterIDs(0),
+  fVectorMatchedTrackIDs(0),
   fCutString(NULL),
   fCutStringRead(""),
   fHistCutIndex(NULL),
@@ -355,6 +356,7 @@ AliCaloPhotonCuts::AliCaloPhotonCuts(const AliCaloPhotonCuts &ref) :
   fUseNonLinearity(ref.fUseNonLinearity),
   fIsPureCalo(ref.fIsPureCalo),
   fVectorMatchedClusterIDs(0),
+  fVectorMatchedTrackIDs(0),
   fCutString(NULL),
   fCutStringRead(""),
   fHistCutIndex(NULL),
@@ -1931,12 +1933,12 @@ Bool_t AliCaloPhotonCuts::ClusterQualityCuts(AliVCluster* cluster, AliVEvent *ev
         if ( classification == 6)
           fHistClusterTMEffiInput->Fill(cluster->E(), 20., weight); // El cl match
 
-        vector<Int_t> labelsMatchedTracks;
+        vector<Int_t> &labelsMatchedTracks = fVectorMatchedTrackIDs;
         if (!fUsePtDepTrackToCluster)
-          labelsMatchedTracks           = fCaloTrackMatcher->GetMatchedTrackIDsForCluster(event, cluster->GetID(), fMaxDistTrackToClusterEta, -fMaxDistTrackToClusterEta,
-                                                                                          fMaxDistTrackToClusterPhi, fMinDistTrackToClusterPhi);
+          fCaloTrackMatcher->GetMatchedTrackIDsForCluster(event, cluster->GetID(), fMaxDistTrackToClusterEta, -fMaxDistTrackToClusterEta,
+                                                          fMaxDistTrackToClusterPhi, fMinDistTrackToClusterPhi, labelsMatchedTracks);
         else
-          labelsMatchedTracks           = fCaloTrackMatcher->GetMatchedTrackIDsForCluster(event, cluster->GetID(), fFuncPtDepEta, fFuncPtDepPhi);
+          fCaloTrackMatcher->GetMatchedTrackIDsForCluster(event, cluster->GetID(), fFuncPtDepEta, fFuncPtDepPhi, labelsMatchedTracks);
 
         //Int_t idHighestPt = -1;
         Double_t ptMax    = -1;
@@ -6567,21 +6569,28 @@ Int_t AliCaloPhotonCuts::ClassifyClusterForTMEffi(AliVCluster* cluster, AliVEven
 //_______________________________________________________________________________
 std::vector<Int_t> AliCaloPhotonCuts::GetVectorMatchedTracksToCluster(AliVEvent* event, AliVCluster* cluster){
   vector<Int_t> labelsMatched(0);
-  if(!fUseDistTrackToCluster) return labelsMatched;
+  GetVectorMatchedTracksToCluster(event, cluster, labelsMatched);
+  return labelsMatched;
+}
+
+//_______________________________________________________________________________
+Int_t AliCaloPhotonCuts::GetVectorMatchedTracksToCluster(AliVEvent* event, AliVCluster* cluster, std::vector<Int_t> &labelsMatched){
+  // fills the track IDs matched to the cluster into labelsMatched, which can be reused for all clusters
+  labelsMatched.clear();
+  if(!fUseDistTrackToCluster) return 0;
 
   if (!fUsePtDepTrackToCluster)
-    labelsMatched = fCaloTrackMatcher->GetMatchedTrackIDsForCluster(event, cluster->GetID(), fMaxDistTrackToClusterEta, -fMaxDistTrackToClusterEta,
-                                                                    fMaxDistTrackToClusterPhi, fMinDistTrackToClusterPhi);
+    return fCaloTrackMatcher->GetMatchedTrackIDsForCluster(event, cluster->GetID(), fMaxDistTrackToClusterEta, -fMaxDistTrackToClusterEta,
+                                                           fMaxDistTrackToClusterPhi, fMinDistTrackToClusterPhi, labelsMatched);
   else
-    labelsMatched = fCaloTrackMatcher->GetMatchedTrackIDsForCluster(event, cluster->GetID(), fFuncPtDepEta, fFuncPtDepPhi);
-
-  return labelsMatched;
+    return fCaloTrackMatcher->GetMatchedTrackIDsForCluster(event, cluster->GetID(), fFuncPtDepEta, fFuncPtDepPhi, labelsMatched);
 }
 
 //_______________________________________________________________________________
 Bool_t AliCaloPhotonCuts::GetClosestMatchedTrackToCluster(AliVEvent* event, AliVCluster* cluster, Int_t &trackLabel){
   if(!fUseDistTrackToCluster) return kFALSE;
-  vector<Int_t> labelsMatched = GetVectorMatchedTracksToCluster(event,cluster);
+  vector<Int_t> &labelsMatched = fVectorMatchedTrackIDs;
+  GetVectorMatchedTracksToCluster(event,cluster,labelsMatched);
 
   if((Int_t) labelsMatched.size()<1) return kFALSE;
 
@@ -6609,7 +6618,8 @@ Bool_t AliCaloPhotonCuts::GetClosestMatchedTrackToCluster(AliVEvent* event, AliV
 //_______________________________________________________________________________
 Bool_t AliCaloPhotonCuts::GetHighestPtMatchedTrackToCluster(AliVEvent* event, AliVCluster* cluster, Int_t &trackLabel){
   if(!fUseDistTrackToCluster) return kFALSE;
-  vector<Int_t> labelsMatched = GetVectorMatchedTracksToCluster(event,cluster);
+  vector<Int_t> &labelsMatched = fVectorMatchedTrackIDs;
+  GetVectorMatchedTracksToCluster(event,cluster,labelsMatched);
 
   if((Int_t) labelsMatched.size()<1) return kFALSE;
 
@@ -318,6 +318,7 @@ class AliCaloPhotonCuts : public AliAnalysisCuts {
     Int_t       ClassifyClusterForTMEffi(AliVCluster* cluster, AliVEvent* event, AliMCEvent* mcEvent, Bool_t isESD);
 
     std::vector<Int_t> GetVectorMatchedTracksToCluster(AliVEvent* event, AliVCluster* cluster);
+    Int_t       GetVectorMatchedTracksToCluster(AliVEvent* event, AliVCluster* cluster, std::vector<Int_t> &labelsMatched);
     Bool_t      GetClosestMatchedTrackToCluster(AliVEvent* event, AliVCluster* cluster, Int_t &trackLabel);
     Bool_t      GetHighestPtMatchedTrackToCluster(AliVEvent* event, AliVCluster* cluster, Int_t &trackLabel);
     Bool_t      IsClusterPi0(AliVEvent *event, AliMCEvent *mcEvent, AliVCluster *cluster);
@@ -466,6 +467,7 @@ class AliCaloPhotonCuts : public AliAnalysisCuts {
 
     //vector
     std::vector<Int_t> fVectorMatchedClusterIDs;        // vector with cluster IDs that have been matched to tracks in merged cluster analysis
+    std::vector<Int_t> fVectorMatchedTrackIDs;          //! track IDs matched to the current cluster, reused for all clusters
 
     // CutString
     TObjString* fCutString;                             // cut number used for analysis
@@ -584,7 +586,7 @@ class AliCaloPhotonCuts : public AliAnalysisCuts {
 
   private:
 
-    ClassDef(AliCaloPhotonCuts,65)
+    ClassDef(AliCaloPhotonCuts,66)
 };
 
 #endif
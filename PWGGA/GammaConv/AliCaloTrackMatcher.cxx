@@ -36,6 +36,7 @@
 #include "TH1F.h"
 #include "TF1.h"
 
+#include <algorithm>
 #include <vector>
 #include <map>
 #include <utility>
@@ -47,6 +48,12 @@ using namespace std;
 
 ClassImp(AliCaloTrackMatcher)
 
+//________________________________________________________________________
+static Bool_t CompareTrackPositionID(const pair<Int_t,Int_t> &a, const pair<Int_t,Int_t> &b){
+  // order (track ID, position in event) by track ID only
+  return a.first < b.first;
+}
+
 //________________________________________________________________________
 AliCaloTrackMatcher::AliCaloTrackMatcher(const char *name, Int_t clusterType, Int_t runningMode) : AliAnalysisTaskSE(name),
   fClusterType(clusterType),
@@ -64,6 +71,16 @@ AliCaloTrackMatcher::AliCaloTrackMatcher(const char *name, Int_t clusterType, In
   fNEntries(1),
   fVectorDeltaEtaDeltaPhi(0),
   fMap_TrID_ClID_ToIndex(),
+  fClusterIndexKeys(),
+  fClusterIndexOffsets(),
+  fClusterIndexMatches(),
+  fClusterIndexWindows(),
+  fTrackIndexKeys(),
+  fTrackIndexOffsets(),
+  fTrackIndexMatches(),
+  fTrackIndexWindows(),
+  fTrackPositionEvent(NULL),
+  fTrackPositions(),
   fSecMapTrackToCluster(),
   fSecMapClusterToTrack(),
   fSecNEntries(1),
@@ -88,6 +105,16 @@ AliCaloTrackMatcher::~AliCaloTrackMatcher(){
     fMapClusterToTrack.clear();
     fVectorDeltaEtaDeltaPhi.clear();
     fMap_TrID_ClID_ToIndex.clear();
+    fClusterIndexKeys.clear();
+    fClusterIndexOffsets.clear();
+    fClusterIndexMatches.clear();
+    fClusterIndexWindows.clear();
+    fTrackIndexKeys.clear();
+    fTrackIndexOffsets.clear();
+    fTrackIndexMatches.clear();
+    fTrackIndexWindows.clear();
+    fTrackPositionEvent = NULL;
+    fTrackPositions.clear();
 
     fSecMapTrackToCluster.clear();
     fSecMapClusterToTrack.clear();
@@ -110,6 +137,16 @@ void AliCaloTrackMatcher::Terminate(Option_t *){
   fMapClusterToTrack.clear();
   fVectorDeltaEtaDeltaPhi.clear();
   fMap_TrID_ClID_ToIndex.clear();
+  fClusterIndexKeys.clear();
+  fClusterIndexOffsets.clear();
+  fClusterIndexMatches.clear();
+  fClusterIndexWindows.clear();
+  fTrackIndexKeys.clear();
+  fTrackIndexOffsets.clear();
+  fTrackIndexMatches.clear();
+  fTrackIndexWindows.clear();
+  fTrackPositionEvent = NULL;
+  fTrackPositions.clear();
 
   fSecMapTrackToCluster.clear();
   fSecMapClusterToTrack.clear();
@@ -164,6 +201,16 @@ void AliCaloTrackMatcher::Initialize(Int_t runNumber){
   fNEntries = 1;
   fVectorDeltaEtaDeltaPhi.clear();
   fMap_TrID_ClID_ToIndex.clear();
+  fClusterIndexKeys.clear();
+  fClusterIndexOffsets.clear();
+  fClusterIndexMatches.clear();
+  fClusterIndexWindows.clear();
+  fTrackIndexKeys.clear();
+  fTrackIndexOffsets.clear();
+  fTrackIndexMatches.clear();
+  fTrackIndexWindows.clear();
+  fTrackPositionEvent = NULL;
+  fTrackPositions.clear();
 
   fSecMapTrackToCluster.clear();
   fSecMapClusterToTrack.clear();
@@ -191,6 +238,9 @@ void AliCaloTrackMatcher::UserExec(Option_t *){
 
   //DebugV0Matching();
 
+  // AOD track positions are looked up again in the new event
+  fTrackPositionEvent = NULL;
+
   // do processing only for EMCal (1), DCal (3) or PHOS (2) clusters, otherwise do nothing
   if(fClusterType == 1 || fClusterType == 2 || fClusterType == 3){
     Initialize(fInputEvent->GetRunNumber());
@@ -492,6 +542,7 @@ void AliCaloTrackMatcher::ProcessEvent(AliVEvent *event){
     delete trackParam;
   }
 
+  BuildMatchIndex(event);
   return;
 }
 
@@ -680,14 +731,7 @@ Bool_t AliCaloTrackMatcher::PropagateV0TrackToClusterAndGetMatchingResidual(AliV
 
     if(aodev){
       //need to search for position in case of AOD
-      Int_t TrackPos = -1;
-      for (Int_t iTrack = 0; iTrack < event->GetNumberOfTracks(); iTrack++){
-        AliVTrack* currTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(iTrack));
-        if(currTrack->GetID() == inSecTrack->GetID()){
-          TrackPos = iTrack;
-          break;
-        }
-      }
+      Int_t TrackPos = GetTrackPosition(event,inSecTrack->GetID());
       if(TrackPos == -1) AliFatal(Form("AliCaloTrackMatcher: PropagateV0TrackToClusterAndGetMatchingResidual - track (ID: '%i') cannot be retrieved from event, should be impossible as it has been used in maim task before!",inSecTrack->GetID()));
       fSecMapTrackToCluster.insert(make_pair(TrackPos,cluster->GetID()));
       fSecMapClusterToTrack.insert(make_pair(cluster->GetID(),TrackPos));
@@ -726,342 +770,342 @@ Bool_t AliCaloTrackMatcher::GetTrackClusterMatchingResidual(Int_t trackID, Int_t
   return kTRUE;
 }
 //________________________________________________________________________
-Int_t AliCaloTrackMatcher::GetNMatchedTrackIDsForCluster(AliVEvent *event, Int_t clusterID, Float_t dEtaMax, Float_t dEtaMin, Float_t dPhiMax, Float_t dPhiMin){
-  Int_t matched = 0;
+void AliCaloTrackMatcher::BuildMatchIndex(AliVEvent *event){
+  // Build the compressed (CSR) cluster -> tracks and track -> clusters index of the matches
+  // of this event, with the residuals, pT and charge of the tracks that the queries need.
+  // Entries keep the order of the multimaps, so all queries give the same results as a scan
+  // of the multimaps.
+  fClusterIndexKeys.clear();
+  fClusterIndexOffsets.clear();
+  fClusterIndexMatches.clear();
+  fTrackIndexKeys.clear();
+  fTrackIndexOffsets.clear();
+  fTrackIndexMatches.clear();
+
+  MatchResidual match;
   multimap<Int_t,Int_t>::iterator it;
   for (it=fMapClusterToTrack.begin(); it!=fMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
+    AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
+    if(!tempTrack) continue;
+    if(!GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,match.fDEta,match.fDPhi)) continue;
+    match.fID           = it->second;
+    match.fTrackPt      = tempTrack->Pt();
+    match.fTrackCharge  = tempTrack->Charge();
+    if(fClusterIndexKeys.empty() || fClusterIndexKeys.back() != it->first){
+      fClusterIndexKeys.push_back(it->first);
+      fClusterIndexOffsets.push_back(fClusterIndexMatches.size());
+    }
+    fClusterIndexMatches.push_back(match);
+  }
+  fClusterIndexOffsets.push_back(fClusterIndexMatches.size());
+
+  AliVTrack* tempTrack  = NULL;
+  for (it=fMapTrackToCluster.begin(); it!=fMapTrackToCluster.end(); ++it){
+    if(fTrackIndexKeys.empty() || fTrackIndexKeys.back() != it->first){
+      tempTrack         = dynamic_cast<AliVTrack*>(event->GetTrack(it->first));
       if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        if(tempTrack->Charge()>0){
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) matched++;
-        }else if(tempTrack->Charge()<0){
-          dPhiMin*=-1;
-          dPhiMax*=-1;
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) matched++;
-        }
-      }
+      fTrackIndexKeys.push_back(it->first);
+      fTrackIndexOffsets.push_back(fTrackIndexMatches.size());
     }
+    if(!GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,match.fDEta,match.fDPhi)) continue;
+    match.fID           = it->second;
+    match.fTrackPt      = tempTrack->Pt();
+    match.fTrackCharge  = tempTrack->Charge();
+    fTrackIndexMatches.push_back(match);
   }
+  fTrackIndexOffsets.push_back(fTrackIndexMatches.size());
 
-  return matched;
+  fClusterIndexWindows.assign(fClusterIndexMatches.size(),PtDepWindow());
+  fTrackIndexWindows.assign(fTrackIndexMatches.size(),PtDepWindow());
+  return;
 }
 
 //________________________________________________________________________
-Int_t AliCaloTrackMatcher::GetNMatchedTrackIDsForCluster(AliVEvent *event, Int_t clusterID, TF1* fFuncPtDepEta, TF1* fFuncPtDepPhi){
-  Int_t matched = 0;
-  multimap<Int_t,Int_t>::iterator it;
-  for (it=fMapClusterToTrack.begin(); it!=fMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        Bool_t match_dEta = kFALSE;
-        Bool_t match_dPhi = kFALSE;
-        if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
-        else match_dEta = kFALSE;
-
-        if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
-        else match_dPhi = kFALSE;
+Int_t AliCaloTrackMatcher::FindMatchIndexRow(const vector<Int_t> &keys, Int_t key) const {
+  // position of key in the sorted keys of the match index, -1 if the key has no matches
+  vector<Int_t>::const_iterator it = lower_bound(keys.begin(),keys.end(),key);
+  if(it == keys.end() || *it != key) return -1;
+  return it - keys.begin();
+}
 
-        if (match_dPhi && match_dEta )matched++;
-      }
+//________________________________________________________________________
+Int_t AliCaloTrackMatcher::GetTrackPosition(AliVEvent *event, Int_t trackID){
+  // position of the first track with the given ID in the event, -1 if not found
+  // the lookup table is filled at the first call in the event
+  if(fTrackPositionEvent != event){
+    fTrackPositions.clear();
+    for (Int_t iTrack = 0; iTrack < event->GetNumberOfTracks(); iTrack++){
+      AliVTrack* currTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(iTrack));
+      if(!currTrack) continue;
+      fTrackPositions.push_back(make_pair(currTrack->GetID(),iTrack));
     }
+    // stable sort keeps the first position for duplicate IDs in front
+    stable_sort(fTrackPositions.begin(),fTrackPositions.end(),CompareTrackPositionID);
+    fTrackPositionEvent = event;
   }
-  return matched;
+  vector<pairInt>::const_iterator it = lower_bound(fTrackPositions.begin(),fTrackPositions.end(),make_pair(trackID,-1),CompareTrackPositionID);
+  if(it == fTrackPositions.end() || it->first != trackID) return -1;
+  return it->second;
 }
 
 //________________________________________________________________________
-Int_t AliCaloTrackMatcher::GetNMatchedTrackIDsForCluster(AliVEvent *event, Int_t clusterID, Float_t dR){
-  Int_t matched = 0;
-  multimap<Int_t,Int_t>::iterator it;
-  for (it=fMapClusterToTrack.begin(); it!=fMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) matched++;
-      }
-    }
+Bool_t AliCaloTrackMatcher::IsInPtDepWindow(PtDepWindow &window, const MatchResidual &match, TF1* fFuncPtDepEta, TF1* fFuncPtDepPhi){
+  // pt-dependent matching window, evaluated only once per match and pair of window functions,
+  // as cluster cuts usually ask several times in a row for the same cluster.
+  // The memo is keyed on the TF1 pointers and valid for the whole event: a window function
+  // whose parameters change within an event would get the outcome of its old parameters.
+  if(window.fFuncPtDepEta != fFuncPtDepEta || window.fFuncPtDepPhi != fFuncPtDepPhi){
+    Bool_t match_dEta = kFALSE;
+    Bool_t match_dPhi = kFALSE;
+    if( TMath::Abs(match.fDEta) < fFuncPtDepEta->Eval(match.fTrackPt)) match_dEta = kTRUE;
+    if( TMath::Abs(match.fDPhi) < fFuncPtDepPhi->Eval(match.fTrackPt)) match_dPhi = kTRUE;
+    window.fFuncPtDepEta  = fFuncPtDepEta;
+    window.fFuncPtDepPhi  = fFuncPtDepPhi;
+    window.fIsInWindow    = match_dEta && match_dPhi;
   }
-  return matched;
+  return window.fIsInWindow;
 }
 
 //________________________________________________________________________
-Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForTrack(AliVEvent *event, Int_t trackID, Float_t dEtaMax, Float_t dEtaMin, Float_t dPhiMax, Float_t dPhiMin){
+Int_t AliCaloTrackMatcher::GetMatchesForCluster(Int_t clusterID, const MatchResidual *&matches) const {
+  // all matches of the cluster stored in this event, without copying them
+  matches = NULL;
+  Int_t row = FindMatchIndexRow(fClusterIndexKeys,clusterID);
+  if(row < 0) return 0;
+  Int_t nMatches = fClusterIndexOffsets[row+1] - fClusterIndexOffsets[row];
+  if(nMatches > 0) matches = &fClusterIndexMatches[fClusterIndexOffsets[row]];
+  return nMatches;
+}
 
+//________________________________________________________________________
+Int_t AliCaloTrackMatcher::GetMatchesForTrack(AliVEvent *event, Int_t trackID, const MatchResidual *&matches){
+  // all matches of the track stored in this event, without copying them
+  matches = NULL;
   Int_t TrackPos = -1;
   if(event->IsA()==AliAODEvent::Class()){ // for AOD, we have to look for position of track in the event
-    for (Int_t iTrack = 0; iTrack < event->GetNumberOfTracks(); iTrack++){
-      AliVTrack* currTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(iTrack));
-      if(currTrack->GetID() == trackID){
-        TrackPos = iTrack;
-        break;
-      }
-    }
+    TrackPos = GetTrackPosition(event,trackID);
     if(TrackPos == -1) AliFatal(Form("AliCaloTrackMatcher: GetNMatchedClusterIDsForTrack - track (ID: '%i') cannot be retrieved from event, should be impossible as it has been used in maim task before!",trackID));
   }else TrackPos = trackID; // for ESD just take trackID
 
+  Int_t row = FindMatchIndexRow(fTrackIndexKeys,TrackPos);
+  if(row < 0) return 0;
+  Int_t nMatches = fTrackIndexOffsets[row+1] - fTrackIndexOffsets[row];
+  if(nMatches > 0) matches = &fTrackIndexMatches[fTrackIndexOffsets[row]];
+  return nMatches;
+}
+
+//________________________________________________________________________
+Int_t AliCaloTrackMatcher::MatchTracksToCluster(Int_t clusterID, Float_t dEtaMax, Float_t dEtaMin, Float_t dPhiMax, Float_t dPhiMin, vector<Int_t> *matchedTracks){
   Int_t matched = 0;
-  multimap<Int_t,Int_t>::iterator it;
-  AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
-  if(!tempTrack) return matched;
-  for (it=fMapTrackToCluster.begin(); it!=fMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        if(tempTrack->Charge()>0){
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) matched++;
-        }else if(tempTrack->Charge()<0){
-          dPhiMin*=-1;
-          dPhiMax*=-1;
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) matched++;
-        }
-      }
+  const MatchResidual *matches = NULL;
+  Int_t nMatches = GetMatchesForCluster(clusterID,matches);
+  for (Int_t i = 0; i < nMatches; i++){
+    Float_t tempDEta = matches[i].fDEta;
+    Float_t tempDPhi = matches[i].fDPhi;
+    Bool_t isMatched = kFALSE;
+    if(matches[i].fTrackCharge>0){
+      if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) isMatched = kTRUE;
+    }else if(matches[i].fTrackCharge<0){
+      dPhiMin*=-1;
+      dPhiMax*=-1;
+      if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) isMatched = kTRUE;
     }
+    if(!isMatched) continue;
+    matched++;
+    if(matchedTracks) matchedTracks->push_back(matches[i].fID);
   }
   return matched;
 }
 
 //________________________________________________________________________
-Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForTrack(AliVEvent *event, Int_t trackID, TF1* fFuncPtDepEta, TF1* fFuncPtDepPhi){
-  Int_t TrackPos = -1;
-  if(event->IsA()==AliAODEvent::Class()){ // for AOD, we have to look for position of track in the event
-    for (Int_t iTrack = 0; iTrack < event->GetNumberOfTracks(); iTrack++){
-      AliVTrack* currTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(iTrack));
-      if(currTrack->GetID() == trackID){
-        TrackPos = iTrack;
-        break;
-      }
-    }
-    if(TrackPos == -1) AliFatal(Form("AliCaloTrackMatcher: GetNMatchedClusterIDsForTrack - track (ID: '%i') cannot be retrieved from event, should be impossible as it has been used in maim task before!",trackID));
-  }else TrackPos = trackID; // for ESD just take trackID
-
+Int_t AliCaloTrackMatcher::MatchTracksToCluster(Int_t clusterID, TF1* fFuncPtDepEta, TF1* fFuncPtDepPhi, vector<Int_t> *matchedTracks){
   Int_t matched = 0;
-  multimap<Int_t,Int_t>::iterator it;
-  AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
-  if(!tempTrack) return matched;
-  for (it=fMapTrackToCluster.begin(); it!=fMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        Bool_t match_dEta = kFALSE;
-        Bool_t match_dPhi = kFALSE;
-        if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
-        else match_dEta = kFALSE;
-
-        if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
-        else match_dPhi = kFALSE;
-
-        if (match_dPhi && match_dEta )matched++;
+  const MatchResidual *matches = NULL;
+  Int_t nMatches = GetMatchesForCluster(clusterID,matches);
+  if(nMatches == 0) return matched;
+  PtDepWindow *windows = &fClusterIndexWindows[matches - &fClusterIndexMatches[0]];
+  for (Int_t i = 0; i < nMatches; i++){
+    if(!IsInPtDepWindow(windows[i],matches[i],fFuncPtDepEta,fFuncPtDepPhi)) continue;
+    matched++;
+    if(matchedTracks) matchedTracks->push_back(matches[i].fID);
+  }
+  return matched;
+}
 
-      }
+//________________________________________________________________________
+Int_t AliCaloTrackMatcher::MatchTracksToCluster(Int_t clusterID, Float_t dR, vector<Int_t> *matchedTracks){
+  Int_t matched = 0;
+  const MatchResidual *matches = NULL;
+  Int_t nMatches = GetMatchesForCluster(clusterID,matches);
+  for (Int_t i = 0; i < nMatches; i++){
+    if (TMath::Sqrt(matches[i].fDEta*matches[i].fDEta + matches[i].fDPhi*matches[i].fDPhi) < dR ){
+      matched++;
+      if(matchedTracks) matchedTracks->push_back(matches[i].fID);
     }
   }
   return matched;
 }
 
 //________________________________________________________________________
-Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForTrack(AliVEvent *event, Int_t trackID, Float_t dR){
-  Int_t TrackPos = -1;
-  if(event->IsA()==AliAODEvent::Class()){ // for AOD, we have to look for position of track in the event
-    for (Int_t iTrack = 0; iTrack < event->GetNumberOfTracks(); iTrack++){
-      AliVTrack* currTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(iTrack));
-      if(currTrack->GetID() == trackID){
-        TrackPos = iTrack;
-        break;
-      }
+Int_t AliCaloTrackMatcher::MatchClustersToTrack(AliVEvent *event, Int_t trackID, Float_t dEtaMax, Float_t dEtaMin, Float_t dPhiMax, Float_t dPhiMin, vector<Int_t> *matchedClusters){
+  Int_t matched = 0;
+  const MatchResidual *matches = NULL;
+  Int_t nMatches = GetMatchesForTrack(event,trackID,matches);
+  for (Int_t i = 0; i < nMatches; i++){
+    Float_t tempDEta = matches[i].fDEta;
+    Float_t tempDPhi = matches[i].fDPhi;
+    Bool_t isMatched = kFALSE;
+    if(matches[i].fTrackCharge>0){
+      if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) isMatched = kTRUE;
+    }else if(matches[i].fTrackCharge<0){
+      dPhiMin*=-1;
+      dPhiMax*=-1;
+      if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) isMatched = kTRUE;
     }
-    if(TrackPos == -1) AliFatal(Form("AliCaloTrackMatcher: GetNMatchedClusterIDsForTrack - track (ID: '%i') cannot be retrieved from event, should be impossible as it has been used in maim task before!",trackID));
-  }else TrackPos = trackID; // for ESD just take trackID
+    if(!isMatched) continue;
+    matched++;
+    if(matchedClusters) matchedClusters->push_back(matches[i].fID);
+  }
+  return matched;
+}
 
+//________________________________________________________________________
+Int_t AliCaloTrackMatcher::MatchClustersToTrack(AliVEvent *event, Int_t trackID, TF1* fFuncPtDepEta, TF1* fFuncPtDepPhi, vector<Int_t> *matchedClusters){
   Int_t matched = 0;
-  multimap<Int_t,Int_t>::iterator it;
-  AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
-  if(!tempTrack) return matched;
-  for (it=fMapTrackToCluster.begin(); it!=fMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) matched++;
-      }
+  const MatchResidual *matches = NULL;
+  Int_t nMatches = GetMatchesForTrack(event,trackID,matches);
+  if(nMatches == 0) return matched;
+  PtDepWindow *windows = &fTrackIndexWindows[matches - &fTrackIndexMatches[0]];
+  for (Int_t i = 0; i < nMatches; i++){
+    if(!IsInPtDepWindow(windows[i],matches[i],fFuncPtDepEta,fFuncPtDepPhi)) continue;
+    matched++;
+    if(matchedClusters) matchedClusters->push_back(matches[i].fID);
+  }
+  return matched;
+}
+
+//________________________________________________________________________
+Int_t AliCaloTrackMatcher::MatchClustersToTrack(AliVEvent *event, Int_t trackID, Float_t dR, vector<Int_t> *matchedClusters){
+  Int_t matched = 0;
+  const MatchResidual *matches = NULL;
+  Int_t nMatches = GetMatchesForTrack(event,trackID,matches);
+  for (Int_t i = 0; i < nMatches; i++){
+    if (TMath::Sqrt(matches[i].fDEta*matches[i].fDEta + matches[i].fDPhi*matches[i].fDPhi) < dR ){
+      matched++;
+      if(matchedClusters) matchedClusters->push_back(matches[i].fID);
     }
   }
   return matched;
 }
 
+//________________________________________________________________________
+Int_t AliCaloTrackMatcher::GetNMatchedTrackIDsForCluster(AliVEvent * /*event*/, Int_t clusterID, Float_t dEtaMax, Float_t dEtaMin, Float_t dPhiMax, Float_t dPhiMin){
+  return MatchTracksToCluster(clusterID,dEtaMax,dEtaMin,dPhiMax,dPhiMin,NULL);
+}
+
+//________________________________________________________________________
+Int_t AliCaloTrackMatcher::GetNMatchedTrackIDsForCluster(AliVEvent * /*event*/, Int_t clusterID, TF1* fFuncPtDepEta, TF1* fFuncPtDepPhi){
+  return MatchTracksToCluster(clusterID,fFuncPtDepEta,fFuncPtDepPhi,NULL);
+}
+
+//________________________________________________________________________
+Int_t AliCaloTrackMatcher::GetNMatchedTrackIDsForCluster(AliVEvent * /*event*/, Int_t clusterID, Float_t dR){
+  return MatchTracksToCluster(clusterID,dR,NULL);
+}
+
+//________________________________________________________________________
+Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForTrack(AliVEvent *event, Int_t trackID, Float_t dEtaMax, Float_t dEtaMin, Float_t dPhiMax, Float_t dPhiMin){
+  return MatchClustersToTrack(event,trackID,dEtaMax,dEtaMin,dPhiMax,dPhiMin,NULL);
+}
+
+//________________________________________________________________________
+Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForTrack(AliVEvent *event, Int_t trackID, TF1* fFuncPtDepEta, TF1* fFuncPtDepPhi){
+  return MatchClustersToTrack(event,trackID,fFuncPtDepEta,fFuncPtDepPhi,NULL);
+}
+
+//________________________________________________________________________
+Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForTrack(AliVEvent *event, Int_t trackID, Float_t dR){
+  return MatchClustersToTrack(event,trackID,dR,NULL);
+}
+
 //________________________________________________________________________
 vector<Int_t> AliCaloTrackMatcher::GetMatchedTrackIDsForCluster(AliVEvent *event, Int_t clusterID, Float_t dEtaMax, Float_t dEtaMin, Float_t dPhiMax, Float_t dPhiMin){
   vector<Int_t> tempMatchedTracks;
-  multimap<Int_t,Int_t>::iterator it;
-  for (it=fMapClusterToTrack.begin(); it!=fMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        if(tempTrack->Charge()>0){
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) tempMatchedTracks.push_back(it->second);
-        }else if(tempTrack->Charge()<0){
-          dPhiMin*=-1;
-          dPhiMax*=-1;
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) tempMatchedTracks.push_back(it->second);
-        }
-      }
-    }
-  }
+  GetMatchedTrackIDsForCluster(event,clusterID,dEtaMax,dEtaMin,dPhiMax,dPhiMin,tempMatchedTracks);
   return tempMatchedTracks;
 }
 
 //________________________________________________________________________
 vector<Int_t> AliCaloTrackMatcher::GetMatchedTrackIDsForCluster(AliVEvent *event, Int_t clusterID,  TF1* fFuncPtDepEta, TF1* fFuncPtDepPhi){
   vector<Int_t> tempMatchedTracks;
-  multimap<Int_t,Int_t>::iterator it;
-  for (it=fMapClusterToTrack.begin(); it!=fMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        Bool_t match_dEta = kFALSE;
-        Bool_t match_dPhi = kFALSE;
-        if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
-        else match_dEta = kFALSE;
-
-        if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
-        else match_dPhi = kFALSE;
-
-        if (match_dPhi && match_dEta )tempMatchedTracks.push_back(it->second);
-
-      }
-    }
-  }
+  GetMatchedTrackIDsForCluster(event,clusterID,fFuncPtDepEta,fFuncPtDepPhi,tempMatchedTracks);
   return tempMatchedTracks;
 }
 
 //________________________________________________________________________
 vector<Int_t> AliCaloTrackMatcher::GetMatchedTrackIDsForCluster(AliVEvent *event, Int_t clusterID,  Float_t dR){
   vector<Int_t> tempMatchedTracks;
-  multimap<Int_t,Int_t>::iterator it;
-  for (it=fMapClusterToTrack.begin(); it!=fMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) tempMatchedTracks.push_back(it->second);
-      }
-    }
-  }
+  GetMatchedTrackIDsForCluster(event,clusterID,dR,tempMatchedTracks);
   return tempMatchedTracks;
 }
 
 //________________________________________________________________________
 vector<Int_t> AliCaloTrackMatcher::GetMatchedClusterIDsForTrack(AliVEvent *event, Int_t trackID, Float_t dEtaMax, Float_t dEtaMin, Float_t dPhiMax, Float_t dPhiMin){
-  Int_t TrackPos = -1;
-  if(event->IsA()==AliAODEvent::Class()){ // for AOD, we have to look for position of track in the event
-    for (Int_t iTrack = 0; iTrack < event->GetNumberOfTracks(); iTrack++){
-      AliVTrack* currTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(iTrack));
-      if(currTrack->GetID() == trackID){
-        TrackPos = iTrack;
-        break;
-      }
-    }
-    if(TrackPos == -1) AliFatal(Form("AliCaloTrackMatcher: GetNMatchedClusterIDsForTrack - track (ID: '%i') cannot be retrieved from event, should be impossible as it has been used in maim task before!",trackID));
-  }else TrackPos = trackID; // for ESD just take trackID
-
   vector<Int_t> tempMatchedClusters;
-  multimap<Int_t,Int_t>::iterator it;
-  AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
-  if(!tempTrack) return tempMatchedClusters;
-  for (it=fMapTrackToCluster.begin(); it!=fMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        if(tempTrack->Charge()>0){
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) tempMatchedClusters.push_back(it->second);
-        }else if(tempTrack->Charge()<0){
-          dPhiMin*=-1;
-          dPhiMax*=-1;
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) tempMatchedClusters.push_back(it->second);
-        }
-      }
-    }
-  }
-
+  GetMatchedClusterIDsForTrack(event,trackID,dEtaMax,dEtaMin,dPhiMax,dPhiMin,tempMatchedClusters);
   return tempMatchedClusters;
 }
 
 //________________________________________________________________________
 vector<Int_t> AliCaloTrackMatcher::GetMatchedClusterIDsForTrack(AliVEvent *event, Int_t trackID, TF1* fFuncPtDepEta, TF1* fFuncPtDepPhi){
-  Int_t TrackPos = -1;
-  if(event->IsA()==AliAODEvent::Class()){ // for AOD, we have to look for position of track in the event
-    for (Int_t iTrack = 0; iTrack < event->GetNumberOfTracks(); iTrack++){
-      AliVTrack* currTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(iTrack));
-      if(currTrack->GetID() == trackID){
-        TrackPos = iTrack;
-        break;
-      }
-    }
-    if(TrackPos == -1) AliFatal(Form("AliCaloTrackMatcher: GetNMatchedClusterIDsForTrack - track (ID: '%i') cannot be retrieved from event, should be impossible as it has been used in maim task before!",trackID));
-  }else TrackPos = trackID; // for ESD just take trackID
-
   vector<Int_t> tempMatchedClusters;
-  multimap<Int_t,Int_t>::iterator it;
-  AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
-  if(!tempTrack) return tempMatchedClusters;
-  for (it=fMapTrackToCluster.begin(); it!=fMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        Bool_t match_dEta = kFALSE;
-        Bool_t match_dPhi = kFALSE;
-        if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
-        else match_dEta = kFALSE;
-
-        if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
-        else match_dPhi = kFALSE;
-
-        if (match_dPhi && match_dEta )tempMatchedClusters.push_back(it->second);
-      }
-    }
-  }
+  GetMatchedClusterIDsForTrack(event,trackID,fFuncPtDepEta,fFuncPtDepPhi,tempMatchedClusters);
   return tempMatchedClusters;
 }
 
 //________________________________________________________________________
 vector<Int_t> AliCaloTrackMatcher::GetMatchedClusterIDsForTrack(AliVEvent *event, Int_t trackID, Float_t dR){
-  Int_t TrackPos = -1;
-  if(event->IsA()==AliAODEvent::Class()){ // for AOD, we have to look for position of track in the event
-    for (Int_t iTrack = 0; iTrack < event->GetNumberOfTracks(); iTrack++){
-      AliVTrack* currTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(iTrack));
-      if(currTrack->GetID() == trackID){
-        TrackPos = iTrack;
-        break;
-      }
-    }
-    if(TrackPos == -1) AliFatal(Form("AliCaloTrackMatcher: GetNMatchedClusterIDsForTrack - track (ID: '%i') cannot be retrieved from event, should be impossible as it has been used in maim task before!",trackID));
-  }else TrackPos = trackID; // for ESD just take trackID
-
   vector<Int_t> tempMatchedClusters;
-  multimap<Int_t,Int_t>::iterator it;
-  AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
-  if(!tempTrack) return tempMatchedClusters;
-  for (it=fMapTrackToCluster.begin(); it!=fMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) tempMatchedClusters.push_back(it->second);
-      }
-    }
-  }
+  GetMatchedClusterIDsForTrack(event,trackID,dR,tempMatchedClusters);
   return tempMatchedClusters;
 }
 
+//________________________________________________________________________
+Int_t AliCaloTrackMatcher::GetMatchedTrackIDsForCluster(AliVEvent * /*event*/, Int_t clusterID, Float_t dEtaMax, Float_t dEtaMin, Float_t dPhiMax, Float_t dPhiMin, vector<Int_t> &matchedTracks){
+  matchedTracks.clear();
+  return MatchTracksToCluster(clusterID,dEtaMax,dEtaMin,dPhiMax,dPhiMin,&matchedTracks);
+}
+
+//________________________________________________________________________
+Int_t AliCaloTrackMatcher::GetMatchedTrackIDsForCluster(AliVEvent * /*event*/, Int_t clusterID, TF1* fFuncPtDepEta, TF1* fFuncPtDepPhi, vector<Int_t> &matchedTracks){
+  matchedTracks.clear();
+  return MatchTracksToCluster(clusterID,fFuncPtDepEta,fFuncPtDepPhi,&matchedTracks);
+}
+
+//________________________________________________________________________
+Int_t AliCaloTrackMatcher::GetMatchedTrackIDsForCluster(AliVEvent * /*event*/, Int_t clusterID, Float_t dR, vector<Int_t> &matchedTracks){
+  matchedTracks.clear();
+  return MatchTracksToCluster(clusterID,dR,&matchedTracks);
+}
+
+//________________________________________________________________________
+Int_t AliCaloTrackMatcher::GetMatchedClusterIDsForTrack(AliVEvent *event, Int_t trackID, Float_t dEtaMax, Float_t dEtaMin, Float_t dPhiMax, Float_t dPhiMin, vector<Int_t> &matchedClusters){
+  matchedClusters.clear();
+  return MatchClustersToTrack(event,trackID,dEtaMax,dEtaMin,dPhiMax,dPhiMin,&matchedClusters);
+}
+
+//________________________________________________________________________
+Int_t AliCaloTrackMatcher::GetMatchedClusterIDsForTrack(AliVEvent *event, Int_t trackID, TF1* fFuncPtDepEta, TF1* fFuncPtDepPhi, vector<Int_t> &matchedClusters){
+  matchedClusters.clear();
+  return MatchClustersToTrack(event,trackID,fFuncPtDepEta,fFuncPtDepPhi,&matchedClusters);
+}
+
+//________________________________________________________________________
+Int_t AliCaloTrackMatcher::GetMatchedClusterIDsForTrack(AliVEvent *event, Int_t trackID, Float_t dR, vector<Int_t> &matchedClusters){
+  matchedClusters.clear();
+  return MatchClustersToTrack(event,trackID,dR,&matchedClusters);
+}
+
 //________________________________________________________________________
 //________________________________________________________________________
 //________________________________________________________________________
@@ -1154,13 +1198,7 @@ Int_t AliCaloTrackMatcher::GetNMatchedSecTrackIDsForCluster(AliVEvent *event, In
 Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForSecTrack(AliVEvent *event, Int_t trackID, Float_t dEtaMax, Float_t dEtaMin, Float_t dPhiMax, Float_t dPhiMin){
   Int_t TrackPos = -1;
   if(event->IsA()==AliAODEvent::Class()){ // for AOD, we have to look for position of track in the event
-    for (Int_t iTrack = 0; iTrack < event->GetNumberOfTracks(); iTrack++){
-      AliVTrack* currTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(iTrack));
-      if(currTrack->GetID() == trackID){
-        TrackPos = iTrack;
-        break;
-      }
-    }
+    TrackPos = GetTrackPosition(event,trackID);
     if(TrackPos == -1) AliFatal(Form("AliCaloTrackMatcher: GetNMatchedClusterIDsForTrack - track (ID: '%i') cannot be retrieved from event, should be impossible as it has been used in maim task before!",trackID));
   }else TrackPos = trackID; // for ESD just take trackID
 
@@ -1190,13 +1228,7 @@ Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForSecTrack(AliVEvent *event, In
 Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForSecTrack(AliVEvent *event, Int_t trackID, TF1* fFuncPtDepEta, TF1* fFuncPtDepPhi){
   Int_t TrackPos = -1;
   if(event->IsA()==AliAODEvent::Class()){ // for AOD, we have to look for position of track in the event
-    for (Int_t iTrack = 0; iTrack < event->GetNumberOfTracks(); iTrack++){
-      AliVTrack* currTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(iTrack));
-      if(currTrack->GetID() == trackID){
-        TrackPos = iTrack;
-        break;
-      }
-    }
+    TrackPos = GetTrackPosition(event,trackID);
     if(TrackPos == -1) AliFatal(Form("AliCaloTrackMatcher: GetNMatchedClusterIDsForTrack - track (ID: '%i') cannot be retrieved from event, should be impossible as it has been used in maim task before!",trackID));
   }else TrackPos = trackID; // for ESD just take trackID
 
@@ -1229,13 +1261,7 @@ Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForSecTrack(AliVEvent *event, In
 Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForSecTrack(AliVEvent *event, Int_t trackID, Float_t dR){
   Int_t TrackPos = -1;
   if(event->IsA()==AliAODEvent::Class()){ // for AOD, we have to look for position of track in the event
-    for (Int_t iTrack = 0; iTrack < event->GetNumberOfTracks(); iTrack++){
-      AliVTrack* currTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(iTrack));
-      if(currTrack->GetID() == trackID){
-        TrackPos = iTrack;
-        break;
-      }
-    }
+    TrackPos = GetTrackPosition(event,trackID);
     if(TrackPos == -1) AliFatal(Form("AliCaloTrackMatcher: GetNMatchedClusterIDsForTrack - track (ID: '%i') cannot be retrieved from event, should be impossible as it has been used in maim task before!",trackID));
   }else TrackPos = trackID; // for ESD just take trackID
 
@@ -1327,13 +1353,7 @@ vector<Int_t> AliCaloTrackMatcher::GetMatchedSecTrackIDsForCluster(AliVEvent *ev
 vector<Int_t> AliCaloTrackMatcher::GetMatchedClusterIDsForSecTrack(AliVEvent *event, Int_t trackID, Float_t dEtaMax, Float_t dEtaMin, Float_t dPhiMax, Float_t dPhiMin){
   Int_t TrackPos = -1;
   if(event->IsA()==AliAODEvent::Class()){ // for AOD, we have to look for position of track in the event
-    for (Int_t iTrack = 0; iTrack < event->GetNumberOfTracks(); iTrack++){
-      AliVTrack* currTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(iTrack));
-      if(currTrack->GetID() == trackID){
-        TrackPos = iTrack;
-        break;
-      }
-    }
+    TrackPos = GetTrackPosition(event,trackID);
     if(TrackPos == -1) AliFatal(Form("AliCaloTrackMatcher: GetNMatchedClusterIDsForTrack - track (ID: '%i') cannot be retrieved from event, should be impossible as it has been used in maim task before!",trackID));
   }else TrackPos = trackID; // for ESD just take trackID
 
@@ -1363,13 +1383,7 @@ vector<Int_t> AliCaloTrackMatcher::GetMatchedClusterIDsForSecTrack(AliVEvent *ev
 vector<Int_t> AliCaloTrackMatcher::GetMatchedClusterIDsForSecTrack(AliVEvent *event, Int_t trackID, TF1* fFuncPtDepEta, TF1* fFuncPtDepPhi){
   Int_t TrackPos = -1;
   if(event->IsA()==AliAODEvent::Class()){ // for AOD, we have to look for position of track in the event
-    for (Int_t iTrack = 0; iTrack < event->GetNumberOfTracks(); iTrack++){
-      AliVTrack* currTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(iTrack));
-      if(currTrack->GetID() == trackID){
-        TrackPos = iTrack;
-        break;
-      }
-    }
+    TrackPos = GetTrackPosition(event,trackID);
     if(TrackPos == -1) AliFatal(Form("AliCaloTrackMatcher: GetNMatchedClusterIDsForTrack - track (ID: '%i') cannot be retrieved from event, should be impossible as it has been used in maim task before!",trackID));
   }else TrackPos = trackID; // for ESD just take trackID
 
@@ -1401,13 +1415,7 @@ vector<Int_t> AliCaloTrackMatcher::GetMatchedClusterIDsForSecTrack(AliVEvent *ev
 vector<Int_t> AliCaloTrackMatcher::GetMatchedClusterIDsForSecTrack(AliVEvent *event, Int_t trackID, Float_t dR){
   Int_t TrackPos = -1;
   if(event->IsA()==AliAODEvent::Class()){ // for AOD, we have to look for position of track in the event
-    for (Int_t iTrack = 0; iTrack < event->GetNumberOfTracks(); iTrack++){
-      AliVTrack* currTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(iTrack));
-      if(currTrack->GetID() == trackID){
-        TrackPos = iTrack;
-        break;
-      }
-    }
+    TrackPos = GetTrackPosition(event,trackID);
     if(TrackPos == -1) AliFatal(Form("AliCaloTrackMatcher: GetNMatchedClusterIDsForTrack - track (ID: '%i') cannot be retrieved from event, should be impossible as it has been used in maim task before!",trackID));
   }else TrackPos = trackID; // for ESD just take trackID
 
@@ -1430,12 +1438,14 @@ vector<Int_t> AliCaloTrackMatcher::GetMatchedClusterIDsForSecTrack(AliVEvent *ev
 //________________________________________________________________________
 Float_t AliCaloTrackMatcher::SumTrackEtAroundCluster(AliVEvent* event, Int_t clusterID, Float_t dR){
   Float_t sumTrackEt = 0.;
-  vector<Int_t> labelsMatched = GetMatchedTrackIDsForCluster(event, clusterID, dR);
-  if((Int_t) labelsMatched.size()<1) return sumTrackEt;
+  const MatchResidual *matches = NULL;
+  Int_t nMatches = GetMatchesForCluster(clusterID, matches);
+  if(nMatches<1) return sumTrackEt;
 
   TLorentzVector vecTrack;
-  for (UInt_t i = 0; i < labelsMatched.size(); i++){
-    AliVTrack* currTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(labelsMatched.at(i)));
+  for (Int_t i = 0; i < nMatches; i++){
+    if (!(TMath::Sqrt(matches[i].fDEta*matches[i].fDEta + matches[i].fDPhi*matches[i].fDPhi) < dR)) continue;
+    AliVTrack* currTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(matches[i].fID));
     if(!currTrack) continue;
     vecTrack.SetPxPyPzE(currTrack->Px(),currTrack->Py(),currTrack->Pz(),currTrack->E());
     sumTrackEt += vecTrack.Et();
@@ -32,9 +32,24 @@ class AliCaloTrackMatcher : public AliAnalysisTaskSE {
     void SetMatchingResidual(Float_t res) {fMatchingResidual = res; return;}
     void SetMatchingWindow(Float_t win) {fMatchingWindow = win; return;}
 
+    // residuals of a stored track <-> cluster association, as seen from the cluster or from the track
+    struct MatchResidual {
+      Int_t     fID;                               // matched track (position in event for AOD, ID for ESD) or matched cluster ID
+      Float_t   fDEta;                             // dEta residual
+      Float_t   fDPhi;                             // dPhi residual
+      Double_t  fTrackPt;                          // pT of the track
+      Short_t   fTrackCharge;                      // charge of the track
+    };
+
     // for cluster <-> primary matching
     Bool_t GetTrackClusterMatchingResidual(Int_t trackID, Int_t clusterID, Float_t &dEta, Float_t &dPhi);
 
+    // all stored matches of a cluster/track in the current event, valid until the next event
+    Int_t GetMatchesForCluster(Int_t clusterID, const MatchResidual *&matches) const;
+    Int_t GetMatchesForTrack(AliVEvent *event, Int_t trackID, const MatchResidual *&matches);
+
+    // The outcome of the pt-dependent windows (TF1 arguments) is memorized per match for the whole event, keyed on
+    // the TF1 pointers: the window functions must not be changed (e.g. SetParameters) while an event is processed.
     Int_t GetNMatchedTrackIDsForCluster(AliVEvent *event, Int_t clusterID, Float_t dEtaMax, Float_t dEtaMin, Float_t dPhiMax, Float_t dPhiMin);
     Int_t GetNMatchedTrackIDsForCluster(AliVEvent *event, Int_t clusterID, TF1* fFuncPtDepEta, TF1* fFuncPtDepPhi);
     Int_t GetNMatchedTrackIDsForCluster(AliVEvent *event, Int_t clusterID, Float_t dR);
@@ -50,7 +65,16 @@ class AliCaloTrackMatcher : public AliAnalysisTaskSE {
     vector<Int_t> GetMatchedClusterIDsForTrack(AliVEvent *event, Int_t trackID, TF1* fFuncPtDepEta, TF1* fFuncPtDepPhi);
     vector<Int_t> GetMatchedClusterIDsForTrack(AliVEvent *event, Int_t trackID, Float_t dEtaMax, Float_t dEtaMin, Float_t dPhiMax, Float_t dPhiMin);
     vector<Int_t> GetMatchedClusterIDsForTrack(AliVEvent *event, Int_t trackID, Float_t dR);
-    
+
+    // same as above, filling a vector owned by the caller which can be reused for all queries
+    Int_t GetMatchedTrackIDsForCluster(AliVEvent *event, Int_t clusterID, Float_t dEtaMax, Float_t dEtaMin, Float_t dPhiMax, Float_t dPhiMin, vector<Int_t> &matchedTracks);
+    Int_t GetMatchedTrackIDsForCluster(AliVEvent *event, Int_t clusterID, TF1* fFuncPtDepEta, TF1* fFuncPtDepPhi, vector<Int_t> &matchedTracks);
+    Int_t GetMatchedTrackIDsForCluster(AliVEvent *event, Int_t clusterID, Float_t dR, vector<Int_t> &matchedTracks);
+
+    Int_t GetMatchedClusterIDsForTrack(AliVEvent *event, Int_t trackID, Float_t dEtaMax, Float_t dEtaMin, Float_t dPhiMax, Float_t dPhiMin, vector<Int_t> &matchedClusters);
+    Int_t GetMatchedClusterIDsForTrack(AliVEvent *event, Int_t trackID, TF1* fFuncPtDepEta, TF1* fFuncPtDepPhi, vector<Int_t> &matchedClusters);
+    Int_t GetMatchedClusterIDsForTrack(AliVEvent *event, Int_t trackID, Float_t dR, vector<Int_t> &matchedClusters);
+
     // for cluster <-> V0-track matching
     Bool_t PropagateV0TrackToClusterAndGetMatchingResidual(AliVTrack* inSecTrack, AliVCluster* cluster, AliVEvent* event, Float_t &dEta, Float_t &dPhi);
     Bool_t IsSecTrackClusterAlreadyTried(Int_t trackID, Int_t clusterID);
@@ -81,6 +105,15 @@ class AliCaloTrackMatcher : public AliAnalysisTaskSE {
     typedef pair<Float_t, Float_t> pairFloat;
     typedef map<pairInt, Int_t> mapT;
 
+    // outcome of the last pt-dependent window checked for a match, kept until the next event and
+    // identified only by the TF1 pointers, not by their parameters
+    struct PtDepWindow {
+      PtDepWindow() : fFuncPtDepEta(NULL), fFuncPtDepPhi(NULL), fIsInWindow(kFALSE) {}
+      TF1*      fFuncPtDepEta;                     // dEta window function
+      TF1*      fFuncPtDepPhi;                     // dPhi window function
+      Bool_t    fIsInWindow;                       // match inside the window
+    };
+
     AliCaloTrackMatcher (const AliCaloTrackMatcher&); // not implemented
     AliCaloTrackMatcher & operator=(const AliCaloTrackMatcher&); // not implemented
 
@@ -88,6 +121,17 @@ class AliCaloTrackMatcher : public AliAnalysisTaskSE {
     void Initialize(Int_t runNumber);
     void ProcessEvent(AliVEvent *event);
     void SetLogBinningYTH2(TH2* histoRebin);
+    void BuildMatchIndex(AliVEvent *event);
+    Int_t FindMatchIndexRow(const vector<Int_t> &keys, Int_t key) const;
+    Int_t GetTrackPosition(AliVEvent *event, Int_t trackID);
+    Bool_t IsInPtDepWindow(PtDepWindow &window, const MatchResidual &match, TF1* fFuncPtDepEta, TF1* fFuncPtDepPhi);
+
+    Int_t MatchTracksToCluster(Int_t clusterID, Float_t dEtaMax, Float_t dEtaMin, Float_t dPhiMax, Float_t dPhiMin, vector<Int_t> *matchedTracks);
+    Int_t MatchTracksToCluster(Int_t clusterID, TF1* fFuncPtDepEta, TF1* fFuncPtDepPhi, vector<Int_t> *matchedTracks);
+    Int_t MatchTracksToCluster(Int_t clusterID, Float_t dR, vector<Int_t> *matchedTracks);
+    Int_t MatchClustersToTrack(AliVEvent *event, Int_t trackID, Float_t dEtaMax, Float_t dEtaMin, Float_t dPhiMax, Float_t dPhiMin, vector<Int_t> *matchedClusters);
+    Int_t MatchClustersToTrack(AliVEvent *event, Int_t trackID, TF1* fFuncPtDepEta, TF1* fFuncPtDepPhi, vector<Int_t> *matchedClusters);
+    Int_t MatchClustersToTrack(AliVEvent *event, Int_t trackID, Float_t dR, vector<Int_t> *matchedClusters);
 
     // debug methods
     void DebugMatching();
@@ -118,6 +162,18 @@ class AliCaloTrackMatcher : public AliAnalysisTaskSE {
     vector<pairFloat>     fVectorDeltaEtaDeltaPhi; // vector of all matching residuals for a specific TrackID/ClusterID
     mapT                  fMap_TrID_ClID_ToIndex;  // map tuple of (trackID,clusterID) to index in vector fVectorDeltaEtaDeltaPhi
 
+    // compressed (CSR) index of the above matches, built once per event after the matching
+    vector<Int_t>         fClusterIndexKeys;       //! sorted cluster IDs with at least one match
+    vector<Int_t>         fClusterIndexOffsets;    //! first entry in fClusterIndexMatches for each cluster, plus end
+    vector<MatchResidual> fClusterIndexMatches;    //! matched tracks with residuals, grouped by cluster
+    vector<PtDepWindow>   fClusterIndexWindows;    //! last pt-dependent window checked for each entry of fClusterIndexMatches
+    vector<Int_t>         fTrackIndexKeys;         //! sorted track keys (position in event for AOD, ID for ESD) with at least one match
+    vector<Int_t>         fTrackIndexOffsets;      //! first entry in fTrackIndexMatches for each track, plus end
+    vector<MatchResidual> fTrackIndexMatches;      //! matched clusters with residuals, grouped by track
+    vector<PtDepWindow>   fTrackIndexWindows;      //! last pt-dependent window checked for each entry of fTrackIndexMatches
+    AliVEvent*            fTrackPositionEvent;     //! event for which fTrackPositions is filled
+    vector<pairInt>       fTrackPositions;         //! sorted (track ID, position in event) of the AOD tracks
+
     // for cluster <-> V0-track matching (running with different mass hypthesis)
     multimap<Int_t,Int_t> fSecMapTrackToCluster;      // connects a given secondary track ID with all associated cluster IDs
     multimap<Int_t,Int_t> fSecMapClusterToTrack;      // connects a given cluster ID with all associated secondary track IDs
@@ -132,7 +188,7 @@ class AliCaloTrackMatcher : public AliAnalysisTaskSE {
     TH2F*                 fHistControlMatches;     // bookkeeping for processed tracks/clusters and succesful matches
     TH2F*                 fSecHistControlMatches;  // bookkeeping for processed V0-tracks/clusters and succesful matches
 
-    ClassDef(AliCaloTrackMatcher,5)
+    ClassDef(AliCaloTrackMatcher,6)
 };
 
 #endif
@@ -21,6 +21,7 @@
 ////////////////////////////////////////////////
 
 #include "AliConversionPhotonCuts.h"
+#include "AliConversionTrackPIDCache.h"
 
 #include "AliKFVertex.h"
 #include "AliAODTrack.h"
@@ -228,7 +229,9 @@ AliConversionPhotonCuts::AliConversionPhotonCuts(const char *name,const char *ti
   fHistoEleMapMean(NULL),
   fHistoEleMapWidth(NULL),
   fHistoPosMapMean(NULL),
-  fHistoPosMapWidth(NULL)
+  fHistoPosMapWidth(NULL),
+  fUseSharedPIDCache(kTRUE),
+  fPIDCache(NULL)
 {
   InitPIDResponse();
   for(Int_t jj=0;jj<kNCuts;jj++){fCuts[jj]=0;}
@@ -384,7 +387,9 @@ AliConversionPhotonCuts::AliConversionPhotonCuts(const AliConversionPhotonCuts &
   fHistoEleMapMean(ref.fHistoEleMapMean),
   fHistoEleMapWidth(ref.fHistoEleMapWidth),
   fHistoPosMapMean(ref.fHistoPosMapMean),
-  fHistoPosMapWidth(ref.fHistoPosMapWidth)
+  fHistoPosMapWidth(ref.fHistoPosMapWidth),
+  fUseSharedPIDCache(ref.fUseSharedPIDCache),
+  fPIDCache(NULL)
 {
   // Copy Constructor
   for(Int_t jj=0;jj<kNCuts;jj++){fCuts[jj]=ref.fCuts[jj];}
@@ -688,6 +693,26 @@ Bool_t AliConversionPhotonCuts::InitPIDResponse(){
 
   return kFALSE;
 }
+
+//________________________________________________________________________
+void AliConversionPhotonCuts::UsePIDCacheOfEvent(AliVEvent *event){
+  // Look up the PID cache of the event and reset it if the event is new.
+  // Called once per event by the V0 reader, before the photon cuts of the tasks
+  // take the cache with ResolvePIDCache()
+
+  if(!fPIDResponse) InitPIDResponse();
+  AliConversionTrackPIDCache *cache = AliConversionTrackPIDCache::GetCache(event, fPIDResponse);
+  fPIDCache = fUseSharedPIDCache ? cache : NULL;
+}
+
+//________________________________________________________________________
+void AliConversionPhotonCuts::ResolvePIDCache(AliVEvent *event){
+  // Take the n-sigma of the tracks from the PID cache of the event, which is
+  // shared with the other photon cuts, instead of asking the PID response each time.
+  // Without a cache looked up by the V0 reader for this event, the PID response is used.
+
+  fPIDCache = fUseSharedPIDCache ? AliConversionTrackPIDCache::GetCurrentCache(event, fPIDResponse) : NULL;
+}
 ///________________________________________________________________________
 Bool_t AliConversionPhotonCuts::InitializeElecDeDxPostCalibration(TString filename) {
 
@@ -1183,6 +1208,7 @@ Bool_t AliConversionPhotonCuts::PhotonIsSelected(AliConversionPhotonBase *photon
   //Selection of Reconstructed Photons
 
   FillPhotonCutIndex(kPhotonIn);
+  ResolvePIDCache(event);
 
   if(event->IsA()==AliESDEvent::Class()) {
     if(!SelectV0Finder( ( ((AliESDEvent*)event)->GetV0(photon->GetV0Index()))->GetOnFlyStatus() ) ){
@@ -1472,6 +1498,8 @@ Float_t AliConversionPhotonCuts::GetKappaTPC(AliConversionPhotonBase *gamma, Ali
   if(!fPIDResponse){InitPIDResponse();}// Try to reinitialize PID Response
   if(!fPIDResponse){AliError("No PID Response"); return kTRUE;}// if still missing fatal error
 
+  ResolvePIDCache(event);
+
   AliVTrack * negTrack = GetTrack(event, gamma->GetTrackLabelNegative());
   AliVTrack * posTrack = GetTrack(event, gamma->GetTrackLabelPositive());
 
@@ -1482,8 +1510,8 @@ Float_t AliConversionPhotonCuts::GetKappaTPC(AliConversionPhotonBase *gamma, Ali
 
   Float_t KappaPlus, KappaMinus, Kappa;
   if(fDoElecDeDxPostCalibration && fElecDeDxPostCalibrationInitialized){
-    CentrnSig[0]=fPIDResponse->NumberOfSigmasTPC(negTrack,AliPID::kElectron);
-    CentrnSig[1]=fPIDResponse->NumberOfSigmasTPC(posTrack,AliPID::kElectron);
+    CentrnSig[0]=NumberOfSigmasTPC(negTrack,AliPID::kElectron);
+    CentrnSig[1]=NumberOfSigmasTPC(posTrack,AliPID::kElectron);
     P[0]        =negTrack->P();
     P[1]        =posTrack->P();
     Eta[0]      =negTrack->Eta();
@@ -1492,8 +1520,8 @@ Float_t AliConversionPhotonCuts::GetKappaTPC(AliConversionPhotonBase *gamma, Ali
     KappaMinus = GetCorrectedElectronTPCResponse(negTrack->Charge(),CentrnSig[0],P[0],Eta[0],R);
     KappaPlus =  GetCorrectedElectronTPCResponse(posTrack->Charge(),CentrnSig[1],P[1],Eta[1],R);
   }else{
-    KappaMinus = fPIDResponse->NumberOfSigmasTPC(negTrack, AliPID::kElectron);
-    KappaPlus =  fPIDResponse->NumberOfSigmasTPC(posTrack, AliPID::kElectron);
+    KappaMinus = NumberOfSigmasTPC(negTrack, AliPID::kElectron);
+    KappaPlus =  NumberOfSigmasTPC(posTrack, AliPID::kElectron);
   }
   Kappa = ( TMath::Abs(KappaMinus) + TMath::Abs(KappaPlus) ) / 2.0 + 2.0*(KappaMinus+KappaPlus);
 
@@ -1509,9 +1537,10 @@ Bool_t AliConversionPhotonCuts::dEdxCuts(AliVTrack *fCurrentTrack,AliConversionP
 
   if(!fPIDResponse){InitPIDResponse();}// Try to reinitialize PID Response
   if(!fPIDResponse){AliError("No PID Response"); return kTRUE;}// if still missing fatal error
+  // fPIDCache was taken for the current event by the caller, PhotonIsSelected() or the V0 reader
 
   Short_t Charge    = fCurrentTrack->Charge();
-  Double_t electronNSigmaTPC = fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kElectron);
+  Double_t electronNSigmaTPC = NumberOfSigmasTPC(fCurrentTrack,AliPID::kElectron);
   Double_t electronNSigmaTPCCor=0.; 
   Double_t P=0.;         
   Double_t Eta=0.;    
@@ -1548,14 +1577,14 @@ Bool_t AliConversionPhotonCuts::dEdxCuts(AliVTrack *fCurrentTrack,AliConversionP
     if( fCurrentTrack->P()>fPIDMinPnSigmaAbovePionLine && fCurrentTrack->P()<fPIDMaxPnSigmaAbovePionLine ){
       if(fDoElecDeDxPostCalibration && fElecDeDxPostCalibrationInitialized){
 	if( electronNSigmaTPCCor >fPIDnSigmaBelowElectronLine && electronNSigmaTPCCor < fPIDnSigmaAboveElectronLine&&
-	    fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kPion)<fPIDnSigmaAbovePionLine){
+	    NumberOfSigmasTPC(fCurrentTrack,AliPID::kPion)<fPIDnSigmaAbovePionLine){
 	  if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
 	  return kFALSE;
 	}
       } else{
 	if( electronNSigmaTPC > fPIDnSigmaBelowElectronLine &&
 	    electronNSigmaTPC < fPIDnSigmaAboveElectronLine&&
-	   fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kPion)<fPIDnSigmaAbovePionLine){
+	   NumberOfSigmasTPC(fCurrentTrack,AliPID::kPion)<fPIDnSigmaAbovePionLine){
 	  if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
 	  return kFALSE;
 	}
@@ -1568,14 +1597,14 @@ Bool_t AliConversionPhotonCuts::dEdxCuts(AliVTrack *fCurrentTrack,AliConversionP
       if(fDoElecDeDxPostCalibration && fElecDeDxPostCalibrationInitialized){
 	if( electronNSigmaTPCCor > fPIDnSigmaBelowElectronLine &&
 	    electronNSigmaTPCCor < fPIDnSigmaAboveElectronLine &&
-	    fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kPion)<fPIDnSigmaAbovePionLineHighPt){
+	    NumberOfSigmasTPC(fCurrentTrack,AliPID::kPion)<fPIDnSigmaAbovePionLineHighPt){
 	  if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
 	  return kFALSE;
 	}
       } else{
 	if( electronNSigmaTPC > fPIDnSigmaBelowElectronLine &&
 	    electronNSigmaTPC < fPIDnSigmaAboveElectronLine &&
-	   fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kPion)<fPIDnSigmaAbovePionLineHighPt){
+	   NumberOfSigmasTPC(fCurrentTrack,AliPID::kPion)<fPIDnSigmaAbovePionLineHighPt){
 	  if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
 	  return kFALSE;
 	}
@@ -1587,7 +1616,7 @@ Bool_t AliConversionPhotonCuts::dEdxCuts(AliVTrack *fCurrentTrack,AliConversionP
 
   if(fDoKaonRejectionLowP == kTRUE && !fSwitchToKappa){
     if(fCurrentTrack->P()<fPIDMinPKaonRejectionLowP ){
-      if( TMath::Abs(fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kKaon))<fPIDnSigmaAtLowPAroundKaonLine){
+      if( TMath::Abs(NumberOfSigmasTPC(fCurrentTrack,AliPID::kKaon))<fPIDnSigmaAtLowPAroundKaonLine){
 	if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
 	return kFALSE;
       }
@@ -1597,7 +1626,7 @@ Bool_t AliConversionPhotonCuts::dEdxCuts(AliVTrack *fCurrentTrack,AliConversionP
 
   if(fDoProtonRejectionLowP == kTRUE && !fSwitchToKappa){
     if( fCurrentTrack->P()<fPIDMinPProtonRejectionLowP ){
-      if( TMath::Abs(fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kProton))<fPIDnSigmaAtLowPAroundProtonLine){
+      if( TMath::Abs(NumberOfSigmasTPC(fCurrentTrack,AliPID::kProton))<fPIDnSigmaAtLowPAroundProtonLine){
 	if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
 	return kFALSE;
       }
@@ -1607,7 +1636,7 @@ Bool_t AliConversionPhotonCuts::dEdxCuts(AliVTrack *fCurrentTrack,AliConversionP
 
   if(fDoPionRejectionLowP == kTRUE && !fSwitchToKappa){
     if( fCurrentTrack->P()<fPIDMinPPionRejectionLowP ){
-      if( TMath::Abs(fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kPion))<fPIDnSigmaAtLowPAroundPionLine){
+      if( TMath::Abs(NumberOfSigmasTPC(fCurrentTrack,AliPID::kPion))<fPIDnSigmaAtLowPAroundPionLine){
 	if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
 	return kFALSE;
       }
@@ -1638,29 +1667,29 @@ Bool_t AliConversionPhotonCuts::dEdxCuts(AliVTrack *fCurrentTrack,AliConversionP
        Double_t dT = TOFsignal - t0 - times[0];
        fHistoTOFbefore->Fill(fCurrentTrack->P(),dT);
      }
-     if(fHistoTOFSigbefore) fHistoTOFSigbefore->Fill(fCurrentTrack->P(),fPIDResponse->NumberOfSigmasTOF(fCurrentTrack, AliPID::kElectron));
+     if(fHistoTOFSigbefore) fHistoTOFSigbefore->Fill(fCurrentTrack->P(),NumberOfSigmasTOF(fCurrentTrack, AliPID::kElectron));
      if(fUseTOFpid){
-       if(fPIDResponse->NumberOfSigmasTOF(fCurrentTrack, AliPID::kElectron)>fTofPIDnSigmaAboveElectronLine ||
-	  fPIDResponse->NumberOfSigmasTOF(fCurrentTrack, AliPID::kElectron)<fTofPIDnSigmaBelowElectronLine ){
+       if(NumberOfSigmasTOF(fCurrentTrack, AliPID::kElectron)>fTofPIDnSigmaAboveElectronLine ||
+	  NumberOfSigmasTOF(fCurrentTrack, AliPID::kElectron)<fTofPIDnSigmaBelowElectronLine ){
 	 if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
          return kFALSE;
        }
      }
-     if(fHistoTOFSigafter)fHistoTOFSigafter->Fill(fCurrentTrack->P(),fPIDResponse->NumberOfSigmasTOF(fCurrentTrack, AliPID::kElectron));
+     if(fHistoTOFSigafter)fHistoTOFSigafter->Fill(fCurrentTrack->P(),NumberOfSigmasTOF(fCurrentTrack, AliPID::kElectron));
    }
    cutIndex++;
 
    if((fCurrentTrack->GetStatus() & AliESDtrack::kITSpid)){
-     if(fHistoITSSigbefore) fHistoITSSigbefore->Fill(fCurrentTrack->P(),fPIDResponse->NumberOfSigmasITS(fCurrentTrack, AliPID::kElectron));
+     if(fHistoITSSigbefore) fHistoITSSigbefore->Fill(fCurrentTrack->P(),NumberOfSigmasITS(fCurrentTrack, AliPID::kElectron));
      if(fUseITSpid){
        if(fCurrentTrack->Pt()<=fMaxPtPIDITS){
-         if(fPIDResponse->NumberOfSigmasITS(fCurrentTrack, AliPID::kElectron)>fITSPIDnSigmaAboveElectronLine || fPIDResponse->NumberOfSigmasITS(fCurrentTrack, AliPID::kElectron)<fITSPIDnSigmaBelowElectronLine ){
+         if(NumberOfSigmasITS(fCurrentTrack, AliPID::kElectron)>fITSPIDnSigmaAboveElectronLine || NumberOfSigmasITS(fCurrentTrack, AliPID::kElectron)<fITSPIDnSigmaBelowElectronLine ){
 	   if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
            return kFALSE;
          }
        }
      }
-     if(fHistoITSSigafter)fHistoITSSigafter->Fill(fCurrentTrack->P(),fPIDResponse->NumberOfSigmasITS(fCurrentTrack, AliPID::kElectron));
+     if(fHistoITSSigafter)fHistoITSSigafter->Fill(fCurrentTrack->P(),NumberOfSigmasITS(fCurrentTrack, AliPID::kElectron));
    }
 
    cutIndex++;
@@ -1685,6 +1714,27 @@ Bool_t AliConversionPhotonCuts::dEdxCuts(AliVTrack *fCurrentTrack,AliConversionP
    return kTRUE;
 }
 
+///________________________________________________________________________
+Float_t AliConversionPhotonCuts::NumberOfSigmasTPC(AliVTrack *track, AliPID::EParticleType type){
+  // TPC n-sigma of the track, from the PID cache of the event if available
+  if(fPIDCache) return fPIDCache->NumberOfSigmasTPC(track, type);
+  return fPIDResponse->NumberOfSigmasTPC(track, type);
+}
+
+///________________________________________________________________________
+Float_t AliConversionPhotonCuts::NumberOfSigmasTOF(AliVTrack *track, AliPID::EParticleType type){
+  // TOF n-sigma of the track, from the PID cache of the event if available
+  if(fPIDCache) return fPIDCache->NumberOfSigmasTOF(track, type);
+  return fPIDResponse->NumberOfSigmasTOF(track, type);
+}
+
+///________________________________________________________________________
+Float_t AliConversionPhotonCuts::NumberOfSigmasITS(AliVTrack *track, AliPID::EParticleType type){
+  // ITS n-sigma of the track, from the PID cache of the event if available
+  if(fPIDCache) return fPIDCache->NumberOfSigmasITS(track, type);
+  return fPIDResponse->NumberOfSigmasITS(track, type);
+}
+
 ///________________________________________________________________________
 Bool_t AliConversionPhotonCuts::KappaCuts(AliConversionPhotonBase * photon,AliVEvent *event) {
   // abort if Kappa selection not enabled
@@ -10,6 +10,7 @@
 #include "AliAODTrack.h"
 #include "AliMCEvent.h"
 #include "AliAnalysisCuts.h"
+#include "AliPID.h"
 #include "TH1F.h"
 #include "TF1.h"
 #include "TProfile.h"
@@ -21,6 +22,7 @@ class AliESDEvent;
 class AliAODEvent;
 class AliConversionPhotonBase;
 class AliPIDResponse;
+class AliConversionTrackPIDCache;
 class AliKFVertex;
 class TH1F;
 class TH2F;
@@ -144,6 +146,9 @@ class AliConversionPhotonCuts : public AliAnalysisCuts {
     Bool_t InitPIDResponse();
     void SetPIDResponse(AliPIDResponse * pidResponse) {fPIDResponse = pidResponse;}
     AliPIDResponse * GetPIDResponse() { return fPIDResponse;}
+    void SetUseSharedPIDCache(Bool_t use) {fUseSharedPIDCache = use;}
+    void UsePIDCacheOfEvent(AliVEvent *event);
+    void ResolvePIDCache(AliVEvent *event);
 
 
     virtual Bool_t IsSelected(TObject* /*obj*/){return kTRUE;}
@@ -187,6 +192,9 @@ class AliConversionPhotonCuts : public AliAnalysisCuts {
     Bool_t PhiSectorCut(AliConversionPhotonBase * photon);
     //   Bool_t dEdxCuts(AliVTrack * track);
     Bool_t dEdxCuts(AliVTrack * track, AliConversionPhotonBase * photon);
+    Float_t NumberOfSigmasTPC(AliVTrack * track, AliPID::EParticleType type);
+    Float_t NumberOfSigmasTOF(AliVTrack * track, AliPID::EParticleType type);
+    Float_t NumberOfSigmasITS(AliVTrack * track, AliPID::EParticleType type);
     Bool_t KappaCuts(AliConversionPhotonBase * photon,AliVEvent *event);
     Bool_t ArmenterosQtCut(AliConversionPhotonBase *photon);
     Bool_t AsymmetryCut(AliConversionPhotonBase *photon,AliVEvent *event);
@@ -395,10 +403,12 @@ class AliConversionPhotonCuts : public AliAnalysisCuts {
     TH2F**            fHistoEleMapWidth; //[fnRBins] 
     TH2F**            fHistoPosMapMean;  //[fnRBins] 
     TH2F**            fHistoPosMapWidth; //[fnRBins] 
+    Bool_t            fUseSharedPIDCache;                   ///< flag to share the PID n-sigma of the tracks with the other photon cuts of the event
+    AliConversionTrackPIDCache* fPIDCache;                  //!<! PID n-sigma cache of the current event
  
   private:
     /// \cond CLASSIMP
-    ClassDef(AliConversionPhotonCuts,19)
+    ClassDef(AliConversionPhotonCuts,20)
     /// \endcond
 };
 
@@ -0,0 +1,169 @@
+/****************************************************************************
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved.   *
+ *                                                                          *
+ * Author: The ALICE Off-line Project.                                      *
+ * Contributors are mentioned in the code where appropriate.                *
+ *                                                                          *
+ * Permission to use, copy, modify and distribute this software and its     *
+ * documentation strictly for non-commercial purposes is hereby granted     *
+ * without fee, provided that the above copyright notice appears in all     *
+ * copies and that both the copyright notice and this permission notice     *
+ * appear in the supporting documentation. The authors make no claims       *
+ * about the suitability of this software for any purpose. It is            *
+ * provided "as is" without express or implied warranty.                    *
+ ***************************************************************************/
+
+////////////////////////////////////////////////
+//---------------------------------------------
+// Per-event cache of the PID n-sigma of the
+// conversion electron candidates, shared by
+// all photon cut objects of a train
+//---------------------------------------------
+////////////////////////////////////////////////
+
+#include "AliConversionTrackPIDCache.h"
+
+#include "AliPIDResponse.h"
+#include "AliVEvent.h"
+#include "AliVTrack.h"
+
+/// \cond CLASSIMP
+ClassImp(AliConversionTrackPIDCache)
+/// \endcond
+
+const char* AliConversionTrackPIDCache::fgkCacheName = "AliConversionTrackPIDCache";
+AliConversionTrackPIDCache* AliConversionTrackPIDCache::fgCurrentCache = NULL;
+
+//________________________________________________________________________
+AliConversionTrackPIDCache::AliConversionTrackPIDCache() :
+  TNamed(fgkCacheName,fgkCacheName),
+  fEvent(NULL),
+  fEventKey(),
+  fPIDResponse(NULL),
+  fEventCounter(0),
+  fTracks(),
+  fTracksNegativeID(),
+  fNHits(0),
+  fNMisses(0)
+{
+  // Default constructor
+}
+
+//________________________________________________________________________
+AliConversionTrackPIDCache::AliConversionTrackPIDCache(const char *name) :
+  TNamed(name,name),
+  fEvent(NULL),
+  fEventKey(),
+  fPIDResponse(NULL),
+  fEventCounter(0),
+  fTracks(),
+  fTracksNegativeID(),
+  fNHits(0),
+  fNMisses(0)
+{
+  // Named constructor
+}
+
+//________________________________________________________________________
+AliConversionTrackPIDCache::~AliConversionTrackPIDCache(){
+  // Destructor, e.g. when the objects of the event are deleted at a new input file
+
+  if(fgCurrentCache == this) fgCurrentCache = NULL;
+}
+
+//________________________________________________________________________
+AliConversionTrackPIDCache* AliConversionTrackPIDCache::GetCache(AliVEvent *event, AliPIDResponse *pidResponse){
+  // Get the cache of the event. The cache is created and attached to the
+  // event when called for the first time, and reset when called for a new event.
+
+  if(!event || !pidResponse) return NULL;
+
+  AliConversionTrackPIDCache *cache = AliEventCacheKey::GetEventObject<AliConversionTrackPIDCache>(event, fgkCacheName);
+  // without an event identifier nothing can be shared safely, Set() then always reports a new event
+  if(cache->fEventKey.Set(event) || pidResponse != cache->fPIDResponse)
+    cache->NextEvent(event, pidResponse);
+
+  fgCurrentCache = cache;
+  return cache;
+}
+
+//________________________________________________________________________
+AliConversionTrackPIDCache* AliConversionTrackPIDCache::GetCurrentCache(const AliVEvent *event, const AliPIDResponse *pidResponse){
+  // Cache set up by the last call of GetCache(), if this was for the given event and PID response.
+  // Event and PID response objects are reused from event to event, the event is compared by its key.
+
+  if(!fgCurrentCache || fgCurrentCache->fEvent != event || fgCurrentCache->fPIDResponse != pidResponse) return NULL;
+  return fgCurrentCache->fEventKey.IsEvent(event) ? fgCurrentCache : NULL;
+}
+
+//________________________________________________________________________
+void AliConversionTrackPIDCache::NextEvent(AliVEvent *event, AliPIDResponse *pidResponse){
+  // Reset the cache for a new event. The statistics are kept.
+
+  fEvent        = event;
+  fPIDResponse  = pidResponse;
+  // invalidates all entries, the arrays keep their size
+  fEventCounter++;
+}
+
+//________________________________________________________________________
+AliConversionTrackPIDCache::TrackPID* AliConversionTrackPIDCache::GetEntry(const AliVTrack *track){
+  // Entry of the track in the current event, reset if it was filled in a previous event.
+  // Returns NULL if the entry is taken by another track with the same ID.
+
+  Int_t id = track->GetID();
+  vector<TrackPID> &tracks = id >= 0 ? fTracks : fTracksNegativeID;
+  UInt_t index = id >= 0 ? id : -id-1;
+  if(index >= tracks.size()) tracks.resize(index+1);
+
+  TrackPID &pid = tracks[index];
+  if(pid.fEventCounter != fEventCounter){
+    pid.fEventCounter = fEventCounter;
+    pid.fTrack        = track;
+    pid.fFilled       = 0;
+  }
+  return pid.fTrack == track ? &pid : NULL;
+}
+
+//________________________________________________________________________
+Float_t AliConversionTrackPIDCache::NumberOfSigmas(EDetector det, AliVTrack *track, AliPID::EParticleType type){
+  // n-sigma of the track for the given detector and particle hypothesis,
+  // evaluated with the PID response at the first request in the event
+
+  if(type < 0 || type >= AliPID::kSPECIESC){
+    switch(det){
+      case kTOF: return fPIDResponse->NumberOfSigmasTOF(track, type);
+      case kITS: return fPIDResponse->NumberOfSigmasITS(track, type);
+      default:   return fPIDResponse->NumberOfSigmasTPC(track, type);
+    }
+  }
+
+  TrackPID *pid = GetEntry(track);
+  ULong64_t bit = 1ULL << (det*AliPID::kSPECIESC + type);
+  if(pid && (pid->fFilled & bit)){
+    fNHits++;
+    return pid->fNSigma[det][type];
+  }
+
+  Float_t nSigma;
+  switch(det){
+    case kTOF: nSigma = fPIDResponse->NumberOfSigmasTOF(track, type); break;
+    case kITS: nSigma = fPIDResponse->NumberOfSigmasITS(track, type); break;
+    default:   nSigma = fPIDResponse->NumberOfSigmasTPC(track, type); break;
+  }
+  if(pid){
+    pid->fNSigma[det][type] = nSigma;
+    pid->fFilled |= bit;
+  }
+  fNMisses++;
+  return nSigma;
+}
+
+//________________________________________________________________________
+void AliConversionTrackPIDCache::Print(Option_t * /*opt*/) const {
+  // Print the cache statistics
+
+  Long64_t total = fNHits+fNMisses;
+  printf("AliConversionTrackPIDCache: %lld n-sigma requested, %lld found in the cache (%.1f%%), %lld evaluated\n",
+         total, fNHits, total > 0 ? 100.*fNHits/total : 0., fNMisses);
+}
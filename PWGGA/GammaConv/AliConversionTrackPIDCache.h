@@ -0,0 +1,99 @@
+#ifndef ALICONVERSIONTRACKPIDCACHE_H
+#define ALICONVERSIONTRACKPIDCACHE_H
+
+#include "TNamed.h"
+#include "AliPID.h"
+#include "AliEventCacheKey.h"
+#include <vector>
+
+class AliVEvent;
+class AliVTrack;
+class AliPIDResponse;
+
+using namespace std;
+
+/**
+ * @class AliConversionTrackPIDCache
+ * @brief Per-event cache of the PID n-sigma of the conversion electron candidates
+ *
+ * The n-sigma of a track with respect to a particle hypothesis does not depend
+ * on the photon cut configuration, but every AliConversionPhotonCuts object of
+ * the train used to ask the AliPIDResponse for it again. The cache is attached
+ * to the input event and shared by all cut objects, so that each n-sigma is
+ * evaluated once per event. Values are stored as returned by AliPIDResponse,
+ * i.e. the cut decisions do not change.
+ *
+ * The event is identified by an AliEventCacheKey (entry and tree number of
+ * the analysis manager, event header). GetCache() is called once per event by
+ * the V0 reader, which runs before the tasks; the cut objects then take the
+ * cache with GetCurrentCache(), which only returns it if it was set up for
+ * the same event, i.e. not in events skipped by the V0 reader.
+ * The n-sigma are stored in flat arrays indexed by the track ID (ESD index,
+ * or ESD label for AOD tracks, with negative IDs in a second array), so a
+ * lookup is an array access. Entries of previous events are invalidated by
+ * an event counter instead of being cleared.
+ */
+class AliConversionTrackPIDCache : public TNamed {
+
+  public:
+    enum EDetector {
+      kTPC = 0,
+      kTOF,
+      kITS,
+      kNDetectors
+    };
+
+    AliConversionTrackPIDCache();
+    AliConversionTrackPIDCache(const char *name);
+    virtual ~AliConversionTrackPIDCache();
+
+    static AliConversionTrackPIDCache* GetCache(AliVEvent *event, AliPIDResponse *pidResponse);
+    static AliConversionTrackPIDCache* GetCurrentCache(const AliVEvent *event, const AliPIDResponse *pidResponse);
+
+    void            NextEvent(AliVEvent *event, AliPIDResponse *pidResponse);
+    const AliEventCacheKey& GetEventKey() const {return fEventKey;}
+
+    Float_t         NumberOfSigmas(EDetector det, AliVTrack *track, AliPID::EParticleType type);
+    Float_t         NumberOfSigmasTPC(AliVTrack *track, AliPID::EParticleType type) {return NumberOfSigmas(kTPC, track, type);}
+    Float_t         NumberOfSigmasTOF(AliVTrack *track, AliPID::EParticleType type) {return NumberOfSigmas(kTOF, track, type);}
+    Float_t         NumberOfSigmasITS(AliVTrack *track, AliPID::EParticleType type) {return NumberOfSigmas(kITS, track, type);}
+
+    Long64_t        GetNHits() const {return fNHits;}
+    Long64_t        GetNMisses() const {return fNMisses;}
+    virtual void    Print(Option_t *opt="") const;
+
+    static const char *fgkCacheName;                        ///< Name of the cache object in the event
+
+  private:
+    static AliConversionTrackPIDCache *fgCurrentCache;      //!<! cache returned by the last call of GetCache()
+
+  protected:
+    struct TrackPID {
+      TrackPID() : fEventCounter(0), fTrack(NULL), fFilled(0) {}
+      UInt_t        fEventCounter;                          ///< event counter of the cache when the entry was filled
+      const AliVTrack* fTrack;                              ///< track the entry belongs to
+      ULong64_t     fFilled;                                ///< bit det*AliPID::kSPECIESC+type set if fNSigma[det][type] is filled
+      Float_t       fNSigma[kNDetectors][AliPID::kSPECIESC];///< n-sigma per detector and particle hypothesis
+    };
+
+    AliVEvent*      fEvent;                                 //!<! current event
+    AliEventCacheKey fEventKey;                             //!<! key of the current event
+    AliPIDResponse* fPIDResponse;                           //!<! PID response the n-sigma are taken from
+    UInt_t          fEventCounter;                          //!<! number of events seen, entries of other events are invalid
+    vector<TrackPID> fTracks;                               //!<! n-sigma of the tracks, indexed by track ID
+    vector<TrackPID> fTracksNegativeID;                     //!<! n-sigma of the tracks with negative ID, indexed by -ID-1
+    Long64_t        fNHits;                                 ///< n-sigma found in the cache
+    Long64_t        fNMisses;                               ///< n-sigma evaluated
+
+    TrackPID*       GetEntry(const AliVTrack *track);
+
+  private:
+    AliConversionTrackPIDCache(const AliConversionTrackPIDCache &ref);
+    AliConversionTrackPIDCache& operator=(const AliConversionTrackPIDCache &ref);
+
+    /// \cond CLASSIMP
+    ClassDef(AliConversionTrackPIDCache,3)
+    /// \endcond
+};
+
+#endif
@@ -45,7 +45,10 @@ AliGammaConversionAODBGHandler::AliGammaConversionAODBGHandler() :
 	fBinLimitsArrayMultiplicity(NULL),
 	fBGEvents(),
 	fBGEventsENeg(),
-	fBGEventsMeson()
+	fBGEventsMeson(),
+	fBGEventsPool(),
+	fBGEventsENegPool(),
+	fBGEventsMesonPool()
 {
 	// constructor
 }
@@ -66,7 +69,10 @@ AliGammaConversionAODBGHandler::AliGammaConversionAODBGHandler(Int_t binsZ,Int_t
 	fBinLimitsArrayMultiplicity(NULL),
 	fBGEvents(binsZ,AliGammaConversionMultipicityVector(binsMultiplicity,AliGammaConversionBGEventVector(nEvents))),
 	fBGEventsENeg(binsZ,AliGammaConversionMultipicityVector(binsMultiplicity,AliGammaConversionBGEventVector(nEvents))),
-	fBGEventsMeson(binsZ,AliGammaConversionMotherMultipicityVector(binsMultiplicity,AliGammaConversionMotherBGEventVector(nEvents)))
+	fBGEventsMeson(binsZ,AliGammaConversionMotherMultipicityVector(binsMultiplicity,AliGammaConversionMotherBGEventVector(nEvents))),
+	fBGEventsPool(binsZ*binsMultiplicity*nEvents),
+	fBGEventsENegPool(binsZ*binsMultiplicity*nEvents),
+	fBGEventsMesonPool(binsZ*binsMultiplicity*nEvents)
 {
 	// constructor
 }
@@ -89,7 +95,10 @@ AliGammaConversionAODBGHandler::AliGammaConversionAODBGHandler(Int_t collisionSy
 	fBinLimitsArrayMultiplicity(NULL),
 	fBGEvents(binsZ,AliGammaConversionMultipicityVector(binsMultiplicity,AliGammaConversionBGEventVector(nEvents))),
 	fBGEventsENeg(binsZ,AliGammaConversionMultipicityVector(binsMultiplicity,AliGammaConversionBGEventVector(nEvents))),
-	fBGEventsMeson(binsZ,AliGammaConversionMotherMultipicityVector(binsMultiplicity,AliGammaConversionMotherBGEventVector(nEvents)))
+	fBGEventsMeson(binsZ,AliGammaConversionMotherMultipicityVector(binsMultiplicity,AliGammaConversionMotherBGEventVector(nEvents))),
+	fBGEventsPool(binsZ*binsMultiplicity*nEvents),
+	fBGEventsENegPool(binsZ*binsMultiplicity*nEvents),
+	fBGEventsMesonPool(binsZ*binsMultiplicity*nEvents)
 {
 	// constructor
     if(fNBinsZ>8) fNBinsZ = 8;
@@ -361,9 +370,23 @@ AliGammaConversionAODBGHandler::AliGammaConversionAODBGHandler(const AliGammaCon
 	fBinLimitsArrayMultiplicity(original.fBinLimitsArrayMultiplicity),
 	fBGEvents(original.fBGEvents),
 	fBGEventsENeg(original.fBGEventsENeg),
-	fBGEventsMeson(original.fBGEventsMeson)
+	fBGEventsMeson(original.fBGEventsMeson),
+	fBGEventsPool(original.fBGEventsPool),
+	fBGEventsENegPool(original.fBGEventsENegPool),
+	fBGEventsMesonPool(original.fBGEventsMesonPool)
 {
-	//copy constructor	
+	//copy constructor
+	// the copied pointer tables point into the pools of the original, redirect them to the copied pools
+	for(UInt_t z=0;z<fBGEvents.size();z++){
+		for(UInt_t m=0;m<fBGEvents[z].size();m++){
+			for(UInt_t e=0;e<fBGEvents[z][m].size();e++){
+				Int_t slot = GetSlotIndex(z,m,e);
+				for(UInt_t d=0;d<fBGEvents[z][m][e].size();d++) fBGEvents[z][m][e][d] = &fBGEventsPool[slot][d];
+				for(UInt_t d=0;d<fBGEventsENeg[z][m][e].size();d++) fBGEventsENeg[z][m][e][d] = &fBGEventsENegPool[slot][d];
+				for(UInt_t d=0;d<fBGEventsMeson[z][m][e].size();d++) fBGEventsMeson[z][m][e][d] = &fBGEventsMesonPool[slot][d];
+			}
+		}
+	}
 }
 
 //_____________________________________________________________________________________________________________________________
@@ -588,20 +611,16 @@ void AliGammaConversionAODBGHandler::AddEvent(TList* const eventGammas,Double_t
 	fBGEventVertex[z][m][eventCounter].fZ = zvalue;
 	fBGEventVertex[z][m][eventCounter].fEP = epvalue;
 
-	//first clear the vector
-	// cout<<"Size of vector: "<<fBGEvents[z][m][eventCounter].size()<<endl;
-	//  cout<<"Checking the entries: Z="<<z<<", M="<<m<<", eventCounter="<<eventCounter<<endl;
-
-	//  cout<<"The size of this vector is: "<<fBGEvents[z][m][eventCounter].size()<<endl;
-    for(UInt_t d=0;d<fBGEvents[z][m][eventCounter].size();d++){
-		delete (AliAODConversionPhoton*)(fBGEvents[z][m][eventCounter][d]);
+	// overwrite the photons of the slot: copies into the storage of the slot,
+	// which keeps its capacity, no allocation once the buffer is filled
+	std::vector<AliAODConversionPhoton> &photons = fBGEventsPool[GetSlotIndex(z,m,eventCounter)];
+	photons.clear();
+	for(Int_t i=0; i< eventGammas->GetEntries();i++){
+		photons.push_back(*(AliAODConversionPhoton*)(eventGammas->At(i)));
 	}
 	fBGEvents[z][m][eventCounter].clear();
-	
-	// add the gammas to the vector
-	for(Int_t i=0; i< eventGammas->GetEntries();i++){
-		//    AliKFParticle *t = new AliKFParticle(*(AliKFParticle*)(eventGammas->At(i)));
-		fBGEvents[z][m][eventCounter].push_back(new AliAODConversionPhoton(*(AliAODConversionPhoton*)(eventGammas->At(i))));
+	for(UInt_t d=0;d<photons.size();d++){
+		fBGEvents[z][m][eventCounter].push_back(&photons[d]);
 	}
 	fBGEventCounter[z][m]++;
 }
@@ -627,15 +646,15 @@ void AliGammaConversionAODBGHandler::AddMesonEvent(TList* const eventMothers, Do
 	fBGEventVertex[z][m][eventCounter].fZ = zvalue;
 	fBGEventVertex[z][m][eventCounter].fEP = epvalue;
 
-	//first clear the vector
-  for(UInt_t d=0;d<fBGEventsMeson[z][m][eventCounter].size();d++){
-		delete (AliAODConversionMother*)(fBGEventsMeson[z][m][eventCounter][d]);
+	// overwrite the mesons of the slot
+	std::vector<AliAODConversionMother> &mesons = fBGEventsMesonPool[GetSlotIndex(z,m,eventCounter)];
+	mesons.clear();
+	for(Int_t i=0; i< eventMothers->GetEntries();i++){
+		mesons.push_back(*(AliAODConversionMother*)(eventMothers->At(i)));
 	}
 	fBGEventsMeson[z][m][eventCounter].clear();
-	
-	// add the gammas to the vector
-	for(Int_t i=0; i< eventMothers->GetEntries();i++){
-		fBGEventsMeson[z][m][eventCounter].push_back(new AliAODConversionMother(*(AliAODConversionMother*)(eventMothers->At(i))));
+	for(UInt_t d=0;d<mesons.size();d++){
+		fBGEventsMeson[z][m][eventCounter].push_back(&mesons[d]);
 	}
 	fBGEventMesonCounter[z][m]++;
 }
@@ -657,15 +676,15 @@ void AliGammaConversionAODBGHandler::AddMesonEvent(const std::vector<AliAODConve
   fBGEventVertex[z][m][eventCounter].fZ = zvalue;
   fBGEventVertex[z][m][eventCounter].fEP = epvalue;
 
-  //first clear the vector
-  for(UInt_t d=0;d<fBGEvents[z][m][eventCounter].size();d++){
-    delete (AliAODConversionMother*)(fBGEventsMeson[z][m][eventCounter][d]);
+  // overwrite the mesons of the slot
+  std::vector<AliAODConversionMother> &mesons = fBGEventsMesonPool[GetSlotIndex(z,m,eventCounter)];
+  mesons.clear();
+  for(const auto &mother : eventMother){
+    mesons.push_back(mother);
   }
   fBGEventsMeson[z][m][eventCounter].clear();
-
-  // add the gammas to the vector
-  for(const auto &mother : eventMother){
-    fBGEventsMeson[z][m][eventCounter].push_back(new AliAODConversionMother(mother));
+  for(auto &mother : mesons){
+    fBGEventsMeson[z][m][eventCounter].push_back(&mother);
   }
   fBGEventMesonCounter[z][m]++;
 }
@@ -681,21 +700,15 @@ void AliGammaConversionAODBGHandler::AddElectronEvent(TClonesArray* const eventE
 	}
 	Int_t eventENegCounter=fBGEventENegCounter[z][m];
 	
-	//first clear the vector
-	// cout<<"Size of vector: "<<fBGEvents[z][m][eventCounter].size()<<endl;
-	//  cout<<"Checking the entries: Z="<<z<<", M="<<m<<", eventCounter="<<eventCounter<<endl;
-
-	//  cout<<"The size of this vector is: "<<fBGEvents[z][m][eventCounter].size()<<endl;
-    for(UInt_t d=0;d<fBGEventsENeg[z][m][eventENegCounter].size();d++){
-		delete (AliAODConversionPhoton*)(fBGEventsENeg[z][m][eventENegCounter][d]);
+	// overwrite the electrons of the slot
+	std::vector<AliAODConversionPhoton> &electrons = fBGEventsENegPool[GetSlotIndex(z,m,eventENegCounter)];
+	electrons.clear();
+	for(Int_t i=0; i< eventENeg->GetEntriesFast();i++){
+		electrons.push_back(*(AliAODConversionPhoton*)(eventENeg->At(i)));
 	}
-
 	fBGEventsENeg[z][m][eventENegCounter].clear();
-
-	// add the electron to the vector
-	for(Int_t i=0; i< eventENeg->GetEntriesFast();i++){
-		//    AliKFParticle *t = new AliKFParticle(*(AliKFParticle*)(eventGammas->At(i)));
-		fBGEventsENeg[z][m][eventENegCounter].push_back(new AliAODConversionPhoton(*(AliAODConversionPhoton*)(eventENeg->At(i))));
+	for(UInt_t d=0;d<electrons.size();d++){
+		fBGEventsENeg[z][m][eventENegCounter].push_back(&electrons[d]);
 	}
 	fBGEventENegCounter[z][m]++;
 }
@@ -83,6 +83,8 @@ class AliGammaConversionAODBGHandler : public TObject {
 	Double_t GetBGProb(Int_t z, Int_t m){return fBGProbability[z][m];}
 
 	private:
+		// index of the (z, multiplicity, event) slot in the storage pools
+		Int_t GetSlotIndex(Int_t z, Int_t m, Int_t event) const {return (z*fNBinsMultiplicity+m)*fNEvents+event;}
 
 		Int_t 								fNEvents; 						// number of events
 		Int_t ** 							fBGEventCounter;				//! bg counter
@@ -98,7 +100,13 @@ class AliGammaConversionAODBGHandler : public TObject {
 		AliGammaConversionBGVector 			fBGEvents; 						// photon background events
 		AliGammaConversionBGVector 			fBGEventsENeg; 					// electron background electron events
 		AliGammaConversionMotherBGVector 	fBGEventsMeson; 				// neutral meson background events
+		// Storage of the background events: one contiguous vector per (z, multiplicity, event) slot,
+		// overwritten in place when the slot is reused. fBGEvents, fBGEventsENeg and fBGEventsMeson
+		// point into these vectors.
+		std::vector<std::vector<AliAODConversionPhoton> >	fBGEventsPool;		//! photons of the background events
+		std::vector<std::vector<AliAODConversionPhoton> >	fBGEventsENegPool;	//! electrons of the background events
+		std::vector<std::vector<AliAODConversionMother> >	fBGEventsMesonPool;	//! neutral mesons of the background events
 		
-	ClassDef(AliGammaConversionAODBGHandler,6)
+	ClassDef(AliGammaConversionAODBGHandler,7)
 };
 #endif
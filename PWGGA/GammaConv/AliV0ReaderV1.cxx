@@ -620,6 +620,9 @@ Bool_t AliV0ReaderV1::ProcessEvent(AliVEvent *inputEvent,AliMCEvent *mcEvent)
   if(!fEventCuts){AliError("No EventCuts");return kFALSE;}
   if(!fConversionCuts){AliError("No ConversionCuts");return kFALSE;}
 
+  // look up the PID cache of the event once, the n-sigma of the daughters are then
+  // shared with the photon cuts of the tasks
+  fConversionCuts->UsePIDCacheOfEvent(fInputEvent);
 
   // Count Primary Tracks Event
   CountTracks();
@@ -64,6 +64,7 @@
 #include "AliRDHFCutsDStartoKpipi.h"
 #include "AliAnalysisFilter.h"
 #include "AliAnalysisVertexingHF.h"
+#include "AliVertexingHFEventCache.h"
 #include "AliMixedEvent.h"
 #include "AliESDv0.h"
 #include "AliAODv0.h"
@@ -152,6 +153,8 @@ fOKInvMassLctoV0(kFALSE),
 fnTrksTotal(0),
 fnSeleTrksTotal(0),
 fMakeReducedRHF(kFALSE),
+fUseEventCache(kTRUE),
+fAODMapShared(kFALSE),
 fMassDzero(0.),
 fMassDplus(0.),
 fMassDs(0.),
@@ -247,6 +250,8 @@ fOKInvMassLctoV0(source.fOKInvMassLctoV0),
 fnTrksTotal(0),
 fnSeleTrksTotal(0),
 fMakeReducedRHF(kFALSE),
+fUseEventCache(source.fUseEventCache),
+fAODMapShared(source.fAODMapShared),
 fMassDzero(source.fMassDzero),
 fMassDplus(source.fMassDplus),
 fMassDs(source.fMassDs),
@@ -338,6 +343,7 @@ AliAnalysisVertexingHF &AliAnalysisVertexingHF::operator=(const AliAnalysisVerte
   fOKInvMassDstar = source.fOKInvMassDstar;
   fOKInvMassD0to4p = source.fOKInvMassD0to4p;
   fOKInvMassLctoV0 = source.fOKInvMassLctoV0;
+  fUseEventCache = source.fUseEventCache;
   fMassDzero = source.fMassDzero;
   fMassDplus = source.fMassDplus;
   fMassDs = source.fMassDs;
@@ -367,7 +373,7 @@ AliAnalysisVertexingHF::~AliAnalysisVertexingHF() {
   if(fCutsLctoV0) { delete fCutsLctoV0; fCutsLctoV0=0; }
   if(fCutsD0toKpipipi) { delete fCutsD0toKpipipi; fCutsD0toKpipipi=0; }
   if(fCutsDStartoKpipi) { delete fCutsDStartoKpipi; fCutsDStartoKpipi=0; }
-  if(fAODMap) { delete [] fAODMap; fAODMap=0; }
+  if(fAODMap) { if(!fAODMapShared) delete [] fAODMap; fAODMap=0; }
   if(fMassCalc2) { delete fMassCalc2; fMassCalc2=0; }
   if(fMassCalc3) { delete fMassCalc3; fMassCalc3=0; }
   if(fMassCalc4) { delete fMassCalc4; fMassCalc4=0; }
@@ -618,6 +624,13 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
   AliDebug(1,Form(" Selected tracks: %d",nSeleTrks));
   fnSeleTrksTotal += nSeleTrks;
 
+  // momenta of the selected tracks at the primary vertex, used by the
+  // invariant mass prefilters before touching the tracks
+  Double_t *momAtVertex = new Double_t[3*nSeleTrks];
+  for(Int_t iTrk=0; iTrk<nSeleTrks; iTrk++) {
+    ((AliExternalTrackParam*)tracksAtVertex.UncheckedAt(iTrk))->GetPxPyPz(&momAtVertex[3*iTrk]);
+  }
+
 
   TObjArray *twoTrackArray1    = new TObjArray(2);
   TObjArray *twoTrackArray2    = new TObjArray(2);
@@ -940,8 +953,16 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	  // create a track from the D0
 	  AliNeutralTrackParam *trackD0 = new AliNeutralTrackParam(io2Prong);
 
+	  // the D0 is the same for all soft pions: propagate it once to the primary
+	  // vertex and restore these parameters for each pion, as the vertexing moves it
+	  trackD0->PropagateToDCA(fV1,fBzkG,kVeryBig);
+	  Bool_t okTrackD0 = (trackD0->GetSigmaY2()>=0. && trackD0->GetSigmaZ2()>=0.); // this is insipired by the AliITStrackV2::Invariant() checks
+	  AliExternalTrackParam trackD0AtVertex(*trackD0);
+	  Double_t momD0[3];
+	  trackD0->GetPxPyPz(momD0);
+
 	  // LOOP ON TRACKS THAT PASSED THE SOFT PION CUTS
-	  for(iTrkSoftPi=0; iTrkSoftPi<nSeleTrks; iTrkSoftPi++) {
+	  for(iTrkSoftPi=0; okTrackD0 && iTrkSoftPi<nSeleTrks; iTrkSoftPi++) {
 
 	    if(iTrkSoftPi==iTrkP1 || iTrkSoftPi==iTrkN1) continue;
 
@@ -955,8 +976,14 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 
 	    //if(iTrkSoftPi%1==0) AliDebug(1,Form("    1st loop on pi_s: track number %d of %d",iTrkSoftPi,nSeleTrks));
 
-	    trackD0->PropagateToDCA(fV1,fBzkG,kVeryBig);
-	    if(trackD0->GetSigmaY2()<0. || trackD0->GetSigmaZ2()<0.) continue; // this is insipired by the AliITStrackV2::Invariant() checks
+	    // check invariant mass cut for D* with the momenta at the primary vertex
+	    Double_t pxDst[2]={momAtVertex[3*iTrkSoftPi],momD0[0]};
+	    Double_t pyDst[2]={momAtVertex[3*iTrkSoftPi+1],momD0[1]};
+	    Double_t pzDst[2]={momAtVertex[3*iTrkSoftPi+2],momD0[2]};
+	    if(!SelectInvMassAndPtDstarD0pi(pxDst,pyDst,pzDst)) continue;
+
+	    // back to primary vertex
+	    trackD0->Set(trackD0AtVertex.GetX(),trackD0AtVertex.GetAlpha(),trackD0AtVertex.GetParameter(),trackD0AtVertex.GetCovariance());
 
 	    // get track from tracks array
 	    trackPi = (AliESDtrack*)seleTrksArray.UncheckedAt(iTrkSoftPi);
@@ -964,11 +991,6 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	    SetParametersAtVertex(trackPi,(AliExternalTrackParam*)tracksAtVertex.UncheckedAt(iTrkSoftPi));
 	    twoTrackArrayCasc->AddAt(trackPi,0);
 	    twoTrackArrayCasc->AddAt(trackD0,1);
-	    if(!SelectInvMassAndPtDstarD0pi(twoTrackArrayCasc)){
-	      twoTrackArrayCasc->Clear();
-	      trackPi=0;
-	      continue;
-	    }
 
 	    AliAODVertex *vertexCasc = 0;
 
@@ -1121,6 +1143,21 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	  if(!TESTBIT(seleFlags[iTrkP1],kBitKaonCompat) &&
 	     !TESTBIT(seleFlags[iTrkP2],kBitKaonCompat) ) okForDsToKKpi=kFALSE;
 	}
+	// check invariant mass cuts for D+,Ds,Lc (cheaper than the track-to-track DCAs)
+        massCutOK=kTRUE;
+	if(f3Prong && fMassCutBeforeVertexing) {
+	  mompos2[0]=momAtVertex[3*iTrkP2]; mompos2[1]=momAtVertex[3*iTrkP2+1]; mompos2[2]=momAtVertex[3*iTrkP2+2];
+	  Double_t pxDau[3]={mompos1[0],momneg1[0],mompos2[0]};
+	  Double_t pyDau[3]={mompos1[1],momneg1[1],mompos2[1]};
+	  Double_t pzDau[3]={mompos1[2],momneg1[2],mompos2[2]};
+	  //	  massCutOK = SelectInvMassAndPt3prong(threeTrackArray);
+	  massCutOK = SelectInvMassAndPt3prong(pxDau,pyDau,pzDau,pidLcStatus);
+	}
+	if(f3Prong && !massCutOK && !f4Prong) {
+	  postrack2=0;
+	  continue;
+	}
+
 	// back to primary vertex
 	//	postrack1->PropagateToDCA(fV1,fBzkG,kVeryBig);
 	//	postrack2->PropagateToDCA(fV1,fBzkG,kVeryBig);
@@ -1136,9 +1173,7 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	dcap1p2 = postrack2->GetDCA(postrack1,fBzkG,xdummy,ydummy);
 	if(dcap1p2>dcaMax) { postrack2=0; continue; }
 
-	// check invariant mass cuts for D+,Ds,Lc
-        massCutOK=kTRUE;
-	if(f3Prong) {
+	if(f3Prong && massCutOK) {
 	  if(postrack2->Charge()>0) {
 	    threeTrackArray->AddAt(postrack1,0);
 	    threeTrackArray->AddAt(negtrack1,1);
@@ -1148,22 +1183,6 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	    threeTrackArray->AddAt(postrack1,1);
 	    threeTrackArray->AddAt(postrack2,2);
 	  }
-	  if(fMassCutBeforeVertexing){
-	    postrack2->GetPxPyPz(mompos2);
-	    Double_t pxDau[3]={mompos1[0],momneg1[0],mompos2[0]};
-	    Double_t pyDau[3]={mompos1[1],momneg1[1],mompos2[1]};
-	    Double_t pzDau[3]={mompos1[2],momneg1[2],mompos2[2]};
-	    //	    massCutOK = SelectInvMassAndPt3prong(threeTrackArray);
-	    massCutOK = SelectInvMassAndPt3prong(pxDau,pyDau,pzDau,pidLcStatus);
-	  }
-	}
-
-	if(f3Prong && !massCutOK) {
-	  threeTrackArray->Clear();
-	  if(!f4Prong) {
-	    postrack2=0;
-	    continue;
-	  }
 	}
 
 	// Vertexing
@@ -1265,6 +1284,25 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 		 evtNumber[iTrkN1]==evtNumber[iTrkP2]) continue;
 	    }
 
+	    // check invariant mass cuts for D0 (cheaper than the track-to-track DCAs)
+	    massCutOK=kTRUE;
+	    if(fMassCutBeforeVertexing) {
+	      Int_t iTrk4[4]={iTrkP1,iTrkN1,iTrkP2,iTrkN2};
+	      Double_t pxDau[4],pyDau[4],pzDau[4];
+	      for(Int_t iDau=0; iDau<4; iDau++) {
+		pxDau[iDau]=momAtVertex[3*iTrk4[iDau]];
+		pyDau[iDau]=momAtVertex[3*iTrk4[iDau]+1];
+		pzDau[iDau]=momAtVertex[3*iTrk4[iDau]+2];
+	      }
+	      //	      massCutOK = SelectInvMassAndPt4prong(fourTrackArray);
+	      massCutOK = SelectInvMassAndPt4prong(pxDau,pyDau,pzDau);
+	    }
+
+	    if(!massCutOK) {
+	      negtrack2=0;
+	      continue;
+	    }
+
 	    // back to primary vertex
 	    // postrack1->PropagateToDCA(fV1,fBzkG,kVeryBig);
 	    // postrack2->PropagateToDCA(fV1,fBzkG,kVeryBig);
@@ -1286,17 +1324,6 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	    fourTrackArray->AddAt(postrack2,2);
 	    fourTrackArray->AddAt(negtrack2,3);
 
-	    // check invariant mass cuts for D0
-	    massCutOK=kTRUE;
-	    if(fMassCutBeforeVertexing)
-	      massCutOK = SelectInvMassAndPt4prong(fourTrackArray);
-
-	    if(!massCutOK) {
-	      fourTrackArray->Clear();
-	      negtrack2=0;
-	      continue;
-	    }
-
 	    // Vertexing
 	    AliAODVertex* secVert4PrAOD = ReconstructSecondaryVertex(fourTrackArray,dispersion);
 	    io4Prong = Make4Prong(fourTrackArray,event,secVert4PrAOD,vertexp1n1,vertexp1n1p2,dcap1n1,dcap1n2,dcap2n1,dcap2n2,ok4Prong);
@@ -1400,6 +1427,21 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	     !TESTBIT(seleFlags[iTrkN2],kBitKaonCompat) ) okForDsToKKpi=kFALSE;
 	}
 
+	// check invariant mass cuts for D+,Ds,Lc (cheaper than the track-to-track DCAs)
+        massCutOK=kTRUE;
+	if(fMassCutBeforeVertexing && f3Prong){
+	  momneg2[0]=momAtVertex[3*iTrkN2]; momneg2[1]=momAtVertex[3*iTrkN2+1]; momneg2[2]=momAtVertex[3*iTrkN2+2];
+	  Double_t pxDau[3]={momneg1[0],mompos1[0],momneg2[0]};
+	  Double_t pyDau[3]={momneg1[1],mompos1[1],momneg2[1]};
+	  Double_t pzDau[3]={momneg1[2],mompos1[2],momneg2[2]};
+	  //	  massCutOK = SelectInvMassAndPt3prong(threeTrackArray);
+	  massCutOK = SelectInvMassAndPt3prong(pxDau,pyDau,pzDau,pidLcStatus);
+	}
+	if(!massCutOK) {
+	  negtrack2=0;
+	  continue;
+	}
+
 	// back to primary vertex
 	// postrack1->PropagateToDCA(fV1,fBzkG,kVeryBig);
 	// negtrack1->PropagateToDCA(fV1,fBzkG,kVeryBig);
@@ -1418,22 +1460,6 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	threeTrackArray->AddAt(postrack1,1);
 	threeTrackArray->AddAt(negtrack2,2);
 
-	// check invariant mass cuts for D+,Ds,Lc
-        massCutOK=kTRUE;
-	if(fMassCutBeforeVertexing && f3Prong){
-	  negtrack2->GetPxPyPz(momneg2);
-	  Double_t pxDau[3]={momneg1[0],mompos1[0],momneg2[0]};
-	  Double_t pyDau[3]={momneg1[1],mompos1[1],momneg2[1]};
-	  Double_t pzDau[3]={momneg1[2],mompos1[2],momneg2[2]};
-	  //	  massCutOK = SelectInvMassAndPt3prong(threeTrackArray);
-	  massCutOK = SelectInvMassAndPt3prong(pxDau,pyDau,pzDau,pidLcStatus);
-	}
-	if(!massCutOK) {
-	  threeTrackArray->Clear();
-	  negtrack2=0;
-	  continue;
-	}
-
 	// Vertexing
 	twoTrackArray2->AddAt(postrack1,0);
 	twoTrackArray2->AddAt(negtrack2,1);
@@ -1545,12 +1571,13 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
   threeTrackArray->Delete(); delete threeTrackArray;
   fourTrackArray->Delete();  delete fourTrackArray;
   delete [] seleFlags; seleFlags=NULL;
+  delete [] momAtVertex; momAtVertex=NULL;
   if(evtNumber) {delete [] evtNumber; evtNumber=NULL;}
   tracksAtVertex.Delete();
 
   if(fInputAOD) {
     seleTrksArray.Delete();
-    if(fAODMap) { delete [] fAODMap; fAODMap=NULL; }
+    if(fAODMap) { if(!fAODMapShared) delete [] fAODMap; fAODMap=NULL; }
   }
 
 
@@ -1696,6 +1723,60 @@ void AliAnalysisVertexingHF::FixReferences(AliAODEvent *aod)
 }
 //----------------------------------------------------------------------------
 Bool_t AliAnalysisVertexingHF::FillRecoCand(AliVEvent *event,AliAODRecoDecayHF3Prong *rd){
+  /// Fill on-the-fly the data members of the reduced candidate rd (see RefillRecoCand).
+  /// With the event cache, the AOD index map is built once per event and refills
+  /// which failed are not retried by the other wagons
+  if(!fUseEventCache || rd->GetIsFilled()==1) return RefillRecoCand(event,rd);
+  AliVertexingHFEventCache *cache = AliVertexingHFEventCache::GetCache(event);
+  if(!cache) return RefillRecoCand(event,rd);
+  Int_t mode = fSecVtxWithKF ? 1 : 0;
+  Bool_t ok = kFALSE;
+  if(cache->GetRefillStatus(rd,mode,rd->GetIsFilled(),ok)) return ok;
+  UseEventCacheAODMap(cache);
+  ok = RefillRecoCand(event,rd);
+  cache->SetRefillStatus(rd,mode,ok);
+  return ok;
+}
+//----------------------------------------------------------------------------
+Bool_t AliAnalysisVertexingHF::FillRecoCand(AliVEvent *event,AliAODRecoDecayHF2Prong *rd){
+  /// Fill on-the-fly the data members of the reduced candidate rd (see RefillRecoCand),
+  /// sharing the refill state between wagons with the event cache
+  if(!fUseEventCache || rd->GetIsFilled()==1) return RefillRecoCand(event,rd);
+  AliVertexingHFEventCache *cache = AliVertexingHFEventCache::GetCache(event);
+  if(!cache) return RefillRecoCand(event,rd);
+  Int_t mode = fSecVtxWithKF ? 1 : 0;
+  Bool_t ok = kFALSE;
+  if(cache->GetRefillStatus(rd,mode,rd->GetIsFilled(),ok)) return ok;
+  UseEventCacheAODMap(cache);
+  ok = RefillRecoCand(event,rd);
+  cache->SetRefillStatus(rd,mode,ok);
+  return ok;
+}
+//----------------------------------------------------------------------------
+Bool_t AliAnalysisVertexingHF::FillRecoCasc(AliVEvent *event,AliAODRecoCascadeHF *rCasc, Bool_t DStar, Bool_t recoSecVtx){
+  /// Fill on-the-fly the data members of the reduced cascade rCasc (see RefillRecoCasc),
+  /// sharing the refill state between wagons with the event cache
+  if(!fUseEventCache || rCasc->GetIsFilled()==1) return RefillRecoCasc(event,rCasc,DStar,recoSecVtx);
+  AliVertexingHFEventCache *cache = AliVertexingHFEventCache::GetCache(event);
+  if(!cache) return RefillRecoCasc(event,rCasc,DStar,recoSecVtx);
+  // the result of a failed refill depends on the options
+  Int_t mode = (fSecVtxWithKF ? 1 : 0) | (DStar ? 2 : 0) | (recoSecVtx ? 4 : 0);
+  Bool_t ok = kFALSE;
+  if(cache->GetRefillStatus(rCasc,mode,rCasc->GetIsFilled(),ok)) return ok;
+  UseEventCacheAODMap(cache);
+  ok = RefillRecoCasc(event,rCasc,DStar,recoSecVtx);
+  cache->SetRefillStatus(rCasc,mode,ok);
+  return ok;
+}
+//----------------------------------------------------------------------------
+void AliAnalysisVertexingHF::UseEventCacheAODMap(AliVertexingHFEventCache *cache){
+  /// Use the AOD index map of the event cache, filled once per event
+  if(fAODMap && !fAODMapShared) delete [] fAODMap;
+  fAODMap = cache->GetAODMap(fAODMapSize);
+  fAODMapShared = kTRUE;
+}
+//----------------------------------------------------------------------------
+Bool_t AliAnalysisVertexingHF::RefillRecoCand(AliVEvent *event,AliAODRecoDecayHF3Prong *rd){
   // method to retrieve daughters from trackID and reconstruct secondary vertex
   // save the TRefs to the candidate AliAODRecoDecayHF3Prong rd
   // and fill on-the-fly the data member of rd
@@ -1765,7 +1846,7 @@ Bool_t AliAnalysisVertexingHF::FillRecoCand(AliVEvent *event,AliAODRecoDecayHF3P
   return kTRUE;
 }
 //___________________________
-Bool_t AliAnalysisVertexingHF::FillRecoCand(AliVEvent *event,AliAODRecoDecayHF2Prong *rd){
+Bool_t AliAnalysisVertexingHF::RefillRecoCand(AliVEvent *event,AliAODRecoDecayHF2Prong *rd){
   // method to retrieve daughters from trackID and reconstruct secondary vertex
   // save the TRefs to the candidate AliAODRecoDecayHF2Prong rd
   // and fill on-the-fly the data member of rd
@@ -1825,7 +1906,7 @@ Bool_t AliAnalysisVertexingHF::FillRecoCand(AliVEvent *event,AliAODRecoDecayHF2P
   return kTRUE;
 }
 //----------------------------------------------------------------------------
-Bool_t AliAnalysisVertexingHF::FillRecoCasc(AliVEvent *event,AliAODRecoCascadeHF *rCasc, Bool_t DStar, Bool_t recoSecVtx){
+Bool_t AliAnalysisVertexingHF::RefillRecoCasc(AliVEvent *event,AliAODRecoCascadeHF *rCasc, Bool_t DStar, Bool_t recoSecVtx){
   // method to retrieve daughters from trackID
   // and fill on-the-fly the data member of rCasc and their AliAODRecoDecayHF2Prong daughters
   if(rCasc->GetIsFilled()!=0) return kTRUE;//if 0: reduced dAOD. skip if rd is already filled (1: standard dAOD, 2: already refilled)
@@ -2752,13 +2833,23 @@ void AliAnalysisVertexingHF::MapAODtracks(AliVEvent *aod){
   //assign and save in fAODMap the index of the AliAODTrack track
   //ordering them on the basis of selected criteria
 
+  if(fAODMap && !fAODMapShared) delete [] fAODMap;
   fAODMapSize = 100000;
   fAODMap = new Int_t[fAODMapSize];
+  fAODMapShared = kFALSE;
+  FillAODTrackMap(aod,fAODMap,fAODMapSize);
+  return;
+}
+//----------------------------------------------------------------------------------
+void AliAnalysisVertexingHF::FillAODTrackMap(AliVEvent *aod,Int_t *map,Int_t size){
+  /// fill map[ID] with the index of the AliAODTrack, for the tracks
+  /// passing the selection of MapAODtracks (0 for all other IDs)
+
   AliAODTrack *track=0;
-  memset(fAODMap,0,sizeof(Int_t)*fAODMapSize);
+  memset(map,0,sizeof(Int_t)*size);
   for(Int_t i=0; i<aod->GetNumberOfTracks(); i++) {
     track = dynamic_cast<AliAODTrack*>(aod->GetTrack(i));
-    if(!track) AliFatal("Not a standard AOD");
+    if(!track) AliFatalClass("Not a standard AOD");
     // skip pure ITS SA tracks
     if(track->GetStatus()&AliESDtrack::kITSpureSA) continue;
 
@@ -2771,7 +2862,7 @@ void AliAnalysisVertexingHF::MapAODtracks(AliVEvent *aod){
     //
 
     Int_t ind = (Int_t)track->GetID();
-    if (ind>-1 && ind < fAODMapSize) fAODMap[ind] = i;
+    if (ind>-1 && ind < size) map[ind] = i;
   }
   return;
 }
@@ -3379,7 +3470,8 @@ void AliAnalysisVertexingHF::SelectTracksAndCopyVertex(const AliVEvent *event,
   const AliVVertex *vprimary = event->GetPrimaryVertex();
 
   if(fV1) { delete fV1; fV1=NULL; }
-  if(fAODMap) { delete [] fAODMap; fAODMap=NULL; }
+  if(fAODMap) { if(!fAODMapShared) delete [] fAODMap; fAODMap=NULL; }
+  fAODMapShared = kFALSE;
 
   Int_t nindices=0;
   UShort_t *indices = 0;
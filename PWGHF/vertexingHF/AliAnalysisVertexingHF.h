@@ -45,6 +45,7 @@ class AliAODVertex;
 class AliVertexerTracks;
 class AliESDv0;
 class AliAODv0;
+class AliVertexingHFEventCache;
 
 //-----------------------------------------------------------------------------
 class AliAnalysisVertexingHF : public TNamed {
@@ -72,6 +73,7 @@ class AliAnalysisVertexingHF : public TNamed {
   Bool_t FillRecoCand(AliVEvent *event,AliAODRecoDecayHF2Prong *rd2);
   Bool_t FillRecoCasc(AliVEvent *event,AliAODRecoCascadeHF *rc,Bool_t isDStar,Bool_t recoSecVtx=kFALSE);
   Bool_t RecoSecondaryVertexForCascades(AliVEvent *event, AliAODRecoCascadeHF *rc);
+  static void FillAODTrackMap(AliVEvent *aod,Int_t *map,Int_t size);
   void PrintStatus() const;
   void SetSecVtxWithKF() { fSecVtxWithKF=kTRUE; }
   void SetD0toKpiOn() { fD0toKpi=kTRUE; }
@@ -94,6 +96,7 @@ class AliAnalysisVertexingHF : public TNamed {
   void SetMixEventOff() { fMixEvent=kFALSE; }
   void SetInputAOD() { fInputAOD=kTRUE; }
   void SetMakeReducedRHF(Bool_t makeredAOD=kFALSE) { fMakeReducedRHF=makeredAOD; }
+  void SetUseEventCache(Bool_t use=kTRUE) { fUseEventCache=use; }
   Bool_t GetD0toKpi() const { return fD0toKpi; }
   Bool_t GetJPSItoEle() const { return fJPSItoEle; }
   Bool_t Get3Prong() const { return f3Prong; }
@@ -107,6 +110,7 @@ class AliAnalysisVertexingHF : public TNamed {
   Bool_t GetRecoPrimVtxSkippingTrks() const {return fRecoPrimVtxSkippingTrks;}
   Bool_t GetRmTrksFromPrimVtx() const {return fRmTrksFromPrimVtx;}
   Bool_t GetMakeReducedRHF() const {return fMakeReducedRHF;}
+  Bool_t GetUseEventCache() const {return fUseEventCache;}
   void SetFindVertexForDstar(Bool_t vtx=kTRUE) { fFindVertexForDstar=vtx; }
   void SetFindVertexForCascades(Bool_t vtx=kTRUE) { fFindVertexForCascades=vtx; }
 
@@ -340,6 +344,8 @@ class AliAnalysisVertexingHF : public TNamed {
   Int_t  fnTrksTotal;
   Int_t  fnSeleTrksTotal;
   Bool_t fMakeReducedRHF;// switch the reduction of dAOD size on/off
+  Bool_t fUseEventCache; /// share the refill of reduced candidates between wagons (AliVertexingHFEventCache)
+  Bool_t fAODMapShared; //! fAODMap owned by the AliVertexingHFEventCache of the event
 
   Double_t fMassDzero;
   Double_t fMassDplus;
@@ -391,6 +397,10 @@ class AliAnalysisVertexingHF : public TNamed {
 				   Bool_t &okCascades);
 
   void MapAODtracks(AliVEvent *aod);
+  Bool_t RefillRecoCand(AliVEvent *event,AliAODRecoDecayHF3Prong *rd3);
+  Bool_t RefillRecoCand(AliVEvent *event,AliAODRecoDecayHF2Prong *rd2);
+  Bool_t RefillRecoCasc(AliVEvent *event,AliAODRecoCascadeHF *rc,Bool_t isDStar,Bool_t recoSecVtx);
+  void UseEventCacheAODMap(AliVertexingHFEventCache *cache);
   AliAODVertex* PrimaryVertex(const TObjArray *trkArray=0x0,AliVEvent *event=0x0) const;
   AliAODVertex* ReconstructSecondaryVertex(TObjArray *trkArray,Double_t &dispersion,Bool_t useTRefArray=kTRUE) const;
 
@@ -420,7 +430,7 @@ class AliAnalysisVertexingHF : public TNamed {
 				  TObjArray *twoTrackArrayV0);
 
   /// \cond CLASSIMP
-  ClassDef(AliAnalysisVertexingHF,27);  // Reconstruction of HF decay candidates
+  ClassDef(AliAnalysisVertexingHF,28);  // Reconstruction of HF decay candidates
   /// \endcond
 };
 
@@ -39,6 +39,7 @@
 #include <TObjArray.h>
 #include <TString.h>
 #include <TCanvas.h>
+#include <TBuffer.h>
 #include <AliPhysicsSelection.h>
 #include <AliMultiplicity.h>
 
@@ -46,6 +47,12 @@
 ClassImp(AliNormalizationCounter);
 /// \endcond
 
+const char *AliNormalizationCounter::fgkCountedEventNames[AliNormalizationCounter::kNCountedEvents] = {
+  "triggered","V0AND","PileUp","PbPbC0SMH-B-NOPF-ALLNOTRD","Candles0.3","PrimaryV","countForNorm",
+  "noPrimaryV","zvtxGT10","!V0A&Candle03","!V0A&PrimaryV",
+  "Candid(Filter)","Candid(Analysis)","NCandid(Filter)","NCandid(Analysis)"
+};
+
 //____________________________________________
 AliNormalizationCounter::AliNormalizationCounter(): 
 TNamed(),
@@ -61,7 +68,11 @@ fHistTrackFilterSpdMult(0),
 fHistTrackAnaSpdMult(0),
 fHistGenVertexZ(0),
 fHistGenVertexZRecoPV(0),
-fHistRecoVertexZ(0)
+fHistRecoVertexZ(0),
+fUseFastCounters(kTRUE),
+fFastRun(-1),
+fFastNSph(0),
+fFastCounts()
 {
   // empty constructor
 }
@@ -81,7 +92,11 @@ fHistTrackFilterSpdMult(0),
 fHistTrackAnaSpdMult(0),
 fHistGenVertexZ(0),
 fHistGenVertexZRecoPV(0),
-fHistRecoVertexZ(0)
+fHistRecoVertexZ(0),
+fUseFastCounters(kTRUE),
+fFastRun(-1),
+fFastNSph(0),
+fFastCounts()
 {
   ;
 }
@@ -115,8 +130,10 @@ AliNormalizationCounter::~AliNormalizationCounter()
 void AliNormalizationCounter::Init()
 {
   //variables initialization
-  fCounters.AddRubric("Event","triggered/V0AND/PileUp/PbPbC0SMH-B-NOPF-ALLNOTRD/Candles0.3/PrimaryV/countForNorm/noPrimaryV/zvtxGT10/!V0A&Candle03/!V0A&PrimaryV/Candid(Filter)/Candid(Analysis)/NCandid(Filter)/NCandid(Analysis)");
-  if(fMultiplicity)  fCounters.AddRubric("Multiplicity", 5000);
+  TString events;
+  for(Int_t i=0; i<kNCountedEvents; i++) events += (i>0 ? "/" : "") + TString(fgkCountedEventNames[i]);
+  fCounters.AddRubric("Event",events);
+  if(fMultiplicity)  fCounters.AddRubric("Multiplicity", fgkMaxFastMultiplicity);
   if(fSpherocity)  fCounters.AddRubric("Spherocity", (Int_t)fSpherocitySteps+1);
   fCounters.AddRubric("Run", 1000000);
   fCounters.Init();
@@ -161,6 +178,8 @@ Long64_t AliNormalizationCounter::Merge(TCollection* list){
 }
 //_______________________________________
 void AliNormalizationCounter::Add(const AliNormalizationCounter *norm){
+  FlushFastCounters();
+  const_cast<AliNormalizationCounter*>(norm)->FlushFastCounters();
   fCounters.Add(&(norm->fCounters));
   fHistTrackFilterEvMult->Add(norm->fHistTrackFilterEvMult);
   fHistTrackAnaEvMult->Add(norm->fHistTrackAnaEvMult);
@@ -202,7 +221,7 @@ void AliNormalizationCounter::StoreEvent(AliVEvent *event,AliRDHFCuts *rdCut,Boo
   //event must be either physics or MC
   if(!(event->GetEventType() == 7||event->GetEventType() == 0))return;
   
-  FillCounters("triggered",runNumber,multiplicity,spherocity);
+  FillCounters(kTriggered,runNumber,multiplicity,spherocity);
 
   //Find V0AND
   AliTriggerAnalysis trAn; /// Trigger Analysis
@@ -213,7 +232,7 @@ void AliNormalizationCounter::StoreEvent(AliVEvent *event,AliRDHFCuts *rdCut,Boo
     v0B = trAn.IsOfflineTriggerFired(eventESD , AliTriggerAnalysis::kV0C);
     v0A = trAn.IsOfflineTriggerFired(eventESD , AliTriggerAnalysis::kV0A);
   }
-  if(v0A&&v0B) FillCounters("V0AND",runNumber,multiplicity,spherocity);
+  if(v0A&&v0B) FillCounters(kV0AND,runNumber,multiplicity,spherocity);
   
   //FindPrimary vertex  
   // AliVVertex *vtrc =  (AliVVertex*)event->GetPrimaryVertex();
@@ -226,30 +245,30 @@ void AliNormalizationCounter::StoreEvent(AliVEvent *event,AliRDHFCuts *rdCut,Boo
   AliAODEvent *eventAOD = (AliAODEvent*)event;
   TString trigclass=eventAOD->GetFiredTriggerClasses();
   if(trigclass.Contains("C0SMH-B-NOPF-ALLNOTRD")||trigclass.Contains("C0SMH-B-NOPF-ALL")){
-    FillCounters("PbPbC0SMH-B-NOPF-ALLNOTRD",runNumber,multiplicity,spherocity);
+    FillCounters(kPbPbC0SMH,runNumber,multiplicity,spherocity);
   }
 
   //FindPrimary vertex  
   if(isEventSelected){
-    FillCounters("PrimaryV",runNumber,multiplicity,spherocity);
+    FillCounters(kPrimaryV,runNumber,multiplicity,spherocity);
     flagPV=kTRUE;
   }else{
     if(rdCut->GetWhyRejection()==0){
-      FillCounters("noPrimaryV",runNumber,multiplicity,spherocity);
+      FillCounters(kNoPrimaryV,runNumber,multiplicity,spherocity);
     }
     //find good vtx outside range
     if(rdCut->GetWhyRejection()==6){
-      FillCounters("zvtxGT10",runNumber,multiplicity,spherocity);
-      FillCounters("PrimaryV",runNumber,multiplicity,spherocity);
+      FillCounters(kZvtxGT10,runNumber,multiplicity,spherocity);
+      FillCounters(kPrimaryV,runNumber,multiplicity,spherocity);
       flagPV=kTRUE;
     }
     if(rdCut->GetWhyRejection()==1){
-      FillCounters("PileUp",runNumber,multiplicity,spherocity);
+      FillCounters(kPileUp,runNumber,multiplicity,spherocity);
     }
   }
   //to be counted for normalization
   if(rdCut->CountEventForNormalization()){
-    FillCounters("countForNorm",runNumber,multiplicity,spherocity);
+    FillCounters(kCountForNorm,runNumber,multiplicity,spherocity);
   }
   // fill histograms of vertex position
   if(mc){
@@ -270,17 +289,17 @@ void AliNormalizationCounter::StoreEvent(AliVEvent *event,AliRDHFCuts *rdCut,Boo
   for(Int_t i=0;i<trkEntries&&!flag03;i++){
     AliAODTrack *track=(AliAODTrack*)event->GetTrack(i);
     if((track->Pt()>0.3)&&(!flag03)){
-      FillCounters("Candles0.3",runNumber,multiplicity,spherocity);
+      FillCounters(kCandles03,runNumber,multiplicity,spherocity);
       flag03=kTRUE;
       break;
     }
   }
   
   if(!(v0A&&v0B)&&(flag03)){ 
-    FillCounters("!V0A&Candle03",runNumber,multiplicity,spherocity);
+    FillCounters(kNoV0AandCandle03,runNumber,multiplicity,spherocity);
   }
   if(!(v0A&&v0B)&&flagPV){
-    FillCounters("!V0A&PrimaryV",runNumber,multiplicity,spherocity);
+    FillCounters(kNoV0AandPrimaryV,runNumber,multiplicity,spherocity);
   }
   
   return;
@@ -305,37 +324,23 @@ void AliNormalizationCounter::StoreCandidates(AliVEvent *event,Int_t nCand,Bool_
   if(flagFilter)fHistTrackFilterSpdMult->Fill(nSPD,nCand);
   else fHistTrackAnaSpdMult->Fill(nSPD,nCand);
   
+  if(nCand<=0)return;
   Int_t runNumber = event->GetRunNumber();
-  Int_t multiplicity = Multiplicity(event);
-  if(nCand==0)return;
+  Int_t multiplicity = fMultiplicity ? Multiplicity(event) : 0;
+  // candidate keys never have the spherocity
   if(flagFilter){
-    if(fMultiplicity) 
-      fCounters.Count(Form("Event:Candid(Filter)/Run:%d/Multiplicity:%d",runNumber,multiplicity));
-    else 
-      fCounters.Count(Form("Event:Candid(Filter)/Run:%d",runNumber));
-    for(Int_t i=0;i<nCand;i++){ 
-      if(fMultiplicity) 
-	fCounters.Count(Form("Event:NCandid(Filter)/Run:%d/Multiplicity:%d",runNumber,multiplicity));
-      else 
-	fCounters.Count(Form("Event:NCandid(Filter)/Run:%d",runNumber));
-    }
+    CountEvent(kCandidFilter,runNumber,multiplicity,0,kFALSE,1);
+    CountEvent(kNCandidFilter,runNumber,multiplicity,0,kFALSE,nCand);
   }else{
-    if(fMultiplicity) 
-      fCounters.Count(Form("Event:Candid(Analysis)/Run:%d/Multiplicity:%d",runNumber,multiplicity));
-    else
-      fCounters.Count(Form("Event:Candid(Analysis)/Run:%d",runNumber));
-    for(Int_t i=0;i<nCand;i++){ 
-      if(fMultiplicity) 
-	fCounters.Count(Form("Event:NCandid(Analysis)/Run:%d/Multiplicity:%d",runNumber,multiplicity));
-      else
-	fCounters.Count(Form("Event:NCandid(Analysis)/Run:%d",runNumber));
-    }
+    CountEvent(kCandidAnalysis,runNumber,multiplicity,0,kFALSE,1);
+    CountEvent(kNCandidAnalysis,runNumber,multiplicity,0,kFALSE,nCand);
   }
   return;
 }
 //_______________________________________________________________________
 TH1D* AliNormalizationCounter::DrawAgainstRuns(TString candle,Bool_t drawHist){
   //
+  FlushFastCounters();
   fCounters.SortRubric("Run");
   TString selection;
   selection.Form("event:%s",candle.Data());
@@ -348,6 +353,7 @@ TH1D* AliNormalizationCounter::DrawAgainstRuns(TString candle,Bool_t drawHist){
 //___________________________________________________________________________
 TH1D* AliNormalizationCounter::DrawRatio(TString candle1,TString candle2){
   //
+  FlushFastCounters();
   fCounters.SortRubric("Run");
   TString name;
 
@@ -365,10 +371,12 @@ TH1D* AliNormalizationCounter::DrawRatio(TString candle1,TString candle2){
 }
 //___________________________________________________________________________
 void AliNormalizationCounter::PrintRubrics(){
+  FlushFastCounters();
   fCounters.PrintKeyWords();
 }
 //___________________________________________________________________________
 Double_t AliNormalizationCounter::GetSum(TString candle){
+  FlushFastCounters();
   TString selection="event:";
   selection.Append(candle);
   return fCounters.GetSum(selection.Data());
@@ -400,6 +408,7 @@ Double_t AliNormalizationCounter::GetNEventsForNorm(){
 }
 //___________________________________________________________________________
 Double_t AliNormalizationCounter::GetNEventsForNorm(Int_t runnumber){
+  FlushFastCounters();
   TString listofruns = fCounters.GetKeyWords("RUN");
   if(!listofruns.Contains(Form("%d",runnumber))){
     printf("WARNING: %d is not a valid run number\n",runnumber);
@@ -417,6 +426,7 @@ Double_t AliNormalizationCounter::GetNEventsForNorm(Int_t runnumber){
 
 //___________________________________________________________________________
 Double_t AliNormalizationCounter::GetNEventsForNorm(Int_t minmultiplicity, Int_t maxmultiplicity){
+  FlushFastCounters();
 
   if(!fMultiplicity) {
     AliInfo("Sorry, you didn't activate the multiplicity in the counter!");
@@ -448,6 +458,7 @@ Double_t AliNormalizationCounter::GetNEventsForNorm(Int_t minmultiplicity, Int_t
 }
 //___________________________________________________________________________
 Double_t AliNormalizationCounter::GetNEventsForNorm(Int_t minmultiplicity, Int_t maxmultiplicity, Double_t minspherocity, Double_t maxspherocity){
+  FlushFastCounters();
 
   if(!fMultiplicity || !fSpherocity) {
     AliInfo("You must activate both multiplicity and spherocity in the counters to use this method!");
@@ -489,6 +500,7 @@ Double_t AliNormalizationCounter::GetNEventsForNorm(Int_t minmultiplicity, Int_t
 
 //___________________________________________________________________________
 Double_t AliNormalizationCounter::GetNEventsForNormSpheroOnly(Double_t minspherocity, Double_t maxspherocity){
+  FlushFastCounters();
 
   if(!fSpherocity) {
     AliInfo("Sorry, you didn't activate the sphericity in the counter!");
@@ -524,6 +536,7 @@ Double_t AliNormalizationCounter::GetNEventsForNormSpheroOnly(Double_t minsphero
 }
 //___________________________________________________________________________
 Double_t AliNormalizationCounter::GetSum(TString candle,Int_t minmultiplicity, Int_t maxmultiplicity){
+  FlushFastCounters();
   // counts events of given type in a given multiplicity range
 
   if(!fMultiplicity) {
@@ -549,6 +562,7 @@ Double_t AliNormalizationCounter::GetSum(TString candle,Int_t minmultiplicity, I
 //___________________________________________________________________________
 TH1D* AliNormalizationCounter::DrawNEventsForNorm(Bool_t drawRatio){
   //usare algebra histos
+  FlushFastCounters();
   fCounters.SortRubric("Run");
   TString selection;
 
@@ -605,15 +619,79 @@ Int_t AliNormalizationCounter::Multiplicity(AliVEvent* event){
 //___________________________________________________________________________
 void AliNormalizationCounter::FillCounters(TString name, Int_t runNumber, Int_t multiplicity, Double_t spherocity){
 
+  Int_t sphToInteger=spherocity*fSpherocitySteps;
+  CountKey(name.Data(),runNumber,multiplicity,sphToInteger,fSpherocity,1);
+  return;
+}
+//___________________________________________________________________________
+void AliNormalizationCounter::FillCounters(ECountedEvent type, Int_t runNumber, Int_t multiplicity, Double_t spherocity, Int_t n){
+  // count n events of category type, same as FillCounters(fgkCountedEventNames[type],...)
+  // without building and parsing the key of the counter collection
 
   Int_t sphToInteger=spherocity*fSpherocitySteps;
-  if(fMultiplicity  && !fSpherocity) 
-    fCounters.Count(Form("Event:%s/Run:%d/Multiplicity:%d",name.Data(),runNumber,multiplicity));
-  else if(fMultiplicity  && fSpherocity) 
-    fCounters.Count(Form("Event:%s/Run:%d/Multiplicity:%d/Spherocity:%d",name.Data(),runNumber,multiplicity,sphToInteger));
-  else if(!fMultiplicity  && fSpherocity) 
-    fCounters.Count(Form("Event:%s/Run:%d/Spherocity:%d",name.Data(),runNumber,sphToInteger));
-  else 
-    fCounters.Count(Form("Event:%s/Run:%d",name.Data(),runNumber));
+  CountEvent(type,runNumber,multiplicity,sphToInteger,fSpherocity,n);
+  return;
+}
+//___________________________________________________________________________
+void AliNormalizationCounter::CountEvent(Int_t type, Int_t runNumber, Int_t multiplicity, Int_t sphToInteger, Bool_t withSph, Int_t n){
+  // count in the dense array of the current run; values which cannot be
+  // stored there go directly to the counter collection
+
+  if(n<=0) return;
+  if(fUseFastCounters && (runNumber!=fFastRun || fFastNSph==0)){
+    FlushFastCounters();
+    fFastRun=runNumber;
+    fFastNSph=(fSpherocity ? (Int_t)fSpherocitySteps+1 : 0)+1;
+  }
+  Int_t imult = fMultiplicity ? multiplicity : 0;
+  Int_t isph = withSph ? sphToInteger : fFastNSph-1;
+  if(!fUseFastCounters || imult<0 || imult>=fgkMaxFastMultiplicity || isph<0 || isph>=fFastNSph || (withSph && isph==fFastNSph-1)){
+    CountKey(fgkCountedEventNames[type],runNumber,multiplicity,sphToInteger,withSph,n);
+    return;
+  }
+  UInt_t index = ((UInt_t)imult*fFastNSph+isph)*kNCountedEvents+type;
+  if(index>=fFastCounts.size()) fFastCounts.resize(((UInt_t)imult+1)*fFastNSph*kNCountedEvents,0);
+  fFastCounts[index]+=n;
+  return;
+}
+//___________________________________________________________________________
+void AliNormalizationCounter::CountKey(const char *name, Int_t runNumber, Int_t multiplicity, Int_t sphToInteger, Bool_t withSph, Int_t n){
+  // count n times the key of the counter collection
+
+  if(fMultiplicity  && withSph)
+    fCounters.Count(Form("Event:%s/Run:%d/Multiplicity:%d/Spherocity:%d",name,runNumber,multiplicity,sphToInteger),n);
+  else if(fMultiplicity)
+    fCounters.Count(Form("Event:%s/Run:%d/Multiplicity:%d",name,runNumber,multiplicity),n);
+  else if(withSph)
+    fCounters.Count(Form("Event:%s/Run:%d/Spherocity:%d",name,runNumber,sphToInteger),n);
+  else
+    fCounters.Count(Form("Event:%s/Run:%d",name,runNumber),n);
   return;
 }
+//___________________________________________________________________________
+void AliNormalizationCounter::FlushFastCounters(){
+  // move the counts of the current run to the counter collection
+
+  if(fFastCounts.empty()) return;
+  for(UInt_t index=0; index<fFastCounts.size(); index++){
+    if(fFastCounts[index]==0) continue;
+    Int_t type = index%kNCountedEvents;
+    Int_t isph = (index/kNCountedEvents)%fFastNSph;
+    Int_t imult = (index/kNCountedEvents)/fFastNSph;
+    CountKey(fgkCountedEventNames[type],fFastRun,imult,isph,isph<fFastNSph-1,fFastCounts[index]);
+  }
+  fFastCounts.clear();
+  return;
+}
+//___________________________________________________________________________
+void AliNormalizationCounter::Streamer(TBuffer &R__b){
+  // Stream an object of class AliNormalizationCounter,
+  // with the fast counters moved to the counter collection before writing
+
+  if (R__b.IsReading()) {
+    R__b.ReadClassBuffer(AliNormalizationCounter::Class(),this);
+  } else {
+    FlushFastCounters();
+    R__b.WriteClassBuffer(AliNormalizationCounter::Class(),this);
+  }
+}
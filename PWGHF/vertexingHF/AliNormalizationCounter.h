@@ -44,23 +44,32 @@
 #include "AliAnalysisDataContainer.h"
 #include "AliRDHFCuts.h"
 //#include "AliAnalysisVertexingHF.h"
+#include <vector>
 
 class AliNormalizationCounter : public TNamed
 {
  public:
 
+  /// event categories, keywords of the "Event" rubric
+  enum ECountedEvent { kTriggered, kV0AND, kPileUp, kPbPbC0SMH, kCandles03, kPrimaryV, kCountForNorm,
+                       kNoPrimaryV, kZvtxGT10, kNoV0AandCandle03, kNoV0AandPrimaryV,
+                       kCandidFilter, kCandidAnalysis, kNCandidFilter, kNCandidAnalysis, kNCountedEvents };
+
   AliNormalizationCounter();
   AliNormalizationCounter(const char *name);
   virtual ~AliNormalizationCounter();
   Long64_t Merge(TCollection* list);
 
-  AliCounterCollection* GetCounter(){return &fCounters;}
+  AliCounterCollection* GetCounter(){FlushFastCounters(); return &fCounters;}
   void Init();
   void Add(const AliNormalizationCounter*);
   void SetESD(Bool_t flag){fESD=flag;}
   void SetStudyMultiplicity(Bool_t flag, Float_t etaRange){ fMultiplicity=flag; fMultiplicityEtaRange=etaRange; }
   void SetStudySpherocity(Bool_t flag, Double_t nsteps=100.){fSpherocity=flag;
     fSpherocitySteps=nsteps;}
+  void SetUseFastCounters(Bool_t flag=kTRUE){ FlushFastCounters(); fUseFastCounters=flag; }
+  void FillCounters(ECountedEvent type, Int_t runNumber, Int_t multiplicity, Double_t spherocity, Int_t n=1);
+  void FlushFastCounters();
   void StoreEvent(AliVEvent*,AliRDHFCuts *,Bool_t mc=kFALSE, Int_t multiplicity=-9999, Double_t spherocity=-99.);
   void StoreCandidates(AliVEvent*, Int_t nCand=0,Bool_t flagFilter=kTRUE);
   TH1D* DrawAgainstRuns(TString candle="candid(filter)",Bool_t drawHist=kTRUE);
@@ -88,6 +97,11 @@ class AliNormalizationCounter : public TNamed
   AliNormalizationCounter& operator=(const AliNormalizationCounter& source);
   Int_t Multiplicity(AliVEvent* event);
   void FillCounters(TString name, Int_t runNumber, Int_t multiplicity, Double_t spherocity);
+  void CountEvent(Int_t type, Int_t runNumber, Int_t multiplicity, Int_t sphToInteger, Bool_t withSph, Int_t n);
+  void CountKey(const char *name, Int_t runNumber, Int_t multiplicity, Int_t sphToInteger, Bool_t withSph, Int_t n);
+
+  static const char *fgkCountedEventNames[kNCountedEvents]; /// keywords of the "Event" rubric
+  static const Int_t fgkMaxFastMultiplicity = 5000; /// multiplicities counted in the fast counters (size of the rubric)
 
 
   AliCounterCollection fCounters; /// internal counter
@@ -103,9 +117,13 @@ class AliNormalizationCounter : public TNamed
   TH1F *fHistGenVertexZ;       /// histo of generated z vertex
   TH1F *fHistGenVertexZRecoPV; /// histo of generated z vertex for events with reco vert
   TH1F *fHistRecoVertexZ;      /// histo of reconstructed z vertex
+  Bool_t fUseFastCounters;     /// count in fFastCounts, moved to fCounters before any use of fCounters
+  Int_t fFastRun;              //! run of fFastCounts
+  Int_t fFastNSph;             //! spherocity slots in fFastCounts (the last one for keys without spherocity)
+  std::vector<Int_t> fFastCounts; //! counts per multiplicity, spherocity slot and event category
 
   /// \cond CLASSIMP    
-  ClassDef(AliNormalizationCounter,8);
+  ClassDef(AliNormalizationCounter,9);
   /// \endcond
 };
 #endif
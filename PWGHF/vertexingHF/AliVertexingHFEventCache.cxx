@@ -0,0 +1,136 @@
+/**************************************************************************
+ * Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+//----------------------------------------------------------------------------
+//    Per-event refill state of reduced HF candidates, shared between the
+//    AliAnalysisVertexingHF objects of all wagons of a train
+//----------------------------------------------------------------------------
+#include <Riostream.h>
+#include "AliVEvent.h"
+#include "AliAnalysisVertexingHF.h"
+#include "AliVertexingHFEventCache.h"
+
+/// \cond CLASSIMP
+ClassImp(AliVertexingHFEventCache);
+/// \endcond
+
+const char *AliVertexingHFEventCache::fgkCacheName = "AliVertexingHFEventCache";
+
+//----------------------------------------------------------------------------
+AliVertexingHFEventCache::AliVertexingHFEventCache():
+TNamed(fgkCacheName,fgkCacheName),
+fEvent(0),
+fEventKey(),
+fAODMap(),
+fAODMapFilled(kFALSE),
+fFailed(),
+fMaxFailedCandidates(10000),
+fNHits(0),
+fNMisses(0),
+fNFailed(0)
+{
+  /// Default constructor
+}
+//----------------------------------------------------------------------------
+AliVertexingHFEventCache::AliVertexingHFEventCache(const char *name):
+TNamed(name,name),
+fEvent(0),
+fEventKey(),
+fAODMap(),
+fAODMapFilled(kFALSE),
+fFailed(),
+fMaxFailedCandidates(10000),
+fNHits(0),
+fNMisses(0),
+fNFailed(0)
+{
+  /// Named constructor
+}
+//----------------------------------------------------------------------------
+AliVertexingHFEventCache *AliVertexingHFEventCache::GetCache(AliVEvent *event){
+  /// Get the cache of the event. The cache is created and attached to the
+  /// event when called for the first time, and reset when called for a new event.
+
+  if(!event) return 0;
+
+  AliVertexingHFEventCache *cache = AliEventCacheKey::GetEventObject<AliVertexingHFEventCache>(event,fgkCacheName);
+  // without an event identifier nothing can be shared safely, Set() then always reports a new event
+  if(cache->fEventKey.Set(event)) cache->NextEvent(event);
+
+  return cache;
+}
+//----------------------------------------------------------------------------
+void AliVertexingHFEventCache::NextEvent(AliVEvent *event){
+  /// Reset the cache for a new event. The statistics are kept.
+
+  fEvent = event;
+  fAODMapFilled = kFALSE;
+  fFailed.clear();
+}
+//----------------------------------------------------------------------------
+Int_t *AliVertexingHFEventCache::GetAODMap(Int_t &size){
+  /// Map between ID and index of the AOD tracks of the event,
+  /// filled at the first call in the event
+
+  if(!fAODMapFilled) {
+    fAODMap.resize(100000);
+    AliAnalysisVertexingHF::FillAODTrackMap(fEvent,&fAODMap[0],(Int_t)fAODMap.size());
+    fAODMapFilled = kTRUE;
+  }
+  size = (Int_t)fAODMap.size();
+  return &fAODMap[0];
+}
+//----------------------------------------------------------------------------
+Bool_t AliVertexingHFEventCache::GetRefillStatus(const TObject *cand, Int_t mode, Int_t isFilled, Bool_t &ok){
+  /// Look up the refill of a candidate in this event.
+  /// mode distinguishes different refills of the same candidate object,
+  /// isFilled is the current AliAODRecoDecayHF::GetIsFilled() of the candidate.
+  /// Returns kFALSE if the candidate still has to be refilled
+
+  if(isFilled==1) {
+    // standard dAOD, nothing to refill
+    ok = kTRUE;
+    return kTRUE;
+  }
+  if(isFilled!=0) {
+    fNHits++;
+    ok = kTRUE;
+    return kTRUE;
+  }
+  if(!fFailed.empty() && fFailed.count(std::make_pair(cand,mode))) {
+    fNHits++;
+    ok = kFALSE;
+    return kTRUE;
+  }
+  return kFALSE;
+}
+//----------------------------------------------------------------------------
+void AliVertexingHFEventCache::SetRefillStatus(const TObject *cand, Int_t mode, Bool_t ok){
+  /// Store the result of a refill done in this event
+
+  fNMisses++;
+  if(ok) return;
+  fNFailed++;
+  if((Int_t)fFailed.size()<fMaxFailedCandidates) fFailed.insert(std::make_pair(cand,mode));
+}
+//----------------------------------------------------------------------------
+void AliVertexingHFEventCache::Print(Option_t * /*opt*/) const {
+  /// Print the cache statistics
+
+  Long64_t total = fNHits+fNMisses;
+  printf("AliVertexingHFEventCache: %lld refills requested, %lld found in the cache (%.1f%%), %lld done (%lld failed)\n",
+         total,fNHits,total>0 ? 100.*fNHits/total : 0.,fNMisses,fNFailed);
+  printf("  max. %d failed refills stored per event\n",fMaxFailedCandidates);
+}
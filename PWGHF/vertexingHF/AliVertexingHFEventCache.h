@@ -0,0 +1,79 @@
+#ifndef ALIVERTEXINGHFEVENTCACHE_H
+#define ALIVERTEXINGHFEVENTCACHE_H
+/* Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+//-------------------------------------------------------------------------
+/// \class AliVertexingHFEventCache
+/// \brief Per-event refill state of reduced HF candidates, shared between wagons
+///
+/// With reduced dAODs (AliAnalysisVertexingHF::SetMakeReducedRHF) the secondary
+/// vertex of every candidate is rebuilt on read by AliAnalysisVertexingHF::FillRecoCand
+/// and FillRecoCasc. A successful refill is stored in the candidate itself (IsFilled()==2),
+/// so later wagons skip it. The cache, attached to the input event, adds what is not
+/// stored in the candidates:
+/// - the map between track ID and index of the AOD tracks, built once per event
+///   instead of once per AliAnalysisVertexingHF object;
+/// - the candidates whose refill failed, so that later wagons do not retry them
+///   (at most GetMaxFailedCandidates() per event);
+/// - statistics on refills found in the cache (hits) and done (misses).
+///
+/// The event is identified by an AliEventCacheKey (entry and tree number of
+/// the analysis manager, event header).
+//-------------------------------------------------------------------------
+
+#include <set>
+#include <utility>
+#include <vector>
+
+#include <TNamed.h>
+
+#include "AliEventCacheKey.h"
+
+class AliVEvent;
+
+class AliVertexingHFEventCache : public TNamed {
+ public:
+  AliVertexingHFEventCache();
+  AliVertexingHFEventCache(const char *name);
+  virtual ~AliVertexingHFEventCache() {}
+
+  static AliVertexingHFEventCache *GetCache(AliVEvent *event);
+
+  void     NextEvent(AliVEvent *event);
+  const AliEventCacheKey &GetEventKey() const { return fEventKey; }
+
+  Int_t   *GetAODMap(Int_t &size);
+  Bool_t   GetRefillStatus(const TObject *cand, Int_t mode, Int_t isFilled, Bool_t &ok);
+  void     SetRefillStatus(const TObject *cand, Int_t mode, Bool_t ok);
+
+  void     SetMaxFailedCandidates(Int_t n) { fMaxFailedCandidates=n; }
+  Int_t    GetMaxFailedCandidates() const { return fMaxFailedCandidates; }
+  Long64_t GetNHits() const { return fNHits; }
+  Long64_t GetNMisses() const { return fNMisses; }
+  Long64_t GetNFailed() const { return fNFailed; }
+  virtual void Print(Option_t *opt="") const;
+
+  static const char *fgkCacheName; /// Name of the cache object in the event
+
+ protected:
+  AliVEvent *fEvent;                 //!<! Current event
+  AliEventCacheKey fEventKey;        //!<! Key of the current event
+  std::vector<Int_t> fAODMap;        //!<! Map between ID and index of the AOD tracks
+  Bool_t     fAODMapFilled;          //!<! fAODMap filled for the current event
+  std::set<std::pair<const TObject*,Int_t> > fFailed; //!<! Candidates (and refill mode) whose refill failed
+  Int_t      fMaxFailedCandidates;   /// Max. number of failed refills stored per event
+  Long64_t   fNHits;                 /// Refills found in the cache
+  Long64_t   fNMisses;               /// Refills done
+  Long64_t   fNFailed;               /// Refills done which failed
+
+ private:
+  AliVertexingHFEventCache(const AliVertexingHFEventCache &source);
+  AliVertexingHFEventCache &operator=(const AliVertexingHFEventCache &source);
+
+  /// \cond CLASSIMP
+  ClassDef(AliVertexingHFEventCache,2); // Per-event refill state of reduced HF candidates
+  /// \endcond
+};
+
+#endif
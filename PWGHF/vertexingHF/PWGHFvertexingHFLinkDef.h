@@ -33,6 +33,7 @@
 #pragma link C++ class AliRDHFCutsXicPlustoXiPiPifromAODtracks++;
 #pragma link C++ class AliRDHFCutsXictoeleXifromAODtracks+;
 #pragma link C++ class AliAnalysisVertexingHF+;
+#pragma link C++ class AliVertexingHFEventCache+;
 #pragma link C++ class AliAnalysisTaskSEVertexingHF+;
 #pragma link C++ class AliAnalysisTaskMEVertexingHF+;
 #pragma link C++ class AliAnalysisTaskSEB0toDStarPi+;
@@ -79,7 +80,7 @@
 #pragma link C++ class AliHFMassFitter+;
 #pragma link C++ class AliHFPtSpectrum+;
 #pragma link C++ class AliHFsubtractBFDcuts+;
-#pragma link C++ class AliNormalizationCounter+;
+#pragma link C++ class AliNormalizationCounter-;
 #pragma link C++ class AliAnalysisTaskSEMonitNorm+;
 #pragma link C++ class AliAnalysisTaskSEBkgLikeSignD0+;
 #pragma link C++ class AliAnalysisTaskSEImproveITS+;
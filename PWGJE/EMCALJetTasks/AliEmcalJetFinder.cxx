@@ -147,7 +147,7 @@ Bool_t AliEmcalJetFinder::Filter(AliEmcalJet *pJet, AliJetContainer *pContJets,
 //=============================================================================
 
   if (pJet->HasGhost()) {
-    const std::vector<TLorentzVector> aGhosts = pJet->GetGhosts();
+    const std::vector<TLorentzVector>& aGhosts = pJet->GetGhosts();
     for (UInt_t i=0; i<aGhosts.size(); i++) AddInputGhost(aGhosts[i].Px(),
                                                           aGhosts[i].Py(),
                                                           aGhosts[i].Pz(),
@@ -315,7 +315,7 @@ Double_t AliEmcalJetFinder::Nsubjettiness(AliEmcalJet *pJet, AliJetContainer *pC
 //=============================================================================
 
   if (pJet->HasGhost()) {
-    const std::vector<TLorentzVector> aGhosts = pJet->GetGhosts();
+    const std::vector<TLorentzVector>& aGhosts = pJet->GetGhosts();
     for (UInt_t i=0; i<aGhosts.size(); i++) AddInputGhost(aGhosts[i].Px(),
                                                           aGhosts[i].Py(),
                                                           aGhosts[i].Pz(),
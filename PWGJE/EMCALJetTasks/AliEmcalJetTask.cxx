@@ -88,7 +88,10 @@ AliEmcalJetTask::AliEmcalJetTask() :
   fJets(0),
   fFastJetWrapper("AliEmcalJetTask","AliEmcalJetTask"),
   fClusterContainerIndexMap(),
-  fParticleContainerIndexMap()
+  fParticleContainerIndexMap(),
+  fSortedJetIndexes(),
+  fSortedJetPt(),
+  fJetConstituents()
 {
 }
 
@@ -128,7 +131,10 @@ AliEmcalJetTask::AliEmcalJetTask(const char *name) :
   fJets(0),
   fFastJetWrapper(name,name),
   fClusterContainerIndexMap(),
-  fParticleContainerIndexMap()
+  fParticleContainerIndexMap(),
+  fSortedJetIndexes(),
+  fSortedJetPt(),
+  fJetConstituents()
 {
 }
 
@@ -247,6 +253,15 @@ Int_t AliEmcalJetTask::FindJets()
 
   AliDebug(2,Form("Jet type = %d", fJetType));
 
+  // Reserve the input vectors once for the largest event seen so far (capacity is kept by Clear())
+  UInt_t nInputs = 0;
+  AliEmcalContainer* cont = 0;
+  TIter nextPartSize(&fParticleCollArray);
+  while ((cont = static_cast<AliEmcalContainer*>(nextPartSize()))) nInputs += cont->GetNEntries();
+  TIter nextClusSize(&fClusterCollArray);
+  while ((cont = static_cast<AliEmcalContainer*>(nextClusSize()))) nInputs += cont->GetNEntries();
+  fFastJetWrapper.ReserveInputVectors(nInputs);
+
   Int_t iColl = 1;
   TIter nextPartColl(&fParticleCollArray);
   AliParticleContainer* tracks = 0;
@@ -306,14 +321,13 @@ void AliEmcalJetTask::FillJetBranch()
   PrepareUtilities();
 
   // loop over fastjet jets
-  std::vector<fastjet::PseudoJet> jets_incl = fFastJetWrapper.GetInclusiveJets();
+  const std::vector<fastjet::PseudoJet>& jets_incl = fFastJetWrapper.GetInclusiveJets();
   // sort jets according to jet pt
-  static Int_t indexes[9999] = {-1};
-  GetSortedArray(indexes, jets_incl);
+  GetSortedArray(fSortedJetIndexes, jets_incl);
 
   AliDebug(1,Form("%d jets found", (Int_t)jets_incl.size()));
   for (UInt_t ijet = 0, jetCount = 0; ijet < jets_incl.size(); ++ijet) {
-    Int_t ij = indexes[ijet];
+    Int_t ij = fSortedJetIndexes[ijet];
     AliDebug(3,Form("Jet pt = %f, area = %f", jets_incl[ij].perp(), fFastJetWrapper.GetJetArea(ij)));
 
     if (jets_incl[ij].perp() < fMinJetPt) continue;
@@ -334,8 +348,8 @@ void AliEmcalJetTask::FillJetBranch()
     jet->SetJetAcceptanceType(FindJetAcceptanceType(jet->Eta(), jet->Phi_0_2pi(), fRadius));
 
     // Fill constituent info
-    std::vector<fastjet::PseudoJet> constituents(fFastJetWrapper.GetJetConstituents(ij));
-    FillJetConstituents(jet, constituents, constituents);
+    fFastJetWrapper.GetJetConstituents(ij, fJetConstituents);
+    FillJetConstituents(jet, fJetConstituents, fJetConstituents);
 
     if (fGeom) {
       if ((jet->Phi() > fGeom->GetArm1PhiMin() * TMath::DegToRad()) &&
@@ -356,23 +370,23 @@ void AliEmcalJetTask::FillJetBranch()
 
 /**
  * Sorts jets by pT (decreasing)
- * @param[out] indexes This array is used to return the indexes of the jets ordered by pT
+ * @param[out] indexes This vector is used to return the indexes of the jets ordered by pT
  * @param[in] array Vector containing the list of jets obtained by the FastJet wrapper
  * @return kTRUE if at least one jet was found in array; kFALSE otherwise
  */
-Bool_t AliEmcalJetTask::GetSortedArray(Int_t indexes[], std::vector<fastjet::PseudoJet> array) const
+Bool_t AliEmcalJetTask::GetSortedArray(std::vector<Int_t>& indexes, const std::vector<fastjet::PseudoJet>& array)
 {
-  static Float_t pt[9999] = {0};
-
   const Int_t n = (Int_t)array.size();
 
+  indexes.resize(n);
   if (n < 1)
     return kFALSE;
 
+  fSortedJetPt.resize(n);
   for (Int_t i = 0; i < n; i++)
-    pt[i] = array[i].perp();
+    fSortedJetPt[i] = array[i].perp();
 
-  TMath::Sort(n, pt, indexes);
+  TMath::Sort(n, &fSortedJetPt[0], &indexes[0]);
 
   return kTRUE;
 }
@@ -435,7 +449,9 @@ void AliEmcalJetTask::ExecOnce()
   fFastJetWrapper.SetAlgorithm(ConvertToFJAlgo(fJetAlgo));
   fFastJetWrapper.SetRecombScheme(ConvertToFJRecoScheme(fRecombScheme));
   fFastJetWrapper.SetMaxRap(1);
- 
+  // area and jet definitions are created once and kept across events
+  fFastJetWrapper.SetReuseState(kTRUE);
+
 
   // setting legacy mode
   if (fLegacyMode) {
@@ -461,8 +477,8 @@ void AliEmcalJetTask::ExecOnce()
  * @param flag If kTRUE it means that the argument "constituents" is a list of subtracted constituents
  * @param particles_sub Array containing subtracted constituents
  */
-void AliEmcalJetTask::FillJetConstituents(AliEmcalJet *jet, std::vector<fastjet::PseudoJet>& constituents,
-    std::vector<fastjet::PseudoJet>& constituents_unsub, Int_t flag, TString particlesSubName)
+void AliEmcalJetTask::FillJetConstituents(AliEmcalJet *jet, const std::vector<fastjet::PseudoJet>& constituents,
+    const std::vector<fastjet::PseudoJet>& constituents_unsub, Int_t flag, const TString& particlesSubName)
 {
   Int_t nt            = 0;
   Int_t nc            = 0;
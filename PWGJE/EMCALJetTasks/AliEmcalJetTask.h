@@ -113,8 +113,8 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
   TClonesArray*          GetJets()                        { return fJets              ; }
   TObjArray*             GetUtilities()                   { return fUtilities         ; }
 
-  void                   FillJetConstituents(AliEmcalJet *jet, std::vector<fastjet::PseudoJet>& constituents,
-                                             std::vector<fastjet::PseudoJet>& constituents_sub, Int_t flag = 0, TString particlesSubName = "");
+  void                   FillJetConstituents(AliEmcalJet *jet, const std::vector<fastjet::PseudoJet>& constituents,
+                                             const std::vector<fastjet::PseudoJet>& constituents_sub, Int_t flag = 0, const TString& particlesSubName = "");
 
   UInt_t                 FindJetAcceptanceType(Double_t eta, Double_t phi, Double_t r);
   
@@ -164,7 +164,7 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
   void                   PrepareUtilities();
   void                   ExecuteUtilities(AliEmcalJet* jet, Int_t ij);
   void                   TerminateUtilities();
-  Bool_t                 GetSortedArray(Int_t indexes[], std::vector<fastjet::PseudoJet> array) const;
+  Bool_t                 GetSortedArray(std::vector<Int_t>& indexes, const std::vector<fastjet::PseudoJet>& array);
   Bool_t                 IsJetInEmcal(Double_t eta, Double_t phi, Double_t r);
   Bool_t                 IsJetInDcal(Double_t eta, Double_t phi, Double_t r);
   Bool_t                 IsJetInDcalOnly(Double_t eta, Double_t phi, Double_t r);
@@ -209,6 +209,11 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
   // Handle mapping between index and containers
   AliEmcalContainerIndexMap <AliClusterContainer, AliVCluster> fClusterContainerIndexMap;    //!<! Mapping between index and cluster containers
   AliEmcalContainerIndexMap <AliParticleContainer, AliVParticle> fParticleContainerIndexMap; //!<! Mapping between index and particle containers
+
+  // Scratch buffers of the jet output, sized to the largest event seen so far
+  std::vector<Int_t>     fSortedJetIndexes;       //!<! Indexes of the jets sorted by pt
+  std::vector<Float_t>   fSortedJetPt;            //!<! Pt of the jets used for the sorting
+  std::vector<fastjet::PseudoJet> fJetConstituents; //!<! Constituents of the current jet
 #endif
 
  private:
@@ -216,7 +221,7 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
   AliEmcalJetTask &operator=(const AliEmcalJetTask&); // not implemented
 
   /// \cond CLASSIMP
-  ClassDef(AliEmcalJetTask, 29);
+  ClassDef(AliEmcalJetTask, 30);
   /// \endcond
 };
 #endif
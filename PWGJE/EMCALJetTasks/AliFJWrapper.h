@@ -23,6 +23,7 @@ class AliFJWrapper
   virtual const char *ClassName()                            const { return "AliFJWrapper";              }
   virtual void  Clear(const Option_t* /*opt*/ = "");
   virtual void  ClearMemory();
+  void          ReserveInputVectors(UInt_t n)  { fInputVectors.reserve(n); if (fEventSub) fEventSubInputVectors.reserve(n); }
   virtual void  CopySettingsFrom (const AliFJWrapper& wrapper);
   virtual void  GetMedianAndSigma(Double_t& median, Double_t& sigma, Int_t remove = 0) const;
   fastjet::ClusterSequenceArea*           GetClusterSequence() const   { return fClustSeq;                 }
@@ -35,6 +36,7 @@ class AliFJWrapper
   const std::vector<fastjet::PseudoJet>&  GetEventSubJets()   const { return fEventSubJets;              }
   const std::vector<fastjet::PseudoJet>&  GetFilteredJets()    const { return fFilteredJets;               }
   std::vector<fastjet::PseudoJet>         GetJetConstituents(UInt_t idx) const;
+  void                                    GetJetConstituents(UInt_t idx, std::vector<fastjet::PseudoJet>& constituents) const;
   std::vector<fastjet::PseudoJet>         GetEventSubJetConstituents(UInt_t idx) const;
   std::vector<fastjet::PseudoJet>         GetFilteredJetConstituents(UInt_t idx) const;
   Double_t                                GetMedianUsedForBgSubtraction() const { return fMedUsedForBgSub; }
@@ -50,6 +52,7 @@ class AliFJWrapper
   virtual std::vector<double>             GetSubtractedJetsPts(Double_t median_pt = -1, Bool_t sorted = kFALSE);
   Bool_t                                  GetLegacyMode()            { return fLegacyMode; }
   Bool_t                                  GetDoFilterArea()          { return fDoFilterArea; }
+  Bool_t                                  GetReuseState()      const { return fReuseState;                 }
   Double_t                                NSubjettiness(Int_t N, Int_t Algorithm, Double_t Radius, Double_t Beta, Int_t Option=0, Int_t Measure=0, Double_t Beta_SD=0.0, Double_t ZCut=0.1, Int_t SoftDropOn=0);
   Double32_t                              NSubjettinessDerivativeSub(Int_t N, Int_t Algorithm, Double_t Radius, Double_t Beta, Double_t JetR, fastjet::PseudoJet jet, Int_t Option=0, Int_t Measure=0, Double_t Beta_SD=0.0, Double_t ZCut=0.1, Int_t SoftDropOn=0);
 #ifdef FASTJET_VERSION
@@ -143,6 +146,7 @@ class AliFJWrapper
   void SetEventSub(Bool_t b) {fEventSub = b;}
   void SetMaxDelR(Double_t r)  {fMaxDelR = r;}
   void SetAlpha(Double_t a)  {fAlpha = a;}
+  void SetReuseState(Bool_t b)  {fReuseState = b;}
 
  protected:
   TString                                fName;               //!
@@ -235,8 +239,17 @@ class AliFJWrapper
   std::vector<double>                      fGRDenominator;    //!
   std::vector<double>                      fGRNumeratorSub;   //!
   std::vector<double>                      fGRDenominatorSub; //!
+  // reuse mode: area and jet definitions are kept until the settings change
+  static const Int_t                       fgkNDefSettings = 13;
+  Bool_t                                   fReuseState;       //! only per-event objects are deleted in Clear()
+  Double_t                                 fDefSettings[fgkNDefSettings]; //! settings used to create the current definitions
 
   virtual void   SubtractBackground(const Double_t median_pt = -1);
+  void           ClearEventMemory();
+  void           ClearDefinitions();
+  void           CreateDefinitions();
+  Bool_t         CheckDefinitions() const;
+  void           GetDefinitionSettings(Double_t *settings) const;
 
  private:
   AliFJWrapper();
@@ -339,8 +352,10 @@ AliFJWrapper::AliFJWrapper(const char *name, const char *title)
   , fGRDenominator()
   , fGRNumeratorSub()
   , fGRDenominatorSub()
+  , fReuseState(kFALSE)
 {
   // Constructor.
+  for (Int_t i = 0; i < fgkNDefSettings; i++) fDefSettings[i] = 0;
 }
 
 //_________________________________________________________________________________________________
@@ -354,12 +369,26 @@ AliFJWrapper::~AliFJWrapper()
 void AliFJWrapper::ClearMemory()
 {
   // Destructor.
+  ClearEventMemory();
+  ClearDefinitions();
+}
+
+//_________________________________________________________________________________________________
+void AliFJWrapper::ClearDefinitions()
+{
+  // Delete the area and jet definitions.
   if (fAreaDef)           { delete fAreaDef;           fAreaDef         = NULL; }
   if (fVorAreaSpec)       { delete fVorAreaSpec;       fVorAreaSpec     = NULL; }
   if (fGhostedAreaSpec)   { delete fGhostedAreaSpec;   fGhostedAreaSpec = NULL; }
   if (fJetDef)            { delete fJetDef;            fJetDef          = NULL; }
   if (fPlugin)            { delete fPlugin;            fPlugin          = NULL; }
   if (fRange)             { delete fRange;             fRange           = NULL; }
+}
+
+//_________________________________________________________________________________________________
+void AliFJWrapper::ClearEventMemory()
+{
+  // Delete the cluster sequences and the objects built on top of them.
   if (fClustSeq)          { delete fClustSeq;          fClustSeq        = NULL; }
   if (fClustSeqES)          { delete fClustSeqES;        fClustSeqES        = NULL; }
   if (fClustSeqSA)        { delete fClustSeqSA;        fClustSeqSA        = NULL; }
@@ -412,8 +441,10 @@ void AliFJWrapper::Clear(const Option_t */*opt*/)
   fInputGhosts.clear();
   fMedUsedForBgSub = 0;
 
-  // for the moment brute force delete everything
-  ClearMemory();
+  // in reuse mode the definitions are kept for the next event,
+  // otherwise brute force delete everything
+  if (fReuseState) ClearEventMemory();
+  else             ClearMemory();
 }
 
 //_________________________________________________________________________________________________
@@ -628,6 +659,21 @@ AliFJWrapper::GetJetConstituents(UInt_t idx) const
   return retval;
 }
 
+//_________________________________________________________________________________________________
+void AliFJWrapper::GetJetConstituents(UInt_t idx, std::vector<fastjet::PseudoJet>& constituents) const
+{
+  // Get jets constituents into a vector provided by the caller (keeps its capacity).
+  // Same order as the constituents returned by value.
+
+  constituents.clear();
+
+  if ( idx < fInclusiveJets.size() ) {
+    fClustSeq->add_constituents(fInclusiveJets[idx], constituents);
+  } else {
+    AliError(Form("[e] ::GetJetConstituents wrong index: %d",idx));
+  }
+}
+
 //_________________________________________________________________________________________________
 std::vector<fastjet::PseudoJet>
 AliFJWrapper::GetEventSubJetConstituents(UInt_t idx) const
@@ -696,6 +742,46 @@ Int_t AliFJWrapper::Run()
 {
   // Run the actual jet finder.
 
+  if (!fReuseState || !CheckDefinitions()) CreateDefinitions();
+
+  try {
+    fClustSeq = new fj::ClusterSequenceArea(fInputVectors, *fJetDef, *fAreaDef);
+    if(fEventSub){
+      DoEventConstituentSubtraction();
+      fClustSeqES = new fj::ClusterSequenceArea(fEventSubCorrectedVectors, *fJetDef, *fAreaDef);
+    }
+  } catch (fj::Error) {
+    AliError(" [w] FJ Exception caught.");
+    return -1;
+  }
+
+  // FJ3 :: Define an JetMedianBackgroundEstimator just in case it will be used
+#ifdef FASTJET_VERSION
+  fBkrdEstimator     = new fj::JetMedianBackgroundEstimator(fj::SelectorAbsRapMax(fMaxRap));
+#endif
+
+  if (fLegacyMode) { SetLegacyFJ(); } // for FJ 2.x even if fLegacyMode is set, SetLegacyFJ is dummy
+
+  // inclusive jets:
+  fInclusiveJets.clear();
+  fEventSubJets.clear();
+  fInclusiveJets = fClustSeq->inclusive_jets(0.0);
+  if(fEventSub) fEventSubJets  = fClustSeqES->inclusive_jets(0.0);
+
+  return 0;
+}
+
+//_________________________________________________________________________________________________
+void AliFJWrapper::CreateDefinitions()
+{
+  // Create the area definition, the rapidity range and the jet definition.
+  // In reuse mode these are kept until one of the settings changes.
+
+  if (fReuseState) {
+    ClearDefinitions();
+    GetDefinitionSettings(fDefSettings);
+  }
+
   if (fAreaType == fj::voronoi_area) {
     // Rfact - check dependence - default is 1.
     // NOTE: hardcoded variable!
@@ -744,32 +830,41 @@ Int_t AliFJWrapper::Run()
   } else {
     fJetDef = new fj::JetDefinition(fAlgor, fR, fScheme, fStrategy);
   }
+}
 
-  try {
-    fClustSeq = new fj::ClusterSequenceArea(fInputVectors, *fJetDef, *fAreaDef);
-    if(fEventSub){
-      DoEventConstituentSubtraction();
-      fClustSeqES = new fj::ClusterSequenceArea(fEventSubCorrectedVectors, *fJetDef, *fAreaDef);
-    }
-  } catch (fj::Error) {
-    AliError(" [w] FJ Exception caught.");
-    return -1;
-  }
-
-  // FJ3 :: Define an JetMedianBackgroundEstimator just in case it will be used
-#ifdef FASTJET_VERSION
-  fBkrdEstimator     = new fj::JetMedianBackgroundEstimator(fj::SelectorAbsRapMax(fMaxRap));
-#endif
+//_________________________________________________________________________________________________
+void AliFJWrapper::GetDefinitionSettings(Double_t *settings) const
+{
+  // Settings which enter the area and jet definitions.
+
+  settings[0]  = fAreaType;
+  settings[1]  = fNGhostRepeats;
+  settings[2]  = fGhostArea;
+  settings[3]  = fMaxRap;
+  settings[4]  = fR;
+  settings[5]  = fGridScatter;
+  settings[6]  = fKtScatter;
+  settings[7]  = fMeanGhostKt;
+  settings[8]  = fAlgor;
+  settings[9]  = fScheme;
+  settings[10] = fStrategy;
+  settings[11] = fPluginAlgor;
+  settings[12] = fLegacyMode;
+}
 
-  if (fLegacyMode) { SetLegacyFJ(); } // for FJ 2.x even if fLegacyMode is set, SetLegacyFJ is dummy
+//_________________________________________________________________________________________________
+Bool_t AliFJWrapper::CheckDefinitions() const
+{
+  // Check whether the definitions exist and were created with the current settings.
 
-  // inclusive jets:
-  fInclusiveJets.clear();
-  fEventSubJets.clear();
-  fInclusiveJets = fClustSeq->inclusive_jets(0.0);
-  if(fEventSub) fEventSubJets  = fClustSeqES->inclusive_jets(0.0);
+  if (!fAreaDef || !fJetDef || !fRange) return kFALSE;
 
-  return 0;
+  Double_t settings[fgkNDefSettings];
+  GetDefinitionSettings(settings);
+  for (Int_t i = 0; i < fgkNDefSettings; i++) {
+    if (settings[i] != fDefSettings[i]) return kFALSE;
+  }
+  return kTRUE;
 }
 
 //_________________________________________________________________________________________________
@@ -779,6 +874,9 @@ Int_t AliFJWrapper::Filter()
 //  AliFJWrapper::Filter
 //
 
+  // the persistent definitions of Run() are not used here
+  if (fReuseState) ClearDefinitions();
+
   fJetDef = new fj::JetDefinition(fAlgor, fR, fScheme, fStrategy);
 
   if (fDoFilterArea) {
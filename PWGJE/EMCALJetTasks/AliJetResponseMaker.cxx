@@ -35,6 +35,7 @@
 #include "AliParticleContainer.h"
 #include "AliClusterContainer.h"
 #include "AliAnalysisTaskEmcalEmbeddingHelper.h"
+#include "AliJetResponseMatchingEngine.h"
 
 ClassImp(AliJetResponseMaker)
 
@@ -46,6 +47,8 @@ AliJetResponseMaker::AliJetResponseMaker() :
   fMatchingPar2(0),
   fUseCellsToMatch(kFALSE),
   fMinJetMCPt(1),
+  fUseMatchingEngine(kTRUE),
+  fMatchingEngine(0),
   fEmbeddingQA(),
   fHistoType(0),
   fDeltaPtAxis(0),
@@ -135,6 +138,8 @@ AliJetResponseMaker::AliJetResponseMaker(const char *name) :
   fMatchingPar2(0),
   fUseCellsToMatch(kFALSE),
   fMinJetMCPt(1),
+  fUseMatchingEngine(kTRUE),
+  fMatchingEngine(0),
   fEmbeddingQA(),
   fHistoType(0),
   fDeltaPtAxis(0),
@@ -220,6 +225,8 @@ AliJetResponseMaker::AliJetResponseMaker(const char *name) :
 AliJetResponseMaker::~AliJetResponseMaker()
 {
   // Destructor
+
+  delete fMatchingEngine;
 }
 
 
@@ -1430,9 +1437,26 @@ void AliJetResponseMaker::DoJetLoop()
   while ((jet2 = jets2->GetNextJet())) jet2->ResetMatching();
 
   jets1->ResetCurrentID();
-  while ((jet1 = jets1->GetNextJet())) {
-    jet1->ResetMatching();
+  while ((jet1 = jets1->GetNextJet())) jet1->ResetMatching();
+
+  if (fUseMatchingEngine && DoJetLoopEngine()) return;
+
+  DoJetLoopPairs();
+}
+
+//________________________________________________________________________
+void AliJetResponseMaker::DoJetLoopPairs()
+{
+  // Evaluate the matching level of every jet pair.
 
+  AliJetContainer *jets1 = static_cast<AliJetContainer*>(fJetCollArray.At(0));
+  AliJetContainer *jets2 = static_cast<AliJetContainer*>(fJetCollArray.At(1));
+
+  AliEmcalJet* jet1 = 0;
+  AliEmcalJet* jet2 = 0;
+
+  jets1->ResetCurrentID();
+  while ((jet1 = jets1->GetNextJet())) {
     if (jet1->MCPt() < fMinJetMCPt) continue;
 
     jets2->ResetCurrentID();
@@ -1442,6 +1466,66 @@ void AliJetResponseMaker::DoJetLoop()
   } // jet1 loop
 }
 
+//________________________________________________________________________
+Bool_t AliJetResponseMaker::DoJetLoopEngine()
+{
+  // Find the closest jets with the matching engine, with the same result as DoJetLoopPairs().
+  // Returns kFALSE if the matching configuration is not supported by the engine.
+
+  AliJetContainer *jets1 = static_cast<AliJetContainer*>(fJetCollArray.At(0));
+  AliJetContainer *jets2 = static_cast<AliJetContainer*>(fJetCollArray.At(1));
+
+  AliParticleContainer *tracks1   = jets1->GetParticleContainer();
+  AliClusterContainer  *clusters1 = jets1->GetClusterContainer();
+  AliParticleContainer *tracks2   = jets2->GetParticleContainer();
+  AliClusterContainer  *clusters2 = jets2->GetClusterContainer();
+  Bool_t useCells = fUseCellsToMatch && fCaloCells;
+
+  switch (fMatching) {
+  case kGeometrical:
+    break;
+  case kMCLabel:
+    if (!tracks2) return kFALSE;
+    break;
+  case kSameCollections:
+    if (useCells && clusters1 && clusters2) return kFALSE;
+    break;
+  default:
+    return kFALSE;
+  }
+
+  if (!fMatchingEngine) fMatchingEngine = new AliJetResponseMatchingEngine;
+  fMatchingEngine->Reset();
+
+  AliEmcalJet* jet1 = 0;
+  AliEmcalJet* jet2 = 0;
+
+  jets1->ResetCurrentID();
+  while ((jet1 = jets1->GetNextJet())) {
+    if (jet1->MCPt() < fMinJetMCPt) continue;
+    fMatchingEngine->AddJet1(jet1);
+  }
+  jets2->ResetCurrentID();
+  while ((jet2 = jets2->GetNextJet())) fMatchingEngine->AddJet2(jet2);
+
+  switch (fMatching) {
+  case kGeometrical:
+    fMatchingEngine->MatchGeometrical();
+    break;
+  case kMCLabel:
+    fMatchingEngine->MatchMCLabel(tracks1, tracks2, fMCLabelShift, useCells ? fCaloCells : 0, fVertex);
+    break;
+  case kSameCollections:
+    fMatchingEngine->MatchSameCollections(tracks1 && tracks2, clusters1 && clusters2, fVertex);
+    break;
+  default:
+    ;
+  }
+  fMatchingEngine->SetClosestJets();
+
+  return kTRUE;
+}
+
 //________________________________________________________________________
 void AliJetResponseMaker::GetGeometricalMatchingLevel(AliEmcalJet *jet1, AliEmcalJet *jet2, Double_t &d) const
 {
@@ -23,6 +23,7 @@ class TClonesArray;
 class TH2;
 class THnSparse;
 class AliNamedArrayI;
+class AliJetResponseMatchingEngine;
 
 #include "AliEmcalJet.h"
 #include "AliAnalysisTaskEmcalJet.h"
@@ -47,6 +48,7 @@ class AliJetResponseMaker : public AliAnalysisTaskEmcalJet {
   void                        SetPtHardBin(Int_t b)                                           { fSelectPtHardBin   = b         ; }
   void                        SetUseCellsToMatch(Bool_t i)                                    { fUseCellsToMatch   = i         ; }
   void                        SetMinJetMCPt(Float_t pt)                                       { fMinJetMCPt        = pt        ; }
+  void                        SetUseMatchingEngine(Bool_t b)                                  { fUseMatchingEngine = b         ; }
   void                        SetHistoType(Int_t b)                                           { fHistoType         = b         ; }
   void                        SetDeltaPtAxis(Int_t b)                                         { fDeltaPtAxis       = b         ; }
   void                        SetDeltaEtaDeltaPhiAxis(Int_t b)                                { fDeltaEtaDeltaPhiAxis= b       ; }
@@ -93,6 +95,8 @@ class AliJetResponseMaker : public AliAnalysisTaskEmcalJet {
  protected:
   void                        ExecOnce();
   void                        DoJetLoop();
+  void                        DoJetLoopPairs();
+  Bool_t                      DoJetLoopEngine();
   Bool_t                      FillHistograms();
   Bool_t                      Run();
   Bool_t                      DoJetMatching();
@@ -111,6 +115,8 @@ class AliJetResponseMaker : public AliAnalysisTaskEmcalJet {
   Double_t                    fMatchingPar2;                           // matching parameter for jet2-jet1 matching
   Bool_t                      fUseCellsToMatch;                        // use cells instead of clusters to match jets (slower but sometimes needed)
   Double_t                    fMinJetMCPt;                             // minimum jet MC pt
+  Bool_t                      fUseMatchingEngine;                      // find closest jets with AliJetResponseMatchingEngine instead of testing every jet pair
+  AliJetResponseMatchingEngine *fMatchingEngine;                       //!<! closest jet finder, memory kept across events
   AliEmcalEmbeddingQA         fEmbeddingQA;                            //!<! Embedding QA hists (will only be added if embedding)
   Int_t                       fHistoType;                              // histogram type (0=TH2, 1=THnSparse)
   Int_t                       fDeltaPtAxis;                            // add delta pt axis in THnSparse (default=0)
@@ -204,6 +210,6 @@ class AliJetResponseMaker : public AliAnalysisTaskEmcalJet {
   AliJetResponseMaker(const AliJetResponseMaker&);            // not implemented
   AliJetResponseMaker &operator=(const AliJetResponseMaker&); // not implemented
 
-  ClassDef(AliJetResponseMaker, 29) // Jet response matrix producing task
+  ClassDef(AliJetResponseMaker, 30) // Jet response matrix producing task
 };
 #endif
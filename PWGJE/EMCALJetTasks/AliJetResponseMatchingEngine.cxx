@@ -0,0 +1,611 @@
+/**************************************************************************
+ * Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+#include <algorithm>
+
+#include <TLorentzVector.h>
+#include <TMath.h>
+#include <TVector2.h>
+
+#include "AliEmcalJet.h"
+#include "AliParticleContainer.h"
+#include "AliTLorentzVector.h"
+#include "AliVCaloCells.h"
+#include "AliVCluster.h"
+#include "AliVParticle.h"
+
+#include "AliJetResponseMatchingEngine.h"
+
+namespace {
+  /// Closest jet distance set by AliEmcalJet::ResetMatching
+  const Double_t kResetDistance = 999;
+  /// Minimum cell size of the eta-phi grid
+  const Double_t kMinCellWidth = 0.05;
+  /// Maximum number of cells of the eta-phi grid
+  const Int_t kMaxCells = 1 << 16;
+  /// Safety margin on the cell size, protects against rounding in the cell index calculation
+  const Double_t kCellMargin = 1.001;
+}
+
+/**
+ * Default constructor
+ */
+AliJetResponseMatchingEngine::AliJetResponseMatchingEngine() :
+  fJets1(),
+  fJets2(),
+  fClosest1(),
+  fClosest2(),
+  fBase1(),
+  fNorm1(),
+  fLevel1(),
+  fLevel2(),
+  fCurrentJet2(-1),
+  fTouched(),
+  fTouchedStamp(),
+  fShared1(),
+  fTrackConst(),
+  fClusterConst(),
+  fCellEta(),
+  fCellPhi(),
+  fCellStart(),
+  fCellTargets(),
+  fCellStamp(),
+  fAlwaysTargets()
+{
+}
+
+/**
+ * Start a new event. Memory of the previous event is kept for reuse.
+ */
+void AliJetResponseMatchingEngine::Reset()
+{
+  fJets1.clear();
+  fJets2.clear();
+}
+
+/**
+ * Set the closest and second closest jets found by the last matching
+ * in the jets of both collections.
+ */
+void AliJetResponseMatchingEngine::SetClosestJets() const
+{
+  for (UInt_t i = 0; i < fClosest1.size() && i < fJets1.size(); i++) {
+    const Closest_t &closest = fClosest1[i];
+    if (closest.fPos[0] < 0) continue;
+    fJets1[i]->SetClosestJet(fJets2[closest.fPos[0]], closest.fDist[0]);
+    if (closest.fPos[1] >= 0) fJets1[i]->SetSecondClosestJet(fJets2[closest.fPos[1]], closest.fDist[1]);
+  }
+  for (UInt_t i = 0; i < fClosest2.size() && i < fJets2.size(); i++) {
+    const Closest_t &closest = fClosest2[i];
+    if (closest.fPos[0] < 0) continue;
+    fJets2[i]->SetClosestJet(fJets1[closest.fPos[0]], closest.fDist[0]);
+    if (closest.fPos[1] >= 0) fJets2[i]->SetSecondClosestJet(fJets1[closest.fPos[1]], closest.fDist[1]);
+  }
+}
+
+/**
+ * Geometrical matching: matching level is jet1->DeltaR(jet2).
+ */
+void AliJetResponseMatchingEngine::MatchGeometrical()
+{
+  StartMatching();
+  FindGeometricalClosest(fJets2, fJets1, kFALSE, fClosest1);
+  FindGeometricalClosest(fJets1, fJets2, kTRUE, fClosest2);
+}
+
+/**
+ * MC label matching (jets 1 detector level, jets 2 particle level), with the same
+ * matching level as AliJetResponseMaker::GetMCLabelMatchingLevel.
+ * @param[in] tracks1 Particle container of the jets 1 (only checked for existence)
+ * @param[in] tracks2 Particle container of the jets 2, providing the index of the MC labels
+ * @param[in] mcLabelShift Shift of the MC labels
+ * @param[in] cells Calo cells, if cells are used to match (NULL otherwise)
+ * @param[in] vertex Event vertex
+ */
+void AliJetResponseMatchingEngine::MatchMCLabel(const AliParticleContainer *tracks1, const AliParticleContainer *tracks2, Int_t mcLabelShift, AliVCaloCells *cells, Double_t *vertex)
+{
+  StartMatching();
+  const Int_t njets1 = fJets1.size(), njets2 = fJets2.size();
+
+  fTrackConst.clear();
+  for (Int_t ijet = 0; ijet < njets1; ijet++) {
+    AliEmcalJet *jet1 = fJets1[ijet];
+
+    // remove completely constituents that are not MC particles (label == 0)
+    Double_t d1 = jet1->Pt();
+    Double_t totalPt1 = d1;
+    if (tracks1 && tracks1->GetArray()) {
+      for (Int_t iTrack = 0; iTrack < jet1->GetNumberOfTracks(); iTrack++) {
+        AliVParticle *track = jet1->Track(iTrack);
+        if (!track) continue;
+        Int_t MClabel = TMath::Abs(track->GetLabel());
+        MClabel -= mcLabelShift;
+        if (MClabel != 0) continue;
+        totalPt1 -= track->Pt();
+        d1 -= track->Pt();
+      }
+    }
+    if (cells) {
+      for (Int_t iClus = 0; iClus < jet1->GetNumberOfClusters(); iClus++) {
+        AliVCluster *clus = jet1->Cluster(iClus);
+        if (!clus) continue;
+        AliTLorentzVector part;
+        clus->GetMomentum(part, vertex);
+        for (Int_t iCell = 0; iCell < clus->GetNCells(); iCell++) {
+          Int_t cellId = clus->GetCellAbsId(iCell);
+          Double_t cellFrac = clus->GetCellAmplitudeFraction(iCell);
+          Int_t MClabel = TMath::Abs(cells->GetCellMCLabel(cellId));
+          MClabel -= mcLabelShift;
+          if (MClabel != 0) continue;
+          totalPt1 -= part.Pt() * cellFrac;
+          d1 -= part.Pt() * cellFrac;
+        }
+      }
+    }
+    else {
+      for (Int_t iClus = 0; iClus < jet1->GetNumberOfClusters(); iClus++) {
+        AliVCluster *clus = jet1->Cluster(iClus);
+        if (!clus) continue;
+        TLorentzVector part;
+        clus->GetMomentum(part, vertex);
+        Int_t MClabel = TMath::Abs(clus->GetLabel());
+        MClabel -= mcLabelShift;
+        if (MClabel != 0) continue;
+        totalPt1 -= part.Pt();
+        d1 -= part.Pt();
+      }
+    }
+    fBase1[ijet] = d1;
+    fNorm1[ijet] = totalPt1;
+
+    // constituents associated with an MC particle, in the order of the pair loop: tracks, then clusters
+    for (Int_t iTrack = 0; iTrack < jet1->GetNumberOfTracks(); iTrack++) {
+      AliVParticle *track = jet1->Track(iTrack);
+      if (!track) continue;
+      Int_t MClabel = TMath::Abs(track->GetLabel());
+      MClabel -= mcLabelShift;
+      if (MClabel <= 0) continue;
+      Int_t index = tracks2->GetIndexFromLabel(MClabel);
+      if (index < 0) continue;
+      Constituent_t constituent = {index, ijet, track->Pt(), 1., kFALSE};
+      fTrackConst.push_back(constituent);
+    }
+    for (Int_t iClus = 0; iClus < jet1->GetNumberOfClusters(); iClus++) {
+      AliVCluster *clus = jet1->Cluster(iClus);
+      if (!clus) continue;
+      AliTLorentzVector part;
+      clus->GetMomentum(part, vertex);
+      if (cells) {
+        for (Int_t iCell = 0; iCell < clus->GetNCells(); iCell++) {
+          Int_t cellId = clus->GetCellAbsId(iCell);
+          Double_t cellFrac = clus->GetCellAmplitudeFraction(iCell);
+          Int_t MClabel = TMath::Abs(cells->GetCellMCLabel(cellId));
+          MClabel -= mcLabelShift;
+          if (MClabel <= 0) continue;
+          Int_t index = tracks2->GetIndexFromLabel(MClabel);
+          if (index < 0) continue;
+          Constituent_t constituent = {index, ijet, part.Pt() * cellFrac, cellFrac, kTRUE};
+          fTrackConst.push_back(constituent);
+        }
+      }
+      else {
+        Int_t MClabel = TMath::Abs(clus->GetLabel());
+        MClabel -= mcLabelShift;
+        if (MClabel <= 0) continue;
+        Int_t index = tracks2->GetIndexFromLabel(MClabel);
+        if (index < 0) continue;
+        Constituent_t constituent = {index, ijet, part.Pt(), 1., kFALSE};
+        fTrackConst.push_back(constituent);
+      }
+    }
+  }
+  SortConstituents(fTrackConst);
+
+  for (Int_t ijet = 0; ijet < njets2; ijet++) {
+    AliEmcalJet *jet2 = fJets2[ijet];
+    StartJet2(ijet);
+    for (Int_t iTrack2 = 0; iTrack2 < jet2->GetNumberOfTracks(); iTrack2++) {
+      AliVParticle *MCpart = jet2->Track(iTrack2);
+      SubtractShared(fTrackConst, jet2->TrackAt(iTrack2), MCpart ? MCpart->Pt() : 0.);
+    }
+    FinishJet2(ijet, kTRUE);
+  }
+  FinishJets1(kTRUE);
+}
+
+/**
+ * Matching of two jet collections from the same constituents, with the same
+ * matching level as AliJetResponseMaker::GetSameCollectionsMatchingLevel
+ * (without cells).
+ * @param[in] useTracks Subtract common tracks (both collections have a particle container)
+ * @param[in] useClusters Subtract common clusters (both collections have a cluster container)
+ * @param[in] vertex Event vertex
+ */
+void AliJetResponseMatchingEngine::MatchSameCollections(Bool_t useTracks, Bool_t useClusters, Double_t *vertex)
+{
+  StartMatching();
+  const Int_t njets1 = fJets1.size(), njets2 = fJets2.size();
+
+  fTrackConst.clear();
+  fClusterConst.clear();
+  for (Int_t ijet = 0; ijet < njets1; ijet++) {
+    AliEmcalJet *jet1 = fJets1[ijet];
+    fBase1[ijet] = jet1->Pt();
+    fNorm1[ijet] = jet1->Pt();
+    if (useTracks) {
+      for (Int_t iTrack1 = 0; iTrack1 < jet1->GetNumberOfTracks(); iTrack1++) {
+        AliVParticle *part1 = jet1->Track(iTrack1);
+        if (!part1) continue;
+        Constituent_t constituent = {jet1->TrackAt(iTrack1), ijet, part1->Pt(), 1., kFALSE};
+        fTrackConst.push_back(constituent);
+      }
+    }
+    if (useClusters) {
+      for (Int_t iClus1 = 0; iClus1 < jet1->GetNumberOfClusters(); iClus1++) {
+        AliVCluster *clus1 = jet1->Cluster(iClus1);
+        if (!clus1) continue;
+        TLorentzVector part1;
+        clus1->GetMomentum(part1, vertex);
+        Constituent_t constituent = {jet1->ClusterAt(iClus1), ijet, part1.Pt(), 1., kFALSE};
+        fClusterConst.push_back(constituent);
+      }
+    }
+  }
+  // the pair loop stops at the first common constituent found in jet 1
+  SortConstituents(fTrackConst);
+  fTrackConst.erase(std::unique(fTrackConst.begin(), fTrackConst.end(), SameConstituent), fTrackConst.end());
+  SortConstituents(fClusterConst);
+  fClusterConst.erase(std::unique(fClusterConst.begin(), fClusterConst.end(), SameConstituent), fClusterConst.end());
+
+  for (Int_t ijet = 0; ijet < njets2; ijet++) {
+    AliEmcalJet *jet2 = fJets2[ijet];
+    StartJet2(ijet);
+    if (useTracks) {
+      for (Int_t iTrack2 = 0; iTrack2 < jet2->GetNumberOfTracks(); iTrack2++) {
+        AliVParticle *part2 = jet2->Track(iTrack2);
+        if (!part2) continue;
+        SubtractShared(fTrackConst, jet2->TrackAt(iTrack2), part2->Pt());
+      }
+    }
+    if (useClusters) {
+      for (Int_t iClus2 = 0; iClus2 < jet2->GetNumberOfClusters(); iClus2++) {
+        AliVCluster *clus2 = jet2->Cluster(iClus2);
+        if (!clus2) continue;
+        TLorentzVector part2;
+        clus2->GetMomentum(part2, vertex);
+        SubtractShared(fClusterConst, jet2->ClusterAt(iClus2), part2.Pt());
+      }
+    }
+    FinishJet2(ijet, kFALSE);
+  }
+  FinishJets1(kFALSE);
+}
+
+/**
+ * Reset the closest jets of both collections.
+ */
+void AliJetResponseMatchingEngine::StartMatching()
+{
+  const Int_t njets1 = fJets1.size(), njets2 = fJets2.size();
+  fClosest1.resize(njets1);
+  for (Int_t i = 0; i < njets1; i++) ResetClosest(fClosest1[i]);
+  fClosest2.resize(njets2);
+  for (Int_t i = 0; i < njets2; i++) ResetClosest(fClosest2[i]);
+  fBase1.resize(njets1);
+  fNorm1.resize(njets1);
+  fLevel1.resize(njets1);
+  fLevel2.resize(njets1);
+  fTouchedStamp.assign(njets1, 0);
+  fShared1.resize(njets1);
+  for (Int_t i = 0; i < njets1; i++) fShared1[i].clear();
+}
+
+/**
+ * Start subtracting the constituents of the next jet 2.
+ * @param[in] pos2 Position of the jet 2
+ */
+void AliJetResponseMatchingEngine::StartJet2(Int_t pos2)
+{
+  fCurrentJet2 = pos2;
+  fTouched.clear();
+}
+
+/**
+ * Subtract a constituent of the current jet 2 from all jets 1 containing it.
+ * @param[in] constituents Constituents of the jets 1, sorted by index
+ * @param[in] index Index of the constituent of jet 2
+ * @param[in] pt2 Transverse momentum of the constituent of jet 2
+ */
+void AliJetResponseMatchingEngine::SubtractShared(const std::vector<Constituent_t> &constituents, Int_t index, Double_t pt2)
+{
+  Constituent_t key = {index, 0, 0., 0., kFALSE};
+  std::vector<Constituent_t>::const_iterator it = std::lower_bound(constituents.begin(), constituents.end(), key, CompareConstituents);
+  Int_t lastJet = -1;
+  for (; it != constituents.end() && it->fIndex == index; ++it) {
+    Int_t ijet = it->fJet;
+    if (fTouchedStamp[ijet] != fCurrentJet2 + 1) {
+      fTouchedStamp[ijet] = fCurrentJet2 + 1;
+      fTouched.push_back(ijet);
+      fLevel1[ijet] = fBase1[ijet];
+      fLevel2[ijet] = fJets2[fCurrentJet2]->Pt();
+    }
+    fLevel1[ijet] -= it->fPt;
+    // jet 2 constituent is only subtracted once per jet 1, with the first common constituent
+    if (ijet != lastJet) {
+      if (it->fUseFraction) fLevel2[ijet] -= pt2 * it->fFraction;
+      else fLevel2[ijet] -= pt2;
+      lastJet = ijet;
+    }
+  }
+}
+
+/**
+ * Normalise the matching levels of the current jet 2 and add them as candidates.
+ * Among the jets 1 not sharing any constituent with the jet 2 (all with the same
+ * matching level) only the first two can become closest jets.
+ * @param[in] pos2 Position of the jet 2
+ * @param[in] mcLabel Normalisation of the MC label matching, otherwise of the same-collection matching
+ */
+void AliJetResponseMatchingEngine::FinishJet2(Int_t pos2, Bool_t mcLabel)
+{
+  AliEmcalJet *jet2 = fJets2[pos2];
+  for (UInt_t i = 0; i < fTouched.size(); i++) {
+    Int_t ijet = fTouched[i];
+    AddCandidate(fClosest1[ijet], NormaliseLevel1(fLevel1[ijet], ijet, mcLabel), pos2);
+    AddCandidate(fClosest2[pos2], NormaliseLevel2(fLevel2[ijet], jet2, mcLabel), ijet);
+    fShared1[ijet].push_back(pos2);
+  }
+
+  Double_t defaultLevel = NormaliseLevel2(jet2->Pt(), jet2, mcLabel);
+  Int_t ndefault = 0;
+  for (Int_t ijet = 0; ijet < static_cast<Int_t>(fJets1.size()) && ndefault < 2; ijet++) {
+    if (fTouchedStamp[ijet] == pos2 + 1) continue;
+    AddCandidate(fClosest2[pos2], defaultLevel, ijet);
+    ndefault++;
+  }
+}
+
+/**
+ * Add the jets 2 not sharing any constituent with each jet 1 as candidates.
+ * Only the first two of them can become closest jets.
+ * @param[in] mcLabel Normalisation of the MC label matching, otherwise of the same-collection matching
+ */
+void AliJetResponseMatchingEngine::FinishJets1(Bool_t mcLabel)
+{
+  const Int_t njets2 = fJets2.size();
+  for (UInt_t ijet = 0; ijet < fJets1.size(); ijet++) {
+    Double_t defaultLevel = NormaliseLevel1(fBase1[ijet], ijet, mcLabel);
+    const std::vector<Int_t> &shared = fShared1[ijet];
+    Int_t ndefault = 0, ishared = 0;
+    for (Int_t pos2 = 0; pos2 < njets2 && ndefault < 2; pos2++) {
+      if (ishared < static_cast<Int_t>(shared.size()) && shared[ishared] == pos2) {
+        ishared++;
+        continue;
+      }
+      AddCandidate(fClosest1[ijet], defaultLevel, pos2);
+      ndefault++;
+    }
+  }
+}
+
+/**
+ * Normalised matching level of a jet 1
+ * @param[in] level Momentum of jet 1 not shared with jet 2
+ * @param[in] pos1 Position of the jet 1
+ * @param[in] mcLabel Normalisation of the MC label matching, otherwise of the same-collection matching
+ * @return Matching level (-1 if not defined)
+ */
+Double_t AliJetResponseMatchingEngine::NormaliseLevel1(Double_t level, Int_t pos1, Bool_t mcLabel) const
+{
+  if (level < 0) level = 0;
+  if (mcLabel) {
+    if (fNorm1[pos1] < 1) return -1;
+    return level / fNorm1[pos1];
+  }
+  if (fNorm1[pos1] > 0) return level / fNorm1[pos1];
+  return -1;
+}
+
+/**
+ * Normalised matching level of a jet 2
+ * @param[in] level Momentum of jet 2 not shared with jet 1
+ * @param[in] jet2 The jet 2
+ * @param[in] mcLabel Normalisation of the MC label matching, otherwise of the same-collection matching
+ * @return Matching level (-1 if not defined)
+ */
+Double_t AliJetResponseMatchingEngine::NormaliseLevel2(Double_t level, const AliEmcalJet *jet2, Bool_t mcLabel) const
+{
+  if (level < 0) level = 0;
+  if (mcLabel) {
+    if (jet2->Pt() < 1) return -1;
+    return level / jet2->Pt();
+  }
+  if (jet2->Pt() > 0) return level / jet2->Pt();
+  return -1;
+}
+
+/**
+ * Find the two closest targets of each source in eta-phi, searching an eta-phi grid
+ * of the targets in rings of cells around the source, until no cell outside the
+ * searched rings can contain a jet closer than the second closest jet found.
+ * @param[in] targets Jets to be searched
+ * @param[in] sources Jets for which the closest targets are searched
+ * @param[in] targetsAreJets1 If true the distance is target->DeltaR(source), otherwise source->DeltaR(target)
+ * @param[out] closest Closest targets of each source
+ */
+void AliJetResponseMatchingEngine::FindGeometricalClosest(const std::vector<AliEmcalJet*> &targets, const std::vector<AliEmcalJet*> &sources,
+                                                          Bool_t targetsAreJets1, std::vector<Closest_t> &closest)
+{
+  const Int_t ntargets = targets.size(), nsources = sources.size();
+  if (!ntargets || !nsources) return;
+
+  // Build the grid of the targets
+  fCellEta.resize(ntargets);
+  fCellPhi.resize(ntargets);
+  fAlwaysTargets.clear();
+  Double_t etaMin = 0, etaMax = 0;
+  Int_t nfinite = 0;
+  for (Int_t i = 0; i < ntargets; i++) {
+    fCellEta[i] = targets[i]->Eta();
+    fCellPhi[i] = targets[i]->Phi();
+    if (!TMath::Finite(fCellEta[i]) || !TMath::Finite(fCellPhi[i])) {
+      fAlwaysTargets.push_back(i);
+      continue;
+    }
+    fCellPhi[i] = TVector2::Phi_0_2pi(fCellPhi[i]);
+    if (!nfinite || fCellEta[i] < etaMin) etaMin = fCellEta[i];
+    if (!nfinite || fCellEta[i] > etaMax) etaMax = fCellEta[i];
+    nfinite++;
+  }
+
+  Int_t nEta = 0, nPhi = 0;
+  Double_t etaWidth = 1, phiWidth = 1;
+  if (nfinite) {
+    // about one target per cell
+    etaWidth = TMath::Max(kMinCellWidth, TMath::Sqrt((etaMax - etaMin + kMinCellWidth) * TMath::TwoPi() / nfinite)) * kCellMargin;
+    nPhi = TMath::Max(TMath::FloorNint(TMath::TwoPi() / etaWidth), 1);
+    nEta = TMath::FloorNint((etaMax - etaMin) / etaWidth) + 1;
+    if (nEta > kMaxCells / nPhi) {
+      // very large eta range (e.g. jets at extreme rapidities)
+      nPhi = 1;
+      etaWidth = (etaMax - etaMin) / (kMaxCells - 1) * kCellMargin;
+      nEta = TMath::FloorNint((etaMax - etaMin) / etaWidth) + 1;
+    }
+    phiWidth = TMath::TwoPi() / nPhi;
+  }
+  const Int_t ncells = nEta * nPhi;
+  fCellStart.assign(ncells + 1, 0);
+  fCellStamp.assign(ncells, -1);
+  std::vector<Int_t> targetCell(ntargets, -1);
+  for (Int_t i = 0; i < ntargets; i++) {
+    if (!TMath::Finite(fCellEta[i]) || !TMath::Finite(fCellPhi[i])) continue;
+    Int_t ieta = TMath::Min(TMath::Max(TMath::FloorNint((fCellEta[i] - etaMin) / etaWidth), 0), nEta - 1);
+    Int_t iphi = TMath::Min(TMath::Max(TMath::FloorNint(fCellPhi[i] / phiWidth), 0), nPhi - 1);
+    targetCell[i] = ieta * nPhi + iphi;
+    fCellStart[targetCell[i] + 1]++;
+  }
+  for (Int_t icell = 0; icell < ncells; icell++) fCellStart[icell + 1] += fCellStart[icell];
+  fCellTargets.resize(fCellStart[ncells]);
+  std::vector<Int_t> fill(fCellStart.begin(), fCellStart.end() - 1);
+  for (Int_t i = 0; i < ntargets; i++) {
+    if (targetCell[i] >= 0) fCellTargets[fill[targetCell[i]]++] = i;
+  }
+
+  // Search the closest targets of each source
+  const Double_t minWidth = TMath::Min(etaWidth, phiWidth);
+  for (Int_t isource = 0; isource < nsources; isource++) {
+    AliEmcalJet *source = sources[isource];
+    Closest_t &result = closest[isource];
+
+    for (UInt_t i = 0; i < fAlwaysTargets.size(); i++) {
+      Int_t itarget = fAlwaysTargets[i];
+      AddCandidate(result, targetsAreJets1 ? targets[itarget]->DeltaR(source) : source->DeltaR(targets[itarget]), itarget);
+    }
+
+    Double_t eta = source->Eta(), phi = source->Phi();
+    if (!ncells) continue;
+    if (!TMath::Finite(eta) || !TMath::Finite(phi)) {
+      for (Int_t itarget = 0; itarget < ntargets; itarget++) {
+        if (targetCell[itarget] < 0) continue;
+        AddCandidate(result, targetsAreJets1 ? targets[itarget]->DeltaR(source) : source->DeltaR(targets[itarget]), itarget);
+      }
+      continue;
+    }
+
+    // sources outside the grid are moved next to it, which can only decrease the distance bound
+    Double_t xeta = (eta - etaMin) / etaWidth;
+    Int_t ieta0 = xeta < -1 ? -1 : (xeta >= nEta ? nEta : TMath::FloorNint(xeta));
+    Int_t iphi0 = TMath::Min(TMath::Max(TMath::FloorNint(TVector2::Phi_0_2pi(phi) / phiWidth), 0), nPhi - 1);
+    Int_t kmax = TMath::Max(TMath::Max(ieta0, nEta - 1 - ieta0), nPhi);
+    for (Int_t k = 0; k <= kmax; k++) {
+      for (Int_t di = -k; di <= k; di++) {
+        Int_t ieta = ieta0 + di;
+        if (ieta < 0 || ieta >= nEta) continue;
+        Bool_t etaEdge = (di == -k || di == k);
+        for (Int_t dj = -k; dj <= k; dj++) {
+          if (!etaEdge && dj != -k && dj != k) continue;
+          Int_t iphi = ((iphi0 + dj) % nPhi + nPhi) % nPhi;
+          Int_t icell = ieta * nPhi + iphi;
+          if (fCellStamp[icell] == isource) continue;
+          fCellStamp[icell] = isource;
+          for (Int_t i = fCellStart[icell]; i < fCellStart[icell + 1]; i++) {
+            Int_t itarget = fCellTargets[i];
+            AddCandidate(result, targetsAreJets1 ? targets[itarget]->DeltaR(source) : source->DeltaR(targets[itarget]), itarget);
+          }
+        }
+      }
+      // all cells outside ring k are at least k cell widths away
+      if (result.fPos[1] >= 0 && k * minWidth / kCellMargin > result.fDist[1]) break;
+    }
+  }
+}
+
+/**
+ * Reset the closest jets to the state of AliEmcalJet::ResetMatching
+ */
+void AliJetResponseMatchingEngine::ResetClosest(Closest_t &closest)
+{
+  closest.fDist[0] = kResetDistance;
+  closest.fDist[1] = kResetDistance;
+  closest.fPos[0] = -1;
+  closest.fPos[1] = -1;
+}
+
+/**
+ * Add a candidate jet. Same result as AliJetResponseMaker::SetMatchingLevel for
+ * candidates added in increasing position; in any order, closest jets are the
+ * two smallest (matching level, position).
+ * @param[in,out] closest Closest jets
+ * @param[in] dist Matching level of the candidate
+ * @param[in] pos Position of the candidate
+ */
+void AliJetResponseMatchingEngine::AddCandidate(Closest_t &closest, Double_t dist, Int_t pos)
+{
+  if (!(dist >= 0) || !(dist < kResetDistance)) return;
+  if (closest.fPos[0] < 0 || dist < closest.fDist[0] || (dist == closest.fDist[0] && pos < closest.fPos[0])) {
+    closest.fDist[1] = closest.fDist[0];
+    closest.fPos[1] = closest.fPos[0];
+    closest.fDist[0] = dist;
+    closest.fPos[0] = pos;
+  }
+  else if (closest.fPos[1] < 0 || dist < closest.fDist[1] || (dist == closest.fDist[1] && pos < closest.fPos[1])) {
+    closest.fDist[1] = dist;
+    closest.fPos[1] = pos;
+  }
+}
+
+/**
+ * Sort constituents by index, keeping the order of the jets and of the
+ * constituents within a jet for equal indices.
+ */
+void AliJetResponseMatchingEngine::SortConstituents(std::vector<Constituent_t> &constituents)
+{
+  std::stable_sort(constituents.begin(), constituents.end(), CompareConstituents);
+}
+
+/**
+ * Order of the constituents by index
+ */
+Bool_t AliJetResponseMatchingEngine::CompareConstituents(const Constituent_t &a, const Constituent_t &b)
+{
+  return a.fIndex < b.fIndex;
+}
+
+/**
+ * Same constituent index in the same jet
+ */
+Bool_t AliJetResponseMatchingEngine::SameConstituent(const Constituent_t &a, const Constituent_t &b)
+{
+  return a.fIndex == b.fIndex && a.fJet == b.fJet;
+}
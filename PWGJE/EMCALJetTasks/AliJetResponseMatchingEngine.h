@@ -0,0 +1,112 @@
+#ifndef ALIJETRESPONSEMATCHINGENGINE_H
+#define ALIJETRESPONSEMATCHINGENGINE_H
+/* Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+#include <vector>
+
+#include <Rtypes.h>
+
+class AliEmcalJet;
+class AliParticleContainer;
+class AliVCaloCells;
+
+/**
+ * @class AliJetResponseMatchingEngine
+ * @brief Closest and second closest jets of two jet collections, without testing every jet pair
+ * @ingroup EMCALJETFW
+ *
+ * AliJetResponseMaker::DoJetLoop evaluates the matching level of every jet1 x jet2 pair,
+ * each time looping over the constituents of both jets. The engine finds the same closest
+ * and second closest jets of every jet in both collections:
+ * - Geometrical matching: the jets of the other collection are sorted into an eta-phi
+ *   grid, and only the cells which can contain one of the two closest jets are searched.
+ * - MC label and same-collection matching: the constituents of the jets 1 are sorted by
+ *   constituent (MC particle, track, cluster) index once per event. Looping over the
+ *   constituents of each jet 2 gives all jets 1 sharing constituents with it, and the
+ *   shared momentum is subtracted in the same order as in the pair loop, so the matching
+ *   levels are identical. All pairs without shared constituents have the same matching
+ *   level per jet and do not need to be evaluated individually.
+ *
+ * ~~~{.cxx}
+ * engine.Reset();
+ * for (jet1 ...) engine.AddJet1(jet1);  // jets in the order of the pair loop
+ * for (jet2 ...) engine.AddJet2(jet2);
+ * engine.MatchGeometrical();            // or MatchMCLabel / MatchSameCollections
+ * engine.SetClosestJets();
+ * ~~~
+ *
+ * In the pair loop a jet becomes the closest jet if its matching level is strictly smaller
+ * than the one of the current closest jet; hence the closest and second closest jets are
+ * the two jets with the smallest (matching level, position in the loop). Jets without any
+ * matching level in [0, 999) keep the state of AliEmcalJet::ResetMatching.
+ */
+class AliJetResponseMatchingEngine {
+ public:
+  AliJetResponseMatchingEngine();
+  ~AliJetResponseMatchingEngine() {}
+
+  void          Reset();
+  void          AddJet1(AliEmcalJet *jet) { fJets1.push_back(jet); }
+  void          AddJet2(AliEmcalJet *jet) { fJets2.push_back(jet); }
+
+  void          MatchGeometrical();
+  void          MatchMCLabel(const AliParticleContainer *tracks1, const AliParticleContainer *tracks2, Int_t mcLabelShift, AliVCaloCells *cells, Double_t *vertex);
+  void          MatchSameCollections(Bool_t useTracks, Bool_t useClusters, Double_t *vertex);
+  void          SetClosestJets() const;
+
+ protected:
+  /// Two smallest (matching level, position) of a jet
+  struct Closest_t {
+    Double_t    fDist[2];   ///< Matching level of the closest and second closest jet
+    Int_t       fPos[2];    ///< Position of the closest and second closest jet in the other collection (-1 if none)
+  };
+
+  /// Constituent of a jet 1 contributing to the shared momentum with the jet 2 containing the constituent index
+  struct Constituent_t {
+    Int_t       fIndex;     ///< Index of the constituent (MC particle, track or cluster)
+    Int_t       fJet;       ///< Position of the jet 1
+    Double_t    fPt;        ///< Momentum subtracted from the jet 1
+    Double_t    fFraction;  ///< Fraction of the momentum of the jet 2 constituent subtracted from jet 2
+    Bool_t      fUseFraction; ///< Subtract fFraction times the momentum of the jet 2 constituent (cells) instead of the full momentum
+  };
+
+  static void   ResetClosest(Closest_t &closest);
+  static void   AddCandidate(Closest_t &closest, Double_t dist, Int_t pos);
+  static void   SortConstituents(std::vector<Constituent_t> &constituents);
+  static Bool_t CompareConstituents(const Constituent_t &a, const Constituent_t &b);
+  static Bool_t SameConstituent(const Constituent_t &a, const Constituent_t &b);
+
+  void          StartMatching();
+  void          FindGeometricalClosest(const std::vector<AliEmcalJet*> &targets, const std::vector<AliEmcalJet*> &sources,
+                                       Bool_t targetsAreJets1, std::vector<Closest_t> &closest);
+  void          StartJet2(Int_t pos2);
+  void          SubtractShared(const std::vector<Constituent_t> &constituents, Int_t index, Double_t pt2);
+  void          FinishJet2(Int_t pos2, Bool_t mcLabel);
+  void          FinishJets1(Bool_t mcLabel);
+  Double_t      NormaliseLevel1(Double_t level, Int_t pos1, Bool_t mcLabel) const;
+  Double_t      NormaliseLevel2(Double_t level, const AliEmcalJet *jet2, Bool_t mcLabel) const;
+
+  std::vector<AliEmcalJet*>   fJets1;          ///< Jets 1, in the order of the pair loop
+  std::vector<AliEmcalJet*>   fJets2;          ///< Jets 2, in the order of the pair loop
+  std::vector<Closest_t>      fClosest1;       ///< Closest jets 2 of every jet 1
+  std::vector<Closest_t>      fClosest2;       ///< Closest jets 1 of every jet 2
+  std::vector<Double_t>       fBase1;          ///< Matching level of jet 1 before subtracting shared constituents
+  std::vector<Double_t>       fNorm1;          ///< Normalisation of the matching level of jet 1
+  std::vector<Double_t>       fLevel1;         ///< Matching level of jet 1 with the current jet 2
+  std::vector<Double_t>       fLevel2;         ///< Matching level of the current jet 2 with jet 1
+  Int_t                       fCurrentJet2;    ///< Position of the jet 2 whose constituents are subtracted
+  std::vector<Int_t>          fTouched;        ///< Jets 1 sharing constituents with the current jet 2
+  std::vector<Int_t>          fTouchedStamp;   ///< Last jet 2 (position + 1) sharing constituents with jet 1
+  std::vector<std::vector<Int_t> > fShared1;   ///< Positions of the jets 2 sharing constituents with jet 1 (increasing)
+  std::vector<Constituent_t>  fTrackConst;     ///< Track (or MC particle) constituents of the jets 1, sorted by index
+  std::vector<Constituent_t>  fClusterConst;   ///< Cluster constituents of the jets 1, sorted by index
+  std::vector<Double_t>       fCellEta;        ///< Grid: eta of the targets
+  std::vector<Double_t>       fCellPhi;        ///< Grid: phi of the targets
+  std::vector<Int_t>          fCellStart;      ///< Grid: first target of each cell in fCellTargets
+  std::vector<Int_t>          fCellTargets;    ///< Grid: targets sorted by cell, increasing position within a cell
+  std::vector<Int_t>          fCellStamp;      ///< Grid: last query visiting the cell
+  std::vector<Int_t>          fAlwaysTargets;  ///< Grid: targets without finite position, tested for every source
+};
+
+#endif /* ALIJETRESPONSEMATCHINGENGINE_H */
@@ -42,6 +42,7 @@ class AliAODv0;
 
 #include <Riostream.h>
 #include "TList.h"
+#include "TArrayD.h"
 #include "TH1.h"
 #include "TH2.h"
 #include "TH3.h"
@@ -124,6 +125,7 @@ fkRevertexAllEvents(kTRUE),
 fkPreselectDedx ( kTRUE ),
 fkPreselectDedxLambda ( kTRUE ),
 fkExtraCleanup    ( kTRUE ), //extra cleanup: eta, etc
+fkDoPairPrefilter ( kTRUE ), //same candidates, fewer propagations
 //________________________________________________
 //Flags for V0 vertexer
 fkRunV0Vertexer (kFALSE),
@@ -174,6 +176,7 @@ fkRevertexAllEvents(kTRUE),
 fkPreselectDedx ( kTRUE ),
 fkPreselectDedxLambda ( kTRUE ),
 fkExtraCleanup    ( kTRUE ), //extra cleanup: eta, etc
+fkDoPairPrefilter ( kTRUE ), //same candidates, fewer propagations
 //________________________________________________
 //Flags for V0 vertexer
 fkRunV0Vertexer (kFALSE),
@@ -291,7 +294,7 @@ void AliAnalysisTaskWeakDecayVertexer::UserCreateOutputObjects()
     }
     if(! fHistV0ToBachelorPropagationStatus ) {
         //Bookkeep bach/v0 combination attempts, please
-        fHistV0ToBachelorPropagationStatus = new TH1D( "fHistV0ToBachelorPropagationStatus", "V0/Bach pair counts",10,0,10);
+        fHistV0ToBachelorPropagationStatus = new TH1D( "fHistV0ToBachelorPropagationStatus", "V0/Bach pair counts",11,0,11);
         fHistV0ToBachelorPropagationStatus->GetXaxis()->SetBinLabel(1, "Linear propag start");
         fHistV0ToBachelorPropagationStatus->GetXaxis()->SetBinLabel(2, "Linear propag failure");
         fHistV0ToBachelorPropagationStatus->GetXaxis()->SetBinLabel(3, "Linear propag OK");
@@ -302,6 +305,7 @@ void AliAnalysisTaskWeakDecayVertexer::UserCreateOutputObjects()
         fHistV0ToBachelorPropagationStatus->GetXaxis()->SetBinLabel(8, "Too many iter");
         fHistV0ToBachelorPropagationStatus->GetXaxis()->SetBinLabel(9, "Propag failure");
         fHistV0ToBachelorPropagationStatus->GetXaxis()->SetBinLabel(10,"Propag OK");
+        fHistV0ToBachelorPropagationStatus->GetXaxis()->SetBinLabel(11,"Prefiltered");
         fListHist->Add(fHistV0ToBachelorPropagationStatus);
     }
     
@@ -588,17 +592,48 @@ Long_t AliAnalysisTaskWeakDecayVertexer::Tracks2V0vertices(AliESDEvent *event) {
         else pos[npos++]=i;
     }
     
+    //Per-track quantities used in the pair loop, computed once per track:
+    //DCA to the primary vertex, mass for tracking, starting parameters
+    //(at the DCA to the primary vertex if requested) and their helix parameters
+    TArrayD negD(nneg), posD(npos), negMass(nneg), posMass(npos);
+    TArrayD negHelix(8*nneg), posHelix(8*npos);
+    TObjArray negStart(nneg), posStart(npos);
+    negStart.SetOwner(kTRUE); posStart.SetOwner(kTRUE);
+    for (Int_t iCharge=0; iCharge<2; iCharge++) {
+        TArrayI &idx = iCharge==0 ? neg : pos;
+        TArrayD &lD = iCharge==0 ? negD : posD;
+        TArrayD &lMass = iCharge==0 ? negMass : posMass;
+        TArrayD &lHelix = iCharge==0 ? negHelix : posHelix;
+        TObjArray &lStart = iCharge==0 ? negStart : posStart;
+        Long_t n = iCharge==0 ? nneg : npos;
+        for (Long_t itrk=0; itrk<n; itrk++) {
+            AliESDtrack *esdTrack=event->GetTrack(idx[itrk]);
+            lD[itrk] = TMath::Abs(esdTrack->GetD(xPrimaryVertex,yPrimaryVertex,b));
+            lMass[itrk] = esdTrack->GetMassForTracking();
+            AliExternalTrackParam *lParam = new AliExternalTrackParam(*esdTrack);
+            //Re-propagate to closest position to the primary vertex if asked to do so
+            if (fkResetInitialPositions){
+                Double_t dztemp[2], covartemp[3];
+                //Safety margin: 250 -> exceedingly large... not sure this makes sense, but ok
+                lParam->PropagateToDCA( vtxT3D , b , 250, dztemp, covartemp );
+            }
+            lStart.AddAt(lParam, itrk);
+            Double_t *h = lHelix.GetArray()+8*itrk;
+            lParam->GetHelixParameters(h,b);
+            h[6]=TMath::Sin(h[2]); h[7]=TMath::Cos(h[2]);
+        }
+    }
     
     for (i=0; i<nneg; i++) {
         Long_t nidx=neg[i];
-        AliESDtrack *ntrk=event->GetTrack(nidx);
+        const AliExternalTrackParam *nstart=(const AliExternalTrackParam*)negStart.UncheckedAt(i);
         
         for (Int_t k=0; k<npos; k++) {
             Int_t pidx=pos[k];
-            AliESDtrack *ptrk=event->GetTrack(pidx);
+            const AliExternalTrackParam *pstart=(const AliExternalTrackParam*)posStart.UncheckedAt(k);
             
-            Double_t lNegMassForTracking = ntrk->GetMassForTracking();
-            Double_t lPosMassForTracking = ptrk->GetMassForTracking();
+            Double_t lNegMassForTracking = negMass[i];
+            Double_t lPosMassForTracking = posMass[k];
             
             //Pre-select dE/dx: only proceed if at least one of these tracks looks like a proton
             /*
@@ -609,22 +644,22 @@ Long_t AliAnalysisTaskWeakDecayVertexer::Tracks2V0vertices(AliESDEvent *event) {
              }
              */
             
-            if (TMath::Abs(ntrk->GetD(xPrimaryVertex,yPrimaryVertex,b))<fV0VertexerSels[1])
-                if (TMath::Abs(ptrk->GetD(xPrimaryVertex,yPrimaryVertex,b))<fV0VertexerSels[2]) continue;
+            if (negD[i]<fV0VertexerSels[1])
+                if (posD[k]<fV0VertexerSels[2]) continue;
             
-            AliExternalTrackParam nt(*ntrk), pt(*ptrk), *ntp=&nt, *ptp=&pt;
+            //Pre-filter: the pair cannot pass the DCA cut, skip the propagation
+            //(the improved propagation moves the tracks first: checked in GetDCAV0Dau)
+            if( fkDoPairPrefilter && !fkDoImprovedDCAV0DauPropagation ){
+                Double_t dy2=nstart->GetSigmaY2() + pstart->GetSigmaY2();
+                Double_t dz2=nstart->GetSigmaZ2() + pstart->GetSigmaZ2();
+                if( GetDCAV0DauLowerBound(negHelix.GetArray()+8*i, posHelix.GetArray()+8*k, dy2, dz2) > fV0VertexerSels[3] ) continue;
+            }
+            
+            AliExternalTrackParam nt(*nstart), pt(*pstart), *ntp=&nt, *ptp=&pt;
             Double_t xn, xp, dca;
             
             //Improved call: use own function, including XY-pre-opt stage
             
-            //Re-propagate to closest position to the primary vertex if asked to do so
-            if (fkResetInitialPositions){
-                Double_t dztemp[2], covartemp[3];
-                //Safety margin: 250 -> exceedingly large... not sure this makes sense, but ok
-                ntp->PropagateToDCA( vtxT3D , b , 250, dztemp, covartemp );
-                ptp->PropagateToDCA( vtxT3D , b , 250, dztemp, covartemp );
-            }
-            
             if( fkDoImprovedDCAV0DauPropagation ){
                 //Improved: use own call
                 dca=GetDCAV0Dau(ptp, ntp, xp, xn, b, lNegMassForTracking, lPosMassForTracking);
@@ -814,6 +849,19 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVertices(AliESDEvent *
         trk[ntr++]=i;
     }
     
+    //Bachelor quantities used by the pair pre-filter, computed once per track
+    TArrayD trkHelix(8*ntr), trkXYZ(3*ntr), trkPxPyPz(3*ntr);
+    if( fkDoPairPrefilter ){
+        for (Long_t itrk=0; itrk<ntr; itrk++) {
+            AliExternalTrackParam bt(*(event->GetTrack(trk[itrk])));
+            Double_t *h = trkHelix.GetArray()+8*itrk;
+            bt.GetHelixParameters(h,b);
+            h[6]=TMath::Sin(h[2]); h[7]=TMath::Cos(h[2]);
+            bt.GetXYZ(trkXYZ.GetArray()+3*itrk);
+            bt.GetPxPyPz(trkPxPyPz.GetArray()+3*itrk);
+        }
+    }
+    
     Double_t massLambda=1.11568;
     Long_t ncasc=0;
     
@@ -823,6 +871,9 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVertices(AliESDEvent *
         AliESDv0 v0(*v);
         v0.ChangeMassHypothesis(kLambda0); // the v0 must be Lambda
         if (TMath::Abs(v0.GetEffMass()-massLambda)>fCascadeVertexerSels[2]) continue;
+        Double_t lV0XYZ[3], lV0PxPyPz[3];
+        v0.GetXYZ(lV0XYZ[0],lV0XYZ[1],lV0XYZ[2]);
+        v0.GetPxPyPz(lV0PxPyPz[0],lV0PxPyPz[1],lV0PxPyPz[2]);
         for (Int_t j=0; j<ntr; j++) {//loop on tracks
             Int_t bidx=trk[j];
             //Bo:   if (bidx==v->GetNindex()) continue; //bachelor and v0's negative tracks must be different
@@ -833,6 +884,13 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVertices(AliESDEvent *
             
             if (btrk->GetSign()>0) continue;  // bachelor's charge
             
+            //Pre-filter: the pair cannot pass the DCA cut, skip the propagation
+            if( fkDoPairPrefilter &&
+               GetDCACascDauLowerBound(trkHelix.GetArray()+8*j, trkXYZ.GetArray()+3*j, trkPxPyPz.GetArray()+3*j, lV0XYZ, lV0PxPyPz) > fCascadeVertexerSels[4] ){
+                fHistV0ToBachelorPropagationStatus->Fill(10.5);
+                continue;
+            }
+            
             AliESDv0 *pv0=&v0;
             AliExternalTrackParam bt(*btrk), *pbt=&bt;
             
@@ -896,6 +954,9 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVertices(AliESDEvent *
         AliESDv0 v0(*v);
         v0.ChangeMassHypothesis(kLambda0Bar); //the v0 must be anti-Lambda
         if (TMath::Abs(v0.GetEffMass()-massLambda)>fCascadeVertexerSels[2]) continue;
+        Double_t lV0XYZ[3], lV0PxPyPz[3];
+        v0.GetXYZ(lV0XYZ[0],lV0XYZ[1],lV0XYZ[2]);
+        v0.GetPxPyPz(lV0PxPyPz[0],lV0PxPyPz[1],lV0PxPyPz[2]);
         
         for (Int_t j=0; j<ntr; j++) {//loop on tracks
             Int_t bidx=trk[j];
@@ -906,6 +967,13 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVertices(AliESDEvent *
             
             if (btrk->GetSign()<0) continue;  // bachelor's charge
             
+            //Pre-filter: the pair cannot pass the DCA cut, skip the propagation
+            if( fkDoPairPrefilter &&
+               GetDCACascDauLowerBound(trkHelix.GetArray()+8*j, trkXYZ.GetArray()+3*j, trkPxPyPz.GetArray()+3*j, lV0XYZ, lV0PxPyPz) > fCascadeVertexerSels[4] ){
+                fHistV0ToBachelorPropagationStatus->Fill(10.5);
+                continue;
+            }
+            
             AliESDv0 *pv0=&v0;
             AliExternalTrackParam bt(*btrk), *pbt=&bt;
             
@@ -1107,6 +1175,19 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVerticesUncheckedCharg
         trk[ntr++]=i;
     }
     
+    //Bachelor quantities used by the pair pre-filter, computed once per track
+    TArrayD trkHelix(8*ntr), trkXYZ(3*ntr), trkPxPyPz(3*ntr);
+    if( fkDoPairPrefilter ){
+        for (Int_t itrk=0; itrk<ntr; itrk++) {
+            AliExternalTrackParam bt(*(event->GetTrack(trk[itrk])));
+            Double_t *h = trkHelix.GetArray()+8*itrk;
+            bt.GetHelixParameters(h,b);
+            h[6]=TMath::Sin(h[2]); h[7]=TMath::Cos(h[2]);
+            bt.GetXYZ(trkXYZ.GetArray()+3*itrk);
+            bt.GetPxPyPz(trkPxPyPz.GetArray()+3*itrk);
+        }
+    }
+    
     Double_t massLambda=1.11568;
     Int_t ncasc=0;
     
@@ -1129,6 +1210,9 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVerticesUncheckedCharg
         //Only disregard if it does not pass any of the desired hypotheses
         if (TMath::Abs(lMassAsLambda-massLambda)>fCascadeVertexerSels[2] &&
             TMath::Abs(lMassAsAntiLambda-massLambda)>fCascadeVertexerSels[2]) continue;
+        Double_t lV0XYZ[3], lV0PxPyPz[3];
+        v0.GetXYZ(lV0XYZ[0],lV0XYZ[1],lV0XYZ[2]);
+        v0.GetPxPyPz(lV0PxPyPz[0],lV0PxPyPz[1],lV0PxPyPz[2]);
         
         for (Int_t j=0; j<ntr; j++) {//loop on tracks
             Int_t bidx=trk[j];
@@ -1140,6 +1224,13 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVerticesUncheckedCharg
             AliESDtrack *btrk=event->GetTrack(bidx);
             Float_t lBachMassForTracking=btrk->GetMassForTracking();
             
+            //Pre-filter: the pair cannot pass the DCA cut, skip the propagation
+            if( fkDoPairPrefilter &&
+               GetDCACascDauLowerBound(trkHelix.GetArray()+8*j, trkXYZ.GetArray()+3*j, trkPxPyPz.GetArray()+3*j, lV0XYZ, lV0PxPyPz) > fCascadeVertexerSels[4] ){
+                fHistV0ToBachelorPropagationStatus->Fill(10.5);
+                continue;
+            }
+            
             //Do not check charges!
             AliESDv0 *pv0=&v0;
             AliExternalTrackParam bt(*btrk), *pbt=&bt;
@@ -1621,6 +1712,8 @@ Double_t AliAnalysisTaskWeakDecayVertexer::GetDCAV0Dau( AliExternalTrackParam *p
     // Propagates this track and the argument track to the position of the
     // distance of closest approach.
     // Returns the (weighed !) distance of closest approach.
+    // With the pair pre-filter, returns a lower bound of it if
+    // already above the DCA cut (tracks not propagated to the DCA)
     //--------------------------------------------------------------
     
     //if( fkDoPureGeometricMinimization ){
@@ -1875,6 +1968,15 @@ Double_t AliAnalysisTaskWeakDecayVertexer::GetDCAV0Dau( AliExternalTrackParam *p
     Double_t dz2=nt -> GetSigmaZ2() + pt->GetSigmaZ2();
     Double_t dx2=dy2;
     
+    //Pre-filter: the minimization can only end above the DCA cut, skip it
+    if( fkDoPairPrefilter ){
+        Double_t lLowerBound = GetDCAV0DauLowerBound(p1, p2, dy2, dz2);
+        if( lLowerBound > fV0VertexerSels[3] ){
+            xn=nt->GetX(); xp=pt->GetX();
+            return lLowerBound;
+        }
+    }
+    
     Double_t r1[3],g1[3],gg1[3]; Double_t t1=0.;
     Evaluate(p1,t1,r1,g1,gg1);
     Double_t r2[3],g2[3],gg2[3]; Double_t t2=0.;
@@ -1997,3 +2099,71 @@ void AliAnalysisTaskWeakDecayVertexer::GetHelixCenter(const AliExternalTrackPara
     center[1] =	ypos + ypoint;
     return;
 }
+
+//________________________________________________________________________
+Double_t AliAnalysisTaskWeakDecayVertexer::GetDCAV0DauLowerBound(const Double_t *p1, const Double_t *p2, Double_t dy2, Double_t dz2) const {
+    //--------------------------------------------------------------
+    // Lower bound of the (weighed !) DCA between two helices, given
+    // their helix parameters (p[6], p[7]: sin, cos of p[2]) and the
+    // summed uncertainties, as used in GetDCA and GetDCAV0Dau:
+    //   dca^2 = dm*sqrt(dy2*dz2), dm >= dxy^2/dy2
+    // where dxy is at least the distance between the two circles in XY.
+    // The minimization can only end at a larger or equal value.
+    // Returns 0 if no bound can be given.
+    //--------------------------------------------------------------
+    if ( !(dy2>0) || !(dz2>0) ) return 0.;
+    if (TMath::Abs(p1[4])<=kAlmost0 || TMath::Abs(p2[4])<=kAlmost0) return 0.;
+    
+    //Circle centers and radii, as in Evaluate
+    Double_t x1 = p1[5] - p1[6]/p1[4], y1 = p1[0] + p1[7]/p1[4], r1 = TMath::Abs(1./p1[4]);
+    Double_t x2 = p2[5] - p2[6]/p2[4], y2 = p2[0] + p2[7]/p2[4], r2 = TMath::Abs(1./p2[4]);
+    Double_t lDist = TMath::Sqrt( (x1-x2)*(x1-x2) + (y1-y2)*(y1-y2) );
+    
+    Double_t lDistXY = 0.;
+    if( lDist > r1 + r2 ) lDistXY = lDist - (r1 + r2); //circles far away
+    else if( lDist < TMath::Abs(r1 - r2) ) lDistXY = TMath::Abs(r1 - r2) - lDist; //one inside the other
+    
+    //Safety margin for rounding in the helix evaluation
+    lDistXY -= 1e-7 + 1e-9*(lDist + r1 + r2 + TMath::Abs(x1) + TMath::Abs(y1) + TMath::Abs(x2) + TMath::Abs(y2));
+    if( lDistXY <= 0 ) return 0.;
+    
+    return lDistXY*TMath::Sqrt(TMath::Sqrt(dz2/dy2));
+}
+
+//________________________________________________________________________
+Double_t AliAnalysisTaskWeakDecayVertexer::GetDCACascDauLowerBound(const Double_t *hBach, const Double_t rBach[3], const Double_t pBach[3],
+                                                                   const Double_t rV0[3], const Double_t pV0[3]) const {
+    //--------------------------------------------------------------
+    // Lower bound of the DCA returned by PropagateToDCA, given the
+    // bachelor before propagation (helix parameters as in Evaluate,
+    // position and momentum) and the V0 position and momentum:
+    //  - linear propagation: the straight-line DCA, as in PropagateToDCA
+    //  - improved propagation without material corrections: the bachelor
+    //    stays on its circle, the DCA is at least the XY distance between
+    //    the circle and the V0 line
+    // Returns 0 if no bound can be given.
+    //--------------------------------------------------------------
+    if ( !fkDoImprovedDCACascDauPropagation ){
+        Double_t dd= Det(rV0[0]-rBach[0],rV0[1]-rBach[1],rV0[2]-rBach[2],pBach[0],pBach[1],pBach[2],pV0[0],pV0[1],pV0[2]);
+        Double_t ax= Det(pBach[1],pBach[2],pV0[1],pV0[2]);
+        Double_t ay=-Det(pBach[0],pBach[2],pV0[0],pV0[2]);
+        Double_t az= Det(pBach[0],pBach[1],pV0[0],pV0[1]);
+        Double_t lDenominator = TMath::Sqrt(ax*ax + ay*ay + az*az);
+        if( !(lDenominator>0) ) return 0.;
+        //Safety margin for rounding
+        return TMath::Abs(dd)/lDenominator*(1.-1e-9);
+    }
+    if ( fkDoMaterialCorrection ) return 0.;
+    if ( TMath::Abs(hBach[4])<=kAlmost0 ) return 0.;
+    
+    Double_t lV0Pt = TMath::Sqrt(pV0[0]*pV0[0] + pV0[1]*pV0[1]);
+    if( !(lV0Pt>0) ) return 0.;
+    
+    Double_t xc = hBach[5] - hBach[6]/hBach[4], yc = hBach[0] + hBach[7]/hBach[4], r = TMath::Abs(1./hBach[4]);
+    Double_t lDist = TMath::Abs( (xc-rV0[0])*pV0[1] - (yc-rV0[1])*pV0[0] )/lV0Pt;
+    
+    //Safety margin for rounding in the propagation
+    Double_t lDistXY = lDist - r - 1e-7 - 1e-9*(lDist + r + TMath::Abs(xc) + TMath::Abs(yc) + TMath::Abs(rV0[0]) + TMath::Abs(rV0[1]));
+    if( lDistXY <= 0 ) return 0.;
+    return lDistXY;
+}
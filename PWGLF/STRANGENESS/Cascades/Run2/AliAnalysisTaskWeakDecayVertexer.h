@@ -122,6 +122,11 @@ public:
     void SetExtraCleanup ( Bool_t lExtraCleanup = kTRUE) {
         fkExtraCleanup = lExtraCleanup;
     }
+    void SetDoPairPrefilter ( Bool_t lOpt = kTRUE) {
+        //Reject V0 daughter and cascade daughter pairs before propagating them
+        //if a lower bound of their DCA is already above the DCA cut (same output)
+        fkDoPairPrefilter = lOpt;
+    }
 //---------------------------------------------------------------------------------------
     void SetRevertexAllEvents     ( Bool_t lOpt ) {
         fkRevertexAllEvents = lOpt;
@@ -226,6 +231,11 @@ public:
     Double_t GetDCAV0Dau ( AliExternalTrackParam *pt, AliExternalTrackParam *nt, Double_t &xp, Double_t &xn, Double_t b, Double_t lNegMassForTracking=0.139, Double_t lPosMassForTracking=0.139);
     void GetHelixCenter(const AliExternalTrackParam *track,Double_t center[2], Double_t b);
     //---------------------------------------------------------------------------------------
+    //Pair pre-filter: lower bounds of the DCA between daughters
+    Double_t GetDCAV0DauLowerBound(const Double_t *p1, const Double_t *p2, Double_t dy2, Double_t dz2) const;
+    Double_t GetDCACascDauLowerBound(const Double_t *hBach, const Double_t rBach[3], const Double_t pBach[3],
+                                     const Double_t rV0[3], const Double_t pV0[3]) const;
+    //---------------------------------------------------------------------------------------
 
 private:
     // Note : In ROOT, "//!" means "do not stream the data from Master node to Worker node" ...
@@ -249,6 +259,7 @@ private:
     Bool_t fkPreselectDedx;
     Bool_t fkPreselectDedxLambda;
     Bool_t fkExtraCleanup;           //if true, perform pre-rejection of useless candidates before going through configs
+    Bool_t fkDoPairPrefilter;        //if true, reject daughter pairs whose DCA lower bound is above the DCA cut before propagating
     
     //Objects Controlling Task Behaviour: has to be streamed!
     Bool_t fkRunV0Vertexer;           // if true, re-run V0 vertexer
@@ -295,8 +306,9 @@ private:
     AliAnalysisTaskWeakDecayVertexer(const AliAnalysisTaskWeakDecayVertexer&);            // not implemented
     AliAnalysisTaskWeakDecayVertexer& operator=(const AliAnalysisTaskWeakDecayVertexer&); // not implemented
 
-    ClassDef(AliAnalysisTaskWeakDecayVertexer, 1);
+    ClassDef(AliAnalysisTaskWeakDecayVertexer, 2);
     //1: first implementation
+    //2: pair pre-filter switch
 };
 
 #endif